@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2014-2023 Frank Eskesen.
+//       Copyright (c) 2014-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Implement ClientThread object methods
 //
 // Last change date-
-//       2023/08/03
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <exception>
@@ -251,6 +251,8 @@ static int                          // constant FALSE
      const char*       path)        // Initial directory
 :  CommonThread(socket)
 ,  path(path)
+,  pendingHead(0)
+,  pendingUsed(0)
 {
    IFHCDM(
      debugf("%4d ClientThread(%p)::ClientThread(%p,%s)\n", __LINE__, this,
@@ -258,6 +260,49 @@ static int                          // constant FALSE
    )
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       ClientThread::completeFile
+//
+// Function-
+//       Complete the oldest pending file request.
+//
+//----------------------------------------------------------------------------
+void
+   ClientThread::completeFile(      // Complete the oldest file request
+     const char*       path)        // Current Path
+{
+   Pending* P= &pending[pendingHead];
+   pendingHead= (pendingHead + 1) % MAX_PIPELINE;
+   pendingUsed--;
+
+   // A failing client entry remains on its DirList, which only uses it for
+   // name ordering. It's discarded along with that DirList.
+   if( receiveFile(path, P->serverE, P->clientE) == RC_NORM )
+   {
+     updateAttr(path, P->serverE, P->clientE);
+     printAction(P->action, P->serverE, "");
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       ClientThread::drainFiles
+//
+// Function-
+//       Complete all pending file requests.
+//
+//----------------------------------------------------------------------------
+void
+   ClientThread::drainFiles(        // Complete all pending file requests
+     const char*       path)        // Current Path
+{
+   while( pendingUsed > 0 )
+     completeFile(path);
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -377,14 +422,7 @@ int
      DirEntry*         serverE,     // -> Server DirEntry
      DirEntry*         clientE)     // -> Target item descriptor
 {
-   PeerRequest         query;       // Order to server
-   PeerResponse        qresp;       // Reply to client
    int                 result;      // Resultant
-
-   int                 outf;        // Output (new) file handle
-   off64_t             left;        // Bytes of file left to send
-   int                 rlen;        // Number of bytes read
-   int                 wlen;        // Number of bytes written
    int                 rc;          // Called routine return code
 
    //-------------------------------------------------------------------------
@@ -439,81 +477,12 @@ int
        break;
 
      case FT_FILE:                  // If it's a file
-       {{{{                         // (Backout object created)
-       //---------------------------------------------------------------------
-       // Request the file
-       //---------------------------------------------------------------------
-       query.oc= REQ_FILE;          // Request the file
-       nSend(&query, 1);            // Get the next entry
-       nSendString(serverE->fileName,
-                   strlen(serverE->fileName)); // Tell SERVER its name
-//                 strlen(serverE->fileName) + 1); // Tell SERVER its name
-
-       nRecv(&qresp, 1);            // Get the reply
-       if( qresp.rc != RSP_YO )     // If operation rejected
-       {
-         if( qresp.rc != RSP_NO )   // If operation garbled
-           invalidResponse(__LINE__, "FILE", qresp.rc);
-
-         printAction("skipped", clientE, "[Disallowed by SERVER]");
-         return RC_ERROR;
-         break;
-       }
-
-       //---------------------------------------------------------------------
-       // Open the file
-       //---------------------------------------------------------------------
-       outf= open64(fullName.c_str(),
-                    O_WRONLY|O_BINARY|O_TRUNC|O_CREAT,
-                    S_IRUSR|S_IWUSR);
-       if( outf < 0 )               // Open failed
-       {
-         msgerr("%4d ClientThread: open64(%s) failure", __LINE__
-               , fullName.c_str());
-         printAction("aborted", clientE, "[Open failure]");
-         result= RC_ERROR;
-       }
-
-       //---------------------------------------------------------------------
-       // Install recovery handler
-       //---------------------------------------------------------------------
-       Backout backout(path, serverE, outf);
-
-       //---------------------------------------------------------------------
-       // Receive the file (using server attributes!)
-       //---------------------------------------------------------------------
-       left= serverE->fileSize;     // Entire file left to be sent
-       while(left > 0 )             // More bytes need to be sent
-       {
-         rlen= (unsigned)min(left, MAX_TRANSFER);
-         nRecvStruct(buffer, rlen); // Read from SERVER
-         if( outf < 0 )
-           wlen= rlen;
-         else
-           wlen= write(outf,buffer,rlen); // Write some of the file
-         if( wlen != rlen )         // Wrong amount written
-           throwf("%4d ClientThread: %d=write(%s,%d) error",
-                  __LINE__, wlen, fullName.c_str(), rlen);
-
-         left -= rlen;              // Those read aren't left to read
-       }                            // Done reading more bytes
-
        //---------------------------------------------------------------------
-       // Close the file
+       // Install a file (Pending responses precede this one)
        //---------------------------------------------------------------------
-       backout.reset();             // Transfer complete, cancel backout
-       rc= 0;                       // Default, closed
-       if( outf >= 0 )
-         rc= close(outf);           // Close the file
-       if( rc != 0 )                // Close data file failed
-       {
-         removeItem(path, serverE);
-         msgerr("%4d ClientThread: close(%s) failure", __LINE__
-               , fullName.c_str());
-         printAction("aborted", serverE, "[I/O error]");
-         result= RC_ERROR;
-       }
-       }}}}
+       drainFiles(path);
+       requestFile(serverE);
+       result= receiveFile(path, serverE, clientE);
        break;
 
      case FT_FIFO:                  // If it's a pipe
@@ -555,6 +524,154 @@ int
    return result;
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       ClientThread::queueFile
+//
+// Function-
+//       Request a file, deferring its receipt.
+//
+//----------------------------------------------------------------------------
+void
+   ClientThread::queueFile(         // Request a file
+     const char*       path,        // Current Path
+     DirEntry*         serverE,     // -> Server DirEntry
+     DirEntry*         clientE,     // -> Target file descriptor
+     const char*       action)      // The completion action name
+{
+   //-------------------------------------------------------------------------
+   // Diagnostics
+   //-------------------------------------------------------------------------
+   msglog("\n");
+   msglog("queueFile: %s\n-----------\n", serverE->fileName);
+   serverE->display("SERVER:");
+   clientE->display("CLIENT:");
+
+   #if( BRINGUP )
+     printAction("ignored", clientE, "[BRINGUP (won't install)]");
+     return;
+   #endif
+
+   //-------------------------------------------------------------------------
+   // If the pipeline is full, complete the oldest request
+   //-------------------------------------------------------------------------
+   if( pendingUsed >= MAX_PIPELINE )
+     completeFile(path);
+
+   //-------------------------------------------------------------------------
+   // Send the request, deferring the response
+   //-------------------------------------------------------------------------
+   requestFile(serverE);
+
+   Pending* P= &pending[(pendingHead + pendingUsed) % MAX_PIPELINE];
+   P->serverE= serverE;
+   P->clientE= clientE;
+   P->action=  action;
+   pendingUsed++;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       ClientThread::receiveFile
+//
+// Function-
+//       Receive a requested file.
+//
+//----------------------------------------------------------------------------
+int                                 // Return code
+   ClientThread::receiveFile(       // Receive a requested file
+     const char*       path,        // Current Path
+     DirEntry*         serverE,     // -> Server DirEntry
+     DirEntry*         clientE)     // -> Target file descriptor
+{
+   PeerResponse        qresp;       // Reply to client
+   int                 result;      // Resultant
+
+   int                 outf;        // Output (new) file handle
+   off64_t             left;        // Bytes of file left to send
+   int                 rlen;        // Number of bytes read
+   int                 wlen;        // Number of bytes written
+   int                 rc;          // Called routine return code
+
+   //-------------------------------------------------------------------------
+   // Get the fully qualified file name
+   //-------------------------------------------------------------------------
+   string fullName= makeFileName(path, serverE->fileName);
+
+   //-------------------------------------------------------------------------
+   // Get the reply
+   //-------------------------------------------------------------------------
+   msglog("receiveFile: %s\n", serverE->fileName);
+   result= RC_NORM;                 // Default, successful
+   nRecv(&qresp, 1);                // Get the reply
+   if( qresp.rc != RSP_YO )         // If operation rejected
+   {
+     if( qresp.rc != RSP_NO )       // If operation garbled
+       invalidResponse(__LINE__, "FILE", qresp.rc);
+
+     printAction("skipped", clientE, "[Disallowed by SERVER]");
+     return RC_ERROR;
+   }
+
+   //-------------------------------------------------------------------------
+   // Open the file
+   //-------------------------------------------------------------------------
+   outf= open64(fullName.c_str(),
+                O_WRONLY|O_BINARY|O_TRUNC|O_CREAT,
+                S_IRUSR|S_IWUSR);
+   if( outf < 0 )                   // Open failed
+   {
+     msgerr("%4d ClientThread: open64(%s) failure", __LINE__
+           , fullName.c_str());
+     printAction("aborted", clientE, "[Open failure]");
+     result= RC_ERROR;
+   }
+
+   //-------------------------------------------------------------------------
+   // Install recovery handler
+   //-------------------------------------------------------------------------
+   Backout backout(path, serverE, outf);
+
+   //-------------------------------------------------------------------------
+   // Receive the file (using server attributes!)
+   //-------------------------------------------------------------------------
+   left= serverE->fileSize;         // Entire file left to be sent
+   while(left > 0 )                 // More bytes need to be sent
+   {
+     rlen= (unsigned)min(left, MAX_TRANSFER);
+     nRecvStruct(buffer, rlen);     // Read from SERVER
+     if( outf < 0 )
+       wlen= rlen;
+     else
+       wlen= write(outf,buffer,rlen); // Write some of the file
+     if( wlen != rlen )             // Wrong amount written
+       throwf("%4d ClientThread: %d=write(%s,%d) error",
+              __LINE__, wlen, fullName.c_str(), rlen);
+
+     left -= rlen;                  // Those read aren't left to read
+   }                                // Done reading more bytes
+
+   //-------------------------------------------------------------------------
+   // Close the file
+   //-------------------------------------------------------------------------
+   backout.reset();                 // Transfer complete, cancel backout
+   rc= 0;                           // Default, closed
+   if( outf >= 0 )
+     rc= close(outf);               // Close the file
+   if( rc != 0 )                    // Close data file failed
+   {
+     removeItem(path, serverE);
+     msgerr("%4d ClientThread: close(%s) failure", __LINE__
+           , fullName.c_str());
+     printAction("aborted", serverE, "[I/O error]");
+     result= RC_ERROR;
+   }
+
+   return result;
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -733,6 +850,27 @@ int                                 // Return code
    return(RC_NORM);
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       ClientThread::requestFile
+//
+// Function-
+//       Send a file request.
+//
+//----------------------------------------------------------------------------
+void
+   ClientThread::requestFile(       // Send a file request
+     DirEntry*         serverE)     // -> Server DirEntry
+{
+   PeerRequest         query;       // Order to server
+
+   query.oc= REQ_FILE;              // Request the file
+   nSend(&query, 1);
+   nSendString(serverE->fileName,
+               strlen(serverE->fileName)); // Tell SERVER its name
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -990,6 +1128,15 @@ void
        ptrEntry->fileTime= 0;
 
        firstTime= printPath(firstTime, pathName.c_str());
+       if( getFileType(serverE->fileInfo) == FT_FILE ) // If a file
+       {
+         // Insert the item onto the client list, then request it
+         ac= AC_BOTH;
+         clientE= clientL->insert(ptrEntry, clientP);
+         queueFile(pathName.c_str(), serverE, ptrEntry, "installed");
+         goto deferred_action;
+       }
+
        rc= installItem(pathName.c_str(), serverE, ptrEntry);
        if( rc != RC_NORM )
        {
@@ -1211,9 +1358,14 @@ void
          // The file needs to be replaced.
          //-------------------------------------------------------------------
          firstTime= printPath(firstTime, pathName.c_str());
-         rc= updateItem(pathName.c_str(), serverE, clientE);
+         #if( BRINGUP )
+           printAction("kept", clientE, "[BRINGUP (won't update)]");
+           break;
+         #endif
+
+         rc= removeItem(pathName.c_str(), clientE);
          if( rc == RC_NORM )
-           printAction("updated", serverE, "");
+           queueFile(pathName.c_str(), serverE, clientE, "updated");
          break;
 
        case FT_FIFO:                // If pipe
@@ -1290,6 +1442,11 @@ deferred_action:
      }
    }
 
+   //-------------------------------------------------------------------------
+   // Complete pending file requests
+   //-------------------------------------------------------------------------
+   drainFiles(pathName.c_str());
+
    //-------------------------------------------------------------------------
    // Process subdirectories
    //-------------------------------------------------------------------------
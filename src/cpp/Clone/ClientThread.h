@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2014 Frank Eskesen.
+//       Copyright (c) 2014-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       The client Thread
 //
 // Last change date-
-//       2014/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef CLIENTTHREAD_H_INCLUDED
@@ -40,14 +40,35 @@ class Socket;
 // Purpose-
 //       ClientThread descriptor.
 //
+// Implementation notes-
+//       File requests are pipelined. Up to MAX_PIPELINE REQ_FILE requests
+//       are sent before the oldest response is read, so the server streams
+//       file content back-to-back rather than waiting one round trip per
+//       file. The server processes requests in order, so no server change
+//       is required. Any other request first drains the pipeline.
+//
 //----------------------------------------------------------------------------
 class ClientThread : public CommonThread { // ClientThread descriptor
+//----------------------------------------------------------------------------
+// ClientThread::Typedefs and enumerations
+//----------------------------------------------------------------------------
+protected:
+struct Pending {                    // A pending (in-flight) file request
+   DirEntry*           serverE;     // -> Server DirEntry
+   DirEntry*           clientE;     // -> Client DirEntry
+   const char*         action;      // The completion action name
+}; // struct Pending
+
 //----------------------------------------------------------------------------
 // ClientThread::Attributes
 //----------------------------------------------------------------------------
 protected:
 const char*            path;        // The starting directory
 
+Pending                pending[MAX_PIPELINE]; // The pending file requests
+unsigned               pendingHead; // Index of the oldest pending request
+unsigned               pendingUsed; // Number of pending requests
+
 //----------------------------------------------------------------------------
 // ClientThread::Constructors
 //----------------------------------------------------------------------------
@@ -58,6 +79,33 @@ virtual
      Socket*           socket,      // Associated Socket
      const char*       path);       // Initial directory
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       ClientThread::completeFile
+//
+// Function-
+//       Complete the oldest pending file request.
+//
+//----------------------------------------------------------------------------
+public:
+void
+   completeFile(                    // Complete the oldest file request
+     const char*       path);       // Current Path
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       ClientThread::drainFiles
+//
+// Function-
+//       Complete all pending file requests.
+//
+//----------------------------------------------------------------------------
+void
+   drainFiles(                      // Complete all pending file requests
+     const char*       path);       // Current Path
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -67,7 +115,6 @@ virtual
 //       Exchange version identifiers.
 //
 //----------------------------------------------------------------------------
-public:
 int                                 // TRUE if version identifiers match
    exchangeVersionID( void );       // Exchange version identifiers
 
@@ -86,6 +133,42 @@ int
      DirEntry*         serverE,     // -> Server DirEntry
      DirEntry*         clientE);    // -> Target file descriptor
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       ClientThread::queueFile
+//
+// Function-
+//       Request a file, deferring its receipt.
+//
+// Implementation notes-
+//       If the pipeline is full, the oldest pending request is completed
+//       first. Upon completion, the file attributes are updated and the
+//       action is displayed.
+//
+//----------------------------------------------------------------------------
+void
+   queueFile(                       // Request a file
+     const char*       path,        // Current Path
+     DirEntry*         serverE,     // -> Server DirEntry
+     DirEntry*         clientE,     // -> Target file descriptor
+     const char*       action);     // The completion action name
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       ClientThread::receiveFile
+//
+// Function-
+//       Receive a requested file.
+//
+//----------------------------------------------------------------------------
+int                                 // Return code
+   receiveFile(                     // Receive a requested file
+     const char*       path,        // Current Path
+     DirEntry*         serverE,     // -> Server DirEntry
+     DirEntry*         clientE);    // -> Target file descriptor
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -118,6 +201,19 @@ int                                 // Return code
      const char*       path,        // Current Path
      DirEntry*         clientE);    // -> Client item descriptor
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       ClientThread::requestFile
+//
+// Function-
+//       Send a file request.
+//
+//----------------------------------------------------------------------------
+void
+   requestFile(                     // Send a file request
+     DirEntry*         serverE);    // -> Server DirEntry
+
 //----------------------------------------------------------------------------
 //
 // Method-
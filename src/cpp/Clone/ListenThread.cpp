@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2014 Frank Eskesen.
+//       Copyright (c) 2014-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Implement ListenThread object methods
 //
 // Last change date-
-//       2014/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <stdlib.h>
@@ -154,6 +154,8 @@ long                                // Return code (always 0)
        break;
      }
 
+     // File responses are small, back-to-back writes. Don't delay them.
+     server->setSocketSO(Socket::SO_NODELAY, TRUE);
      createServer(server, path);
    }
 
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2014-2020 Frank Eskesen.
+//       Copyright (c) 2014-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       The (multi-threaded) client.
 //
 // Last change date-
-//       2020/10/03
+//       2026/10/18
 //
 // Usage-
 //       RdClient <-options> <server_host<:server_port> <client_path>>
@@ -51,6 +51,7 @@
 //       LOG_SCDM=n    Soft Core Debug Mode verbosity
 //       LOG_IODM=n    In/Output Debug Mode size
 //       LOG_FILE=name Log file name (rdist.log)
+//       RD_CACHE=name Checksum cache file name (no default, no cache)
 //
 // Implementation notes-
 //       Used in conjunction with RdServer for file distribution.
@@ -284,9 +285,10 @@ static void
             rc, hostName, port, socket->getSocketEI());
 
    //-------------------------------------------------------------------------
-   // Set transfer size -- optimization attempt (has no noticable effect)
+   // Disable send coalescing. Pipelined requests are small, and delaying them
+   // stalls the server. (Do not shrink SO_RCVBUF: it limits the TCP window.)
    //-------------------------------------------------------------------------
-   socket->setSocketSO(Socket::SO_RCVBUF, 8192);
+   socket->setSocketSO(Socket::SO_NODELAY, TRUE);
 
    //-------------------------------------------------------------------------
    // Create the client worker Thread
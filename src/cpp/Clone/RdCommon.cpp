@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2014-2023 Frank Eskesen.
+//       Copyright (c) 2014-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,13 +16,14 @@
 //       Common routines used by RdClient and RdServer.
 //
 // Last change date-
-//       2023/08/03
+//       2026/10/18
 //
 // Environment variables-
 //       LOG_HCDM=n    Hard Core Debug Mode verbosity
 //       LOG_SCDM=n    Soft Core Debug Mode verbosity
 //       LOG_IODM=n    In/Output Debug Mode size
 //       LOG_FILE=name Log file name (rdist.log)
+//       RD_CACHE=name Checksum cache file name (no default, no cache)
 //
 //----------------------------------------------------------------------------
 #include <assert.h>
@@ -41,6 +42,7 @@
 #include <com/Clock.h>
 #include <com/Debug.h>
 #include <com/FileInfo.h>
+#include <com/HashCache.h>
 #include <com/istring.h>
 #include <com/Julian.h>
 #include <com/Network.h>
@@ -130,6 +132,7 @@ using std::string;
 // Global data areas
 //----------------------------------------------------------------------------
 Buffer*                mx_buffer= NULL; // Global MAX_TRANSFER Buffer
+HashCache*             ks_cache= NULL; // Global checksum cache
 
 int                    hcdm;        // Hard Core Debug Mode
 int                    scdm;        // Soft Core Debug Mode
@@ -741,6 +744,25 @@ int                                 // Return code (0 OK)
    //-------------------------------------------------------------------------
    string fileName= makeFileName(path, this->fileName);
 
+   //-------------------------------------------------------------------------
+   // Use the cached checksum if the file is unchanged
+   //-------------------------------------------------------------------------
+   HashCache::Entry cached;
+   memset(&cached, 0, sizeof(cached));
+   int cacheable= FALSE;
+   if( ks_cache != NULL
+       && HashCache::getKey(fileName.c_str(), cached.key) == 0
+       && cached.key.size == fileSize )
+   {
+     cacheable= TRUE;
+     if( ks_cache->fetch(cached.key, cached) == 0
+         && (cached.flags & HashCache::F_KSUM) )
+     {
+       fileKsum= cached.ksum;
+       return 0;
+     }
+   }
+
    //-------------------------------------------------------------------------
    // Open the file
    //-------------------------------------------------------------------------
@@ -792,9 +814,22 @@ int                                 // Return code (0 OK)
    }
 
    //-------------------------------------------------------------------------
-   // Set the checksum
+   // Set the checksum, caching it if the file did not change while read
    //-------------------------------------------------------------------------
    fileKsum= ksum;
+
+   HashCache::Key key;
+   if( cacheable
+       && HashCache::getKey(fileName.c_str(), key) == 0
+       && memcmp(&key, &cached.key, sizeof(key)) == 0 )
+   {
+     memset(cached.hash, 0, sizeof(cached.hash));
+     cached.ksum= ksum;
+     cached.flags= HashCache::F_KSUM;
+     cached.session= 0;
+     ks_cache->store(cached);
+   }
+
    return 0;
 }
 
@@ -2143,6 +2178,19 @@ void
    if( string != NULL )
      fileName= string;
 
+   // Open the checksum cache
+   string= getenv("RD_CACHE");
+   if( string != NULL )
+   {
+     ks_cache= new HashCache(string);
+     if( !ks_cache->isOpen() )
+     {
+       msgerr("File(%s): Checksum cache unavailable", string);
+       delete ks_cache;
+       ks_cache= NULL;
+     }
+   }
+
    if( fileName != NULL )
    {
      stdlog= fopen(fileName, "w");
@@ -2235,6 +2283,12 @@ void
    delete mx_buffer;
    mx_buffer= NULL;
 
+   //-------------------------------------------------------------------------
+   // Close the checksum cache
+   //-------------------------------------------------------------------------
+   delete ks_cache;
+   ks_cache= NULL;
+
    //-------------------------------------------------------------------------
    // Close logging
    //-------------------------------------------------------------------------
@@ -16,7 +16,7 @@
 //       Common controls.
 //
 // Last change date-
-//       2023/08/03
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef RDCOMMON_H_INCLUDED
@@ -58,6 +58,7 @@
 enum                                // Generic constants
 {  MAX_SENDSIZE=       1500         // If > zero, the largest send size
 ,  MAX_TRANSFER=       0x00100000   // The size of the transfer buffer
+,  MAX_PIPELINE=       16           // The largest number of in-flight files
 
 #if defined(_OS_WIN)
 ,  SERVER_PORT=        0x0000fefc   // The "well-known" port number (DOS)
@@ -175,12 +176,14 @@ class Buffer;
 class CommonThread;
 class DirEntry;
 class DirList;
+class HashCache;
 class Socket;
 
 //----------------------------------------------------------------------------
 // Global data areas
 //----------------------------------------------------------------------------
 extern Buffer*         mx_buffer;   // Global MAX_TRANSFER Buffer
+extern HashCache*      ks_cache;    // Global checksum cache (RD_CACHE)
 
 extern int             hcdm;        // Hard Core Debug Mode
 extern int             scdm;        // Soft Core Debug Mode
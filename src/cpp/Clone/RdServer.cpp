@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2014-2020 Frank Eskesen.
+//       Copyright (c) 2014-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       The (multi-threaded) file server.
 //
 // Last change date-
-//       2020/10/03
+//       2026/10/18
 //
 // Usage-
 //       RdServer <-options>
@@ -37,6 +37,7 @@
 //       LOG_SCDM=n    Soft Core Debug Mode verbosity
 //       LOG_IODM=n    In/Output Debug Mode size
 //       LOG_FILE=name Log file name (rdist.log)
+//       RD_CACHE=name Checksum cache file name (no default, no cache)
 //
 // Implementation notes-
 //       Used in conjunction with RdClient for file distribution.
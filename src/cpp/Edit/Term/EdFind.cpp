@@ -0,0 +1 @@
+Xcb/EdFind.cpp
\ No newline at end of file
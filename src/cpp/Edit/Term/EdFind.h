@@ -0,0 +1 @@
+Xcb/EdFind.h
\ No newline at end of file
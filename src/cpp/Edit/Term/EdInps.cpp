@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2024 Frank Eskesen.
+//       Copyright (C) 2024-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Implement EdInps.h: Terminal keyboard and mouse handlers.
 //
 // Last change date-
-//       2024/08/28
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #define _XOPEN_SOURCE_EXTENDED 1
@@ -243,6 +243,8 @@ void
 
    int fg_mark= config::mark_fg;
    int bg_mark= config::mark_bg;
+   int fg_find= config::find_fg;
+   int bg_find= config::find_bg;
    int fg_chg=  config::change_fg;
        bg_chg=  config::change_bg;
    int fg_msg=  config::message_fg;
@@ -301,6 +303,8 @@ void
        bg=      nc_set_color(bg     );
        fg_mark= nc_set_color(fg_mark);
        bg_mark= nc_set_color(bg_mark);
+       fg_find= nc_set_color(fg_find);
+       bg_find= nc_set_color(bg_find);
        fg_chg=  nc_set_color(fg_chg );
        bg_chg=  nc_set_color(bg_chg );
        fg_msg=  nc_set_color(fg_msg );
@@ -319,6 +323,8 @@ void
        bg=      nc_64k(bg     );
        fg_mark= nc_64k(fg_mark);
        bg_mark= nc_64k(bg_mark);
+       fg_find= nc_64k(fg_find);
+       bg_find= nc_64k(bg_find);
        fg_chg=  nc_64k(fg_chg );
        bg_chg=  nc_64k(bg_chg );
        fg_msg=  nc_64k(fg_msg );
@@ -333,6 +339,8 @@ void
        bg=      nc_256(bg     );
        fg_mark= nc_256(fg_mark);
        bg_mark= nc_256(bg_mark);
+       fg_find= nc_256(fg_find);
+       bg_find= nc_256(bg_find);
        fg_chg=  nc_256(fg_chg );
        bg_chg=  nc_256(bg_chg );
        fg_msg=  nc_256(fg_msg );
@@ -348,6 +356,8 @@ void
        bg=      COLOR_BLUE;
        fg_mark= COLOR_BLACK;
        bg_mark= COLOR_CYAN;
+       fg_find= COLOR_BLACK;
+       bg_find= COLOR_MAGENTA;
        fg_chg=  COLOR_WHITE;
        bg_chg=  COLOR_RED;
        fg_msg=  COLOR_BLACK;
@@ -360,6 +370,7 @@ void
      nc_set_pair(gc_font, fg,      bg);
      nc_set_pair(gc_flip, bg,      fg);
      nc_set_pair(gc_mark, fg_mark, bg_mark);
+     nc_set_pair(gc_find, fg_find, bg_find);
      nc_set_pair(gc_chg,  fg_chg,  bg_chg);
      nc_set_pair(gc_msg,  fg_msg,  bg_msg);
      nc_set_pair(gc_sts,  fg_sts,  bg_sts);
@@ -962,7 +973,11 @@ void
    // The main polling loop
    while( operational ) {
 //   flush();                       // (Not needed: poll flushes automatically)
-     int key= (int)poll(15'000);    // (When data present, immediate response)
+     int key= (int)poll(editor::search ? 100 : 15'000); // (Data: immediate)
+     if( search_post ) {            // If background search complete
+       search_post= false;
+       editor::search_done();
+     }
      if( key > 0 ) {
        key= read();
        key_input(key, key_state);
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Terminal input services.
 //
 // Last change date-
-//       2024/08/20
+//       2026/10/18
 //
 // Implementation notes-
 //       See EdOuts.h for terminal output services.
@@ -27,6 +27,7 @@
 
 #define USE_CURSESW false           // Use cursesw.h instead of ncurses.h
 
+#include <atomic>                   // For std::atomic_bool
 #include <string>                   // For std::string
 #include <sys/types.h>              // For system types
 #if USE_CURSESW                     // Linux formatting fix attempt (FAILS)
@@ -96,10 +97,12 @@ const GC_t             gc_mark= 3;  // GC: Marked line or block
 const GC_t             gc_chg=  4;  // GC: TOP: File changed
 const GC_t             gc_msg=  5;  // GC: TOP: Message line
 const GC_t             gc_sts=  6;  // GC: TOP: File unchanged
+const GC_t             gc_find= 7;  // GC: Highlighted locate string
 
 // Operational controls
 int                    operational= false; // TRUE while operational
 int                    poll_char= 0; // Method poll(), read-ahead character
+std::atomic_bool       search_post= false; // Background search complete?
 
 // Option controls
 EdOpts                 opts;        // Local data area, used by EdOpts.i
@@ -172,6 +175,19 @@ bool                                // TRUE if a  character is available
 uint32_t                            // The next character
    read( void );                    // Get the next character
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdInps::post_search
+//
+// Purpose-
+//       Post background search completion
+//
+//----------------------------------------------------------------------------
+virtual void
+   post_search( void )              // Post background search completion
+{  search_post= true; }             // (The polling loop checks it)
+
 //----------------------------------------------------------------------------
 //
 // Pseudo-thread methods-
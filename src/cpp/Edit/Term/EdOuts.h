@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Terminal output services.
 //
 // Last change date-
-//       2024/08/14
+//       2026/10/18
 //
 // Implementation notes-
 //       Attributes are defined in EdInps.h and EdUnit.h
@@ -81,6 +81,7 @@ virtual void
 // Public method-
 //       EdOuts::draw               Redraw everything
 //       EdOuts::draw_line          Draw a screen line
+//       EdOuts::draw_find          Draw a screen line, highlighting matches
 //       EdOuts::draw_history       Draw the history line
 //       EdOuts::draw_message       Draw the message line
 //       EdOuts::draw_status        Draw the status line
@@ -99,6 +100,11 @@ virtual void
      unsigned          row,         // The (absolute) row number
      const EdLine*     line);       // The line to draw
 
+void
+   draw_find(                       // Draw a line, highlighting matches
+     unsigned          row,         // The (absolute) row number
+     const char*       text);       // The (col_zero origin) line text
+
 virtual void
    draw_history( void );            // Redraw the history line
 
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Implement Config.h
 //
 // Last change date-
-//       2024/08/23
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <string>                   // For std::string
@@ -110,6 +110,9 @@ int                    config::opt_iodm= false; // I/O Debug Mode?
 uint32_t               config::mark_bg=    0x00C0F0FF; // Text BG (marked)
 uint32_t               config::mark_fg=    0x00000000; // Text FG (marked)
 
+uint32_t               config::find_bg=    0x00FFC080; // Text BG (highlighted)
+uint32_t               config::find_fg=    0x00000000; // Text FG (highlighted)
+
 uint32_t               config::text_bg=    0x00FFFFF0; // Text BG (default)
 uint32_t               config::text_fg=    0x00000000; // Text FG (default)
 
@@ -452,6 +455,8 @@ struct Option          bool_list[]= // Boolean parameter list
 struct Option          color_list[]= // The color parameter list
 { {"mark.bg",          &mark_bg}
 , {"mark.fg",          &mark_fg}
+, {"find.bg",          &find_bg}
+, {"find.fg",          &find_fg}
 , {"text.bg",          &text_bg}
 , {"text.fg",          &text_fg}
 , {"change.bg",        &change_bg}
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Configuration controls
 //
 // Last change date-
-//       2024/08/23
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef CONFIG_H_INCLUDED
@@ -132,6 +132,9 @@ extern int             opt_verbose; // Debugging verbosity
 extern uint32_t        mark_bg;     // mark.bg: Marked text BG (background)
 extern uint32_t        mark_fg;     // mark.bg: Marked text FG (foreground)
 
+extern uint32_t        find_bg;     // find.bg: Highlighted text BG
+extern uint32_t        find_fg;     // find.fg: Highlighted text FG
+
 extern uint32_t        text_bg;     // text.bg: Normal Text BG
 extern uint32_t        text_fg;     // text.bg: Normal Text FG
 
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,10 +16,11 @@
 //       Editor: Built in functions
 //
 // Last change date-
-//       2024/08/30
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <sys/stat.h>               // For stat
+#include <vector>                   // For std::vector
 
 #include <pub/Debug.h>              // For namespace pub::debugging
 #include <pub/Fileman.h>            // For pub::fileman::Name::get_file_name()
@@ -30,6 +31,7 @@
 #include "EdData.h"                 // For EdData
 #include "Editor.h"                 // For Editor Globals
 #include "EdFile.h"                 // For EdFile, EdLine
+#include "EdFind.h"                 // For EdFind
 #include "EdHist.h"                 // For EdHist
 #include "EdMark.h"                 // For EdMark
 #include "EdOpts.h"                 // For EdOpts::suspend/resume
@@ -127,6 +129,7 @@ const char*            desc;        // The command description
 
 static const char* command_bot(char*); // Forward references: commands
 static const char* command_change(char*);
+static const char* command_count(char*);
 static const char* command_deblank(char*);
 static const char* command_debug(char*);
 static const char* command_detab(char*);
@@ -153,6 +156,7 @@ static const char* number_error(char*);
 static const Command_desc  command_desc[]= // The Command descriptor list
 {  {command_bot,      "BOT",      "Bottom of file"}
 ,  {command_change,   "C",        "Change"}
+,  {command_count,    "COUNT",    "Count and highlight locate string matches"}
 ,  {command_deblank,  "DEBLANK",  "Remove all trailing blanks"}
 ,  {command_debug,    "DEBUG",    nullptr}
 ,  {command_detab,    "DETAB",    "Convert tabs to spaces"}
@@ -358,6 +362,66 @@ static const char*                  // Error message, nullptr expected
    return nullptr;                  // (No error)
 }
 
+static const char*                  // Error message, nullptr expected
+   command_count(                   // Count command
+     char*             parm)        // (Mutable) parameter string
+{
+   delete editor::search;           // Stop any active count
+   editor::search= nullptr;
+   delete editor::highlight;        // And remove any highlighting
+   editor::highlight= nullptr;
+
+   if( parm == nullptr ) {          // (COUNT with no parameter just clears)
+     editor::unit->draw();
+     return nullptr;
+   }
+
+   int D= (unsigned char)parm[0];   // The string delimiter
+   parm++;
+   char* C= strchr(parm, D);
+   if( C == nullptr )
+     C= strchr(parm, '\0');
+   if( C == parm )
+     return "Invalid parameter";
+
+   if( *C != '\0' && *(C+1) != '\0' ) // If delimiter is not final character
+       return "Invalid parameter";
+
+   // The count runs in the background, completing in editor::search_done
+   string locate(parm, C - parm);
+   editor::highlight= new EdFind(locate, editor::locate_case);
+   editor::search= new EdSearch(editor::file, locate, editor::locate_case);
+   editor::search->start();
+   editor::unit->draw();
+   editor::put_message("Counting...");
+   return nullptr;
+}
+
+static bool                         // TRUE if any block line ends with ' '
+   has_trailing_blank(              // Does any block line end with ' '?
+     const EdBlock*    block)       // The unloaded block
+{
+   const char* text= block->text;
+   const char* const last= text + block->size;
+   const char* from= text;
+   while( from < last ) {
+     const char* nend= (const char*)memchr(from, '\n', last - from);
+     if( nend == nullptr )          // (The ending '\n' is missing)
+       nend= last;
+     else if( nend > from && nend[-1] == '\r' ) // (DOS delimiter)
+       --nend;
+     if( nend > from && nend[-1] == ' ' )
+       return true;
+
+     from= (const char*)memchr(nend, '\n', last - nend);
+     if( from == nullptr )
+       break;
+     ++from;
+   }
+
+   return false;
+}
+
 static const char*                  // Error message, nullptr expected
    command_deblank(char*)           // Remove all trailing blanks from lines
 {
@@ -372,6 +436,12 @@ static const char*                  // Error message, nullptr expected
      return "Cancelled: save or undo changes first";
 
    for(EdLine* line= file->line_list.get_head(); line; line= line->get_next()) {
+     if( line->flags & EdLine::F_LAZY ) { // If the block isn't loaded
+       if( file->check(line->block) // (A truncated block loads empty)
+           && !has_trailing_blank(line->block) )
+         continue;                  // (Skip block; it has no trailing blanks)
+       file->load(line);
+     }
      if( line->flags & EdLine::F_PROT ) // If the line is protected
        continue;                    // (Skip line. Don't check trailing blanks)
      const char* text= line->text;
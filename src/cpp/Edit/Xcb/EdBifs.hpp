@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Handle tabs and margins
 //
 // Last change date-
-//       2024/08/30
+//       2026/10/18
 //
 // Implementation notes-
 //       (Only) included by EdBifs.cpp
@@ -114,6 +114,13 @@ static const char*                  // Error message, nullptr expected
      return "Cancelled: save or undo changes first";
 
    for(EdLine* line= file->line_list.get_head(); line; line= line->get_next()) {
+     if( line->flags & EdLine::F_LAZY ) { // If the block isn't loaded
+       const EdBlock* block= line->block;
+       if( file->check(block)       // (A truncated block loads empty)
+           && memchr(block->text, '\t', block->size) == nullptr )
+         continue;                  // (Skip block; it has no tabs)
+       file->load(line);
+     }
      if( line->flags & EdLine::F_PROT ) // If the line is protected
        continue;                    // (Skip line; don't remove tabs)
      Active* active= nullptr;
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,19 +16,25 @@
 //       Editor: Implement EdFile.h
 //
 // Last change date-
-//       2024/08/30
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <stdio.h>                  // For printf, fopen, fclose, ...
 #include <stdlib.h>                 // For various
-#include <unistd.h>                 // For unlink
+#include <string.h>                 // For memchr, ...
+#include <fcntl.h>                  // For open
+#include <unistd.h>                 // For unlink, close, sysconf
+#include <sys/mman.h>               // For mmap
 #include <sys/stat.h>               // For stat
+#include <thread>                   // For std::thread::hardware_concurrency
+#include <vector>                   // For std::vector
 
 #include <pub/Debug.h>              // For namespace pub::debugging
 #include <pub/Fileman.h>            // For pub::Name
 #include <pub/List.h>               // For pub::List
 #include <pub/Signals.h>            // For pub::signals::Signal
 #include <pub/Trace.h>              // For pub::Trace
+#include <pub/Worker.h>             // For pub::WorkerPool
 
 #include "Config.h"                 // For Config::check, namespace config
 #include "EdData.h"                 // For EdData
@@ -38,6 +44,7 @@
 #include "EdMark.h"                 // For EdMark
 #include "EdMess.h"                 // For EdMess
 #include "EdOpts.h"                 // For EdOpts
+#include "EdPool.h"                 // For EdPool
 #include "EdUnit.h"                 // For EdUnit
 #include "EdRedo.h"                 // For EdRedo
 
@@ -55,12 +62,474 @@ enum // Compilation controls
 
 #define USE_REDO_DIAGNOSTICS true   // Use redo/undo diagnostics?
 
+enum // Large file controls
+{  LARGE_FILE= 0x01000000           // Memory map files at least this large
+,  INDEX_CHUNK= 0x00400000          // Minimum line index chunk size
+}; // Large file controls
+
+enum // Undo controls
+{  UNDO_ROWS= 1000000               // Maximum undo_list removed EdLines
+}; // Undo controls
+
 //----------------------------------------------------------------------------
 // External data areas
 //----------------------------------------------------------------------------
 pub::signals::Signal<EdFile::CloseEvent>
                        EdFile::close_signal; // CloseEvent signal
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdBlock::~EdBlock
+//
+// Purpose-
+//       Destructor
+//
+//----------------------------------------------------------------------------
+   EdBlock::~EdBlock( void )        // Destructor
+{
+   if( pool )                       // If unloaded, release the mapping
+     editor::release(pool);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdList::~EdList
+//
+// Purpose-
+//       Destructor
+//
+//----------------------------------------------------------------------------
+   EdList::~EdList( void )          // Destructor
+{
+   for(size_t i= 0; i<block.size(); ++i) {
+     if( block[i]->text == nullptr ) // (Placeholders own unloaded blocks)
+       delete block[i];
+   }
+}
+
+//----------------------------------------------------------------------------
+// EdList::Accessor methods
+//----------------------------------------------------------------------------
+EdLine*                             // The line (or placeholder) containing row
+   EdList::get_line(                // Get EdLine*
+     size_t            row) const   // For this row number
+{
+   size_t const n= block.size();
+   if( row >= sum(n) )              // (Never return nullptr)
+     return get_tail();
+
+   size_t index= 0;                 // Locate the block containing row
+   size_t step= 1;
+   while( (step << 1) <= n )
+     step <<= 1;
+   for(; step; step >>= 1) {
+     if( (index + step) <= n && tree[index + step] <= row ) {
+       index += step;
+       row -= tree[index];
+     }
+   }
+
+   EdLine* line= block[index]->head;
+   if( line->flags & EdLine::F_LAZY ) // (All its rows are in the placeholder)
+     return line;
+
+   while( row-- )
+     line= line->get_next();
+   return line;
+}
+
+size_t                              // The (first) row number
+   EdList::get_row(                 // Get row number
+     const EdLine*     line) const  // For this line
+{
+   const EdBlock* from= line ? line->block : nullptr;
+   if( from == nullptr || from->head == nullptr ) // If not in the list
+     return get_rows();
+
+   size_t row= sum(from->index);
+   for(; line != from->head; line= line->get_prev())
+     ++row;
+   return row;
+}
+
+size_t                              // The number of rows
+   EdList::get_rows(                // Get number of rows
+     const EdLine*     line)        // In this line or placeholder
+{
+   if( line->flags & EdLine::F_LAZY )
+     return line->block->rows;
+   return 1;
+}
+
+bool                                // TRUE if the line is in the list
+   EdList::is_on(                   // Is a line in the list?
+     const EdLine*     line) const  // This line or placeholder
+{
+   // Removed lines have no block. Removed placeholders' blocks have no head.
+   const EdBlock* from= line->block;
+   if( from == nullptr || from->head == nullptr )
+     return false;
+
+   return from->index < block.size() && block[from->index] == from;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdList::copy
+//
+// Purpose-
+//       Copy a placeholder line
+//
+// Implementation notes-
+//       The copy gets its own (unloaded) block, which shares the original's
+//       text and references its mapped EdPool.
+//
+//----------------------------------------------------------------------------
+EdLine*                             // The placeholder copy
+   EdList::copy(                    // Copy a placeholder line
+     const EdLine*     line)        // The placeholder to copy
+{
+   const EdBlock* from= line->block;
+   EdBlock* into= new EdBlock();
+   into->rows= from->rows;
+   into->text= from->text;
+   into->size= from->size;
+   into->pool= from->pool;
+   into->pool->reference();
+
+   EdLine* result= new EdLine();
+   result->flags= EdLine::F_LAZY;
+   result->block= into;
+   return result;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdList::load
+//
+// Purpose-
+//       Replace the placeholder with its loaded lines
+//
+// Implementation notes-
+//       The placeholder line becomes the block's first line. Its block
+//       becomes a loaded block, and keeps its index.
+//
+//----------------------------------------------------------------------------
+void
+   EdList::load(                    // Replace placeholder rows
+     EdLine*           line,        // The placeholder, now the first line
+     EdLine*           head,        // The first following line, or nullptr
+     EdLine*           tail)        // The final following line
+{
+   EdBlock* from= line->block;
+   size_t rows= 1;                  // The number of loaded rows
+   if( head ) {
+     _Base::insert(line, head, tail);
+     for(EdLine* L= head; ; L= L->get_next()) {
+       L->block= from;
+       ++rows;
+       if( L == tail )
+         break;
+     }
+   }
+
+   line->flags &= decltype(line->flags)(~EdLine::F_LAZY);
+   from->text= nullptr;
+   from->size= 0;
+   if( from->pool ) {               // (The text was copied)
+     editor::release(from->pool);
+     from->pool= nullptr;
+   }
+   if( rows != from->rows ) {       // (Only if the mapped file changed)
+     add(from->index, ptrdiff_t(rows) - ptrdiff_t(from->rows));
+     from->rows= rows;
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdList::reset
+//
+// Purpose-
+//       Reset (empty) the List
+//
+//----------------------------------------------------------------------------
+EdLine*                             // -> The set of removed Links
+   EdList::reset( void )            // Reset (empty) the List
+{
+   for(size_t i= 0; i<block.size(); ++i) {
+     if( block[i]->text == nullptr )
+       delete block[i];
+     else                           // (Owned by its placeholder)
+       block[i]->head= nullptr;
+   }
+   block.clear();
+   tree.clear();
+
+   EdLine* head= _Base::reset();
+   for(EdLine* line= head; line; line= line->get_next()) {
+     if( (line->flags & EdLine::F_LAZY) == 0 )
+       line->block= nullptr;
+   }
+   return head;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdList::add
+//       EdList::sum
+//
+// Purpose-
+//       Add a (signed) row count to a block's tree entries
+//       Sum the row counts of blocks [0..index)
+//
+//----------------------------------------------------------------------------
+void
+   EdList::add(                     // Add to the tree
+     size_t            index,       // For this block index
+     ptrdiff_t         rows)        // This (signed) row count
+{
+   for(size_t i= index + 1; i < tree.size(); i += i & (~i + 1))
+     tree[i] += size_t(rows);       // (Modular arithmetic)
+}
+
+size_t                              // The number of rows
+   EdList::sum(                     // Sum row counts
+     size_t            index) const // Of blocks [0..index)
+{
+   size_t rows= 0;
+   for(size_t i= index; i > 0; i -= i & (~i + 1))
+     rows += tree[i];
+   return rows;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdList::inserted
+//
+// Purpose-
+//       Update the blocks after an insert
+//
+// Implementation notes-
+//       Lines are normally added to the block containing the line before
+//       (or after) them. Placeholder lines are separate blocks, so inserting
+//       them (or inserting between two placeholders) adds blocks.
+//
+//----------------------------------------------------------------------------
+void
+   EdList::inserted(                // Update blocks after insert
+     EdLine*           head,        // First inserted line
+     EdLine*           tail)        // Final inserted line
+{
+   size_t count= 0;                 // The number of inserted lines
+   bool lazy= false;                // Were any placeholders inserted?
+   for(EdLine* line= head; ; line= line->get_next()) {
+     if( line == nullptr ) throw "Invalid insert chain";
+     if( line->flags & EdLine::F_LAZY )
+       lazy= true;
+     ++count;
+     if( line == tail )
+       break;
+   }
+
+   EdLine* prev= head->get_prev();
+   EdLine* next= tail->get_next();
+   EdBlock* into= nullptr;          // The existing block to use
+   if( !lazy ) {
+     if( prev && (prev->flags & EdLine::F_LAZY) == 0 )
+       into= prev->block;
+     else if( next && (next->flags & EdLine::F_LAZY) == 0 ) {
+       into= next->block;           // (next is the block's first line)
+       into->head= head;
+     }
+   }
+
+   if( into ) {                     // Add the lines to an existing block
+     for(EdLine* line= head; ; line= line->get_next()) {
+       line->block= into;
+       if( line == tail )
+         break;
+     }
+     into->rows += count;
+     add(into->index, ptrdiff_t(count));
+     if( into->rows > 2 * BLOCK_ROWS ) { // If the block is too large
+       EdLine* line= into->head;
+       for(size_t i= 0; i<BLOCK_ROWS; ++i)
+         line= line->get_next();
+       split(into, BLOCK_ROWS, line);
+       rebuild();
+     }
+     return;
+   }
+
+   // Separate the lines before and after the insert, then add new blocks
+   size_t index= 0;                 // The new block index
+   if( prev ) {
+     EdBlock* from= prev->block;
+     if( next && next->block == from ) { // If inserted within a block
+       size_t keep= 1;
+       for(EdLine* line= from->head; line != prev; line= line->get_next())
+         ++keep;
+       split(from, keep, next);
+     }
+     index= from->index + 1;
+   }
+
+   std::vector<EdBlock*> insert;    // The new blocks
+   into= nullptr;
+   for(EdLine* line= head; ; line= line->get_next()) {
+     if( line->flags & EdLine::F_LAZY ) {
+       line->block->head= line;
+       insert.push_back(line->block);
+       into= nullptr;
+     } else {
+       if( into == nullptr || into->rows >= BLOCK_ROWS ) {
+         into= new EdBlock();
+         into->head= line;
+         insert.push_back(into);
+       }
+       line->block= into;
+       into->rows++;
+     }
+
+     if( line == tail )
+       break;
+   }
+
+   block.insert(block.begin() + ptrdiff_t(index), insert.begin(), insert.end());
+   rebuild();
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdList::rebuild
+//
+// Purpose-
+//       Rebuild the block index and tree
+//
+// Implementation notes-
+//       Removed and empty blocks are dropped. Loaded blocks are deleted.
+//
+//----------------------------------------------------------------------------
+void
+   EdList::rebuild( void )          // Rebuild the block index and tree
+{
+   size_t n= 0;                     // The number of blocks kept
+   for(size_t i= 0; i<block.size(); ++i) {
+     EdBlock* from= block[i];
+     if( from->head == nullptr ) {  // If removed or empty
+       if( from->text == nullptr )  // (Placeholders own unloaded blocks)
+         delete from;
+       continue;
+     }
+
+     from->index= n;
+     block[n++]= from;
+   }
+   block.resize(n);
+
+   tree.assign(n + 1, 0);           // Build the tree in O(n)
+   for(size_t i= 1; i <= n; ++i) {
+     tree[i] += block[i-1]->rows;
+     size_t j= i + (i & (~i + 1));
+     if( j <= n )
+       tree[j] += tree[i];
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdList::removed
+//
+// Purpose-
+//       Update the blocks before a remove
+//
+// Implementation notes-
+//       Removed placeholders keep their (unloaded) blocks, but the blocks'
+//       head is set to nullptr. Removed lines get a nullptr block.
+//
+//----------------------------------------------------------------------------
+void
+   EdList::removed(                 // Update blocks before remove
+     EdLine*           head,        // First line to remove
+     EdLine*           tail)        // Final line to remove
+{
+   bool changed= false;             // Was any block removed or emptied?
+   for(EdLine* line= head; ; line= line->get_next()) {
+     if( line == nullptr ) throw "Invalid remove chain";
+     EdBlock* from= line->block;
+     if( line->flags & EdLine::F_LAZY ) {
+       add(from->index, -ptrdiff_t(from->rows));
+       from->head= nullptr;
+       changed= true;
+     } else {
+       from->rows--;
+       add(from->index, -1);
+       if( from->head == line ) {   // If removing the block's first line
+         EdLine* next= line->get_next();
+         from->head= (next && next->block == from) ? next : nullptr;
+         if( from->head == nullptr )
+           changed= true;
+       }
+       line->block= nullptr;
+     }
+
+     if( line == tail )
+       break;
+   }
+
+   if( changed )
+     rebuild();
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdList::split
+//
+// Purpose-
+//       Split a block
+//
+// Implementation notes-
+//       The block keeps its first rows. The remaining rows are moved into
+//       new blocks of up to BLOCK_ROWS rows, inserted after it. The caller
+//       then rebuilds the index.
+//
+//----------------------------------------------------------------------------
+void
+   EdList::split(                   // Split a block
+     EdBlock*          from,        // The block to split
+     size_t            keep,        // Keeping this many rows
+     EdLine*           line)        // The first remaining line
+{
+   std::vector<EdBlock*> insert;    // The new blocks
+   size_t rows= from->rows - keep;  // The number of rows to move
+   from->rows= keep;
+   EdBlock* into= nullptr;
+   for(; rows > 0; --rows) {
+     if( into == nullptr || into->rows >= BLOCK_ROWS ) {
+       into= new EdBlock();
+       into->head= line;
+       insert.push_back(into);
+     }
+     line->block= into;
+     into->rows++;
+     line= line->get_next();
+   }
+
+   block.insert(block.begin() + ptrdiff_t(from->index + 1)
+               , insert.begin(), insert.end());
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -107,12 +576,11 @@ pub::signals::Signal<EdFile::CloseEvent>
    if( HCDM && !line_list.is_coherent() )
      Editor::alertf("%4d incoherent\n", __LINE__);
 
-   for(;;) {                        // Delete all lines
-     EdLine* line= line_list.remq();
-     if( line == nullptr )
-       break;
-
+   EdLine* line= line_list.reset(); // Delete all lines
+   while( line ) {
+     EdLine* next= line->get_next();
      delete line;
+     line= next;
    }
 
    // Raise CloseEvent signal
@@ -130,34 +598,21 @@ char*
 
 EdLine*                             // The EdLine*
    EdFile::get_line(                // Get EdLine*
-     size_t            row) const   // For this row number
+     size_t            row)         // For this row number
 {
-   EdLine* line= line_list.get_head(); // Get top line
-   while( row > 0 ) {               // Locate row
-     line= (EdLine*)line->get_next();
-     if( line == nullptr )
-       break;
-
-     row--;
+   EdLine* line= line_list.get_line(row);
+   if( line->flags & EdLine::F_LAZY ) { // If the row isn't loaded
+     load(line);
+     line= line_list.get_line(row);
    }
 
-   return line ? line : line_list.get_tail(); // (Never return nullptr)
+   return line;
 }
 
 size_t                              // The row number
    EdFile::get_row(                 // Get row number
      const EdLine*    cursor) const // For this line
-{
-   size_t row= 0;
-   for(EdLine* line= line_list.get_head(); line; line= line->get_next() ) {
-     if( line == cursor )
-       break;
-
-     row++;
-   }
-
-   return row;
-}
+{  return line_list.get_row(cursor); }
 
 bool                                // TRUE if file is changed or damaged
    EdFile::is_changed( void ) const // Is file changed or damaged?
@@ -234,6 +689,9 @@ void
    EdFile::activate(                // Activate
      EdLine*           line)        // This line
 {
+   if( line->flags & EdLine::F_LAZY ) // If the line isn't loaded
+     line= load(line);              // (Use its last row)
+
    if( this == editor::file ) {     // If the file is active
      editor::unit->activate(line);
    } else {                         // If the file is off-screen
@@ -306,8 +764,15 @@ EdLine*                             // The last inserted line
      return nullptr;
    }
 
-   // Allocate the input data area Pool
+   // Memory map large files
    size_t size= st.st_size;         // The size of the file
+   if( size >= LARGE_FILE ) {
+     EdLine* last= insert_large(name, line, size);
+     if( last )
+       return last;
+   }
+
+   // Allocate the input data area Pool
    char* text= allocate(size + 1);  // Allocate space for entire file (+ '\0')
    memset(text, 0, size + 1);       // (In case read fails)
 
@@ -331,6 +796,209 @@ EdLine*                             // The last inserted line
    return parse(line, text, size);
 }
 
+//----------------------------------------------------------------------------
+//
+// Struct-
+//       IndexChunk
+//
+// Purpose-
+//       Index one chunk of text
+//
+// Implementation notes-
+//       Each chunk contains complete lines, and is divided into blocks of
+//       EdList::BLOCK_ROWS rows. (Its last block may contain fewer rows.)
+//
+//       The '\0' and non-ASCII checks examine a word at a time. A word W
+//       contains a '\0' byte iff (W - 0x01..01) & ~W & 0x80..80 is non-zero.
+//       The '\n' delimiters are located using memchr, which is vectorized.
+//
+//----------------------------------------------------------------------------
+struct IndexChunk {                 // A text chunk to index
+const char*            text;        // The text origin
+size_t                 origin;      // The chunk offset
+size_t                 length;      // The chunk length
+std::vector<size_t>    block;       // The block offsets
+size_t                 rows= 0;     // The number of rows
+bool                   binary= false; // Chunk contains '\0'
+bool                   crlf= false; // Chunk contains DOS delimiters
+bool                   lf= false;   // Chunk contains UNIX delimiters
+bool                   utf8= false; // Chunk contains non-ASCII characters
+
+void
+   index( void )                    // Index the chunk
+{
+   const uint64_t ONES= 0x0101010101010101; // (Each byte 0x01)
+   const uint64_t HIGH= 0x8080808080808080; // (Each byte 0x80)
+
+   const char* C= text + origin;
+   const char* const last= C + length;
+   uint64_t high= 0;                // Accumulated character bits
+   uint64_t zero= 0;                // Accumulated '\0' detector bits
+   for(; C + sizeof(uint64_t) <= last; C += sizeof(uint64_t)) {
+     uint64_t W;
+     memcpy(&W, C, sizeof(W));
+     high |= W;
+     zero |= (W - ONES) & ~W;
+   }
+   for(; C < last; ++C) {
+     high |= uint8_t(*C);
+     if( *C == '\0' )
+       zero |= HIGH;
+   }
+
+   utf8= (high & HIGH) != 0;
+   binary= (zero & HIGH) != 0;
+   if( binary )                     // (Binary files are not indexed)
+     return;
+
+   block.push_back(origin);
+   size_t used= 0;                  // The current block's rows
+   C= text + origin;
+   for(;;) {
+     C= (const char*)memchr(C, '\n', last - C);
+     if( C == nullptr )
+       break;
+
+     if( C > text && C[-1] == '\r' )
+       crlf= true;
+     else
+       lf= true;
+     ++C;
+     ++rows;
+     if( ++used >= EdList::BLOCK_ROWS && C < last ) {
+       block.push_back(C - text);
+       used= 0;
+     }
+   }
+   if( last[-1] != '\n' )           // (The ending '\n' is missing)
+     ++rows;
+}
+}; // struct IndexChunk
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdFile::insert_large
+//
+// Purpose-
+//       Load large file data
+//
+// Implementation notes-
+//       The file is mapped read-only, so its pages are shared with the page
+//       cache and can be discarded. Each row block becomes one F_LAZY
+//       placeholder line, and EdFile::load copies a block's text when it is
+//       used. The mapping's EdPool is deleted when no unloaded block (or
+//       background search) references it.
+//
+//----------------------------------------------------------------------------
+EdLine*                             // The last inserted line, nullptr if none
+   EdFile::insert_large(            // Insert large file
+     const char*       name,        // The file name to insert
+     EdLine*           line,        // Insert after this line
+     size_t            size)        // The file size
+{
+   int fd= open(name, O_RDONLY);
+   if( fd < 0 )
+     return nullptr;
+
+   void* map= mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+   if( map == MAP_FAILED ) {
+     close(fd);
+     return nullptr;
+   }
+
+   const char* text= (const char*)map;
+   if( HCDM || opt_hcdm )
+     traceh("EdFile(%p)::insert_large(%s) %p.%zd\n", this, name, text, size);
+
+   // Divide the text into chunks of complete lines
+   size_t count= std::thread::hardware_concurrency();
+   if( count > size / INDEX_CHUNK )
+     count= size / INDEX_CHUNK;
+   if( count < 1 )
+     count= 1;
+
+   std::vector<IndexChunk> chunk;
+   size_t origin= 0;
+   for(size_t i= 1; origin < size; ++i) {
+     size_t end= size;
+     if( i < count ) {              // (The last chunk ends at size)
+       end= size / count * i;
+       if( end < origin )
+         end= origin;
+       const char* C= (const char*)memchr(text + end, '\n', size - end);
+       end= C ? C + 1 - text : size;
+     }
+
+     chunk.emplace_back();
+     chunk.back().text= text;
+     chunk.back().origin= origin;
+     chunk.back().length= end - origin;
+     origin= end;
+   }
+
+   // Index the chunks. (This thread also indexes chunks)
+   pub::WorkerPool::parallel(unsigned(chunk.size()), chunk.size(),
+     [&chunk](size_t i) { chunk[i].index(); });
+
+   bool binary= false, crlf= false, lf= false, utf8= false;
+   for(size_t i= 0; i<chunk.size(); ++i) {
+     binary |= chunk[i].binary;
+     crlf   |= chunk[i].crlf;
+     lf     |= chunk[i].lf;
+     utf8   |= chunk[i].utf8;
+   }
+
+   if( binary ) {                   // (Binary files are read normally)
+     munmap(map, size);
+     close(fd);
+     return nullptr;
+   }
+   EdPool* pool= new EdPool((char*)map, size, fd); // (The pool closes fd)
+   editor::filePool.lifo(pool);
+
+   if( utf8 ) {                     // If UTF-8 (or garbage)
+     contains_UTF8= true;
+     if( !EdOpts::has_unicode_support() ) { // If UTF-8 not supported
+       put_message("UTF-8 not supported, file not writable");
+       damaged= true;
+     }
+   }
+
+   if( mode == M_NONE )
+     mode= crlf ? (lf ? M_MIX : M_DOS) : M_UNIX;
+   else if( (mode == M_DOS && lf) || (mode == M_UNIX && crlf) )
+     mode= M_MIX;
+
+   if( text[size-1] != '\n' )
+     put_message("Ending '\\n' missing");
+
+   // Create the placeholder lines
+   pub::List<EdLine> list;
+   for(size_t i= 0; i<chunk.size(); ++i) {
+     const IndexChunk& C= chunk[i];
+     size_t const blocks= C.block.size();
+     for(size_t b= 0; b<blocks; ++b) {
+       EdBlock* block= new EdBlock();
+       size_t end= (b + 1) < blocks ? C.block[b+1] : C.origin + C.length;
+       block->text= text + C.block[b];
+       block->size= end - C.block[b];
+       block->pool= pool;
+       pool->reference();
+       block->rows= EdList::BLOCK_ROWS;
+       if( (b + 1) == blocks )
+         block->rows= C.rows - b * EdList::BLOCK_ROWS;
+
+       EdLine* L= new EdLine();
+       L->flags= EdLine::F_LAZY;
+       L->block= block;
+       list.fifo(L);
+     }
+   }
+
+   return insert(line, list.get_head(), list.get_tail());
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -348,16 +1016,144 @@ EdLine*                             // (Always tail)
 {
    line_list.insert(after, head, tail);
 
-   for(EdLine* line= head; line != tail; line= line->get_next()) {
-     if( line == nullptr ) throw "Invalid insert chain";
-     rows++;
+   for(EdLine* line= head; ; line= line->get_next()) {
+     rows += EdList::get_rows(line);
+     if( line == tail )
+       break;
    }
-   rows++;                          // (Count the tail line)
    row_zero= get_row(top_line);     // Correct row_zero
 
    return tail;
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdFile::check
+//
+// Purpose-
+//       Check an unloaded block's mapped file
+//
+//----------------------------------------------------------------------------
+bool                                // TRUE if the block's text can be read
+   EdFile::check(                   // Check an unloaded block's mapped file
+     const EdBlock*    block)       // The unloaded block
+{
+   int rc= block->pool->check();
+   if( rc != EdPool::CHECK_INTACT && !damaged ) {
+     damaged= true;
+     if( rc == EdPool::CHECK_TRUNCATED )
+       put_message("File truncated by another program, text lost");
+     else
+       put_message("File changed by another program");
+   }
+
+   return rc != EdPool::CHECK_TRUNCATED;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdFile::load
+//       EdFile::load_near
+//
+// Purpose-
+//       Load a placeholder line's rows
+//       Load the rows near a line
+//
+// Implementation notes-
+//       The block's text is copied, then parsed in place. DOS delimiters
+//       are kept per line, as EdFile::parse does.
+//
+//       If the mapped file was truncated, the block's rows are replaced by
+//       one empty line.
+//
+//----------------------------------------------------------------------------
+EdLine*                             // The last loaded line
+   EdFile::load(                    // Load placeholder rows
+     EdLine*           line)        // The placeholder line
+{
+   if( (line->flags & EdLine::F_LAZY) == 0 ) // If already loaded
+     return line;
+
+   const EdBlock* block= line->block;
+   size_t const size= check(block) ? block->size : 0;
+   size_t const before= block->rows;
+   char* text= allocate(size + 1);
+   if( size )
+     memcpy(text, block->text, size);
+   text[size]= '\0';
+   line->text= text;                // (In case the text is empty)
+   line->delim[0]= '\n';
+   line->delim[1]= '\0';
+
+   pub::List<EdLine> list;          // The lines following the placeholder
+   EdLine* L= line;                 // (The placeholder is the first line)
+   auto flags= decltype(line->flags)(line->flags & ~EdLine::F_LAZY);
+   size_t used= 0;
+   while( used < size ) {
+     if( L == nullptr ) {
+       L= new EdLine();
+       L->flags= flags;
+       list.fifo(L);
+     }
+
+     char* from= text + used;
+     char* nend= (char*)memchr(from, '\n', size - used);
+     L->text= from;
+     if( nend == nullptr ) {        // (The ending '\n' is missing)
+       L->delim[0]= L->delim[1]= '\0';
+       break;
+     }
+
+     *nend= '\0';                   // Replace with string delimiter
+     L->delim[0]= '\n';
+     L->delim[1]= '\0';
+     if( nend > from && nend[-1] == '\r' ) { // If DOS delimiter
+       L->delim[1]= '\r';
+       nend[-1]= '\0';
+     }
+     used= nend + 1 - text;         // Next line origin
+     L= nullptr;
+   }
+
+   line_list.load(line, list.get_head(), list.get_tail());
+   rows += block->rows;             // (Only changes if the file changed)
+   rows -= before;
+   if( HCDM || (opt_hcdm && VERBOSE > 1) )
+     traceh("EdFile(%p)::load(%p) %zd rows\n", this, line, block->rows);
+
+   return list.get_tail() ? list.get_tail() : line;
+}
+
+void
+   EdFile::load(                    // Load placeholder rows
+     EdLine*           head,        // From this line
+     EdLine*           tail)        // Upto this line
+{
+   for(EdLine* line= head; line; line= line->get_next()) {
+     bool last= (line == tail);
+     line= load(line);
+     if( last )
+       break;
+   }
+}
+
+void
+   EdFile::load_near(               // Load the rows near
+     EdLine*           line)        // This line
+{
+   EdLine* L= line;
+   for(size_t n= 0; L && n < EdList::BLOCK_ROWS; ++n) {
+     load(L);
+     L= L->get_next();
+   }
+
+   L= line->get_prev();
+   for(size_t n= 0; L && n < EdList::BLOCK_ROWS; ++n)
+     L= load(L)->get_prev();
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -417,30 +1213,33 @@ EdLine*                             // The last inserted line
    }
 
    // Parse the text into lines (Performance critical path)
+   pub::List<EdLine> list;          // The parsed lines, inserted together
    char* used= text;
    while( used < last ) {
      char* from= used;              // Starting character
-     line= insert(line, new EdLine(from));
+     EdLine* edLine= new EdLine(from);
+     list.fifo(edLine);
 
      char* nend= strchr(used, '\n'); // Get next line delimiter
      if( nend == nullptr ) {        // Missing '\n' delimiter
        size_t L= strlen(from);      // String length
        if( (from + L) >= last ) {
-         line->delim[0]= line->delim[1]= '\0';
+         edLine->delim[0]= edLine->delim[1]= '\0';
          put_message("Ending '\\n' missing");
          break;
        }
 
        nend= from + L;              // '\0' delimiter found
-       line->delim[0]= 0;
-       line->delim[1]= 1;
+       edLine->delim[0]= 0;
+       edLine->delim[1]= 1;
        while( ++nend < last ) {
          if( *nend ) break;         // If not a '\0' delimiter
-         if( ++line->delim[1] == 0 ) { // If repetition count overflow
-           line->delim[1]= 255;
-           line= insert(line, new EdLine(nend));
-           line->delim[0]= 0;
-           line->delim[1]= 1;
+         if( ++edLine->delim[1] == 0 ) { // If repetition count overflow
+           edLine->delim[1]= 255;
+           edLine= new EdLine(nend);
+           list.fifo(edLine);
+           edLine->delim[0]= 0;
+           edLine->delim[1]= 1;
          }
        }
        used= nend;
@@ -451,7 +1250,7 @@ EdLine*                             // The last inserted line
      // '\n' delimiter found
      *nend= '\0';                   // Replace with string delimiter
      used= nend + 1;                // Next line origin
-     line->delim[0]= '\n';
+     edLine->delim[0]= '\n';
      if( nend == from || *(nend-1) != '\r' ) { // If UNIX delimiter
        if( mode == M_UNIX || mode == M_MIX || mode == M_BIN ) continue;
        if( mode == M_NONE ) {
@@ -460,7 +1259,7 @@ EdLine*                             // The last inserted line
          mode= M_MIX;
        }
      } else {                       // IF DOS delimiter
-       line->delim[1]= '\r';
+       edLine->delim[1]= '\r';
        *(nend - 1)= '\0';
        if( mode == M_DOS || mode == M_MIX || mode == M_BIN ) continue;
        if( mode == M_NONE ) {
@@ -471,6 +1270,9 @@ EdLine*                             // The last inserted line
      }
    }
 
+   if( list.get_head() )
+     line= insert(line, list.get_head(), list.get_tail());
+
    return line;
 }
 
@@ -544,14 +1346,14 @@ void
 {
    line_list.remove(head, tail);
 
-   for(EdLine* line= head; line != tail; line= line->get_next()) {
+   for(EdLine* line= head; ; line= line->get_next()) {
      if( line == top_line )         // If removing top line
        top_line= head->get_prev()->get_next(); // Insure top_line is valid
 
-     if( line == nullptr ) throw "Invalid remove chain";
-     rows--;
+     rows -= EdList::get_rows(line);
+     if( line == tail )
+       break;
    }
-   rows--;                          // (Count the tail line)
    row_zero= get_row(top_line);     // Correct row_zero
 }
 
@@ -611,6 +1413,9 @@ void
    // Clear any existing mark
    editor::mark->undo();
 
+   // Every line's delimiter changes, so every line is loaded
+   load(line_list.get_head(), line_list.get_tail());
+
    // Create the REDO
    EdRedo* redo= new EdRedo();
    pub::List<EdLine> list;          // The replacement list
@@ -653,6 +1458,12 @@ void
 // Implementation notes-
 //       Caller responsible for damaged/protected checking
 //
+//       Unloaded blocks are written from the file mapping. The file is
+//       replaced using rename, so the mapping remains valid. If another
+//       program truncated the mapped file, the blocks that can't be read
+//       are omitted. (The file is then damaged, so it can only be written
+//       using another name.)
+//
 //----------------------------------------------------------------------------
 int                                 // Return code, 0 OK
    EdFile::write(                   // Write the file
@@ -669,6 +1480,14 @@ int                                 // Return code, 0 OK
          rc= 0;                     // No error
          break;
        }
+       if( line->flags & EdLine::F_LAZY ) { // If not loaded, copy the text
+         const EdBlock* block= line->block;
+         if( !check(block) )        // (If truncated, the text is lost)
+           continue;
+         if( fwrite(block->text, 1, block->size, F) != block->size )
+           break;                   // If write failure
+         continue;
+       }
        if( (line->flags & EdLine::F_PROT) == 0 ) {
          // Write line data
          if( line->text[0] != '\0' ) {
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,12 +16,14 @@
 //       Editor: File descriptor
 //
 // Last change date-
-//       2024/05/16
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef EDFILE_H_INCLUDED
 #define EDFILE_H_INCLUDED
 
+#include <stddef.h>                 // For ptrdiff_t
+#include <vector>                   // For std::vector
 #include <pub/List.h>               // For pub::List
 #include <pub/Signals.h>            // For namespace pub::signals
 
@@ -30,6 +32,190 @@
 #include "EdMess.h"                 // For EdMess
 #include "EdRedo.h"                 // For EdRedo
 
+//----------------------------------------------------------------------------
+//
+// Class-
+//       EdBlock
+//
+// Purpose-
+//       Editor File row block
+//
+// Implementation note-
+//       A block is a run of consecutive file rows. A loaded block contains
+//       EdLines. An unloaded block contains one F_LAZY placeholder EdLine,
+//       which owns the block, and the block's text is still in the file's
+//       (read-only) memory mapping.
+//
+//       Unloaded blocks are the pieces of a piece table. Line copies, cuts
+//       and pastes, and their REDO/UNDO entries, move or copy placeholders
+//       rather than loading their rows. Each unloaded block references its
+//       mapped EdPool.
+//
+//----------------------------------------------------------------------------
+class EdBlock {                     // Editor File row block
+public:
+size_t                 index= 0;    // The EdList::block index
+size_t                 rows= 0;     // The number of rows
+EdLine*                head= nullptr; // The first line, nullptr if removed
+
+// Unloaded block information
+const char*            text= nullptr; // The text, nullptr if loaded
+size_t                 size= 0;     // The text length
+EdPool*                pool= nullptr; // The mapped EdPool, nullptr if loaded
+
+   EdBlock( void ) = default;       // Constructor
+   ~EdBlock( void );                // Destructor (releases the pool)
+   EdBlock(const EdBlock&) = delete; // Disallowed copy constructor
+EdBlock& operator=(const EdBlock&) = delete; // Disallowed assignment operator
+}; // class EdBlock
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       EdList
+//
+// Purpose-
+//       Editor File line list
+//
+// Implementation note-
+//       The list is divided into row blocks, each containing about
+//       BLOCK_ROWS rows. A Fenwick (binary indexed) tree holds the block
+//       row counts, so get_line and get_row locate the block in O(log n)
+//       time and then walk at most 2 * BLOCK_ROWS lines. Each insert or
+//       remove updates the counts of the blocks it changes. Blocks are only
+//       added or deleted when a block becomes too large or empty, or when
+//       a placeholder line is inserted or removed.
+//
+//----------------------------------------------------------------------------
+class EdList : public pub::List<EdLine> { // Editor File line list
+public:
+typedef pub::List<EdLine> _Base;    // The base List type
+
+enum { BLOCK_ROWS= 1024 };          // The (nominal) rows per block
+
+protected:
+std::vector<EdBlock*>  block;       // The row blocks, in row order
+std::vector<size_t>    tree;        // The block row count (Fenwick) tree
+
+public:
+   EdList( void ) = default;        // Constructor
+   ~EdList( void );                 // Destructor
+
+//----------------------------------------------------------------------------
+// EdList::Accessor methods
+//----------------------------------------------------------------------------
+EdLine*                             // The line (or placeholder) containing row
+   get_line(                        // Get EdLine*
+     size_t            row) const;  // For this row number
+
+size_t                              // The (first) row number
+   get_row(                         // Get row number
+     const EdLine*     line) const; // For this line
+
+size_t                              // The number of rows
+   get_rows( void ) const           // Get number of rows
+{  return sum(block.size()); }
+
+static size_t                       // The number of rows
+   get_rows(                        // Get number of rows
+     const EdLine*     line);       // In this line or placeholder
+
+bool                                // TRUE if the line is in the list
+   is_on(                           // Is a line in the list?
+     const EdLine*     line) const; // This line or placeholder
+
+//----------------------------------------------------------------------------
+// EdList::Methods
+//----------------------------------------------------------------------------
+static EdLine*                      // The placeholder copy
+   copy(                            // Copy a placeholder line
+     const EdLine*     line);       // The placeholder to copy
+
+void
+   fifo(                            // Insert (FIFO order)
+     EdLine*           link)        // -> Link to insert
+{  _Base::fifo(link); inserted(link, link); }
+
+void
+   insert(                          // Insert at position,
+     EdLine*           after,       // -> Link to insert after
+     EdLine*           head,        // -> First Link to insert
+     EdLine*           tail)        // -> Final Link to insert
+{  _Base::insert(after, head, tail); inserted(head, tail); }
+
+void
+   insert(                          // Insert at position,
+     EdLine*           after,       // -> Link to insert after
+     EdLine*           link)        // -> The Link to insert
+{  _Base::insert(after, link); inserted(link, link); }
+
+void
+   lifo(                            // Insert (LIFO order)
+     EdLine*           link)        // -> Link to insert
+{  _Base::lifo(link); inserted(link, link); }
+
+void
+   load(                            // Replace placeholder rows
+     EdLine*           line,        // The placeholder, now the first line
+     EdLine*           head,        // The first following line, or nullptr
+     EdLine*           tail);       // The final following line
+
+void
+   remove(                          // Remove from list
+     EdLine*           head,        // -> First Link to remove
+     EdLine*           tail)        // -> Final Link to remove
+{  removed(head, tail); _Base::remove(head, tail); }
+
+void
+   remove(                          // Remove from list
+     EdLine*           link)        // -> The Link to remove
+{  removed(link, link); _Base::remove(link); }
+
+EdLine*                             // Removed EdLine*
+   remq( void )                     // Remove head link
+{
+   EdLine* link= get_head();
+   if( link )
+     remove(link, link);
+   return link;
+}
+
+EdLine*                             // -> The set of removed Links
+   reset( void );                   // Reset (empty) the List
+
+//----------------------------------------------------------------------------
+// EdList::Internal methods
+//----------------------------------------------------------------------------
+protected:
+void
+   add(                             // Add to the tree
+     size_t            index,       // For this block index
+     ptrdiff_t         rows);       // This (signed) row count
+
+void
+   inserted(                        // Update blocks after insert
+     EdLine*           head,        // First inserted line
+     EdLine*           tail);       // Final inserted line
+
+void
+   rebuild( void );                 // Rebuild the block index and tree
+
+void
+   removed(                         // Update blocks before remove
+     EdLine*           head,        // First line to remove
+     EdLine*           tail);       // Final line to remove
+
+void
+   split(                           // Split a block
+     EdBlock*          from,        // The block to split
+     size_t            keep,        // Keeping this many rows
+     EdLine*           line);       // The first remaining line
+
+size_t                              // The number of rows
+   sum(                             // Sum row counts
+     size_t            index) const; // Of blocks [0..index)
+}; // class EdList
+
 //----------------------------------------------------------------------------
 //
 // Class-
@@ -46,9 +232,10 @@ public:
 enum MODE { M_NONE, M_BIN, M_DOS, M_MIX, M_UNIX }; // The file mode
 
 pub::List<EdMess>      mess_list;   // The List of warning messages
-pub::List<EdLine>      line_list;   // The line list
+EdList                 line_list;   // The line list
 pub::List<EdRedo>      redo_list;   // The redo list
 pub::List<EdRedo>      undo_list;   // The undo list
+size_t                 undo_rows= 0; // The number of undo_list removed EdLines
 
 std::string            name;        // The fully qualified file name
 size_t                 rows= 0;     // The number of file rows
@@ -89,6 +276,10 @@ public:
 
 //----------------------------------------------------------------------------
 // EdFile::Accessor methods
+//
+// Implementation notes-
+//       get_line loads the row's block if it is not loaded.
+//
 //----------------------------------------------------------------------------
 public:
 char*
@@ -97,7 +288,7 @@ char*
 
 EdLine*                             // The EdLine*
    get_line(                        // Get EdLine*
-     size_t            row) const;  // For this row number
+     size_t            row);        // For this row number
 
 std::string
    get_name( void ) const           // Get the file name (Named interface)
@@ -158,12 +349,25 @@ void
 // Purpose-
 //       Load and insert file without redo/undo
 //
+// Implementation notes-
+//       insert_large memory maps the file (read-only) and divides it into
+//       row blocks using multiple threads. Each block is inserted as one
+//       F_LAZY placeholder line, loaded when it's needed. It returns nullptr
+//       if the file cannot be mapped or contains '\0' characters, and the
+//       caller then reads the file.
+//
 //----------------------------------------------------------------------------
 EdLine*                             // The last inserted line
    insert_file(                     // Insert file (Without redo/undo)
      const char*       name,        // The file name to insert
      EdLine*           line);       // Insert after this line
 
+EdLine*                             // The last inserted line, nullptr if none
+   insert_large(                    // Insert large file (Without redo/undo)
+     const char*       name,        // The file name to insert
+     EdLine*           line,        // Insert after this line
+     size_t            size);       // The file size
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -185,6 +389,57 @@ EdLine*                             // (Always line)
      EdLine*           line)        // This line
 {  return insert(after, line, line); }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdFile::check
+//
+// Purpose-
+//       Check an unloaded block's mapped file
+//
+// Implementation notes-
+//       If the file was changed or truncated by another program, the file
+//       is marked damaged. The block's text can't be used if it's truncated.
+//
+//----------------------------------------------------------------------------
+bool                                // TRUE if the block's text can be read
+   check(                           // Check an unloaded block's mapped file
+     const EdBlock*    block);      // The unloaded block
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdFile::load
+//       EdFile::load_near
+//
+// Purpose-
+//       Load a placeholder line's rows
+//       Load the rows near a line
+//
+// Implementation notes-
+//       load returns the last loaded line. The placeholder itself becomes
+//       the first loaded line, so pointers to it remain valid. (A line that
+//       is not a placeholder is returned unchanged.)
+//
+//       load(head, tail) loads each placeholder in the range head..tail.
+//
+//       load_near loads every placeholder within EdList::BLOCK_ROWS lines
+//       of the line, so that screen movement only finds loaded lines.
+//
+//----------------------------------------------------------------------------
+EdLine*                             // The last loaded line
+   load(                            // Load placeholder rows
+     EdLine*           line);       // The placeholder line
+
+void
+   load(                            // Load placeholder rows
+     EdLine*           head,        // From this line
+     EdLine*           tail);       // Upto this line
+
+void
+   load_near(                       // Load the rows near
+     EdLine*           line);       // This line
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -358,6 +613,22 @@ void
 void
    undo_delete( void );             // Delete the UNDO list
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdFile::undo_trim
+//
+// Purpose-
+//       Limit the UNDO list size
+//
+// Implementation notes-
+//       When the undo_list retains too many removed lines, the oldest UNDO
+//       entries are deleted and chglock is set. The newest entry is kept.
+//
+//----------------------------------------------------------------------------
+void
+   undo_trim( void );               // Limit the UNDO list size
+
 //----------------------------------------------------------------------------
 //
 // Method-
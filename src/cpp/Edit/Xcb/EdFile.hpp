@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       EdFile: Implement EdFile.h REDO/UNDO functions
 //
 // Last change date-
-//       2024/08/30
+//       2026/10/18
 //
 // Implementation notes-
 //       (Only) included by EdFile.cpp
@@ -230,7 +230,9 @@ static void
 //       Bringup debugging
 //
 // Implementation notes-
-//       For BRINGUP checking. NOT optimized.
+//       For BRINGUP checking. EdList::is_on checks whether a line is in the
+//       file in constant time, so a check is O(change) lines. It does not
+//       depend on the file's size.
 //
 //----------------------------------------------------------------------------
 static void
@@ -257,10 +259,8 @@ static void
      EdFile*           file,        // This file for
      EdRedo*           redo)        // This redo
 {
-   for(EdLine* L= file->line_list.get_head(); L; L= L->get_next()) {
-     if( L == test )
-       return;
-   }
+   if( file->line_list.is_on(test) )
+     return;
 
    debugf("%4d EdFile(%p)->assert_line(%p) FAILED\n", __LINE__, file, test);
    debug_redo(__LINE__, redo);
@@ -272,11 +272,9 @@ static void
      EdFile*           file,        // This file for
      EdRedo*           redo)        // This redo
 {
-   for(EdLine* line= file->line_list.get_head(); line; line= line->get_next() ) {
-     if( line == test ) {
-       debugf("%4d EdFile(%p)->assert_miss(%p) FAILED\n", __LINE__, file, test);
-       debug_redo(__LINE__, redo);
-     }
+   if( file->line_list.is_on(test) ) {
+     debugf("%4d EdFile(%p)->assert_miss(%p) FAILED\n", __LINE__, file, test);
+     debug_redo(__LINE__, redo);
    }
 }
 
@@ -457,6 +455,7 @@ void
    editor::unit->activate(line);
    editor::unit->draw();
    undo_list.lifo(redo);            // Move REDO to UNDO list
+   undo_rows += redo->remove_rows;
    if( redo->head_insert )          // If lines inserted
      chg_mode(redo->head_insert, redo->tail_insert);
 
@@ -504,6 +503,7 @@ void
    editor::unit->activate(line);
    editor::unit->draw();
    redo_list.lifo(undo);            // Move UNDO to REDO list
+   undo_rows -= undo->remove_rows;
    if( undo->head_remove )          // If lines removed
      chg_mode(undo->head_remove, undo->tail_remove);
 
@@ -558,8 +558,18 @@ void
    assert_undo(redo, this);         // (Only when USE_REDO_DIAGNOSTICS == true)
    redo_delete();                   // Delete the current REDO list
 
+   redo->remove_rows= 0;            // Count the removed lines
+   for(EdLine* line= redo->head_remove; line; line= line->get_next()) {
+     redo->remove_rows++;
+     if( line == redo->tail_remove )
+       break;
+   }
+
    undo_list.lifo(redo);            // Insert the REDO onto the UNDO list
+   undo_rows += redo->remove_rows;
    changed= true;
+   if( undo_rows > UNDO_ROWS )      // If too many lines retained
+     undo_trim();
 
    if( USE_REDO_DIAGNOSTICS )
      Config::check("redo_insert");
@@ -590,4 +600,46 @@ void
 
      delete undo;
    }
+
+   undo_rows= 0;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdFile::undo_trim
+//
+// Purpose-
+//       Limit the UNDO list size, deleting the oldest UNDO entries
+//
+// Implementation notes-
+//       The oldest UNDO entry is the undo_list tail. Its removed lines are
+//       referenced only by that entry: newer entries reference lines that
+//       were in the file after it completed. Its inserted lines are either
+//       in the file or owned by a newer entry, so they are not deleted.
+//
+//----------------------------------------------------------------------------
+void
+   EdFile::undo_trim( void )        // Limit the UNDO list size
+{
+   while( undo_rows > UNDO_ROWS ) {
+     EdRedo* undo= undo_list.get_tail();
+     if( undo == undo_list.get_head() ) // (Always keep the newest entry)
+       break;
+
+     undo_list.remove(undo, undo);
+     EdLine* line= undo->head_remove;
+     while( line ) {
+       EdLine* next= line->get_next();
+       delete line;
+
+       if( line == undo->tail_remove )
+         break;
+       line= next;
+     }
+
+     undo_rows -= undo->remove_rows;
+     delete undo;
+     chglock= true;                 // Changed, but undo is not available
+   }
 }
@@ -0,0 +1,466 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (C) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       EdFind.cpp
+//
+// Purpose-
+//       Implement EdFind.h
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                 // For memrchr
+#endif
+#include <string.h>                 // For memchr, memrchr, strlen
+#include <thread>                   // For std::thread::hardware_concurrency
+#include <vector>                   // For std::vector
+
+#include <pub/Debug.h>              // For namespace pub::debugging
+#include <pub/Worker.h>             // For pub::WorkerPool
+
+#include "Config.h"                 // For namespace config
+#include "Editor.h"                 // For namespace editor
+#include "EdFile.h"                 // For EdFile
+#include "EdFind.h"                 // For EdFind, EdSearch - implemented
+#include "EdLine.h"                 // For EdLine
+#include "EdPool.h"                 // For EdPool
+#include "EdUnit.h"                 // For EdUnit
+
+using namespace config;             // For config::opt_*
+using namespace pub::debugging;     // For debugging
+
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+enum // Compilation controls
+{  HCDM= false                      // Hard Core Debug Mode?
+,  VERBOSE= 0                       // Verbosity, higher is more verbose
+
+,  MIN_SKIP= 4                      // Minimum length using skip tables
+,  MIN_TEXTS= 4096                  // Minimum texts per EdSearch thread
+,  TEXT_BATCH= 256                  // The number of texts per EdSearch batch
+}; // Compilation controls
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdFind::EdFind
+//
+// Purpose-
+//       Constructor
+//
+//----------------------------------------------------------------------------
+   EdFind::EdFind(                  // Constructor
+     const std::string&string,      // The locate string
+     bool              exact)       // Case sensitive search?
+:  find(string), mixed(!exact)
+{  if( HCDM || (opt_hcdm && VERBOSE > 0) )
+     traceh("EdFind(%p)::EdFind(%s,%d)\n", this, string.c_str(), exact);
+
+   for(unsigned c= 0; c<256; ++c)
+     fold[c]= (unsigned char)c;
+   if( mixed ) {
+     for(unsigned c= 'A'; c<='Z'; ++c)
+       fold[c]= (unsigned char)(c - 'A' + 'a');
+   }
+
+   size_t m= find.size();
+   for(size_t j= 0; j<m; ++j)
+     find[j]= (char)fold[(unsigned char)find[j]];
+
+   // Forward: the skip distance from the window's last character
+   for(unsigned c= 0; c<256; ++c)
+     next[c]= prev[c]= m;
+   for(size_t j= 0; j+1 < m; ++j)
+     next[(unsigned char)find[j]]= m - 1 - j;
+
+   // Reverse: the skip distance from the window's first character
+   for(size_t j= m; j > 1; --j)
+     prev[(unsigned char)find[j-1]]= j - 1;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdFind::count
+//
+// Purpose-
+//       Count the non-overlapping matches in text
+//
+// Implementation notes-
+//       A match never contains '\n', so a match that begins after the end
+//       of the last matching line begins a new matching line.
+//
+//----------------------------------------------------------------------------
+void
+   EdFind::count(                   // Count matches
+     const char*       text,        // In this text
+     size_t            length,      // Of this length
+     Count&            count) const // (Accumulated) match count
+{
+   size_t const m= find.size();
+   if( m == 0 )
+     return;
+
+   const char* const last= text + length;
+   const char* line_end= text;      // The end of the last matching line
+   while( text < last ) {
+     const char* M= next_match(text, size_t(last - text));
+     if( M == nullptr )
+       break;
+
+     ++count.matches;
+     if( M >= line_end ) {          // If a new matching line
+       ++count.lines;
+       line_end= (const char*)memchr(M, '\n', size_t(last - M));
+       if( line_end == nullptr )
+         line_end= last;
+     }
+     text= M + m;
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdFind::find_next
+//       EdFind::find_prev
+//
+// Purpose-
+//       Locate the first match in text
+//       Locate the last match in text
+//
+//----------------------------------------------------------------------------
+const char*                         // The first match, nullptr if none
+   EdFind::find_next(               // Locate first match
+     const char*       text) const  // In this ('\0' delimited) text
+{  return next_match(text, strlen(text)); }
+
+const char*                         // The last match, nullptr if none
+   EdFind::find_prev(               // Locate last match
+     const char*       text) const  // In this ('\0' delimited) text
+{  return prev_match(text, strlen(text)); }
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdFind::next_match
+//
+// Purpose-
+//       Locate the first match in text
+//
+// Implementation notes-
+//       Short strings use memchr to locate candidates, checking the other
+//       character case separately for mixed searches. Longer strings use
+//       the Boyer-Moore-Horspool skip table.
+//
+//----------------------------------------------------------------------------
+const char*                         // The first match, nullptr if none
+   EdFind::next_match(              // Locate first match
+     const char*       text,        // In this text
+     size_t            length) const // Of this length
+{
+   size_t const m= find.size();
+   if( m == 0 )
+     return text;
+   if( length < m )
+     return nullptr;
+
+   const unsigned char* T= (const unsigned char*)text;
+   const unsigned char* P= (const unsigned char*)find.c_str();
+   size_t const last= length - m;   // The last window origin
+
+   if( m < MIN_SKIP ) {             // Short string: locate first character
+     int C0= P[0];                  // The (folded) first character
+     int C1= C0;                    // The other case first character
+     if( mixed && C0 >= 'a' && C0 <= 'z' )
+       C1= C0 - 'a' + 'A';
+
+     size_t i= 0;
+     while( i <= last ) {
+       const void* M= memchr(T + i, C0, last + 1 - i);
+       size_t x= M ? (const unsigned char*)M - T : last + 1;
+       if( C1 != C0 ) {             // Check the other case, up to x
+         const void* N= memchr(T + i, C1, x - i);
+         if( N )
+           x= (const unsigned char*)N - T;
+       }
+       if( x > last )
+         break;
+
+       size_t j= 1;
+       while( j < m && fold[T[x+j]] == P[j] )
+         ++j;
+       if( j == m )
+         return text + x;
+       i= x + 1;
+     }
+
+     return nullptr;
+   }
+
+   unsigned char const P_last= P[m-1];
+   size_t i= 0;
+   while( i <= last ) {             // Boyer-Moore-Horspool
+     unsigned char c= fold[T[i+m-1]];
+     if( c == P_last ) {
+       size_t j= 0;
+       while( j < m - 1 && fold[T[i+j]] == P[j] )
+         ++j;
+       if( j == m - 1 )
+         return text + i;
+     }
+     i += next[c];
+   }
+
+   return nullptr;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdFind::prev_match
+//
+// Purpose-
+//       Locate the last match in text
+//
+// Implementation notes-
+//       The mirror image of next_match, scanning right to left. Short exact
+//       strings use memrchr.
+//
+//----------------------------------------------------------------------------
+const char*                         // The last match, nullptr if none
+   EdFind::prev_match(              // Locate last match
+     const char*       text,        // In this text
+     size_t            length) const // Of this length
+{
+   size_t const m= find.size();
+   if( m == 0 )
+     return text + length;
+   if( length < m )
+     return nullptr;
+
+   const unsigned char* T= (const unsigned char*)text;
+   const unsigned char* P= (const unsigned char*)find.c_str();
+
+   if( m < MIN_SKIP ) {             // Short string: locate first character
+     int C0= P[0];                  // The (folded) first character
+     int C1= C0;                    // The other case first character
+     if( mixed && C0 >= 'a' && C0 <= 'z' )
+       C1= C0 - 'a' + 'A';
+
+     size_t n= length - m + 1;      // The number of window origins left
+     while( n > 0 ) {
+       size_t x;                    // The candidate origin
+       if( C1 == C0 ) {
+         const void* M= memrchr(T, C0, n);
+         if( M == nullptr )
+           break;
+         x= (const unsigned char*)M - T;
+       } else {                     // (Check both cases)
+         x= n;
+         while( x > 0 && fold[T[x-1]] != C0 )
+           --x;
+         if( x == 0 )
+           break;
+         --x;
+       }
+
+       size_t j= 1;
+       while( j < m && fold[T[x+j]] == P[j] )
+         ++j;
+       if( j == m )
+         return text + x;
+       n= x;
+     }
+
+     return nullptr;
+   }
+
+   unsigned char const P_first= P[0];
+   size_t i= length - m;            // The window origin
+   for(;;) {                        // Boyer-Moore-Horspool, right to left
+     unsigned char c= fold[T[i]];
+     if( c == P_first ) {
+       size_t j= 1;
+       while( j < m && fold[T[i+j]] == P[j] )
+         ++j;
+       if( j == m )
+         return text + i;
+     }
+
+     size_t skip= prev[c];
+     if( i < skip )
+       break;
+     i -= skip;
+   }
+
+   return nullptr;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdSearch::EdSearch
+//       EdSearch::~EdSearch
+//
+// Purpose-
+//       Constructor, taking the file text snapshot
+//       Destructor
+//
+//----------------------------------------------------------------------------
+   EdSearch::EdSearch(              // Constructor
+     const EdFile*     file,        // Search this file
+     const std::string&string,      // For this locate string
+     bool              exact)       // Case sensitive search?
+:  file(file), find(string, exact)
+{  if( HCDM || (opt_hcdm && VERBOSE > 0) )
+     traceh("EdSearch(%p)::EdSearch(%p,%s,%d)\n", this, file
+           , string.c_str(), exact);
+
+   text.reserve(file->line_list.get_rows() / 8);
+   for(EdLine* line= file->line_list.get_head(); line; line= line->get_next()) {
+     if( line->flags & EdLine::F_LAZY ) { // (Unloaded blocks aren't protected)
+       const EdBlock* block= line->block;
+       text.push_back({block->text, block->size});
+       if( pool.empty() || pool.back() != block->pool ) { // (Keep it mapped)
+         block->pool->reference();
+         pool.push_back(block->pool);
+       }
+     } else if( (line->flags & EdLine::F_PROT) == 0 )
+       text.push_back({line->text, 0}); // (The worker gets its length)
+   }
+}
+
+   EdSearch::~EdSearch( void )      // Destructor
+{  if( HCDM || (opt_hcdm && VERBOSE > 0) )
+     traceh("EdSearch(%p)::~EdSearch\n", this);
+
+   stop();
+   for(size_t i= 0; i<pool.size(); ++i)
+     editor::release(pool[i]);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdSearch::start
+//       EdSearch::stop
+//
+// Purpose-
+//       Start the search
+//       Stop (and wait for) the search
+//
+//----------------------------------------------------------------------------
+void
+   EdSearch::start( void )          // Start the search
+{
+   if( started )                    // (Only start once)
+     return;
+
+   started= true;
+   pub::WorkerPool::work(this);
+}
+
+void
+   EdSearch::stop( void )           // Stop (and wait for) the search
+{
+   if( !started )
+     return;
+
+   cancel= true;
+   ended.wait();
+   started= false;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdSearch::search
+//
+// Purpose-
+//       Search text snapshot batches until none remain
+//
+// Implementation notes-
+//       The mapped files are checked before each batch. If one was
+//       truncated, its text can't be read and the search ends early.
+//
+//----------------------------------------------------------------------------
+void
+   EdSearch::search(                // Search text snapshot batches
+     EdFind::Count&    count)       // (Accumulated) match count
+{
+   size_t const size= text.size();
+   for(;;) {
+     if( cancel || truncated )
+       break;
+
+     for(size_t i= 0; i<pool.size(); ++i) {
+       if( pool[i]->check() == EdPool::CHECK_TRUNCATED )
+         truncated= true;
+     }
+     if( truncated )
+       break;
+
+     size_t index= next.fetch_add(TEXT_BATCH);
+     if( index >= size )
+       break;
+
+     size_t const last= std::min(index + TEXT_BATCH, size);
+     for(; index < last; ++index) {
+       const Text& T= text[index];
+       size_t length= T.size ? T.size : strlen(T.text);
+       find.count(T.text, length, count);
+     }
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdSearch::work
+//
+// Purpose-
+//       Run the search (on a pub::WorkerPool thread)
+//
+// Implementation notes-
+//       The search is divided between pub::WorkerPool threads, with this
+//       thread acting as the first worker.
+//
+//----------------------------------------------------------------------------
+void
+   EdSearch::work( void )           // Run the search
+{
+   size_t N= std::thread::hardware_concurrency();
+   if( N > text.size() / MIN_TEXTS )
+     N= text.size() / MIN_TEXTS;
+   if( N < 1 )
+     N= 1;
+
+   std::vector<EdFind::Count> count(N); // The match count, by task
+   pub::WorkerPool::parallel(unsigned(N), N,
+     [this, &count](size_t t) { search(count[t]); });
+
+   if( !cancel ) {
+     for(size_t t= 0; t<N; ++t) {
+       result.matches += count[t].matches;
+       result.lines += count[t].lines;
+     }
+
+     done= true;
+     editor::unit->post_search();   // (Calls editor::search_done)
+   }
+
+   ended.post();                    // (This EdSearch may now be deleted)
+}
@@ -0,0 +1,237 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (C) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       EdFind.h
+//
+// Purpose-
+//       Editor: Locate string search engine
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       An EdFind compiles a locate string once, then searches any number of
+//       lines. Mixed (case insensitive) searches use the same ASCII folding
+//       as strcasestr: only 'A'..'Z' are folded.
+//
+//       The first string character is located using memchr, which is
+//       vectorized. Longer strings use Boyer-Moore-Horspool skipping, in
+//       either direction, so a reverse search finds the last match in one
+//       right to left pass.
+//
+//       An EdSearch counts all matches in a file snapshot, in the background,
+//       using pub::WorkerPool threads.
+//
+//----------------------------------------------------------------------------
+#ifndef EDFIND_H_INCLUDED
+#define EDFIND_H_INCLUDED
+
+#include <atomic>                   // For std::atomic
+#include <string>                   // For std::string
+#include <vector>                   // For std::vector
+
+#include <pub/Semaphore.h>          // For pub::Semaphore
+#include <pub/Worker.h>             // For pub::Worker
+
+class EdFile;                       // (Forward reference)
+class EdPool;                       // (Forward reference)
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       EdFind
+//
+// Purpose-
+//       Editor locate string search engine
+//
+//----------------------------------------------------------------------------
+class EdFind {                      // Editor locate string search engine
+//----------------------------------------------------------------------------
+// EdFind::Attributes
+public:
+struct Count {                      // A match count
+size_t                 matches= 0;  // The number of matches
+size_t                 lines= 0;    // The number of matching lines
+}; // struct Count
+
+protected:
+std::string            find;        // The (folded) locate string
+bool                   mixed;       // Case insensitive search?
+unsigned char          fold[256];   // Character folding table
+size_t                 next[256];   // Forward skip table
+size_t                 prev[256];   // Reverse skip table
+
+//----------------------------------------------------------------------------
+// EdFind::Constructor/Destructor
+//----------------------------------------------------------------------------
+public:
+   EdFind(                          // Constructor
+     const std::string&string,      // The locate string
+     bool              exact);      // Case sensitive search?
+
+   ~EdFind( void ) = default;       // Destructor
+
+//----------------------------------------------------------------------------
+// EdFind::Accessor methods
+//----------------------------------------------------------------------------
+size_t                              // The locate string length
+   get_length( void ) const         // Get locate string length
+{  return find.size(); }
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdFind::count
+//
+// Purpose-
+//       Count the non-overlapping matches in text
+//
+// Implementation notes-
+//       The text may contain multiple '\n' delimited lines. The result is
+//       added to the count.
+//
+//----------------------------------------------------------------------------
+void
+   count(                           // Count matches
+     const char*       text,        // In this text
+     size_t            length,      // Of this length
+     Count&            count) const; // (Accumulated) match count
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdFind::find_next
+//       EdFind::find_prev
+//
+// Purpose-
+//       Locate the first match in text
+//       Locate the last match in text
+//
+// Implementation notes-
+//       A locate string can't contain '\n', so a match in a block of text
+//       is always contained within one of the block's lines.
+//
+//----------------------------------------------------------------------------
+const char*                         // The first match, nullptr if none
+   find_next(                       // Locate first match
+     const char*       text) const; // In this ('\0' delimited) text
+
+const char*                         // The last match, nullptr if none
+   find_prev(                       // Locate last match
+     const char*       text) const; // In this ('\0' delimited) text
+
+const char*                         // The first match, nullptr if none
+   find_next(                       // Locate first match
+     const char*       text,        // In this text
+     size_t            length) const // Of this length
+{  return next_match(text, length); }
+
+const char*                         // The last match, nullptr if none
+   find_prev(                       // Locate last match
+     const char*       text,        // In this text
+     size_t            length) const // Of this length
+{  return prev_match(text, length); }
+
+//----------------------------------------------------------------------------
+// EdFind::Internal methods
+//----------------------------------------------------------------------------
+protected:
+const char*                         // The first match, nullptr if none
+   next_match(                      // Locate first match
+     const char*       text,        // In this text
+     size_t            length) const; // Of this length
+
+const char*                         // The last match, nullptr if none
+   prev_match(                      // Locate last match
+     const char*       text,        // In this text
+     size_t            length) const; // Of this length
+}; // class EdFind
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       EdSearch
+//
+// Purpose-
+//       Count all locate string matches in the background
+//
+// Implementation notes-
+//       The constructor takes a snapshot of the file's (immutable) line
+//       and unloaded block text, so the file may change while the search
+//       runs. Protected lines are not included. The search references the
+//       snapshot's mapped EdPools, so they remain mapped until it's deleted.
+//
+//       The search runs on pub::WorkerPool threads. When it completes, it
+//       calls editor::unit->post_search, which then calls editor::search_done
+//       from the event loop. The EdSearch may then be deleted.
+//
+//----------------------------------------------------------------------------
+class EdSearch : public pub::Worker { // Background match counter
+//----------------------------------------------------------------------------
+// EdSearch::Attributes
+public:
+struct Text {                       // A searchable text snapshot
+const char*            text;        // The text
+size_t                 size;        // The text length, 0 if '\0' delimited
+}; // struct Text
+
+const EdFile*          file;        // The searched file
+EdFind::Count          result;      // The result, valid when is_done()
+
+protected:
+EdFind                 find;        // The search engine
+std::vector<Text>      text;        // The file text snapshot
+std::vector<EdPool*>   pool;        // The snapshot's mapped EdPools
+std::atomic<size_t>    next= 0;     // The next text index to search
+std::atomic_bool       cancel= false; // Stop the search?
+std::atomic_bool       done= false; // Has the search completed?
+std::atomic_bool       truncated= false; // Was a mapped file truncated?
+bool                   started= false; // Has the search started?
+pub::Semaphore         ended;       // Posted when the search has ended
+
+//----------------------------------------------------------------------------
+// EdSearch::Constructor/Destructor
+//----------------------------------------------------------------------------
+public:
+   EdSearch(                        // Constructor
+     const EdFile*     file,        // Search this file
+     const std::string&string,      // For this locate string
+     bool              exact);      // Case sensitive search?
+
+virtual
+   ~EdSearch( void );               // Destructor (stops the search)
+
+//----------------------------------------------------------------------------
+// EdSearch::Methods
+//----------------------------------------------------------------------------
+bool                                // TRUE if the search completed
+   is_done( void ) const            // Has the search completed?
+{  return done; }
+
+bool                                // TRUE if the result is incomplete
+   is_truncated( void ) const       // Was a mapped file truncated?
+{  return truncated; }
+
+void
+   start( void );                   // Start the search
+
+void
+   stop( void );                    // Stop (and wait for) the search
+
+virtual void
+   work( void );                    // (pub::Worker) Run the search
+
+void
+   search(                          // Search text snapshot batches
+     EdFind::Count&    count);      // (Accumulated) match count
+}; // class EdSearch
+#endif // EDFIND_H_INCLUDED
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Implement EdInps.h: Terminal keyboard and mouse handlers.
 //
 // Last change date-
-//       2024/05/24
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <string>                   // For std::string
@@ -414,15 +414,45 @@ void
          , head, tail, col_size, row_size, row_used);
    debugf("..motion(%d,%d,%d,%d)\n", motion.state, motion.time
          , motion.x, motion.y);
-   debugf("..gc_font(%u) gc_flip(%u) gc_mark(%u)\n", gc_font, gc_flip, gc_mark);
+   debugf("..gc_font(%u) gc_flip(%u) gc_mark(%u) gc_find(%u)\n"
+         , gc_font, gc_flip, gc_mark, gc_find);
    debugf("..gc_chg(%u) gc_msg(%u) gc_sts(%u)\n"
          , gc_chg, gc_msg, gc_sts);
-   debugf("..protocol(%u) wm_close(%u)\n", protocol, wm_close);
+   debugf("..protocol(%u) wm_close(%u) search_post(%u)\n"
+         , protocol, wm_close, search_post);
    Window::debug(info);
    debugf("\n..font:\n");
    font->debug(info);
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdInps::post_search
+//
+// Purpose-
+//       Post background search completion
+//
+// Implementation notes-
+//       This runs on a pub::WorkerPool thread, so it can't use the (single
+//       thread) enqueue/noqueue request checking. XCB requests themselves
+//       are thread-safe.
+//
+//----------------------------------------------------------------------------
+void
+   EdInps::post_search( void )      // Post background search completion
+{  if( opt_hcdm ) debugh("EdInps(%p)::post_search\n", this);
+
+   xcb_client_message_event_t E= {};
+   E.response_type= XCB_CLIENT_MESSAGE;
+   E.format= 32;
+   E.window= widget_id;
+   E.type= search_post;
+   xcb_send_event(c, false, widget_id, XCB_EVENT_MASK_NO_EVENT
+                 , (const char*)&E);
+   xcb_flush(c);
+}
+
 //----------------------------------------------------------------------------
 //
 // Pseudo-thread methods-
@@ -452,6 +482,7 @@ void
    gc_font= font->makeGC(fg, bg);   // (The default)
    gc_flip= font->makeGC(bg, fg);   // (Inverted)
    gc_mark= font->makeGC(mark_fg,    mark_bg);
+   gc_find= font->makeGC(find_fg,    find_bg);
    bg_chg=  font->makeGC(change_bg,  change_bg);
    bg_sts=  font->makeGC(status_bg,  status_bg);
    gc_chg=  font->makeGC(change_fg,  change_bg);
@@ -613,6 +644,8 @@ void
 
    if( E->type == protocol && E->data.data32[0] == wm_close )
      stop();                        // Unconditional terminate
+   else if( E->type == search_post )
+     editor::search_done();         // Background search complete
 }
 
 void
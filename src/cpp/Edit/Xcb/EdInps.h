@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Terminal input services.
 //
 // Last change date-
-//       2024/05/06
+//       2026/10/18
 //
 // Implementation notes-
 //       See EdOuts.h for terminal output services.
@@ -86,6 +86,7 @@ Motion                 motion= {CS_VISIBLE, 0, 0, 0}; // System motion controls
 GC_t                   gc_font= 0;  // Graphic Context: Standard line
 GC_t                   gc_flip= 0;  // GC: Cursor character
 GC_t                   gc_mark= 0;  // GC: Marked line or block
+GC_t                   gc_find= 0;  // GC: Highlighted locate string
 GC_t                   bg_chg= 0;   // GC: TOP: BG: File changed
 GC_t                   bg_sts= 0;   // GC: TOP: BG: File unchanged
 GC_t                   gc_chg= 0;   // GC: TOP: File changed
@@ -99,6 +100,7 @@ GC_t                   pcsrGC= 0;   // GC: Protected cursor character
 // XCB atoms
 xcb_atom_t             protocol= 0; // WM_PROTOCOLS atom
 xcb_atom_t             wm_close= 0; // WM_CLOSE atom
+xcb_atom_t             search_post= 0; // EDIT_SEARCH_DONE atom
 
 //----------------------------------------------------------------------------
 //
@@ -264,6 +266,18 @@ virtual void
    flush( void )                    // Complete enqueued I/O operations
 {  Pixmap::flush(); }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdInps::post_search
+//
+// Purpose-
+//       Post background search completion
+//
+//----------------------------------------------------------------------------
+virtual void
+   post_search( void );             // Post background search completion
+
 //----------------------------------------------------------------------------
 //
 // Pseudo-thread methods-
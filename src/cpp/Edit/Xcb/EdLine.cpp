@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Implement EdLine.h
 //
 // Last change date-
-//       2024/08/28
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <stdio.h>                  // For printf, fopen, fclose, ...
@@ -29,6 +29,7 @@
 #include <pub/List.h>               // For pub::List
 
 #include "Config.h"                 // For namespace config
+#include "EdFile.h"                 // For EdBlock
 #include "EdLine.h"                 // For EdLine - implemented
 
 using namespace config;             // For config::opt_*
@@ -79,6 +80,9 @@ enum // Compilation controls
 
    Trace::trace(".DEL", "line", this);
 
+   if( flags & F_LAZY )             // If this is a placeholder line
+     delete block;                  // It owns its (unloaded) block
+
    if( USE_OBJECT_COUNT )
      --object_count;
 }
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Line descriptor
 //
 // Last change date-
-//       2024/08/30
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef EDLINE_H_INCLUDED
@@ -26,6 +26,8 @@
 
 #include "Editor.h"                 // For Editor
 
+class EdBlock;                      // (Forward reference)
+
 //----------------------------------------------------------------------------
 //
 // Class-
@@ -37,6 +39,11 @@
 // Implementation note-
 //       Lines are allocated and deleted, but text is never deleted
 //
+//       An F_LAZY line is the placeholder for all the rows of an unloaded
+//       EdBlock. Its text is empty and it owns its EdBlock. EdFile::load
+//       replaces it with the block's lines, the placeholder becoming the
+//       first of these lines.
+//
 //----------------------------------------------------------------------------
 class EdLine : public pub::List<EdLine>::Link { // Editor Line descriptor
 //----------------------------------------------------------------------------
@@ -50,6 +57,7 @@ enum FLAGS                          // Control flags
 ,  F_MARK= 0x0001                   // Line is marked (selected)
 ,  F_PROT= 0x0002                   // Line is read/only
 ,  F_HIDE= 0x0004                   // Line is hidden
+,  F_LAZY= 0x0008                   // Line is an unloaded block placeholder
 ,  F_AUTO= 0x0100                   // Line is in automatic (stack) storage
 };
 
@@ -57,6 +65,8 @@ unsigned char          delim[2]= {'\0', 0}; // Delimiter (NONE default)
 //   For [0]= '\n', [1]= either '\r' or '\0' for DOS or Unix format.
 //   For [0]= '\0', [1]= repetition count. {'\0',0}= NO delimiter
 
+EdBlock*               block= nullptr; // The containing EdList row block
+
 // Static attributes (For debugging)
 static size_t          object_count; // Number of allocated lines
 
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Implement EdMark.h
 //
 // Last change date-
-//       2024/08/30
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <string>                   // For std::string
@@ -168,6 +168,9 @@ static void
 // Purpose-
 //       Create a Copy
 //
+// Implementation notes-
+//       Placeholder lines are copied as placeholders, sharing their text.
+//
 //----------------------------------------------------------------------------
 EdMark::Copy                        // The resultant Copy
    EdMark::Copy::create(            // Copy line sequence
@@ -178,9 +181,13 @@ EdMark::Copy                        // The resultant Copy
    pub::List<EdLine> list;
 
    for(EdLine* line= head; line; line= line->get_next() ) {
-     EdLine* edLine= new EdLine(line->text);
+     EdLine* edLine= nullptr;
+     if( line->flags & EdLine::F_LAZY )
+       edLine= EdList::copy(line);
+     else
+       edLine= new EdLine(line->text);
      list.fifo(edLine);             // (For list structure)
-     copy.rows++;
+     copy.rows += EdList::get_rows(line);
      if( line == tail )
        break;
    }
@@ -425,6 +432,7 @@ const char*                         // Error message, nullptr expected
    if( edFile->mode == EdFile::M_DOS )
      delim[1]= '\r';
 
+   edFile->load(mark_head, mark_tail); // (Formatting uses the lines' text)
    EdLine* cursor= edFile->csr_line;
    EdLine* prev= mark_head->get_prev();
    EdRedo* redo= new EdRedo();
@@ -630,6 +638,8 @@ const char*                         // Error message, nullptr expected
      undo();                         // (Silently) undo the mark
 
    if( column >= 0 ) {               // If block mark
+     if( mark_file )                 // (Block marks use the lines' text)
+       edFile->load(mark_head, mark_tail);
      if( mark_col < 0 ) {            // If no block mark yet
        mark_col= mark_lh= mark_rh= column;
      } else if( column > mark_col ) {
@@ -673,6 +683,15 @@ const char*                         // Error message, nullptr expected
      return nullptr;
    }
 
+   // Block marks load the rows between the line and the mark. Line marks
+   // include (and mark) placeholder lines without loading them.
+   if( mark_col >= 0 ) {
+     if( edFile->get_row(edLine) < edFile->get_row(mark_head) )
+       edFile->load(edLine, mark_head);
+     else
+       edFile->load(mark_tail, edLine);
+   }
+
    // Expand the mark (Consistency check: do not mark protected lines)
    EdLine* line= edLine;
    while( line && line != mark_head ) { // Locate downward
@@ -734,6 +753,8 @@ const char*                         // Error message, nullptr expected
    if( copy_col >= 0 ) {            // Validate block copy (Must fit in file)
      EdLine* line= edLine;          // The first copy into line
      for(size_t i= 0; i<copy_rows; i++) {
+       if( line && line->flags & EdLine::F_LAZY )
+         edFile->load(line);
        if( line == nullptr || line->flags & EdLine::F_PROT )
          return "Protected paste";
        line= line->get_next();
@@ -750,8 +771,10 @@ const char*                         // Error message, nullptr expected
    if( edFile->mode == EdFile::M_DOS )
      delim[1]= '\r';
    for(EdLine* line= copy.head; line; line= line->get_next()) {
-     line->delim[0]= delim[0];
-     line->delim[1]= delim[1];
+     if( (line->flags & EdLine::F_LAZY) == 0 ) { // (Placeholder rows keep
+       line->delim[0]= delim[0];    // their delimiters when loaded)
+       line->delim[1]= delim[1];
+     }
      line->flags |= EdLine::F_MARK;
    }
 
@@ -918,6 +941,8 @@ const char*                         // Error message, nullptr expected
      // Verify there is room in target for paste
      EdLine* line= edLine;          // The first copy into line
      for(EdLine* from= mark_head; from; from= from->get_next()) {
+       if( line && line->flags & EdLine::F_LAZY )
+         editor::file->load(line);
        if( line == nullptr || line->flags & EdLine::F_PROT )
          return "Protected paste";
        if( from == mark_tail )
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Implement EdOuts.h: Terminal output services
 //
 // Last change date-
-//       2024/08/30
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <string>                   // For std::string
@@ -40,6 +40,7 @@
 #include "Editor.h"                 // For namespace editor
 #include "EdData.h"                 // For EdData
 #include "EdFile.h"                 // For EdFile
+#include "EdFind.h"                 // For EdFind
 #include "EdHist.h"                 // For EdHist
 #include "EdInps.h"                 // For EdInps - base class
 #include "EdMark.h"                 // For EdMark
@@ -213,6 +214,7 @@ void
    // Set up WM_DELETE_WINDOW protocol handler
    protocol= name_to_atom("WM_PROTOCOLS", true);
    wm_close= name_to_atom("WM_DELETE_WINDOW");
+   search_post= name_to_atom("EDIT_SEARCH_DONE"); // (EdInps::post_search)
    ENQUEUE("xcb_change_property", xcb_change_property_checked
           ( c, XCB_PROP_MODE_REPLACE, widget_id
           , protocol, 4, 32, 1, &wm_close) );
@@ -320,6 +322,9 @@ void
    EdData* const data= editor::data;
    EdFile* const file= editor::file;
 
+   if( act_line->flags & EdLine::F_LAZY ) // If not loaded
+     act_line= file->load(act_line); // Use the block's last line
+
    // Trace line activation
    Trace::trace(".ACT", "line", data->cursor, act_line); // (Old, new)
 
@@ -348,58 +353,56 @@ void
    }
 
    // Line off-screen. Locate line in file
-   data->row_zero= 0;
-   for( line= file->line_list.get_head(); line; line= line->get_next() ) {
-     if( line == act_line ) {       // If line found
-       // If near top of file
-       if( data->row_zero < (row_size - USER_TOP) ) {
-         this->head= file->line_list.get_head();
-         data->row= (unsigned)data->row_zero + USER_TOP;
-         data->row_zero= 0;
-         draw();
-         return;
-       }
+   data->row_zero= file->get_row(act_line);
+   if( data->row_zero >= (file->rows + 2) ) { // Line is not in file
+     // SHOULD NOT OCCUR
+     Editor::alertf("%4d EdOuts file(%p) line(%p)", __LINE__
+                   , file, act_line);
+     data->cursor= line= file->line_list.get_head();
+     data->col_zero= data->col= 0;
+     data->row_zero= 0;
+     data->row= USER_TOP;
+     draw();
+     return;
+   }
+   file->load_near(act_line);       // (The screen's lines must be loaded)
 
-       // If near end of file
-       if( data->row_zero > (file->rows + 1 + USER_TOP - row_size ) ) {
-         data->row_zero= file->rows + 2 + USER_TOP - row_size;
-         data->row= USER_TOP;
-         unsigned r= row_size - 1;
-         line= file->line_list.get_tail(); // "** END OF FILE **", rows + 1
-         while( r > USER_TOP ) {
-           if( line == act_line )
-             data->row= r;
-           line= line->get_prev();
-           r--;
-         }
-         this->head= line;
-         draw();
-         return;
-       }
+   // If near top of file
+   if( data->row_zero < (row_size - USER_TOP) ) {
+     this->head= file->line_list.get_head();
+     data->row= (unsigned)data->row_zero + USER_TOP;
+     data->row_zero= 0;
+     draw();
+     return;
+   }
 
-       // Not near top or end of file
-       unsigned r= row_size / 2;
-       data->row= r;
-       data->row_zero -= r - USER_TOP;
-       while( r > USER_TOP ) {
-         line= line->get_prev();
-         r--;
-       }
-       this->head= line;
-       draw();
-       return;
+   // If near end of file
+   if( data->row_zero > (file->rows + 1 + USER_TOP - row_size ) ) {
+     data->row_zero= file->rows + 2 + USER_TOP - row_size;
+     data->row= USER_TOP;
+     unsigned r= row_size - 1;
+     line= file->line_list.get_tail(); // "** END OF FILE **", rows + 1
+     while( r > USER_TOP ) {
+       if( line == act_line )
+         data->row= r;
+       line= line->get_prev();
+       r--;
      }
-
-     data->row_zero++;
+     this->head= line;
+     draw();
+     return;
    }
 
-   // Line is not in file (SHOULD NOT OCCUR)
-   Editor::alertf("%4d EdOuts file(%p) line(%p)", __LINE__
-                 , file, act_line);
-   data->cursor= line= file->line_list.get_head();
-   data->col_zero= data->col= 0;
-   data->row_zero= 0;
-   data->row= USER_TOP;
+   // Not near top or end of file
+   unsigned r= row_size / 2;
+   data->row= r;
+   data->row_zero -= r - USER_TOP;
+   line= act_line;
+   while( r > USER_TOP ) {
+     line= line->get_prev();
+     r--;
+   }
+   this->head= line;
    draw();
 }
 
@@ -425,6 +428,7 @@ void
    // Display the text (if any)
    tail= this->head;
    if( tail ) {
+     editor::file->load_near(tail); // (The screen's lines must be loaded)
      EdLine* line= tail;
      row_used= USER_TOP;
 
@@ -519,11 +523,59 @@ void
      // Right section
      if( off_last > rh_off )
        putcr(gc_font, int(rh_mark), row, buffer+rh_off, off_last - rh_off);
+   } else if( editor::highlight && !(line->flags & EdLine::F_PROT) ) {
+     draw_find(row, text);
    } else {
      putcr(gc_font, 0, row, text);
    }
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdOuts::draw_find
+//
+// Purpose-
+//       Draw one line, highlighting editor::highlight matches
+//
+// Implementation notes-
+//       The text has a col_zero origin, so a match that begins left of
+//       col_zero is not highlighted.
+//
+//----------------------------------------------------------------------------
+void
+   EdOuts::draw_find(               // Draw a line, highlighting matches
+     unsigned          row,         // The (absolute) row number
+     const char*       text)        // The (col_zero origin) line text
+{
+   const EdFind& find= *editor::highlight;
+   size_t M= find.get_length();     // The match length
+   size_t L= strlen(text);          // The text length (excluding fill)
+   active.reset(text);              // Load the line (with col_zero origin)
+   active.get_column(col_size+1);   // Fill buffer to screen length
+   const char* buffer= active.get_buffer();
+
+   unsigned col= 0;                 // The current screen column
+   const char* last= buffer;        // The first undrawn character
+   if( M ) {                        // (An empty locate string never matches)
+     for(const char* match= find.find_next(buffer, L); match;
+         match= find.find_next(last, L - size_t(last - buffer)) ) {
+       if( match > last ) {         // Unmatched section
+         putcr(gc_font, col, row, last, size_t(match - last));
+         col += unsigned(utf8_decoder(last, match - last).get_symbol_count());
+       }
+       putcr(gc_find, col, row, match, M); // Matched section
+       col += unsigned(utf8_decoder(match, M).get_symbol_count());
+       last= match + M;
+       if( col >= col_size )        // If past the end of the screen
+         return;
+     }
+   }
+
+   if( *last )                      // Trailing unmatched section (and fill)
+     putcr(gc_font, col, row, last);
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Terminal output services.
 //
 // Last change date-
-//       2024/07/27
+//       2026/10/18
 //
 // Implementation notes-
 //       Attributes are defined in EdInps.h and EdUnit.h
@@ -101,6 +101,7 @@ virtual void
 // Public method-
 //       EdUnit::draw               Redraw everything
 //       EdUnit::draw_line          Draw a screen line
+//       EdOuts::draw_find          Draw a screen line, highlighting matches
 //       EdUnit::draw_history       Draw the history line
 //       EdUnit::draw_message       Draw the message line
 //       EdUnit::draw_status        Draw the status line
@@ -127,6 +128,11 @@ virtual void
      unsigned          row,         // The (absolute) row number
      const EdLine*     line);       // The line to draw
 
+void
+   draw_find(                       // Draw a line, highlighting matches
+     unsigned          row,         // The (absolute) row number
+     const char*       text);       // The (col_zero origin) line text
+
 virtual void
    draw_history( void );            // Redraw the history line
 
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,12 +16,15 @@
 //       Editor: Storage Pool descriptor
 //
 // Last change date-
-//       2024/05/05
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef EDPOOL_H_INCLUDED
 #define EDPOOL_H_INCLUDED
 
+#include <unistd.h>                 // For close
+#include <sys/mman.h>               // For munmap
+#include <sys/stat.h>               // For fstat
 #include <pub/Debug.h>              // For namespace pub::debugging
 #include <pub/List.h>               // For pub::List
 
@@ -37,7 +40,20 @@
 //
 // Implementation note-
 //       Lines are allocated and deleted, but pool text is only allocated.
-//       Text is immutable. EdPools remain allocated until Editor completion.
+//       Text is immutable. Text EdPools remain allocated until Editor
+//       completion.
+//
+//       A mapped EdPool holds a (private) memory mapped file. It is created
+//       100% allocated. It is referenced by the unloaded blocks (and
+//       background searches) that use its text, and editor::release deletes
+//       it when the last reference is removed.
+//
+//       A mapped file can be changed or truncated by another program after
+//       it's mapped. Reading a page beyond a truncated file's end raises
+//       SIGBUS, and an in-place change silently changes the mapped text.
+//       The file descriptor is kept open so that check() can detect either
+//       one before the text is used. (A file truncated between check() and
+//       the read can still raise SIGBUS.)
 //
 //----------------------------------------------------------------------------
 class EdPool : public pub::List<EdPool>::Link { // Editor text pool descriptor
@@ -48,12 +64,22 @@ enum // Compile time constants
 {  MIN_SIZE= 65536                  // Minimum text pool size
 }; // Compile time constants
 
+enum CHECK                          // Mapped file check() result
+{  CHECK_INTACT                     // The file is unchanged
+,  CHECK_CHANGED                    // The file changed, but can be read
+,  CHECK_TRUNCATED                  // The file is shorter, don't read it
+}; // enum CHECK
+
 //----------------------------------------------------------------------------
 // EdPool::Attributes
 protected:
 size_t                 used;        // Number of bytes used
 size_t                 size;        // The total Pool size
 char*                  data;        // The Pool data area
+bool                   mapped= false; // Is the data area memory mapped?
+size_t                 refs= 0;     // Reference count (mapped EdPools)
+int                    fd= -1;      // The mapped file descriptor
+struct timespec        mtime= {};   // The mapped file's modification time
 
 //----------------------------------------------------------------------------
 // EdPool::Constructor/Destructor
@@ -70,6 +96,23 @@ public:
      traceh("EdPool(%p)::EdPool(%zd)\n", this, size_);
 }
 
+   EdPool(                          // Constructor (mapped file)
+     char*             data_,       // The mapped data area
+     size_t            size_,       // The mapped data length
+     int               fd_)         // The mapped file descriptor (now owned)
+:  ::pub::List<EdPool>::Link()
+,  used(size_), size(size_), data(data_), mapped(true), fd(fd_)
+{  using namespace config; using namespace pub::debugging;
+
+   if( opt_hcdm )
+     traceh("EdPool(%p)::EdPool(%p,%zd,%d) mapped\n", this, data_, size_
+           , fd_);
+
+   struct stat st;
+   if( fstat(fd, &st) == 0 )
+     mtime= st.st_mtim;
+}
+
 virtual
    ~EdPool( void )                  // Destructor
 {  using namespace config; using namespace pub::debugging;
@@ -77,7 +120,11 @@ virtual
    if( opt_hcdm )
      traceh("EdPool(%p)::~EdPool, used %6zd of %6zd\n", this, used, size);
 
-   delete [] data;                  // Delete the data
+   if( mapped ) {                   // Delete the data
+     munmap(data, size);
+     close(fd);
+   } else
+     delete [] data;
 }
 
 //----------------------------------------------------------------------------
@@ -90,6 +137,21 @@ size_t get_used( void ) const { return used; }
 //----------------------------------------------------------------------------
 // EdPool::Methods
 //----------------------------------------------------------------------------
+int                                 // The CHECK result
+   check( void ) const              // Check the mapped file
+{
+   if( !mapped )
+     return CHECK_INTACT;
+
+   struct stat st;
+   if( fstat(fd, &st) != 0 || size_t(st.st_size) < size )
+     return CHECK_TRUNCATED;
+   if( st.st_mtim.tv_sec != mtime.tv_sec
+       || st.st_mtim.tv_nsec != mtime.tv_nsec )
+     return CHECK_CHANGED;
+   return CHECK_INTACT;
+}
+
 char*                               // The allocated storage, nullptr if none
    allocate(                        // Get allocated storage
      size_t            size)        // Of this length
@@ -106,5 +168,13 @@ char*                               // The allocated storage, nullptr if none
 
    return result;
 }
+
+void
+   reference( void )                // Add a reference
+{  ++refs; }
+
+bool                                // TRUE if no references remain
+   release( void )                  // Remove a reference
+{  return --refs == 0; }
 }; // class EdPool
 #endif // EDPOOL_H_INCLUDED
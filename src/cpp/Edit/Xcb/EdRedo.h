@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Redo/Undo descriptor
 //
 // Last change date-
-//       2024/08/30
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef EDREDO_H_INCLUDED
@@ -35,6 +35,12 @@
 // Purpose-
 //       Editor Redo/Undo descriptor
 //
+// Implementation notes-
+//       The inserted and removed lines may include F_LAZY placeholders,
+//       which reference unloaded file text rather than copying it. The
+//       first and last lines are always loaded lines, so loading an
+//       inserted placeholder doesn't change them.
+//
 //----------------------------------------------------------------------------
 class EdRedo : public pub::List<EdRedo>::Link { // Editor Undo/Redo
 //----------------------------------------------------------------------------
@@ -44,6 +50,7 @@ EdLine*                head_insert= nullptr; // First line inserted
 EdLine*                tail_insert= nullptr; // Last line  inserted
 EdLine*                head_remove= nullptr; // First line removed
 EdLine*                tail_remove= nullptr; // Last line  removed
+size_t                 remove_rows= 0; // The number of removed EdLines
 
 // Block copy/move columns
 ssize_t                lh_col= -1;  // Left  hand column
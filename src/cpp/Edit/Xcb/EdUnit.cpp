@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2024 Frank Eskesen.
+//       Copyright (C) 2024-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Input/output interface; Handle editor operations.
 //
 // Last change date-
-//       2024/08/30
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <string>                   // For std::string
@@ -553,6 +553,7 @@ void
    if( data->row < USER_TOP )       // (File initial row == 0)
      data->row= USER_TOP;
 
+   file->load_near(head);           // (The screen's lines must be loaded)
    EdLine* line= head;              // Get the top line
    const char* match_type= " ???";  // Default, NO match
    for(unsigned r= USER_TOP; ; r++) { // Set the Active line
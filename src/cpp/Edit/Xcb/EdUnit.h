@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Input/output unit interface
 //
 // Last change date-
-//       2024/05/15
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef EDUNIT_H_INCLUDED
@@ -261,6 +261,22 @@ virtual void
    flush( void )                    // Complete enqueued I/O operations
 {  }                                // (Default does nothing)
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       EdUnit::post_search
+//
+// Purpose-
+//       Post background search completion
+//
+// Implementation notes-
+//       Called from a pub::WorkerPool thread. The polling loop then calls
+//       editor::search_done.
+//
+//----------------------------------------------------------------------------
+virtual void
+   post_search( void ) = 0;         // Post background search completion
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Command line processor
 //
 // Last change date-
-//       2024/08/23
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <exception>                // For std::exception
@@ -33,6 +33,7 @@
 
 #include <pub/Debug.h>              // For Debug object
 #include <pub/Exception.h>          // For Exception object
+#include <pub/Worker.h>             // For pub::WorkerPool
 
 #include "Config.h"                 // For namespace config
 #include "Editor.h"                 // For namespace editor
@@ -309,6 +310,7 @@ extern int                          // Return code
    //-------------------------------------------------------------------------
    // Terminate
    //-------------------------------------------------------------------------
+   pub::WorkerPool::reset();        // (Used by EdFile::insert_file)
    if( opt_hcdm && opt_verbose > 0 )
      Config::errorf("Edit completed\n");
 
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,12 +16,9 @@
 //       Editor: Implement Editor.h
 //
 // Last change date-
-//       2024/08/27
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
-#ifndef _GNU_SOURCE
-#define _GNU_SOURCE                 // For strcasestr
-#endif
 #include <assert.h>                 // For assert
 #include <stdio.h>                  // For printf
 #include <stdlib.h>                 // For various
@@ -40,6 +37,7 @@
 #include "EdData.h"                 // For EdData
 #include "Editor.h"                 // For Editor (Implementation class)
 #include "EdFile.h"                 // For EdFile, EdLine, EdPool, ...
+#include "EdFind.h"                 // For EdFind
 #include "EdHist.h"                 // For EdHist
 #include "EdMark.h"                 // For EdMark
 #include "EdPool.h"                 // For EdPool
@@ -61,6 +59,12 @@ enum // Compilation controls
 ,  USE_HCDM_FILE_DEBUG= true        // (As opposed to name-only file info)
 }; // Compilation controls
 
+//----------------------------------------------------------------------------
+// Internal data areas
+//----------------------------------------------------------------------------
+static pub::signals::Connector<EdFile::CloseEvent>
+                       closeEvent_connector;
+
 //----------------------------------------------------------------------------
 // External data areas
 //----------------------------------------------------------------------------
@@ -91,6 +95,9 @@ uint32_t               editor::locate_back= false;
 uint32_t               editor::locate_case= false;
 uint32_t               editor::locate_wrap= false;
 
+EdFind*                editor::highlight= nullptr; // Highlighted locate string
+EdSearch*              editor::search= nullptr; // Background match count
+
 // Margins and tabs ----------------------------------------------------------
 size_t                 editor::margins[2]= {1, 78}; // {Left, right} margin
 size_t                 editor::tabs[Editor::TAB_DIM]=
@@ -122,49 +129,31 @@ inline
 //----------------------------------------------------------------------------
 //
 // Subroutine-
-//       edit_strstr
+//       has_prefix
 //
 // Purpose-
-//       Editor editor::locate_case controlled strstr
+//       Does any line in an unloaded block begin with a string?
 //
 //----------------------------------------------------------------------------
-static const char*                  // Resultant
-   edit_strstr(                     // Multi-case strstr
-     const char*       lhs,         // Source string
-     const char*       rhs)         // Locate string
+static bool                         // TRUE if a block line begins with S
+   has_prefix(                      // Does a block line begin with S?
+     const EdBlock*    block,       // The unloaded block
+     const char*       S,           // The string
+     size_t            L)           // The string length
 {
-   if( editor::locate_case )        // If case sensitive compare
-     return strstr(lhs, rhs);
-   else
-     return strcasestr(lhs, rhs);
-}
-
-//----------------------------------------------------------------------------
-//
-// Method-
-//       last_strstr
-//
-// Purpose-
-//       Locate last occurance of string in text.
-//
-//----------------------------------------------------------------------------
-static const char*                  // Last occurance, nullptr none
-   last_strstr(                     // Locate last occurance of string in text
-     const char*       text,        // Text origin
-     const char*       find)        // Search string
-{
-   const char* final= edit_strstr(text, find); // Find first occurance
-   if( final ) {                    // If existent
-     for(;;) {                      // Find last occurrance
-       const char* next= edit_strstr(final+1, find);
-       if( next == nullptr )
-         break;
-
-       final= next;
-     }
+   const char* text= block->text;
+   const char* const last= text + block->size;
+   while( text < last ) {
+     if( size_t(last - text) >= L && memcmp(text, S, L) == 0 )
+       return true;
+
+     text= (const char*)memchr(text, '\n', last - text);
+     if( text == nullptr )
+       break;
+     ++text;
    }
 
-   return final;
+   return false;
 }
 
 //----------------------------------------------------------------------------
@@ -180,7 +169,7 @@ static const char*                  // Return message, nullptr if OK
    prev_locate(                     // Locate previous
      int               offset)      // (For locate_change, offset= 0, else 1)
 {
-   const char* S= locate_string.c_str();
+   EdFind find(locate_string, locate_case); // The search engine
 
    //-------------------------------------------------------------------------
    // Locate in the active line
@@ -192,7 +181,7 @@ static const char*                  // Return message, nullptr if OK
      size_t column= data->get_column() + editor::locate_string.size();
      if( offset && column > 0 ) {
        const char* C= A.resize(column - 1);
-       const char* M= last_strstr(C, S);
+       const char* M= find.find_prev(C);
        if( M != nullptr ) {
          unit->move_cursor_H(M - C);
          unit->draw_top();
@@ -204,8 +193,15 @@ static const char*                  // Return message, nullptr if OK
    //-------------------------------------------------------------------------
    // Search backward in file
    for(line= line->get_prev(); line; line= line->get_prev() ) {
+     if( line->flags & EdLine::F_LAZY ) { // If not loaded
+       const EdBlock* block= line->block;
+       if( file->check(block)       // (A truncated block loads empty)
+           && find.find_prev(block->text, block->size) == nullptr )
+         continue;                  // (No match in the block)
+       line= file->load(line);      // Search its (last) loaded line
+     }
      if( (line->flags & EdLine::F_PROT) == 0 ) {
-       const char* M= last_strstr(line->text, S);
+       const char* M= find.find_prev(line->text);
        if( M != nullptr ) {
          unit->activate(line);
          unit->move_cursor_H(M - line->text);
@@ -219,8 +215,15 @@ static const char*                  // Return message, nullptr if OK
    if( editor::locate_wrap ) {
      line= file->line_list.get_tail(); // (The "bot of file" line, skipped)
      for(line= line->get_prev(); line; line= line->get_prev()) {
+       if( line->flags & EdLine::F_LAZY ) { // If not loaded
+         const EdBlock* block= line->block;
+         if( file->check(block)     // (A truncated block loads empty)
+             && find.find_prev(block->text, block->size) == nullptr )
+           continue;                // (No match in the block)
+         line= file->load(line);    // Search its (last) loaded line
+       }
        if( (line->flags & EdLine::F_PROT) == 0 ) {
-         const char* M= last_strstr(line->text, S);
+         const char* M= find.find_prev(line->text);
          if( M != nullptr ) {
            unit->activate(line);
            unit->move_cursor_H(M - line->text);
@@ -260,6 +263,15 @@ static const char*                  // Return message, nullptr if OK
    active= new Active();            // An Active work area
    altact= new Active();            // An Active work area
 
+   // Initialize EdFile::CloseEvent handler (Stop its background search)
+   using Event= EdFile::CloseEvent;
+   closeEvent_connector= EdFile::close_signal.connect([](Event& event) {
+     if( search && search->file == event.file ) {
+       delete search;
+       search= nullptr;
+     }
+   });
+
    //-------------------------------------------------------------------------
    // Load the edit files
    int protect= false;              // Default, read/write files
@@ -287,7 +299,16 @@ static const char*                  // Return message, nullptr if OK
 
    using namespace editor;
 
-   // Remove and delete Files
+   // Stop the background search. (It references file text.)
+   delete search;
+   search= nullptr;
+   delete highlight;
+   highlight= nullptr;
+
+   // Remove the copy/cut, then delete the Files. (Both may reference
+   // mapped EdPools, which are deleted when their last reference is.)
+   if( mark )
+     mark->reset();
    for(EdFile* file= file_list.remq(); file; file= file_list.remq())
      delete file;
 
@@ -551,6 +572,12 @@ const char*                         // Return message, nullptr if OK
    // Search remainder of file
    EdLine* line= data->cursor;
    for(line= line->get_next(); line; line= line->get_next() ) {
+     if( line->flags & EdLine::F_LAZY ) { // If not loaded
+       if( file->check(line->block) // (A truncated block loads empty)
+           && !has_prefix(line->block, S, L) )
+         continue;                  // (No match in the block)
+       file->load(line);            // Search its (first) loaded line
+     }
      if( memcmp(line->text, S, L) == 0 ) {
        if( line->get_next() ) {     // If not "end of file" line
          unit->activate(line);
@@ -565,6 +592,12 @@ const char*                         // Return message, nullptr if OK
    if( editor::locate_wrap ) {
      line= file->line_list.get_head(); // (The "top of file" line, skipped)
      for(line= line->get_next(); line; line= line->get_next()) {
+       if( line->flags & EdLine::F_LAZY ) { // If not loaded
+         if( file->check(line->block) // (A truncated block loads empty)
+             && !has_prefix(line->block, S, L) )
+           continue;                // (No match in the block)
+         file->load(line);          // Search its (first) loaded line
+       }
        if( memcmp(line->text, S, L) == 0 && line->get_next() ) {
          unit->activate(line);
          unit->move_cursor_H(0);
@@ -700,7 +733,7 @@ const char*                         // Return message, nullptr if OK
    if( locate_back )                // If reverse search active
      return prev_locate(offset);
 
-   const char* S= locate_string.c_str();
+   EdFind find(locate_string, locate_case); // The search engine
 
    //-------------------------------------------------------------------------
    // Locate in the active line
@@ -708,7 +741,7 @@ const char*                         // Return message, nullptr if OK
    size_t column= data->col_zero + data->col + offset;
    if( (line->flags & EdLine::F_PROT) == 0 ) { // If line is not protected
      const char* C= data->active.get_buffer(column); // Remaining characters
-     const char* M= edit_strstr(C, S);
+     const char* M= find.find_next(C);
      if( M != nullptr ) {
        data->activate();
        column += M - C;
@@ -721,8 +754,15 @@ const char*                         // Return message, nullptr if OK
    //-------------------------------------------------------------------------
    // Search remainder of file
    for(line= line->get_next(); line; line= line->get_next() ) {
+     if( line->flags & EdLine::F_LAZY ) { // If not loaded
+       const EdBlock* block= line->block;
+       if( file->check(block)       // (A truncated block loads empty)
+           && find.find_next(block->text, block->size) == nullptr )
+         continue;                  // (No match in the block)
+       file->load(line);            // Search its (first) loaded line
+     }
      if( (line->flags & EdLine::F_PROT) == 0 ) {
-       const char* M= edit_strstr(line->text, S);
+       const char* M= find.find_next(line->text);
        if( M != nullptr ) {
          data->activate();
          unit->activate(line);
@@ -737,8 +777,15 @@ const char*                         // Return message, nullptr if OK
    if( editor::locate_wrap ) {
      line= file->line_list.get_head(); // (The "top of file" line, skipped)
      for(line= line->get_next(); line; line= line->get_next()) {
+       if( line->flags & EdLine::F_LAZY ) { // If not loaded
+         const EdBlock* block= line->block;
+         if( file->check(block)     // (A truncated block loads empty)
+             && find.find_next(block->text, block->size) == nullptr )
+           continue;                // (No match in the block)
+         file->load(line);          // Search its (first) loaded line
+       }
        if( (line->flags & EdLine::F_PROT) == 0 ) {
-         const char* M= edit_strstr(line->text, S);
+         const char* M= find.find_next(line->text);
          if( M != nullptr ) {
            data->activate();
            unit->activate(line);
@@ -1010,6 +1057,28 @@ void
      fprintf(stderr, "ERROR: %s\n", mess_);
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       editor::release
+//
+// Purpose-
+//       Release a mapped EdPool reference
+//
+//----------------------------------------------------------------------------
+void
+   editor::release(                 // Release a mapped EdPool reference
+     EdPool*           pool)        // The mapped EdPool
+{
+   if( pool->release() ) {          // If no references remain
+     if( opt_hcdm )
+       traceh("editor::release(%p) unmapped\n", pool);
+
+     filePool.remove(pool, pool);
+     delete pool;
+   }
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -1039,6 +1108,38 @@ void
    } // The last file removed remains on the file_list (It's still referenced)
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       editor::search_done
+//
+// Purpose-
+//       Complete the background match count
+//
+//----------------------------------------------------------------------------
+void
+   editor::search_done( void )      // Complete the background match count
+{
+   if( search == nullptr || !search->is_done() ) // If not the current search
+     return;
+
+   EdFind::Count count= search->result;
+   const EdFile* from= search->file;
+   bool truncated= search->is_truncated();
+   delete search;
+   search= nullptr;
+
+   if( from == file ) {             // (Report only for the active file)
+     if( truncated )
+       Editor::put_message("File truncated by another program, count failed");
+     else
+       Editor::put_message("%zu matches, %zu lines", count.matches
+                          , count.lines);
+     unit->draw_top();
+     unit->flush();
+   }
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2020-2024 Frank Eskesen.
+//       Copyright (C) 2020-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Editor: Global data areas
 //
 // Last change date-
-//       2024/04/22
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef EDITOR_H_INCLUDED
@@ -31,9 +31,11 @@
 class Active;                       // Editor Active line object
 class EdData;                       // Editor data view
 class EdFile;                       // Editor file descriptor
+class EdFind;                       // Editor locate string search engine
 class EdHist;                       // Editor history view
 class EdMark;                       // Editor mark controller
 class EdPool;                       // Editor pool allocators
+class EdSearch;                     // Editor background match counter
 class EdView;                       // Editor view
 class EdUnit;                       // Editor Unit
 
@@ -151,6 +153,9 @@ extern uint32_t        locate_back; // Reverse search (default= false)
 extern uint32_t        locate_case; // Case sensitive search (default= false)
 extern uint32_t        locate_wrap; // Autowrap (default= false)
 
+extern EdFind*         highlight;   // The highlighted locate string, if any
+extern EdSearch*       search;      // The background match count, if any
+
 // Margins (for format) ------------------------------------------------------
 extern size_t          margins[2];  // [left][right] margins
 extern size_t          tabs[Editor::TAB_DIM]; // Tabs array, tab[0] is count
@@ -367,6 +372,23 @@ void
      const char*       mess_,       // Message text
      int               type_= 0);   // Message mode (default EdMess::T_INFO)
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       editor::release
+//
+// Purpose-
+//       Release a mapped EdPool reference
+//
+// Implementation notes-
+//       The EdPool is removed from the filePool and deleted (unmapping its
+//       file) when its last reference is released.
+//
+//----------------------------------------------------------------------------
+void
+   release(                         // Release a mapped EdPool reference
+     EdPool*           pool);       // The mapped EdPool
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -379,6 +401,22 @@ void
 void
    remove_file( void );             // Remove active file from the file list
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       editor::search_done
+//
+// Purpose-
+//       Complete the background match count
+//
+// Implementation notes-
+//       Called from the EdUnit polling loop after EdUnit::post_search.
+//       Posts from stopped searches are ignored.
+//
+//----------------------------------------------------------------------------
+void
+   search_done( void );             // Complete the background match count
+
 //----------------------------------------------------------------------------
 //
 // Method-
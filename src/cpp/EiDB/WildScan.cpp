@@ -0,0 +1,169 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (C) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       WildScan.cpp
+//
+// Purpose-
+//       WildScan methods.
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#include <stdlib.h>
+#include <string.h>
+
+#include "Wildstr.h"
+#include "WildScan.h"
+
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+#define __SOURCE__       "WILDSCAN" // Source filename
+
+#define MAX_STATE              64   // The largest bit-parallel pattern length
+#define MAX_MISMATCH           63   // The largest bit-parallel tolerance
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       WildScan::~WildScan
+//
+// Purpose-
+//       Destructor
+//
+//----------------------------------------------------------------------------
+   WildScan::~WildScan( void )      // Destructor
+{
+   free(table);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       WildScan::WildScan
+//
+// Purpose-
+//       Constructor
+//
+//----------------------------------------------------------------------------
+   WildScan::WildScan(              // Constructor
+     const char*       pattern,     // The wildcard pattern
+     unsigned          mismatch)    // The mismatch tolerance
+:  length(strlen(pattern))
+,  mismatch(mismatch)
+,  table(NULL)
+{
+   char                source;      // Source character
+   unsigned            c;           // Character index
+   unsigned            j;           // Pattern index
+
+   memset(mask, 0, sizeof(mask));
+   if( length > MAX_STATE || length == 0 || mismatch > MAX_MISMATCH )
+     table= (unsigned char*)malloc(length * 256 + 1);
+
+   // A character matches a pattern position if wildcmp says it does
+   for(c= 1; c<256; c++)
+   {
+     source= (char)c;
+     for(j= 0; j<length; j++)
+     {
+       int cc= wildcmp(&source, pattern+j, 1);
+       if( table != NULL )
+         table[j * 256 + c]= (cc == 0);
+       else if( cc == 0 )
+         mask[c] |= uint64_t(1) << j;
+     }
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       WildScan::scan
+//
+// Purpose-
+//       Scan a string, appending the offset of each match.
+//
+// Notes-
+//       Matches are reported in offset order, including overlapping matches.
+//
+//----------------------------------------------------------------------------
+void
+   WildScan::scan(                  // Scan a string
+     const char*       string,      // The string to scan
+     unsigned          minOffset,   // The lowest match offset
+     unsigned          maxOffset,   // The highest match offset
+     std::vector<unsigned>&
+                       offset) const // (OUTPUT) The match offsets
+{
+   unsigned            const n= strlen(string);
+
+   if( n < length )                 // If no match is possible
+     return;
+   if( maxOffset > n - length )
+     maxOffset= n - length;
+   if( minOffset > maxOffset )
+     return;
+
+   if( table != NULL )              // If not bit-parallel
+   {
+     for(unsigned s= minOffset; s<=maxOffset; s++)
+     {
+       const unsigned char* S= (const unsigned char*)string + s;
+       unsigned miss= 0;
+       for(unsigned j= 0; j<length && miss<=mismatch; j++)
+         miss += (table[j * 256 + S[j]] == 0);
+
+       if( miss <= mismatch )
+         offset.push_back(s);
+     }
+
+     return;
+   }
+
+   uint64_t            const high= uint64_t(1) << (length - 1);
+   uint64_t            state[MAX_MISMATCH + 1]; // State, by mismatch count
+   for(unsigned d= 0; d<=mismatch; d++)
+     state[d]= 0;
+
+   const unsigned char* S= (const unsigned char*)string;
+   unsigned            const ending= maxOffset + length; // Last index + 1
+   if( mismatch == 0 )              // (The usual case)
+   {
+     uint64_t D= 0;
+     for(unsigned i= minOffset; i<ending; i++)
+     {
+       D= ((D << 1) | 1) & mask[S[i]];
+       if( D & high )
+         offset.push_back(i + 1 - length);
+     }
+
+     return;
+   }
+
+   for(unsigned i= minOffset; i<ending; i++)
+   {
+     uint64_t const M= mask[S[i]];
+     uint64_t prior= state[0];      // The prior state[d-1]
+     state[0]= ((state[0] << 1) | 1) & M;
+     for(unsigned d= 1; d<=mismatch; d++)
+     {
+       uint64_t const D= state[d];
+       state[d]= (((D << 1) | 1) & M) | ((prior << 1) | 1);
+       prior= D;
+     }
+
+     if( state[mismatch] & high )
+       offset.push_back(i + 1 - length);
+   }
+}
@@ -0,0 +1,104 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (C) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       WildScan.h
+//
+// Purpose-
+//       Bit-parallel wildcard sequence scanner.
+//
+// Last change date-
+//       2026/10/18
+//
+// Classes-
+         class WildScan;
+//
+// Description-
+//       A WildScan compiles a wildcard pattern into a Shift-And automaton.
+//       Each pattern position is one bit of a 64-bit state word. A
+//       character matches a pattern position using the same rules as
+//       wildcmp, so the wildcard lists must be set (setWild) before the
+//       WildScan is constructed.
+//
+//       With a mismatch tolerance k, one state word is kept for each
+//       mismatch count 0..k. A match is then any segment that differs from
+//       the pattern in at most k positions.
+//
+//       Patterns longer than 64 characters are scanned position by
+//       position, using the same character match table.
+//
+//----------------------------------------------------------------------------
+#ifndef WILDSCAN_H_INCLUDED
+#define WILDSCAN_H_INCLUDED
+
+#include <stdint.h>
+#include <vector>
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       WildScan
+//
+// Purpose-
+//       Bit-parallel wildcard sequence scanner.
+//
+//----------------------------------------------------------------------------
+class WildScan                      // Bit-parallel wildcard scanner
+{
+//----------------------------------------------------------------------------
+// WildScan::Constructors
+//----------------------------------------------------------------------------
+public:
+   ~WildScan( void );               // Destructor
+   WildScan(                        // Constructor
+     const char*       pattern,     // The wildcard pattern
+     unsigned          mismatch= 0);// The mismatch tolerance
+
+private:                            // Bitwise copy is prohibited
+   WildScan(const WildScan&);       // Disallowed copy constructor
+WildScan&
+   operator=(const WildScan&);      // Disallowed assignment operator
+
+//----------------------------------------------------------------------------
+// WildScan::Accessor methods
+//----------------------------------------------------------------------------
+public:
+inline unsigned                     // The pattern length
+   getLength( void ) const
+{  return length; }
+
+inline unsigned                     // The mismatch tolerance
+   getMismatch( void ) const
+{  return mismatch; }
+
+//----------------------------------------------------------------------------
+// WildScan::Methods
+//----------------------------------------------------------------------------
+public:
+void
+   scan(                            // Scan a string
+     const char*       string,      // The string to scan
+     unsigned          minOffset,   // The lowest match offset
+     unsigned          maxOffset,   // The highest match offset
+     std::vector<unsigned>&
+                       offset) const; // (OUTPUT) The match offsets
+
+//----------------------------------------------------------------------------
+// WildScan::Attributes
+//----------------------------------------------------------------------------
+protected:
+   unsigned            length;      // The pattern length
+   unsigned            mismatch;    // The mismatch tolerance
+   uint64_t            mask[256];   // Pattern positions matching character
+   unsigned char*      table;       // Match table [length][256] (length>64)
+}; // class WildScan
+
+#endif // WILDSCAN_H_INCLUDED
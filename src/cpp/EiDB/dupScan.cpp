@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2002-2021 Frank Eskesen.
+//       Copyright (C) 2002-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Exon/Intron DataBase, scan for duplicate Exons.
 //
 // Last change date-
-//       2021/07/17
+//       2026/10/18
 //
 // Description-
 //       This routine examines an Exon/Intron database file, looking for
@@ -25,9 +25,21 @@
 //       A will match B and C and B will match C.  (This is a simple scan
 //       of lines which follow.)
 //
+// Implementation notes-
+//       Rather than comparing each sequence with every sequence in the lines
+//       which follow, an index of all sequences is sorted by (hash, sequence,
+//       line, column). Matching sequences are then adjacent, in line order.
+//       The hashes are computed and the index ranges sorted in parallel.
+//
 //----------------------------------------------------------------------------
+#include <algorithm>
+#include <new>
+#include <thread>
+#include <vector>
+
 #include <assert.h>
 #include <errno.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -39,7 +51,6 @@
 #include "Extractor.h"
 #include "EiDBLoader.h"
 #include "List.h"
-#include "new.h"
 #include "Wildstr.h"
 
 //----------------------------------------------------------------------------
@@ -72,6 +83,41 @@ static List*           list;        // List array
 static int             fileName;    // The fileName parameter index
 static char            sw_exon;     // TRUE iff -exon option specified
 static char            sw_verbose;  // TRUE iff -v   option specified
+static unsigned        threads;     // The number of index threads
+
+//----------------------------------------------------------------------------
+//
+// Struct-
+//       Entry
+//
+// Purpose-
+//       Sequence index entry.
+//
+//----------------------------------------------------------------------------
+struct Entry {                      // Sequence index entry
+   uint64_t            hash;        // The sequence hash
+   const char*         exon;        // The sequence
+   unsigned            row;         // The line index
+   unsigned            col;         // The column index (origin 0)
+}; // struct Entry
+
+static inline bool                  // TRUE iff L < R
+   operator<(                       // Compare Entries
+     const Entry&      L,           // Left Entry
+     const Entry&      R)           // Right Entry
+{
+   if( L.hash != R.hash )
+     return L.hash < R.hash;
+
+   int cc= strcmp(L.exon, R.exon);
+   if( cc != 0 )
+     return cc < 0;
+
+   if( L.row != R.row )
+     return L.row < R.row;
+
+   return L.col < R.col;
+}
 
 //----------------------------------------------------------------------------
 //
@@ -94,7 +140,8 @@ static void
    fprintf(stderr,"\n\n");
 
    fprintf(stderr,"Options:\n"
-                  "-exon\tSearch for duplicate exons\n");
+                  "-exon\tSearch for duplicate exons\n"
+                  "-threads:value\tThe number of index threads\n");
    fprintf(stderr,"\n\n");
 
    fprintf(stderr,"filename\n"
@@ -124,6 +171,7 @@ static void
    //-------------------------------------------------------------------------
    sw_exon=    FALSE;               // Default switch settings
    sw_verbose= FALSE;
+   threads=    std::thread::hardware_concurrency();
 
    fileName=   (-1);                // Set fileName parameter index
 
@@ -141,6 +189,17 @@ static void
        if( strcmp("-exon", argv[j]) == 0 )
          sw_exon= TRUE;
 
+       else if( strncmp("-threads:", argv[j], 9) == 0 )
+       {
+         int count= atoi(argv[j]+9);
+         threads= count > 0 ? unsigned(count) : 0;
+         if( threads == 0 )
+         {
+           error= TRUE;
+           fprintf(stderr, "Invalid thread count '%s'\n", argv[j]);
+         }
+       }
+
        else                         // Switch list
        {
          for(int i=1; argv[j][i] != '\0'; i++) // Examine the switch list
@@ -177,6 +236,9 @@ static void
    //-------------------------------------------------------------------------
    // Validate the parameters
    //-------------------------------------------------------------------------
+   if( threads == 0 )               // If hardware_concurrency unknown
+     threads= 1;
+
    if( fileName < 0 )               // If fileName not specified
    {
      error= TRUE;
@@ -304,6 +366,66 @@ static void
    }
 }
 
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       hash
+//
+// Function-
+//       Hash a sequence (64-bit FNV-1a.)
+//
+//----------------------------------------------------------------------------
+static inline uint64_t              // The sequence hash
+   hash(                            // Hash a sequence
+     const char*       exon)        // The sequence
+{
+   uint64_t            resultant= 0xcbf29ce484222325ULL;
+
+   while( *exon != '\0' )
+   {
+     resultant ^= (unsigned char)(*exon++);
+     resultant *= 0x00000100000001b3ULL;
+   }
+
+   return resultant;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       sortRange
+//
+// Function-
+//       Build and sort a range of the sequence index.
+//
+//----------------------------------------------------------------------------
+static void
+   sortRange(                       // Build and sort an index range
+     Entry*            entry,       // The index range
+     unsigned          origin,      // The first line
+     unsigned          ending)      // The last line + 1
+{
+   Entry*              first= entry;
+
+   for(unsigned row= origin; row<ending; row++)
+   {
+     for(unsigned col= 0;; col++)
+     {
+       char* exon= (char*)list[row].getItem(col);
+       if( exon == NULL )
+         break;
+
+       entry->hash= hash(exon);
+       entry->exon= exon;
+       entry->row=  row;
+       entry->col=  col;
+       entry++;
+     }
+   }
+
+   std::sort(first, entry);
+}
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -322,77 +444,119 @@ static void
 
    unsigned            dupCount;    // Number of duplicates encountered
    unsigned            dupTotal;    // Number of duplicates encountered
-   char*               sourceExon;  // Source database Exon
-   char*               targetExon;  // Target database Exon
 
-   unsigned            sourceCol;   // Source column index
-   unsigned            targetCol;   // Target column index
+   // Index items
+   if( sw_verbose )
+     fprintf(stderr, "Indexing\n");
+
+   std::vector<size_t> rowOrigin(m + 1); // The first index of each line
+   rowOrigin[0]= 0;
+   for(unsigned row= 0; row<m; row++)
+   {
+     unsigned col= 0;
+     while( list[row].getItem(col) != NULL )
+       col++;
+
+     rowOrigin[row+1]= rowOrigin[row] + col;
+   }
+
+   size_t              const n= rowOrigin[m];
+   std::vector<Entry>  entry(n);    // The sequence index
+
+   // Build and sort the index ranges, then merge them
+   std::vector<size_t> range;       // The index range origins
+   range.push_back(0);
+   unsigned T= std::min(threads, std::max(m, 1u));
+   std::vector<std::thread> thread;
+   for(unsigned t= 0; t<T; t++)
+   {
+     unsigned origin= (unsigned)((uint64_t)m *  t      / T);
+     unsigned ending= (unsigned)((uint64_t)m * (t + 1) / T);
+     range.push_back(rowOrigin[ending]);
+     if( t+1 == T )
+       sortRange(&entry[rowOrigin[origin]], origin, ending);
+     else
+       thread.push_back(std::thread(sortRange, &entry[rowOrigin[origin]],
+                                    origin, ending));
+   }
+
+   for(unsigned t= 0; t<thread.size(); t++)
+     thread[t].join();
+
+   for(size_t width= 1; width<T; width *= 2)
+   {
+     for(size_t t= 0; t+width<T; t += 2*width)
+       std::inplace_merge(entry.begin() + range[t],
+                          entry.begin() + range[t + width],
+                          entry.begin() + range[std::min(t+2*width, (size_t)T)]);
+   }
+
+   // Locate each sequence's index position and its last matching position
+   std::vector<size_t> position(n); // Index position, by (line, column)
+   std::vector<size_t> groupEnd(n); // Matching group ending, by position
+   for(size_t k= 0; k<n; k++)
+     position[rowOrigin[entry[k].row] + entry[k].col]= k;
 
-   unsigned            sourceRow;   // Source row index
-   unsigned            targetRow;   // Target row index
+   for(size_t k= n; k>0; k--)
+   {
+     if( k < n && entry[k-1].hash == entry[k].hash
+         && strcmp(entry[k-1].exon, entry[k].exon) == 0 )
+       groupEnd[k-1]= groupEnd[k];
+     else
+       groupEnd[k-1]= k;
+   }
 
    // Scan items
    if( sw_verbose )
      fprintf(stderr, "Scanning\n");
 
    dupTotal= 0;
-   for(sourceRow= 0; sourceRow<m; sourceRow++)
+   for(unsigned sourceRow= 0; sourceRow<m; sourceRow++)
    {
      if( sw_verbose )
        fprintf(stderr, "%8d\r", sourceRow);
 
-     sourceCol= 0;
-     for(;;)
+     for(size_t x= rowOrigin[sourceRow]; x<rowOrigin[sourceRow+1]; x++)
      {
-       sourceExon= (char*)list[sourceRow].getItem(sourceCol);
-       if( sourceExon == NULL )
-         break;
-
-       sourceCol++;
+       size_t k= position[x];
+       const Entry& source= entry[k];
+       unsigned sourceCol= source.col + 1;
        dupCount= 0;
-       for(targetRow= sourceRow+1; targetRow<m; targetRow++)
+       for(size_t j= k+1; j<groupEnd[k]; j++)
        {
-         targetCol= 0;
-         for(;;)
-         {
-           targetExon= (char*)list[targetRow].getItem(targetCol);
-           if( targetExon == NULL )
-             break;
+         const Entry& target= entry[j];
+         if( target.row == sourceRow ) // (Same line, following column)
+           continue;
 
-           targetCol++;
-           if( strcmp(sourceExon,targetExon) == 0 )
-           {
-             if( sw_exon )
-             {
-               if( dupCount == 0 )
-                 printf("\n"
-                        "  Exon match: %s\n"
-                        "Exon[%3d] of: %s\n"
-                        , sourceExon
-                        , sourceCol, label.getLine(sourceRow)
-                        );
-               printf("Exon[%3d] of: %s\n"
-                      , targetCol, label.getLine(targetRow)
-                      );
-             }
-             else
-             {
-               if( dupCount == 0 )
-                 printf("\n"
-                        "Match: %s\n"
-                        "Label: %s\n"
-                        , sourceExon
-                        , label.getLine(sourceRow)
-                        );
-               printf("Label: %s\n"
-                      , label.getLine(targetRow)
-                      );
-             }
-
-             dupCount++;
-             dupTotal++;
-           }
+         if( sw_exon )
+         {
+           if( dupCount == 0 )
+             printf("\n"
+                    "  Exon match: %s\n"
+                    "Exon[%3d] of: %s\n"
+                    , source.exon
+                    , sourceCol, label.getLine(sourceRow)
+                    );
+           printf("Exon[%3d] of: %s\n"
+                  , target.col + 1, label.getLine(target.row)
+                  );
          }
+         else
+         {
+           if( dupCount == 0 )
+             printf("\n"
+                    "Match: %s\n"
+                    "Label: %s\n"
+                    , source.exon
+                    , label.getLine(sourceRow)
+                    );
+           printf("Label: %s\n"
+                  , label.getLine(target.row)
+                  );
+         }
+
+         dupCount++;
+         dupTotal++;
        }
      }
    }
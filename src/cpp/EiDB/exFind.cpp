@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2002 Frank Eskesen.
+//       Copyright (C) 2002-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Exon/Intron DataBase, controlled sequence scan.
 //
 // Last change date-
-//       2002/06/17
+//       2026/10/18
 //
 // Description-
 //       This routine examines an Exon/Intron database file, looking for
@@ -30,10 +30,18 @@
 //       When a sequence match is found, the associated label and data items
 //       are written to an output file.
 //
+//       Each sequence is compiled into a bit-parallel WildScan automaton,
+//       optionally tolerating mismatches. Line ranges are scanned in
+//       parallel, and the matches are written in line order.
+//
 //       Although this routine contains an INTRON_SCANNER compile control,
 //       this control is not used and its compilation has not been tested.
 //
 //----------------------------------------------------------------------------
+#include <new>
+#include <thread>
+#include <vector>
+
 #include <assert.h>
 #include <errno.h>
 #include <stdio.h>
@@ -47,8 +55,8 @@
 #include "EiDBLoader.h"
 #include "Extractor.h"
 #include "List.h"
-#include "new.h"
 #include "Wildstr.h"
+#include "WildScan.h"
 
 //----------------------------------------------------------------------------
 // Constants for parameterization
@@ -90,6 +98,8 @@ static List*           list;        // List array
 static int             fileName;    // The fileName parameter index
 static unsigned        minCol;      // Lowest column number
 static unsigned        maxCol;      // Highest column number
+static unsigned        mismatch;    // Mismatch tolerance
+static unsigned        threads;     // The number of scan threads
 static char            sw_exon;     // TRUE iff -exon option specified
 static char            sw_rev;      // TRUE iff -rev option specified
 static char            sw_verbose;  // TRUE iff -v   option specified
@@ -118,7 +128,9 @@ static void
 
    fprintf(stderr,"Global options:\n"
                   "-rev\n"
-                  "\tUse right adjustment\n");
+                  "\tUse right adjustment\n"
+                  "-threads:value\n"
+                  "\tThe number of scan threads\n");
    fprintf(stderr,"\n\n");
 
    fprintf(stderr,"filename\n"
@@ -129,7 +141,9 @@ static void
                   "-min:column\n"
                   "\tMinimum column number\n"
                   "-max:column\n"
-                  "\tMaximum column number\n");
+                  "\tMaximum column number\n"
+                  "-mismatch:count\n"
+                  "\tMismatch tolerance\n");
 
    exit(EXIT_FAILURE);
 }
@@ -155,6 +169,7 @@ static void
    //-------------------------------------------------------------------------
    sw_exon=    FALSE;               // Default switch settings
    sw_verbose= FALSE;
+   threads=    std::thread::hardware_concurrency();
 
    fileName=   (-1);                // Set fileName parameter index
 
@@ -175,6 +190,17 @@ static void
        if( strcmp("-rev", argv[j]) == 0 )
          sw_rev= TRUE;
 
+       else if( strncmp("-threads:", argv[j], 9) == 0 )
+       {
+         int count= atoi(argv[j]+9);
+         threads= count > 0 ? unsigned(count) : 0;
+         if( threads == 0 )
+         {
+           error= TRUE;
+           fprintf(stderr, "Invalid thread count '%s'\n", argv[j]);
+         }
+       }
+
        else                         // Switch list
        {
          for(int i=1; argv[j][i] != '\0'; i++) // Examine the switch list
@@ -205,6 +231,9 @@ static void
    //-------------------------------------------------------------------------
    // Validate the parameters
    //-------------------------------------------------------------------------
+   if( threads == 0 )               // If hardware_concurrency unknown
+     threads= 1;
+
    if( fileName < 0 )               // If fileName not specified
    {
      error= TRUE;
@@ -333,13 +362,66 @@ static void
    }
 }
 
+//----------------------------------------------------------------------------
+//
+// Struct-
+//       Match
+//
+// Purpose-
+//       Sequence match descriptor.
+//
+//----------------------------------------------------------------------------
+struct Match {                      // Sequence match descriptor
+   unsigned            col;         // Item column index
+   unsigned            offset;      // Item offset
+}; // struct Match
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       scanRange
+//
+// Function-
+//       Scan a range of lines.
+//
+//----------------------------------------------------------------------------
+static void
+   scanRange(                       // Scan a range of lines
+     const WildScan*   scanner,     // The compiled sequence
+     std::vector<Match>* match,     // (OUTPUT) Matches, by line
+     unsigned          origin,      // The first line
+     unsigned          ending)      // The last line + 1
+{
+   unsigned            const L= scanner->getLength();
+   unsigned            const maxOffset= (maxCol < L) ? 0 : maxCol - L;
+
+   std::vector<unsigned> offset;    // Item match offsets
+   for(unsigned row= origin; row<ending; row++)
+   {
+     for(unsigned col=0;;col++)
+     {
+       const char* item= (char*)list[row].getItem(col);
+       if( item == NULL )
+         break;
+
+       offset.clear();
+       scanner->scan(item, minCol, maxOffset, offset);
+       for(unsigned i= 0; i<offset.size(); i++)
+       {
+         Match m= {col, offset[i]};
+         match[row].push_back(m);
+       }
+     }
+   }
+}
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
 //       scan
 //
 // Function-
-//       Scan the database, looking for duplicates.
+//       Scan the database, looking for a sequence.
 //
 //----------------------------------------------------------------------------
 static void
@@ -351,67 +433,54 @@ static void
    (void)fileName;                  // Currently unused
 
    unsigned            const m= eidb.getLineCount();
-   unsigned            const L= strlen(target);
-
-   const char*         S;           // -> String
-   char*               item;        // Source database Item
-   unsigned            col;         // Source column index
-   unsigned            row;         // Source row index
-   unsigned            count;       // Item match count
-   unsigned            length;      // Item length
-   unsigned            offset;      // Item offset
 
-   int                 i;
+   WildScan            scanner(target, mismatch);
+   std::vector<std::vector<Match> > match(m); // Matches, by line
 
    // Scan items
    fprintf(file, "\n");
-   fprintf(file, "Scan: '%s' Columns[%d:%d]\n", target, minCol+1, maxCol);
-
-   for(row= 0; row<m; row++)
+   if( mismatch == 0 )
+     fprintf(file, "Scan: '%s' Columns[%d:%d]\n", target, minCol+1, maxCol);
+   else
+     fprintf(file, "Scan: '%s' Columns[%d:%d] Mismatch[%d]\n",
+                   target, minCol+1, maxCol, mismatch);
+
+   unsigned T= threads < m ? threads : (m > 0 ? m : 1);
+   std::vector<std::thread> thread;
+   for(unsigned t= 0; t<T; t++)
    {
-     count= 0;
-     for(col=0;;col++)
-     {
-       item= (char*)list[row].getItem(col);
-       if( item == NULL )
-         break;
-
-       offset= minCol;
-       length= strlen(item);
-       if( maxCol < L )
-         length= 0;
+     unsigned origin= (unsigned)((uint64_t)m *  t      / T);
+     unsigned ending= (unsigned)((uint64_t)m * (t + 1) / T);
+     if( t+1 == T )
+       scanRange(&scanner, match.data(), origin, ending);
+     else
+       thread.push_back(std::thread(scanRange, &scanner, match.data(),
+                                    origin, ending));
+   }
 
-       else if( length > (maxCol-L) )
-         length= (maxCol-L);
+   for(unsigned t= 0; t<thread.size(); t++)
+     thread[t].join();
 
-       while( offset <= length )
-       {
-         S= wildstr(item+offset, target);
-         if( S == NULL )
-           break;
-         offset= S-item;
-         if( offset > length )
-           break;
-         offset++;
-
-         if( count == 0 )
-         {
-           fprintf(file, "\n%s\n", label.getLine(row));
-           for(i= 0; ;i++)
-           {
-             if( list[row].getItem(i) == NULL )
-               break;
-             if( i != 0 )
-               fprintf(file, " .. ");
-             fprintf(file, "%s", (char*)list[row].getItem(i));
-           }
-           fprintf(file, "\n");
-         }
-         count++;
+   // Write the matches, in line order
+   for(unsigned row= 0; row<m; row++)
+   {
+     if( match[row].empty() )
+       continue;
 
-         fprintf(file, "%s[%d], column[%d]\n", SCANNER_TYPE, col+1, offset);
-       }
+     fprintf(file, "\n%s\n", label.getLine(row));
+     for(unsigned i= 0; ;i++)
+     {
+       if( list[row].getItem(i) == NULL )
+         break;
+       if( i != 0 )
+         fprintf(file, " .. ");
+       fprintf(file, "%s", (char*)list[row].getItem(i));
      }
+     fprintf(file, "\n");
+
+     for(unsigned i= 0; i<match[row].size(); i++)
+       fprintf(file, "%s[%d], column[%d]\n", SCANNER_TYPE,
+                     match[row][i].col+1, match[row][i].offset+1);
    }
 }
 
@@ -451,6 +520,7 @@ extern int                          // Return code
    file= stdout;
    minCol= 0;
    maxCol= unsigned(-1);
+   mismatch= 0;
    for(argx= fileName+1; argx<argc; argx++)
    {
      if( *argv[argx] != '-' )
@@ -459,7 +529,7 @@ extern int                          // Return code
      }
      else
      {
-       if( memcmp(argv[argx], "-file:", 6) == 0 )
+       if( strncmp(argv[argx], "-file:", 6) == 0 )
        {
          name= argv[argx]+6;
          file= fopen(name, "wb");
@@ -472,7 +542,7 @@ extern int                          // Return code
            file= stdout;
          }
        }
-       else if( memcmp(argv[argx], "-min:", 5) == 0 )
+       else if( strncmp(argv[argx], "-min:", 5) == 0 )
        {
          minCol= atol(argv[argx]+5);
          if( minCol == 0 )
@@ -480,10 +550,19 @@ extern int                          // Return code
 
          minCol--;
        }
-       else if( memcmp(argv[argx], "-max:", 5) == 0 )
+       else if( strncmp(argv[argx], "-max:", 5) == 0 )
        {
          maxCol= atol(argv[argx]+5);
        }
+       else if( strncmp(argv[argx], "-mismatch:", 10) == 0 )
+       {
+         long count= atol(argv[argx]+10);
+         if( count < 0 )
+           fprintf(stderr, "Invalid mismatch count '%s' ignored!\n",
+                           argv[argx]);
+         else
+           mismatch= unsigned(count);
+       }
        else
          fprintf(stderr, "Scan option '%s' ignored!\n", argv[argx]);
      }
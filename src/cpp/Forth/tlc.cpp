@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2019-2020 Frank Eskesen.
+//       Copyright (c) 2019-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,15 +16,23 @@
 //       Threaded Language Compiler, i.e. Forth
 //
 // Last change date-
-//       2020/10/04
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
+#include <pub/Console.h>            // For pub::Console
+
 #include "tlc.h"
 
 //----------------------------------------------------------------------------
 // Constants for parameterization
 //----------------------------------------------------------------------------
+#ifndef MAIN                        // The threaded code and CC_MAIN
 #define MAIN "tlc_main.hpp"
+#endif
+
+#ifndef USE_DTC                     // Use the direct threaded code engine?
+#define USE_DTC false               // (CNEXT runs CNEXT_DTC if true)
+#endif
 
 #if false
 #include "tlc_main.hpp"
@@ -288,10 +296,10 @@ static void CGOTO(void) {
 static Word TGOTO[] = {(Word)CGOTO};
 
 //----------------------------------------------------------------------------
-// CNEXT: Threaded operation mode instruction processing loop
+// CNEXT_ITC: Threaded operation mode instruction processing loop
 //   Called with next instruction to execute on data stack
 //----------------------------------------------------------------------------
-static void CNEXT(void)
+static void CNEXT_ITC(void)
 {
    Word              PROGRAM[2]; // The program to execute
    Word              s_iaddr= i_addr; // The current i_addr
@@ -373,6 +381,19 @@ static void CNEXT(void)
    x_addr= s_xaddr;                 // Restore exit address
    i_addr= s_iaddr;                 // Restore instruction address
 }
+
+//----------------------------------------------------------------------------
+// CNEXT: Run the instruction on the data stack, using the USE_DTC engine
+//----------------------------------------------------------------------------
+static void CNEXT_DTC(void);        // (tlc_dtc.hpp)
+
+static void CNEXT(void)
+{
+   if( USE_DTC )
+     CNEXT_DTC();
+   else
+     CNEXT_ITC();
+}
 static Word TNEXT[] = {Word(CNEXT)};
 
 //----------------------------------------------------------------------------
@@ -399,6 +420,11 @@ static void CRESET(void) {
 // Threaded code
 //----------------------------------------------------------------------------
 #include MAIN
+#include "tlc_dtc.hpp"              // Direct threaded code engine
+
+#ifndef USE_CONSOLE                 // Use pub::Console? (MAIN may override)
+#define USE_CONSOLE true
+#endif
 
 //----------------------------------------------------------------------------
 //
@@ -415,13 +441,15 @@ static void
    code.item= (Word*)malloc(sizeof(Code) * CODE_SIZE);
    code.size= CODE_SIZE;
 
-   data.item= (Data*)malloc(sizeof(Data) * DATA_SIZE);
+   data.item= (Data*)malloc(sizeof(Data) * (DATA_SIZE + 1));
    data.size= DATA_SIZE;
 
-   if( data.item == nullptr || data.item == nullptr )
+   if( code.item == nullptr || data.item == nullptr )
      throwf("Storage shortage");
+   data.item++;                     // (data.item[-1] is a guard element)
 
-   pub::Console::start();
+   if( USE_CONSOLE )
+     pub::Console::start();
 }
 
 //----------------------------------------------------------------------------
@@ -436,10 +464,13 @@ static void
 static void
    term( void )                     // Terminate
 {
+   dtc_term();
+
    if( code.item ) free(code.item);
-   if( data.item ) free(data.item);
+   if( data.item ) free(data.item - 1);
 
-   pub::Console::stop();
+   if( USE_CONSOLE )
+     pub::Console::stop();
 }
 
 //----------------------------------------------------------------------------
@@ -0,0 +1,608 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       tlc_dtc.hpp
+//
+// Purpose-
+//       TLC direct threaded code engine.
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       Threads are translated, when first run, into cells containing the
+//       address of the operation's label followed by its inline operands.
+//       The inner interpreter dispatches using GCC labels as values.
+//
+//       The top Data Stack element is kept in a register while running.
+//       (data.item[-1] is a guard element, so an empty stack needs no test.)
+//       The Code Stack contains the compiled return addresses.
+//
+//       Built-in Code words run inline. Common sequences are fused into
+//       superinstructions: literal+add/sub, literal+fetch/store (including
+//       DEF_VAR), literal+compare+branch, and dup+branch on zero.
+//       Other Code words are called with the stacks, i_addr and i_word set
+//       as they would be by CNEXT_ITC. Only CDEBUG_IMMW of these is known
+//       to have an inline operand.
+//
+//       Unlike CNEXT_ITC, a nullptr in a thread is always a HALT. Alignment
+//       padding is not skipped. The USE_DEBUG counters are not maintained.
+//
+//----------------------------------------------------------------------------
+#include <map>                      // For std::map
+#include <vector>                   // For std::vector
+
+//----------------------------------------------------------------------------
+// CSTOP: Direct threaded program end (Not used by CNEXT_ITC)
+//----------------------------------------------------------------------------
+static void CSTOP(void) {
+}
+static Word TSTOP[] = {Word(CSTOP)};
+
+//----------------------------------------------------------------------------
+// The direct threaded operations
+//----------------------------------------------------------------------------
+#define DTC_OPS(X) \
+   X(CALL)   X(ENTER)  X(EXIT)   X(JUMP)   X(LIT)    X(HALT)   X(STOP) \
+   X(QUIT)   X(PUTI)   X(ABS)    X(ADD)    X(AND)    X(DEC)    X(DIV) \
+   X(DUP)    X(INC)    X(MAX)    X(MIN)    X(MOD)    X(MUL)    X(NEG) \
+   X(NOP)    X(NOT)    X(OR)     X(OVER)   X(PEEKC)  X(PEEKW)  X(POKEC) \
+   X(POKEW)  X(POP)    X(SUB)    X(SWAP)   X(XOR) \
+   X(IFEQZ)  X(IFGEZ)  X(IFGTZ)  X(IFLEZ)  X(IFLTZ)  X(IFNEZ) \
+   X(IFEQ)   X(IFGE)   X(IFGT)   X(IFLE)   X(IFLT)   X(IFNE) \
+   X(LIT_ADD) X(LIT_SUB) X(FETCH) X(STORE) X(DUP_IFEQZ) X(DUP_IFNEZ) \
+   X(LIT_IFEQ) X(LIT_IFGE) X(LIT_IFGT) X(LIT_IFLE) X(LIT_IFLT) X(LIT_IFNE)
+
+#define DTC_ENUM(op) OP_##op,
+enum DTC_OP                         // The direct threaded operations
+{  DTC_OPS(DTC_ENUM)
+   OP_COUNT                         // The number of operations
+}; // enum DTC_OP
+#undef DTC_ENUM
+
+//----------------------------------------------------------------------------
+// The built-in Code words run inline
+//----------------------------------------------------------------------------
+static const struct {               // Code word to operation map
+Code                   code;        // The Code word
+int                    op;          // The operation
+}                      dtc_code[]=
+{  {CEXIT,   OP_EXIT},   {CGOTO,   OP_JUMP},   {CIMMW,   OP_LIT}
+,  {CSTOP,   OP_STOP},   {CQUIT,   OP_QUIT},   {CPUTI,   OP_PUTI}
+,  {CABS,    OP_ABS},    {CADD,    OP_ADD},    {CAND,    OP_AND}
+,  {CDEC,    OP_DEC},    {CDIV,    OP_DIV},    {CDUP,    OP_DUP}
+,  {CINC,    OP_INC},    {CMAX,    OP_MAX},    {CMIN,    OP_MIN}
+,  {CMOD,    OP_MOD},    {CMUL,    OP_MUL},    {CNEG,    OP_NEG}
+,  {CNOP,    OP_NOP},    {CNOT,    OP_NOT},    {COR,     OP_OR}
+,  {COVER,   OP_OVER},   {CPEEKC,  OP_PEEKC},  {CPEEKW,  OP_PEEKW}
+,  {CPOKEC,  OP_POKEC},  {CPOKEW,  OP_POKEW},  {CPOP,    OP_POP}
+,  {CSUB,    OP_SUB},    {CSWAP,   OP_SWAP},   {CXOR,    OP_XOR}
+,  {CIFEQZ,  OP_IFEQZ},  {CIFGEZ,  OP_IFGEZ},  {CIFGTZ,  OP_IFGTZ}
+,  {CIFLEZ,  OP_IFLEZ},  {CIFLTZ,  OP_IFLTZ},  {CIFNEZ,  OP_IFNEZ}
+,  {CIFEQ,   OP_IFEQ},   {CIFGE,   OP_IFGE},   {CIFGT,   OP_IFGT}
+,  {CIFLE,   OP_IFLE},   {CIFLT,   OP_IFLT},   {CIFNE,   OP_IFNE}
+};
+
+//----------------------------------------------------------------------------
+// Internal data areas
+//----------------------------------------------------------------------------
+static void* const*    dtc_label= nullptr; // The operation label addresses
+static std::map<Word*, Word*>
+                       dtc_map;     // Thread address => compiled cell
+static std::map<Word, Word*>
+                       dtc_prog;    // Program Word => program thread
+static std::vector<Word*>
+                       dtc_heap;    // Allocated cells and programs
+static std::vector<std::pair<Word*, Word*>>
+                       dtc_link;    // Unresolved (cell, thread address)
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       dtc_op
+//
+// Purpose-
+//       Get the operation for a Word
+//
+// Implementation notes-
+//       Returns OP_HALT for nullptr and malformed words, OP_CALL for Code
+//       words that are not built in.
+//
+//----------------------------------------------------------------------------
+static int                          // The operation
+   dtc_op(                          // Get operation
+     Word              word)        // For this Word
+{
+   if( word == nullptr )
+     return OP_HALT;
+
+   Code code= *(Code*)word;
+   if( code == nullptr )            // (Malformed)
+     return OP_HALT;
+
+   for(size_t i= 0; i < sizeof(dtc_code) / sizeof(dtc_code[0]); i++)
+   {
+     if( dtc_code[i].code == code )
+       return dtc_code[i].op;
+   }
+
+   return OP_CALL;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       dtc_region
+//
+// Purpose-
+//       Compile a thread region
+//
+// Implementation notes-
+//       A region ends after an EXIT, GOTO, HALT, QUIT or STOP, or when it
+//       reaches code that's already compiled. Branch targets and DEF_SUB
+//       bodies are added to dtc_link, and are compiled by dtc_compile.
+//
+//----------------------------------------------------------------------------
+static Word*                        // The compiled region
+   dtc_region(                      // Compile a thread region
+     Word*             addr)        // The thread address
+{
+   std::vector<Word>   cell;        // The compiled cells
+   std::vector<std::pair<size_t, Word*>>
+                       link;        // Unresolved (cell index, address)
+   std::vector<std::pair<Word*, size_t>>
+                       where;       // Compiled (address, cell index)
+
+   auto emit= [&](int op) { cell.push_back(dtc_label[op]); };
+   auto jump= [&](Word* target) { link.push_back({cell.size(), target});
+                                  cell.push_back(nullptr); };
+
+   for(;;)
+   {
+     auto mi= dtc_map.find(addr);
+     if( mi != dtc_map.end() )      // If already compiled, join it
+     {
+       emit(OP_JUMP);
+       cell.push_back(Word(mi->second));
+       break;
+     }
+
+     where.push_back({addr, cell.size()});
+     Word word= *addr++;
+     if( word == nullptr )          // If HALT
+     {
+       emit(OP_HALT);
+       break;
+     }
+
+     // Literals: DEF_CON value, DEF_VAR address or CIMMW operand
+     int op;
+     Data value= 0;
+     Word head= *(Word*)word;
+     if( head == DEF_SUB )
+     {
+       emit(OP_ENTER);
+       jump((Word*)word + 1);
+       continue;
+     } else if( head == DEF_CON ) {
+       op= OP_LIT;
+       value= *((Data*)word + 1);
+     } else if( head == DEF_VAR ) {
+       op= OP_LIT;
+       value= Data((Word*)word + 1);
+     } else {
+       op= dtc_op(word);
+       if( op == OP_LIT )
+         value= Data(*addr++);
+     }
+
+     int next= OP_NOP;              // (Superinstruction candidate)
+     if( op == OP_LIT || op == OP_DUP )
+       next= dtc_op(*addr);
+     switch( op )
+     {
+       case OP_LIT:
+         if( next == OP_ADD || next == OP_SUB )
+         {
+           emit(next == OP_ADD ? OP_LIT_ADD : OP_LIT_SUB);
+           cell.push_back(Word(value));
+           addr++;
+         } else if( (next == OP_PEEKW || next == OP_POKEW) && value != 0 ) {
+           emit(next == OP_PEEKW ? OP_FETCH : OP_STORE);
+           cell.push_back(Word(value));
+           addr++;
+         } else if( next >= OP_IFEQ && next <= OP_IFNE ) {
+           emit(next - OP_IFEQ + OP_LIT_IFEQ);
+           cell.push_back(Word(value));
+           jump((Word*)addr[1]);
+           addr += 2;
+         } else {
+           emit(OP_LIT);
+           cell.push_back(Word(value));
+         }
+         break;
+
+       case OP_DUP:
+         if( next == OP_IFEQZ || next == OP_IFNEZ )
+         {
+           emit(next == OP_IFEQZ ? OP_DUP_IFEQZ : OP_DUP_IFNEZ);
+           jump((Word*)addr[1]);
+           addr += 2;
+         } else
+           emit(OP_DUP);
+         break;
+
+       case OP_CALL:
+         emit(OP_CALL);
+         cell.push_back(Word(addr - 1));
+         if( *(Code*)word == CDEBUG_IMMW )
+           addr++;
+         break;
+
+       case OP_PUTI:
+         emit(OP_PUTI);
+         cell.push_back(*addr++);
+         break;
+
+       case OP_EXIT:
+         emit(OP_EXIT);
+         break;
+
+       case OP_JUMP:
+         emit(OP_JUMP);
+         jump((Word*)*addr++);
+         break;
+
+       default:
+         emit(op);
+         if( op >= OP_IFEQZ && op <= OP_IFNE )
+           jump((Word*)*addr++);
+         break;
+     }
+
+     if( op == OP_EXIT || op == OP_JUMP || op == OP_HALT
+         || op == OP_STOP || op == OP_QUIT )
+       break;
+   }
+
+   Word* region= new Word[cell.size()];
+   dtc_heap.push_back(region);
+   for(size_t i= 0; i < cell.size(); i++)
+     region[i]= cell[i];
+
+   for(auto it : where)
+     dtc_map[it.first]= region + it.second;
+   for(auto it : link)
+     dtc_link.push_back({region + it.first, it.second});
+
+   return region;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       dtc_compile
+//
+// Purpose-
+//       Compile a thread, including everything it can reach
+//
+//----------------------------------------------------------------------------
+static Word*                        // The compiled thread
+   dtc_compile(                     // Compile a thread
+     Word*             addr)        // The thread address
+{
+   auto mi= dtc_map.find(addr);
+   if( mi != dtc_map.end() )
+     return mi->second;
+
+   Word* result= dtc_region(addr);
+   while( !dtc_link.empty() )
+   {
+     auto link= dtc_link.back();
+     dtc_link.pop_back();
+
+     mi= dtc_map.find(link.second);
+     if( mi != dtc_map.end() )
+       *link.first= Word(mi->second);
+     else
+       *link.first= Word(dtc_region(link.second));
+   }
+
+   return result;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       dtc_run
+//
+// Purpose-
+//       Run direct threaded code
+//
+// Implementation notes-
+//       dtc_run(nullptr) initializes dtc_label.
+//
+//----------------------------------------------------------------------------
+static void
+   dtc_run(                         // Run direct threaded code
+     Word*             ip)          // The compiled thread (nullptr: init)
+{
+#define DTC_LABEL(op) &&L_##op,
+   static void* const  label[]= { DTC_OPS(DTC_LABEL) };
+#undef DTC_LABEL
+
+   if( ip == nullptr )
+   {
+     dtc_label= label;
+     return;
+   }
+
+   Data* const         base= data.item; // The Data Stack origin
+   Data* const         sp_last= base + data.size - 1; // The Data Stack limit
+   Word* const         rp_base= code.item; // The Code Stack origin
+   Word* const         rp_last= code.item + code.size; // The Code Stack limit
+
+   Data*               sp;          // The Data Stack (top element) pointer
+   Data                tos;         // The top Data Stack element
+   Word*               rp;          // The Code Stack pointer
+
+   Data                lhs, rhs;    // Working operands
+
+#define LOAD() sp= base + data.used - 1; tos= *sp; rp= code.item + code.used
+#define SAVE() *sp= tos; data.used= sp - base + 1; code.used= rp - code.item
+#define NEED(n) IFCHECK( if( sp < base + ((n) - 1) ) goto E_UNDER; )
+#define ROOM() IFCHECK( if( sp >= sp_last ) goto E_OVER; )
+#define PUSH(v) ROOM(); *sp++= tos; tos= (v)
+#define NEXT() goto **ip++
+#define BRANCH(cc) if( cc ) ip= (Word*)*ip; else ip++; NEXT()
+
+   LOAD();
+   NEXT();
+
+   //-------------------------------------------------------------------------
+   // Control operations
+   //-------------------------------------------------------------------------
+L_CALL:
+   i_addr= *ip++;
+   i_word= *(Word*)i_addr;
+   SAVE();
+   (*(Code*)i_word)();
+   LOAD();
+   if( !operational )
+     return;
+   NEXT();
+
+L_ENTER:
+   IFCHECK( if( rp >= rp_last ) goto E_CODE; )
+   *rp++= Word(ip + 1);
+   ip= (Word*)*ip;
+   NEXT();
+
+L_EXIT:
+   IFCHECK( if( rp <= rp_base ) goto E_CODE; )
+   ip= (Word*)*--rp;
+   IFCHECK(
+     if( ip == nullptr )
+     {
+       SAVE();
+       debugf("ERROR: i_addr == nullptr\n");
+       return;
+     }
+   )
+   NEXT();
+
+L_JUMP:
+   ip= (Word*)*ip;
+   NEXT();
+
+L_LIT:
+   PUSH(Data(*ip++));
+   NEXT();
+
+L_HALT:
+   SAVE();
+   IFCHECK( debugf("ERROR: HALT detected\n"); )
+   return;
+
+L_STOP:
+   SAVE();
+   return;
+
+L_QUIT:
+   SAVE();
+   operational= false;
+   return;
+
+L_PUTI:
+   printf("%s", (char*)*ip++);
+   NEXT();
+
+   //-------------------------------------------------------------------------
+   // Stack and arithmetic operations
+   //-------------------------------------------------------------------------
+L_ABS:   NEED(1); if( tos < 0 ) tos= -tos; NEXT();
+L_ADD:   NEED(2); tos= *--sp + tos; NEXT();
+L_AND:   NEED(2); tos= *--sp & tos; NEXT();
+L_DEC:   NEED(1); tos--; NEXT();
+L_DIV:   NEED(2); tos= *--sp / tos; NEXT();
+L_DUP:   NEED(1); PUSH(tos); NEXT();
+L_INC:   NEED(1); tos++; NEXT();
+L_MAX:   NEED(2); lhs= *--sp; if( lhs > tos ) tos= lhs; NEXT();
+L_MIN:   NEED(2); lhs= *--sp; if( lhs < tos ) tos= lhs; NEXT();
+L_MOD:   NEED(2); tos= *--sp % tos; NEXT();
+L_MUL:   NEED(2); tos= *--sp * tos; NEXT();
+L_NEG:   NEED(1); tos= -tos; NEXT();
+L_NOP:   NEXT();
+L_NOT:   NEED(1); tos= !tos; NEXT();
+L_OR:    NEED(2); tos= *--sp | tos; NEXT();
+L_OVER:  NEED(2); lhs= sp[-1]; PUSH(lhs); NEXT();
+L_POP:   NEED(1); tos= *--sp; NEXT();
+L_SUB:   NEED(2); tos= *--sp - tos; NEXT();
+L_SWAP:  NEED(2); lhs= sp[-1]; sp[-1]= tos; tos= lhs; NEXT();
+L_XOR:   NEED(2); tos= *--sp ^ tos; NEXT();
+
+   //-------------------------------------------------------------------------
+   // Memory operations
+   //-------------------------------------------------------------------------
+L_PEEKC:
+   NEED(1);
+   IFCHECK( if( tos == 0 ) goto E_PEEK; )
+   tos= *(unsigned char*)tos;
+   NEXT();
+
+L_PEEKW:
+   NEED(1);
+   IFCHECK( if( tos == 0 ) goto E_PEEK; )
+   tos= *(Data*)tos;
+   NEXT();
+
+L_POKEC:
+   NEED(2);
+   lhs= tos;                        // (The address)
+   rhs= *--sp;                      // (The value)
+   tos= *--sp;
+   IFCHECK( if( lhs == 0 ) goto E_POKE; )
+   *(unsigned char*)lhs= rhs;
+   NEXT();
+
+L_POKEW:
+   NEED(2);
+   lhs= tos;                        // (The address)
+   rhs= *--sp;                      // (The value)
+   tos= *--sp;
+   IFCHECK( if( lhs == 0 ) goto E_POKE; )
+   *(Data*)lhs= rhs;
+   NEXT();
+
+   //-------------------------------------------------------------------------
+   // Branch operations
+   //-------------------------------------------------------------------------
+L_IFEQZ: NEED(1); lhs= tos; tos= *--sp; BRANCH( lhs == 0 );
+L_IFGEZ: NEED(1); lhs= tos; tos= *--sp; BRANCH( lhs >= 0 );
+L_IFGTZ: NEED(1); lhs= tos; tos= *--sp; BRANCH( lhs >  0 );
+L_IFLEZ: NEED(1); lhs= tos; tos= *--sp; BRANCH( lhs <= 0 );
+L_IFLTZ: NEED(1); lhs= tos; tos= *--sp; BRANCH( lhs <  0 );
+L_IFNEZ: NEED(1); lhs= tos; tos= *--sp; BRANCH( lhs != 0 );
+
+L_IFEQ:  NEED(2); rhs= tos; lhs= *--sp; tos= *--sp; BRANCH( lhs == rhs );
+L_IFGE:  NEED(2); rhs= tos; lhs= *--sp; tos= *--sp; BRANCH( lhs >= rhs );
+L_IFGT:  NEED(2); rhs= tos; lhs= *--sp; tos= *--sp; BRANCH( lhs >  rhs );
+L_IFLE:  NEED(2); rhs= tos; lhs= *--sp; tos= *--sp; BRANCH( lhs <= rhs );
+L_IFLT:  NEED(2); rhs= tos; lhs= *--sp; tos= *--sp; BRANCH( lhs <  rhs );
+L_IFNE:  NEED(2); rhs= tos; lhs= *--sp; tos= *--sp; BRANCH( lhs != rhs );
+
+   //-------------------------------------------------------------------------
+   // Superinstructions
+   //-------------------------------------------------------------------------
+L_LIT_ADD: NEED(1); tos += Data(*ip++); NEXT();
+L_LIT_SUB: NEED(1); tos -= Data(*ip++); NEXT();
+
+L_FETCH:   PUSH(*(Data*)*ip++); NEXT();
+L_STORE:   NEED(1); *(Data*)*ip++= tos; tos= *--sp; NEXT();
+
+L_DUP_IFEQZ: NEED(1); BRANCH( tos == 0 );
+L_DUP_IFNEZ: NEED(1); BRANCH( tos != 0 );
+
+#define LIT_IF(cc) NEED(1); lhs= tos; rhs= Data(*ip++); tos= *--sp; BRANCH(cc)
+L_LIT_IFEQ: LIT_IF( lhs == rhs );
+L_LIT_IFGE: LIT_IF( lhs >= rhs );
+L_LIT_IFGT: LIT_IF( lhs >  rhs );
+L_LIT_IFLE: LIT_IF( lhs <= rhs );
+L_LIT_IFLT: LIT_IF( lhs <  rhs );
+L_LIT_IFNE: LIT_IF( lhs != rhs );
+#undef LIT_IF
+
+   //-------------------------------------------------------------------------
+   // Error exits (stacks consistent)
+   //-------------------------------------------------------------------------
+E_UNDER:
+   SAVE();
+   throwf("Stack::pop underflow");
+
+E_OVER:
+   SAVE();
+   throwf("Stack::push overflow");
+
+E_CODE:
+   SAVE();
+   throwf("Stack::%s", rp <= rp_base ? "pop underflow" : "push overflow");
+
+E_PEEK:
+   tos= *--sp;
+   SAVE();
+   debugf("ERROR: nullptr PEEK detected\n");
+   operational= false;
+   return;
+
+E_POKE:
+   SAVE();
+   debugf("ERROR: nullptr POKE detected\n");
+   operational= false;
+   return;
+
+#undef LOAD
+#undef SAVE
+#undef NEED
+#undef ROOM
+#undef PUSH
+#undef NEXT
+#undef BRANCH
+}
+
+//----------------------------------------------------------------------------
+// CNEXT_DTC: Direct threaded code CNEXT
+//   Called with next instruction to execute on data stack
+//----------------------------------------------------------------------------
+static void CNEXT_DTC(void)
+{
+   Word              s_iaddr= i_addr; // The current i_addr
+
+   if( dtc_label == nullptr )       // If not initialized
+     dtc_run(nullptr);
+
+   Word word= Word(data.pop());     // Get THE instruction
+   Word* prog;                      // Its program, {word, TSTOP}
+   auto mi= dtc_prog.find(word);
+   if( mi != dtc_prog.end() )
+     prog= mi->second;
+   else
+   {
+     prog= new Word[2];
+     prog[0]= word;
+     prog[1]= TSTOP;
+     dtc_heap.push_back(prog);
+     dtc_prog[word]= prog;
+   }
+
+   dtc_run(dtc_compile(prog));
+   i_addr= s_iaddr;                 // Restore instruction address
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       dtc_term
+//
+// Purpose-
+//       Release the direct threaded code storage
+//
+//----------------------------------------------------------------------------
+static void
+   dtc_term( void )                 // Release direct threaded code
+{
+   for(Word* cells : dtc_heap)
+     delete[] cells;
+
+   dtc_heap.clear();
+   dtc_map.clear();
+   dtc_prog.clear();
+}
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2019 Frank Eskesen.
+//       Copyright (c) 2019-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -13,12 +13,20 @@
 //       tlc_test.hpp
 //
 // Purpose-
-//       TLC bringup tests.
+//       TLC bringup tests and benchmark.
 //
 // Last change date-
-//       2019/01/01
+//       2026/10/18
+//
+// Implementation notes-
+//       The regression tests and the benchmark run using both CNEXT_ITC and
+//       CNEXT_DTC. Build using -DMAIN='"tlc_test.hpp"' (make tlc_test.)
 //
 //----------------------------------------------------------------------------
+#include <pub/Clock.h>              // For pub::Clock
+
+#define USE_CONSOLE false           // (No terminal required)
+
 #include "tlc_base.hpp"             // Base functions
 #include "tlc_refs.hpp"             // Load references
 
@@ -139,19 +147,191 @@ static Word TH_MAIN[]=
 };
 
 //============================================================================
-// CC_MAIN
+// Benchmark data areas
 //============================================================================
-void CC_MAIN( void ) {
-   debugf("\nTH_UNIT\n"); debug_list((void**)TH_UNIT);
-   debugf("\nTH_REGR\n"); debug_list((void**)TH_REGRESSION);
-   debugf("\nTH_MAIN %p\n", TH_MAIN); debug_list((void**)TH_MAIN);
-   debugf("\nTH_NADA %p\n", TH_NADA); debug_list((void**)TH_NADA);
+static unsigned char   b_flags[8191]; // The sieve flags
+
+static Word B_COUNT[]= { DEF_VAR, Word(0) }; // The sieve prime count
+static Word B_FLAGS[]= { DEF_CON, Word(b_flags) }; // The sieve flags
+static Word B_PRIME[]= { DEF_VAR, Word(0) }; // The current sieve prime
+static Word B_SUM[]=   { DEF_VAR, Word(0) }; // The TH_B_SUM accumulator
+
+//============================================================================
+// Benchmark threads
+//============================================================================
+static Word TH_B_LOOP[]=            // (n) :: (0), Empty countdown loop
+{  DEF_SUB                          // 0
+,  TDEC, TDUP, TIFNEZ, TH_B_LOOP + 1 // 1..4   (n-1) Loop while n != 0
+,  TEXIT                            // 5
+};
+
+static Word TH_B_SUM[]=             // (n) :: (n*(n+1)/2), Variable update
+{  DEF_SUB                          // 0
+,  TIMMW, Word(0), B_SUM, TPOKEW    // 1..4   sum= 0
+,  TDUP, B_SUM, TPEEKW, TADD, B_SUM, TPOKEW // 5..10 sum += n
+,  TDEC, TDUP, TIFNEZ, TH_B_SUM + 5 // 11..14 (n-1) Loop while n != 0
+,  TPOP, B_SUM, TPEEKW              // 15..17 (sum)
+,  TEXIT                            // 18
+};
+
+static Word TH_B_FIB[]=             // (n) :: (fib(n)), Recursive calls
+{  DEF_SUB                          // 0
+,  TDUP, TIMMW, Word(2), TIFLT, TH_B_FIB + 13 // 1..5 (n) if( n < 2 ) return n
+,  TDEC, TDUP, TH_B_FIB             // 6..8   (n-1) (fib(n-1))
+,  TSWAP, TDEC, TH_B_FIB            // 9..11  (fib(n-1)) (fib(n-2))
+,  TADD                             // 12     (fib(n-1) + fib(n-2))
+,  TEXIT                            // 13
+};
+
+static Word TH_B_FILL[]=            // {} :: {}, b_flags[*]= 1
+{  DEF_SUB                          // 0
+,  TIMMW, Word(sizeof(b_flags))     // 1..2   (i)
+,  TDEC, TIMMW, Word(1), TOVER, B_FLAGS, TADD, TPOKEC // 3..9 (i-1) flag= 1
+,  TDUP, TIFNEZ, TH_B_FILL + 3      // 10..12 Loop while i != 0
+,  TPOP, TEXIT                      // 13..14
+};
+
+static Word TH_B_PASS[]=            // {} :: {}, One sieve pass (B_COUNT)
+{  DEF_SUB                          // 0
+,  TH_B_FILL                        // 1
+,  TIMMW, Word(0), B_COUNT, TPOKEW  // 2..5   count= 0
+,  TIMMW, Word(0)                   // 6..7   (i= 0)
+,  TDUP, B_FLAGS, TADD, TPEEKC      // 8..11  (i) (flags[i])
+,  TIFEQZ, TH_B_PASS + 47           // 12..13 if( !flags[i] ) next i
+,  TDUP, TDUP, TADD, TIMMW, Word(3), TADD // 14..19 (i) (prime= i+i+3)
+,  TDUP, B_PRIME, TPOKEW            // 20..22 (i) (prime)
+,  TOVER, TADD                      // 23..24 (i) (k= i+prime)
+,  TDUP, TIMMW, Word(sizeof(b_flags)), TIFGE, TH_B_PASS + 41 // 25..29
+,  TIMMW, Word(0), TOVER, B_FLAGS, TADD, TPOKEC // 30..35 (i) (k) flags[k]= 0
+,  B_PRIME, TPEEKW, TADD            // 36..38 (i) (k += prime)
+,  TGOTO, TH_B_PASS + 25            // 39..40
+,  TPOP                             // 41     (i)
+,  B_COUNT, TPEEKW, TINC, B_COUNT, TPOKEW // 42..46 count++
+,  TINC                             // 47     (i+1)
+,  TDUP, TIMMW, Word(sizeof(b_flags)), TIFLT, TH_B_PASS + 8 // 48..52
+,  TPOP, TEXIT                      // 53..54
+};
+
+static Word TH_B_SIEVE[]=           // (n) :: (count), n sieve passes
+{  DEF_SUB                          // 0
+,  TH_B_PASS                        // 1
+,  TDEC, TDUP, TIFNEZ, TH_B_SIEVE + 1 // 2..5 Loop while n != 0
+,  TPOP, B_COUNT, TPEEKW            // 6..8   (count)
+,  TEXIT                            // 9
+};
 
-   debugf("\nStarting TH_MAIN...\n");
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       bench_run
+//
+// Purpose-
+//       Run a benchmark thread
+//
+//----------------------------------------------------------------------------
+static double                       // The elapsed time, in seconds
+   bench_run(                       // Run a benchmark thread
+     Code              engine,      // Using this CNEXT engine
+     Word*             thread,      // The (DEF_SUB) benchmark thread
+     Data              arg,         // Its argument
+     Data&             result)      // (OUTPUT) Its result
+{
+   CRESET();                        // Reset the environment
+   data.push(arg);
+   data.push(Data(thread));
+
+   double start= pub::Clock::now();
+   engine();
+   double elapsed= pub::Clock::now() - start;
+
+   result= data.pop();
+   if( !operational || data.used != 8 ) // If stacks not as expected
+     result= ~result;
+   return elapsed;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       bench
+//
+// Purpose-
+//       Run the benchmark
+//
+//----------------------------------------------------------------------------
+static int                          // Error count
+   bench( void )                    // Run the benchmark
+{
+   static const struct {            // The benchmark workloads
+     const char*       name;        // The workload name
+     Word*             thread;      // The workload thread
+     Data              arg;         // Its argument
+     Data              expect;      // Its expected result
+   } work[]=
+   {  {"loop",  TH_B_LOOP,  10000000, 0}
+   ,  {"sum",   TH_B_SUM,    5000000, Data(5000000) * 5000001 / 2}
+   ,  {"fib",   TH_B_FIB,         30, 832040}
+   ,  {"sieve", TH_B_SIEVE,      100, 1899}
+   };
+
+   int error_count= 0;
+   debugf("\n%-8s %10s %10s %8s\n", "Workload", "ITC(ms)", "DTC(ms)", "Speedup");
+   for(auto& it : work)
+   {
+     Data itc_result, dtc_result;
+     double itc= bench_run(CNEXT_ITC, it.thread, it.arg, itc_result);
+     double dtc= bench_run(CNEXT_DTC, it.thread, it.arg, dtc_result);
+     debugf("%-8s %10.1f %10.1f %8.2f\n", it.name, itc * 1000.0
+           , dtc * 1000.0, itc / dtc);
+
+     if( itc_result != it.expect || dtc_result != it.expect )
+     {
+       error_count++;
+       debugf("%s: **FAILED** ITC(%zd) DTC(%zd) expected(%zd)\n", it.name
+             , itc_result, dtc_result, it.expect);
+     }
+   }
+
+   return error_count;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       regression
+//
+// Purpose-
+//       Run the regression test
+//
+//----------------------------------------------------------------------------
+static int                          // Error count
+   regression(                      // Run the regression test
+     Code              engine,      // Using this CNEXT engine
+     const char*       name)        // (The engine's name)
+{
+   debugf("\nStarting TH_MAIN (%s)...\n", name);
    CRESET();                        // Reset the environment
    data.push(Data(TH_MAIN));        // Set program word
-   CNEXT();                         // Run threaded mode
+   engine();                        // Run threaded mode
    if( !operational )
      debugf("ERROR: NOT OPERATIONAL\n");
    debugf("\n...TH_MAIN completed, operational(%d)\n", operational);
+
+   return !operational;
+}
+
+//============================================================================
+// CC_MAIN
+//============================================================================
+static void CC_MAIN( void ) {
+   debugf("\nTH_UNIT\n"); debug_list((void**)TH_UNIT);
+   debugf("\nTH_REGR\n"); debug_list((void**)TH_REGRESSION);
+   debugf("\nTH_MAIN %p\n", TH_MAIN); debug_list((void**)TH_MAIN);
+   debugf("\nTH_NADA %p\n", TH_NADA); debug_list((void**)TH_NADA);
+
+   int error_count= regression(CNEXT_ITC, "ITC");
+   error_count += regression(CNEXT_DTC, "DTC");
+   error_count += bench();
+
+   debugf("\n%d error%s\n", error_count, error_count == 1 ? "" : "s");
 }
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2018 Frank Eskesen.
+//       Copyright (c) 2018-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Define NN::MiddleLayer and associated storage objects
 //
 // Last change date-
-//       2018/01/01
+//       2026/10/18
 //
 // Storage per FanoutNeuron token (before page rounding)-
 //        2 getter
@@ -293,6 +293,7 @@ class FaninpNeuron : public Network { // FaninpNeuron Network descriptor
 public:
 MiddleLayer&           _layer;      // Our MiddleLayer
 InpNetwork*            _prevN;      // Our input Network
+OutNetwork*            _prevO= nullptr; // Our input Network, if OutNetwork
 Network*               _nextN;      // Our output Network
 Count                  _bundle_index; // Our bundle index
 Count                  _weight_index; // Our weight index
@@ -377,16 +378,20 @@ virtual RC                          // Fanin count
 
 inline Pulse                        // Fanin value
    faninp_bundle(                   // Drive faninp bundle
-     FanoutBundle&     bundle) const // The bundle
-{  Token const origin= _prevN->origin();
-
-   Pulse result= 0;
-   for(int i= 0; i<FanoutBundle::DIM; i++) {
-     Token index= origin + bundle.index[i];
-     result += to_pulse(_prevN->to_value(index), bundle.weight[i]);
+     FanoutBundle&     bundle,      // The bundle
+     const Value_t*    array= nullptr) const // The _prevN Value_t array
+{  Value_t value[FanoutBundle::DIM]; // The input values
+
+   if( array ) {                    // If the Value_t array is available
+     for(int i= 0; i<FanoutBundle::DIM; i++)
+       value[i]= array[bundle.index[i]];
+   } else {
+     Token const origin= _prevN->origin();
+     for(int i= 0; i<FanoutBundle::DIM; i++)
+       value[i]= _prevN->to_value(origin + bundle.index[i]);
    }
 
-   return result;
+   return dot_pulse(value, bundle.weight);
 }
 }; // class FaninpNeuron
 
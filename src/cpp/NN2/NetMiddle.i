@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2018 Frank Eskesen.
+//       Copyright (c) 2018-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       NetMiddle.h method implementations.
 //
 // Last change date-
-//       2018/01/01
+//       2026/10/18
 //
 // Implementation notes-
 //       For 64-bit GCC compile only (Does not use inttypes.h macros.)
@@ -173,6 +173,7 @@ Count                               // The build length
    _prevN= dynamic_cast<InpNetwork*>(_layer.build_locate(origin-1));
    if( _prevN == nullptr )
      throw BuildError("FaninpNeuron must follow InpNetwork");
+   _prevO= dynamic_cast<OutNetwork*>(_prevN);
    _nextN= _layer.build_locate(_ending);
    if( _nextN->length() != _length )
      throw BuildError("TEMPORARY: FaninpNeuron _nextN->length()");
@@ -317,12 +318,15 @@ RC                                  // Fanin count
    Count weight_index= get_weight_index(token);
    Weight_t* _weight= _layer.weight + weight_index;
 
+   // The _prevN Value_t array, if there is one
+   const Value_t* _array= _prevO ? _prevO->to_value() : nullptr;
+
    // TODO: Figure out how to distribute the pulse
    token += _length; // TEMPORARY: Just drive next layer
    // BUILD: Just drive the associated fanin
    RC rc= 0;
    for(Count i= 0; i<count; i++) {
-     Pulse pulse= faninp_bundle(*_bundle);
+     Pulse pulse= faninp_bundle(*_bundle, _array);
      Weight_t weight= *_weight;
      if( weight > 0 ) {
        if( pulse >= weight )
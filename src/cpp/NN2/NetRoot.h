@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2018 Frank Eskesen.
+//       Copyright (c) 2018-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,16 +16,31 @@
 //       Define the root Network Layer: Drives threads.
 //
 // Last change date-
-//       2018/01/01
+//       2026/10/18
 //
 // Implementation notes-
 //       TODO: Divide work by work_charge rather than by Token count.
 //
+//       In parallel mode (Root::set_parallel), a fixed Team of threads
+//       evaluates the Network in lock-step. Each leaf Network is a pass: its
+//       Token range is partitioned across the Team, and a Barrier separates
+//       each pass from the next.
+//
+//       Every Team member must reach every Barrier, so an exception thrown
+//       by a pass is recorded rather than propagated. The remaining passes
+//       are skipped, but their Barriers are still reached. Root::update then
+//       rethrows the first recorded exception once the Team is idle.
+//
 //----------------------------------------------------------------------------
 #ifndef NETROOT_H_INCLUDED
 #define NETROOT_H_INCLUDED
 
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <vector>
 #include <pthread.h>
+#include <sched.h>
 #include <unistd.h>
 
 #include "Network.h"
@@ -41,6 +56,10 @@
 #define USE_THREADING_MODEL false
 #endif
 
+#ifndef NETROOT_H_BARRIER_SPIN
+#define NETROOT_H_BARRIER_SPIN 4096 // Barrier spin count (before blocking)
+#endif
+
 namespace NETWORK_H_NAMESPACE {
 //----------------------------------------------------------------------------
 //
@@ -153,6 +172,141 @@ inline void
 }
 }; // class Thread
 
+//----------------------------------------------------------------------------
+//
+// Class-
+//       Barrier
+//
+// Purpose-
+//       Sense-reversing thread Barrier.
+//
+// Implementation notes-
+//       Each thread owns a local sense flag, initially false. The last thread
+//       to arrive resets the count and flips the global sense, releasing the
+//       others. Waiting threads spin briefly, then block.
+//
+//----------------------------------------------------------------------------
+class Barrier {                     // Sense-reversing Barrier
+//----------------------------------------------------------------------------
+// Barrier::Attributes
+//----------------------------------------------------------------------------
+protected:
+const unsigned         total;       // The number of threads
+std::atomic<unsigned>  count;       // The number of threads not yet arrived
+std::atomic<bool>      sense;       // The global sense
+std::mutex             mutex;       // Blocking wait mutex
+std::condition_variable
+                       event;       // Blocking wait event
+
+//----------------------------------------------------------------------------
+// Barrier::Constructors
+//----------------------------------------------------------------------------
+public:
+   Barrier(                         // Constructor
+     unsigned          total)       // The number of threads
+:  total(total), count(total), sense(false)
+{  IFDEBUG( debugf("Barrier(%p).Barrier(%u)\n", this, total); ) }
+
+   Barrier( void ) = delete;        // NO Default Constructor
+   Barrier(const Barrier&) = delete; // Disallowed copy constructor
+   Barrier& operator=(const Barrier&) = delete; // Disallowed assignment operator
+
+//----------------------------------------------------------------------------
+// Barrier::Methods
+//----------------------------------------------------------------------------
+public:
+inline void
+   wait(                            // Wait for all threads to arrive
+     bool&             local)       // This thread's local sense
+{  local= !local;                   // The sense that releases this wait
+   if( count.fetch_sub(1, std::memory_order_acq_rel) == 1 ) {
+     count.store(total, std::memory_order_relaxed);
+     std::lock_guard<std::mutex> lock(mutex);
+     sense.store(local, std::memory_order_release);
+     event.notify_all();
+     return;
+   }
+
+   for(unsigned spin= 0; spin<NETROOT_H_BARRIER_SPIN; spin++) {
+     if( sense.load(std::memory_order_acquire) == local )
+       return;
+     if( (spin & 63) == 63 )
+       sched_yield();
+   }
+
+   std::unique_lock<std::mutex> lock(mutex);
+   event.wait(lock, [&]{ return sense.load(std::memory_order_acquire) == local; });
+}
+}; // class Barrier
+
+class Root;                         // (Forward reference)
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       Team
+//
+// Purpose-
+//       A parallel mode Team member thread.
+//
+//----------------------------------------------------------------------------
+class Team {                        // A Team member thread
+//----------------------------------------------------------------------------
+// Team::Attributes
+//----------------------------------------------------------------------------
+public:
+Root&                  root;        // The Root Layer
+unsigned               member;      // Our Team member index
+bool                   local= false; // Our local Barrier sense
+pthread_t              thread_id= 0; // Our thread identifier
+
+//----------------------------------------------------------------------------
+// Team::Constructors
+//----------------------------------------------------------------------------
+public:
+   Team(                            // Data constructor
+     Root&             root,        // The Root Layer
+     unsigned          member)      // Our Team member index
+:  root(root), member(member)
+{  IFDEBUG( debugf("Team(%p).Team(%u)\n", this, member); ) }
+
+   Team( void ) = delete;           // NO Default Constructor
+   Team(const Team&) = delete;      // Disallowed copy constructor
+   Team& operator=(const Team&) = delete; // Disallowed assignment operator
+
+//----------------------------------------------------------------------------
+// Team::Methods
+//----------------------------------------------------------------------------
+protected:
+static inline void*                 // Resultant
+   driver(                          // Operate
+     void*             team);       // This Team member
+// Implementation follows class Root
+
+public:
+inline void
+   join( void )                     // Wait for completion
+{  int rc= pthread_join(thread_id, NULL);
+   if( rc != 0 ) assert( false );
+
+   thread_id= 0;
+}
+
+inline void
+   start( void )                    // Start the Team member thread
+{  assert( thread_id == 0 );        // Must not be running
+
+   pthread_attr_t      attr;
+   int rc= pthread_attr_init(&attr);
+   assert( rc == 0 );
+   pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+   pthread_attr_setstacksize(&attr, NETROOT_H_THREAD_STACK_SIZE);
+   rc= pthread_create(&thread_id, &attr, driver, (void*)this);
+   assert( rc == 0 );
+   pthread_attr_destroy(&attr);
+}
+}; // class Team
+
 //----------------------------------------------------------------------------
 //
 // Class-
@@ -170,6 +324,15 @@ public:
 unsigned               thread_count; // Our Thread count
 Thread**               thread_array; // Our Thread array
 
+// Parallel mode controls
+Barrier*               barrier= nullptr; // The Team Barrier
+std::vector<Team*>     team;        // The Team, [0] is the update() thread
+std::vector<Network*>  passes;      // The leaf Networks, in fanout order
+std::atomic<bool>      team_exit;   // TRUE when the Team is terminating
+std::atomic<bool>      team_fail;   // TRUE when a pass threw an exception
+std::exception_ptr     team_error;  // The first exception thrown by a pass
+std::mutex             team_mutex;  // Protects team_error
+
 //----------------------------------------------------------------------------
 // Root::Destructor/Constructor
 //----------------------------------------------------------------------------
@@ -177,6 +340,8 @@ public:
    ~Root( void )
 {  IFDEBUG( debugf("Root(%p).~Root\n", this); )
 
+   set_parallel(false);             // Terminate the Team
+
    for(unsigned i= 0; i<thread_count; i++)
      delete thread_array[i];
 
@@ -186,7 +351,8 @@ public:
    Root(
      unsigned          thread_count) // The number of Threads
 :  Layer(*this)
-,  thread_count(thread_count), thread_array(nullptr)
+,  thread_count(thread_count), thread_array(nullptr), team_exit(false)
+,  team_fail(false)
 {  IFDEBUG( debugf("Root(%p).Root\n", this); )
 
    thread_array= new Thread*[thread_count];
@@ -226,6 +392,88 @@ virtual Network*                    // The associated Network
    return (Network*)this;           // Avoid compiler warnings
 }
 
+//----------------------------------------------------------------------------
+// Root::Parallel mode methods
+//----------------------------------------------------------------------------
+protected:
+void
+   collect(                         // Collect the leaf Networks
+     Network*          network)     // From this Network
+{  Layer* layer= dynamic_cast<Layer*>(network);
+   if( layer == nullptr ) {
+     if( network->length() > 0 )
+       passes.push_back(network);
+     return;
+   }
+
+   for(size_t i= 0; i<layer->layers_used; i++)
+     collect(layer->layer_array[i]);
+}
+
+public:
+inline bool                         // TRUE iff parallel mode is active
+   is_parallel( void ) const        // Is parallel mode active?
+{  return barrier != nullptr; }
+
+inline void
+   parallel(                        // Run all passes
+     Team&             member)      // For this Team member
+{  Count members= team.size();
+   for(size_t p= 0; p<passes.size(); p++) {
+     Network* network= passes[p];
+     Count length= network->length();
+     Count origin= length *  member.member      / members;
+     Count ending= length * (member.member + 1) / members;
+     if( ending > origin && !team_fail.load(std::memory_order_relaxed) ) {
+       try {
+         network->fanout(network->origin() + origin, ending - origin);
+       } catch(...) {               // Record it, but reach every Barrier
+         std::lock_guard<std::mutex> lock(team_mutex);
+         if( !team_error )
+           team_error= std::current_exception();
+         team_fail= true;
+       }
+     }
+
+     barrier->wait(member.local);   // Lock-step: wait for this pass
+   }
+}
+
+void
+   set_parallel(                    // Set parallel mode
+     bool              active)      // TRUE to activate, FALSE to terminate
+{  if( active == is_parallel() )    // If no change
+     return;
+
+   if( active ) {                   // Start the Team (after the build)
+     if( thread_count == 0 )
+       throw ShouldNotOccur("Parallel mode, but no Threads");
+
+     passes.clear();
+     for(size_t i= 0; i<layers_used; i++)
+       collect(layer_array[i]);
+
+     team_exit= false;
+     barrier= new Barrier(thread_count);
+     for(unsigned i= 0; i<thread_count; i++)
+       team.push_back(new Team(*this, i));
+     for(unsigned i= 1; i<thread_count; i++)
+       team[i]->start();
+   } else {                         // Terminate the Team
+     team_exit= true;
+     barrier->wait(team[0]->local); // Release the Team
+     for(unsigned i= 1; i<team.size(); i++)
+       team[i]->join();
+
+     for(unsigned i= 0; i<team.size(); i++)
+       delete team[i];
+     team.clear();
+
+     delete barrier;
+     barrier= nullptr;
+   }
+}
+
 //----------------------------------------------------------------------------
 // Root::Methods
 //----------------------------------------------------------------------------
@@ -246,6 +494,19 @@ virtual void
    update( void )                   // Process new thread cycle
 {  Layer::update();                 // Prepare for new clock cycle
 
+   if( is_parallel() ) {            // Parallel mode, lock-step Team
+     barrier->wait(team[0]->local); // Start the Team
+     parallel(*team[0]);            // Run all passes
+
+     if( team_fail ) {              // If a pass failed, the Team is now idle
+       std::exception_ptr error= team_error;
+       team_error= nullptr;
+       team_fail= false;
+       std::rethrow_exception(error);
+     }
+     return;
+   }
+
 #if USE_THREADING_MODEL
    // Start the fanout threads
    Count count= length();           // Number of Networks
@@ -277,6 +538,38 @@ virtual void
 #endif
 }
 }; // class Root
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Team::driver
+//
+// Purpose-
+//       Team member thread: Wait for Root::update, then run all passes.
+//
+// Implementation notes-
+//       Root::parallel records pass exceptions, so every Barrier is reached.
+//       Root::update rethrows them.
+//
+//----------------------------------------------------------------------------
+void*                               // Resultant
+   Team::driver(                    // Operate
+     void*             thread)      // This Team member
+{  Team* team= (Team*)thread;
+   Root& root= team->root;
+   IFDEBUG( debugf("Team(%p).driver(%u)\n", team, team->member); )
+
+   for(;;) {
+     root.barrier->wait(team->local); // Wait for Root::update
+     if( root.team_exit )
+       break;
+
+     root.parallel(*team);          // (Pass exceptions are recorded)
+   }
+
+   IFDEBUG( debugf("Team(%p).*DONE*\n", team); )
+   return nullptr;
+}
 }  // namespace NETWORK_H_NAMESPACE
 
 #endif // NETROOT_H_INCLUDED
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2018 Frank Eskesen.
+//       Copyright (c) 2018-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Define the macros, types and requisite includes for Network.h
 //
 // Last change date-
-//       2018/01/01
+//       2026/10/18
 //
 // Usage note-
 //       #define NETWORK_H_NAMESPACE to override the default namespace name
@@ -41,6 +41,10 @@
 #include <string.h>                 // For memset, ...
 #include <typeinfo>                 // For typeid
 
+#if defined(__SSE2__)
+#include <emmintrin.h>              // For SSE2 intrinsics
+#endif
+
 #include "com/Debug.h"
 
 #include "Neuron.h"                 // Base class
@@ -249,6 +253,57 @@ inline Pulse                        // Adjusted Value_t
    return pulse;
 }
 
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       NN::dot_pulse
+//
+// Purpose-
+//       Sum(to_pulse(value[i], weight[i])), for a FanoutBundle::DIM bundle.
+//
+// Implementation notes-
+//       Each product is rounded (away from zero) before it is summed, so the
+//       SSE2 implementation cannot use a multiply-add. The int16 products
+//       are formed using mullo/mulhi, and the rounded division by Bundle_ONE
+//       uses double precision, which is exact for |value * weight| < 2**31.
+//
+//----------------------------------------------------------------------------
+inline Pulse                        // Resultant
+   dot_pulse(                       // Bundle dot product
+     const Value_t*    value,       // Input value array
+     const Bundle_weight_t*         // Input weight array
+                       weight)
+{
+#if defined(__SSE2__) && BUNDLE_DIM == 8 && !defined(NN_DOT_PULSE_SCALAR)
+   __m128i V= _mm_loadu_si128((const __m128i*)value);
+   __m128i W= _mm_loadu_si128((const __m128i*)weight);
+   __m128i L= _mm_mullo_epi16(V, W);
+   __m128i H= _mm_mulhi_epi16(V, W);
+   __m128i sum= _mm_setzero_si128();
+   const __m128d ONE= _mm_set1_pd(Bundle_ONE);
+   const __m128i BIAS= _mm_set1_epi32(Bundle_ONE - 1);
+   for(int half= 0; half<2; half++) {
+     __m128i P= half ? _mm_unpackhi_epi16(L, H) : _mm_unpacklo_epi16(L, H);
+     __m128i S= _mm_srai_epi32(P, 31); // -1 iff negative
+     __m128i A= _mm_sub_epi32(_mm_xor_si128(P, S), S); // abs(P)
+     A= _mm_add_epi32(A, BIAS);
+     __m128i Q0= _mm_cvttpd_epi32(_mm_div_pd(_mm_cvtepi32_pd(A), ONE));
+     __m128i Q1= _mm_cvttpd_epi32(_mm_div_pd(
+                   _mm_cvtepi32_pd(_mm_shuffle_epi32(A, 0xEE)), ONE));
+     __m128i Q= _mm_unpacklo_epi64(Q0, Q1);
+     sum= _mm_add_epi32(sum, _mm_sub_epi32(_mm_xor_si128(Q, S), S));
+   }
+   sum= _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+   sum= _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+   return _mm_cvtsi128_si32(sum);
+#else
+   Pulse result= 0;
+   for(int i= 0; i<BUNDLE_DIM; i++)
+     result += to_pulse(value[i], weight[i]);
+   return result;
+#endif
+}
+
 //----------------------------------------------------------------------------
 // Static flag for running explicit tests. Defined in Network.cpp
 //----------------------------------------------------------------------------
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2018 Frank Eskesen.
+//       Copyright (c) 2018-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Define Network video input and output classes.
 //
 // Last change date-
-//       2018/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef NETVIDEO_H_INCLUDED
@@ -182,7 +182,7 @@ virtual RC                          // Fanin count
      Token target= rand() & 0x7fffffff;
      target= target % out_count;
      target += _ending;
-     Pulse pulse= current[i].W;
+     Pulse pulse= current[(token-_origin) + i].W;
      rc += neuron->fanin(target, pulse);
    }
 
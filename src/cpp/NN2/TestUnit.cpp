@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2018 Frank Eskesen.
+//       Copyright (c) 2018-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Configuration unit test.
 //
 // Last change date-
-//       2018/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include "com/Debug.h"
@@ -42,6 +42,9 @@
 //----------------------------------------------------------------------------
 static const char*     fileName= nullptr; // Source file name
 static int             cycleCount= DEFAULT_CYCLES; // Iteration count
+static bool            parallel= false; // Use parallel mode?
+static bool            timing= false; // Time sequential and parallel modes?
+static unsigned        threads= 3;  // The Root Thread count
 static struct timespec delay= {0, 250000000}; // Iteration delay
 
 //----------------------------------------------------------------------------
@@ -61,6 +64,9 @@ static void
    fprintf(stderr, "\n");
    fprintf(stderr, "Options:\n");
    fprintf(stderr, "--cycles=n\tSet run cycle count\n");
+   fprintf(stderr, "--parallel\tUse parallel (lock-step) mode\n");
+   fprintf(stderr, "--threads=n\tSet Thread count\n");
+   fprintf(stderr, "--timing\tTime sequential and parallel modes\n");
    fprintf(stderr, "-v\tVerify parameters\n");
    exit(EXIT_FAILURE);
 }
@@ -102,6 +108,12 @@ static void
            error= true;
          else if( memcmp(argv[j]+2, "cycles=", 7) == 0 )
            cycleCount= atoi(argv[j]+9);
+         else if( strcmp(argv[j], "--parallel") == 0 )
+           parallel= true;
+         else if( memcmp(argv[j]+2, "threads=", 8) == 0 )
+           threads= atoi(argv[j]+10);
+         else if( strcmp(argv[j], "--timing") == 0 )
+           timing= true;
          else {
            error= true;
            fprintf(stderr, "Invalid control '%s'\n", argv[j]);
@@ -141,6 +153,11 @@ static void
    if( fileName == nullptr )
      fileName= CIFAR10_SOURCE;      // Default source file name
 
+   if( threads == 0 ) {
+     error= true;
+     fprintf(stderr, "Invalid thread count: 0\n");
+   }
+
    if( error )
      info(argv[0]);
 
@@ -148,29 +165,27 @@ static void
    {
      fprintf(stderr, "Cycle count: %d\n", cycleCount);
      fprintf(stderr, "File name: '%s'\n", fileName);
+     fprintf(stderr, "Parallel: %s\n", parallel ? "true" : "false");
+     fprintf(stderr, "Threads: %u\n", threads);
+     fprintf(stderr, "Timing: %s\n", timing ? "true" : "false");
    }
 }
 
 //----------------------------------------------------------------------------
 //
 // Subroutine-
-//       test_unit
+//       build
 //
 // Purpose-
-//       Configuration unit test.
+//       Build the test network.
 //
 //----------------------------------------------------------------------------
-static inline int                   // Error count
-   test_unit( void )                // Configuration unit test
-{  debugf("test_unit: Configuration unit test.\n");
-
-   int error_count = 0;
-
-{{{{
-   NN::Root            root(3);     // The Root instance
-   NN::VideoSourceCIFAR10
-                       source(fileName); // CIFAR10 VideoSource
-
+static NN::MiddleLayer*             // The MiddleLayer
+   build(                           // Build the test network
+     NN::Root&         root,        // The Root instance
+     NN::VideoSourceCIFAR10&
+                       source)      // The CIFAR10 VideoSource
+{
 // // This Layer is not needed. It's here to verify the basic Layer
 // NN::Layer*          outer= new NN::Layer(root);
 // root.insert_layer(outer);
@@ -198,6 +213,31 @@ static inline int                   // Error count
      retry |= root.build_update(i);
    }
 
+   return middle;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       test_unit
+//
+// Purpose-
+//       Configuration unit test.
+//
+//----------------------------------------------------------------------------
+static inline int                   // Error count
+   test_unit( void )                // Configuration unit test
+{  debugf("test_unit: Configuration unit test.\n");
+
+   int error_count = 0;
+
+{{{{
+   NN::Root            root(threads); // The Root instance
+   NN::VideoSourceCIFAR10
+                       source(fileName); // CIFAR10 VideoSource
+   NN::MiddleLayer*    middle= build(root, source);
+   root.set_parallel(parallel);
+
    debugf("\n\nBUILD_DEBUG >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\n");
    root.build_debug();              // Debug the build
 
@@ -219,6 +259,47 @@ static inline int                   // Error count
    return error_count;
 }
 
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       test_timing
+//
+// Purpose-
+//       Time the sequential and parallel modes.
+//
+//----------------------------------------------------------------------------
+static inline int                   // Error count
+   test_timing( void )              // Time sequential and parallel modes
+{  debugf("test_timing: %d cycles, %u threads\n", cycleCount, threads);
+
+   int error_count = 0;
+
+   double elapsed[2];               // Elapsed time, sequential and parallel
+   for(int mode= 0; mode<2; mode++) {
+     NN::Root          root(threads); // The Root instance
+     NN::VideoSourceCIFAR10
+                       source(fileName); // CIFAR10 VideoSource
+     build(root, source);
+     root.set_parallel(mode != 0);
+
+     Interval interval;
+     interval.start();
+     for(int i= 0; i<cycleCount; i++)
+       root.update();
+     elapsed[mode]= interval.stop();
+
+     debugf("%10s: %8.3f seconds, %8.3f ms/cycle\n"
+           , mode ? "parallel" : "sequential", elapsed[mode]
+           , elapsed[mode] * 1000.0 / (cycleCount ? cycleCount : 1));
+   }
+
+   if( elapsed[1] > 0.0 )
+     debugf("%10s: %8.3f\n", "speedup", elapsed[0] / elapsed[1]);
+
+   debugf("Error count: %d\n", error_count);
+   return error_count;
+}
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -239,7 +320,10 @@ extern int                          // Return code
    parm(argc, argv);
 
    try {
-     error_count += test_unit();
+     if( timing )
+       error_count += test_timing();
+     else
+       error_count += test_unit();
    } catch(NN::NetworkException& X) {
      debugf("%s.what(%s)\n", X.get_class_name().c_str(), X.what());
      error_count += 1;
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       (NN) Neural Net: Globals
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef NN_COM_H_INCLUDED
@@ -91,6 +91,9 @@ struct NN_com : public Zeroed       // Neural Net Common area
    unsigned char       sw_graph;    // Graphics traces
    unsigned char       sw_timer;    // Timing trace
    unsigned char       sw_trace;    // General traces
+   unsigned char       sw_csr;      // Use the CSR evaluation engine
+   unsigned char       sw_simd;     // Use the CSR vector kernel
+   int                 threads;     // CSR threads (0: one per processor)
    int                 sw_jig;      // (Used for code development)
 }; // struct NN_com
 
@@ -167,6 +170,14 @@ extern void*
      NN::PartId        part,        // Target partition identifier
      NN::Offset        offset);     // Target offset
 
+extern void*
+   nnuran(                          // Access unit range for reference
+     NN::FileId        file,        // Target file identifier
+     NN::PartId        part,        // Target partition identifier
+     NN::Offset        offset,      // Target offset
+     unsigned&         count,       // (IN) Unit count, (OUT) Units accessed
+     unsigned          size);       // Unit size
+
 extern void
    nnurel(                          // Release unit access
      NN::FileId        file,        // Target file identifier
@@ -179,6 +190,9 @@ extern void
 #define ref_fanin(fileId, offset) \
    (Fanin*)nnuref(fileId, NN::PartFanin, offset)
 
+#define rng_fanin(fileId, offset, count) \
+   (Fanin*)nnuran(fileId, NN::PartFanin, offset, count, sizeof(Fanin))
+
 #define rel_fanin(fileId, offset) \
    nnurel(fileId, NN::PartFanin, offset)
 
@@ -0,0 +1,776 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       NN_csr.cpp
+//
+// Purpose-
+//       (NN) Neural Net: Compressed Sparse Row evaluation engine
+//
+// Last change date-
+//       2026/10/18
+//
+// Entry points-
+//       nncsr      Evaluate network (CSR)
+//
+//----------------------------------------------------------------------------
+#include <unordered_map>
+#include <vector>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <pub/Worker.h>             // For pub::WorkerPool
+
+#include <com/Debug.h>
+#include <com/Interval.h>
+
+#include "NN_com.h"
+#include "NN_csr.h"
+
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+#define __SOURCE__       "NN_CSR  " // Source file, for debugging
+
+#define CSR_BLOCK               256 // The number of rows per parallel task
+#define CSR_LANES                 8 // The number of rows per vector group
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define CSR_X86                     // Use the AVX2 kernel (when available)
+#include <immintrin.h>
+#endif
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       opOf
+//
+// Purpose-
+//       Convert a Neuron type into an evaluation operation.
+//
+// Notes-
+//       This follows the NNrdval.cpp readval vector. Types with side
+//       effects (and invalid types) are not supported.
+//
+//----------------------------------------------------------------------------
+static int                          // The Op, -1 if not supported
+   opOf(                            // Get evaluation operation
+     unsigned          type)        // For this Neuron type
+{
+   switch( type )
+   {
+     case  1: return NN_csr::OpConst; // Constant
+     case 20: return NN_csr::OpInc; // Inc
+     case 21: return NN_csr::OpDec; // Dec
+     case 22: return NN_csr::OpSigma; // Add
+     case 23: return NN_csr::OpSub; // Sub
+     case 24: return NN_csr::OpMul; // Mul
+     case 25: return NN_csr::OpDiv; // Div
+     case 40: return NN_csr::OpAnd; // And
+     case 41: return NN_csr::OpOr;  // Or
+     case 42: return NN_csr::OpNand;// Nand
+     case 43: return NN_csr::OpNor; // Nor
+
+     case  0:                       // Abort
+     case  2:                       // Clock
+     case  6:                       // Store
+     case 50:                       // Until
+     case 51:                       // While
+       return -1;
+
+     default:
+       break;
+   }
+
+   if( type >= Neuron::TypeCOUNT )  // If invalid type
+     return -1;
+
+   return NN_csr::OpSigmoid;        // (All other types)
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       span
+//
+// Purpose-
+//       Get the summed fanin range of a row.
+//
+//----------------------------------------------------------------------------
+static inline void
+   span(                            // Get summed fanin range
+     unsigned          op,          // The row's operation
+     uint32_t          origin,      // The row's first fanin
+     uint32_t          ending,      // The row's last fanin + 1
+     uint32_t&         first,       // (OUTPUT) First summed fanin
+     uint32_t&         last)        // (OUTPUT) Last summed fanin + 1
+{
+   first= last= origin;             // Default, empty
+   switch( op )
+   {
+     case NN_csr::OpSigma:
+     case NN_csr::OpInc:
+     case NN_csr::OpDec:
+     case NN_csr::OpSigmoid:
+       last= ending;
+       break;
+
+     case NN_csr::OpSub:            // (fanin[0] is not summed)
+     case NN_csr::OpMul:
+     case NN_csr::OpDiv:
+       if( origin < ending )
+       {
+         first= origin + 1;
+         last= ending;
+       }
+       break;
+
+     default:                       // (Not summed)
+       break;
+   }
+}
+
+#ifdef CSR_X86
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       sigma_avx2
+//
+// Purpose-
+//       Compute CSR_LANES row sums, one row per lane.
+//
+// Implementation notes-
+//       Each lane accumulates weight[k] * value[index[k]] in fanin order,
+//       exactly as nnsigma does. (Separate multiply and add, no FMA.)
+//       Fanin and neuron indexes must be less than 2**31.
+//
+//       The sums are memory bound, and hardware gathers are slower than
+//       scalar loads on some processors. The kernel is therefore only used
+//       when requested (-simd).
+//
+//----------------------------------------------------------------------------
+__attribute__((target("avx2")))
+static void
+   sigma_avx2(                      // Compute CSR_LANES row sums
+     const uint32_t*   index,       // Fanin source neuron array
+     const NN::Weight* weight,      // Fanin weight array
+     const NN::Value*  value,       // Neuron value array
+     const uint32_t*   origin,      // First summed fanin, per lane
+     const uint32_t*   ending,      // Last summed fanin + 1, per lane
+     NN::Value*        sum)         // (OUTPUT) Sum, per lane
+{
+   __m256i pos= _mm256_loadu_si256((const __m256i*)origin);
+   __m256i end= _mm256_loadu_si256((const __m256i*)ending);
+   __m256i one= _mm256_set1_epi32(1);
+   __m256  acc= _mm256_setzero_ps();
+
+   for(;;)
+   {
+     __m256i live= _mm256_cmpgt_epi32(end, pos);
+     if( _mm256_testz_si256(live, live) )
+       break;
+
+     __m256i ix= _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                   (const int*)index, pos, live, 4);
+     __m256  w=  _mm256_mask_i32gather_ps(_mm256_setzero_ps(),
+                   weight, pos, _mm256_castsi256_ps(live), 4);
+     __m256  v=  _mm256_mask_i32gather_ps(_mm256_setzero_ps(),
+                   value, ix, _mm256_castsi256_ps(live), 4);
+
+     __m256  add= _mm256_add_ps(acc, _mm256_mul_ps(w, v));
+     acc= _mm256_blendv_ps(acc, add, _mm256_castsi256_ps(live));
+     pos= _mm256_add_epi32(pos, _mm256_and_si256(live, one));
+   }
+
+   _mm256_storeu_ps(sum, acc);
+}
+#endif
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       NN_csr::~NN_csr
+//
+// Purpose-
+//       Destructor
+//
+//----------------------------------------------------------------------------
+   NN_csr::~NN_csr( void )          // Destructor
+{
+   reset();
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       NN_csr::NN_csr
+//
+// Purpose-
+//       Constructor
+//
+//----------------------------------------------------------------------------
+   NN_csr::NN_csr( void )           // Constructor
+:  neurons(0), fanins(0), levels(0), initial(0), reads(0)
+,  level(NULL), row(NULL), index(NULL), weight(NULL), value(NULL)
+,  op(NULL), fileId(NULL), offset(NULL)
+{
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       NN_csr::evaluate
+//
+// Purpose-
+//       Evaluate the network, level by level.
+//
+//----------------------------------------------------------------------------
+NN::Value                           // The initial neuron's value
+   NN_csr::evaluate(                // Evaluate the network
+     unsigned          threads)     // Using this many threads
+{
+   if( threads < 1 )
+     threads= 1;
+
+   for(uint32_t L= 0; L<levels; L++)
+   {
+     uint32_t origin= level[L];
+     uint32_t ending= level[L+1];
+     unsigned count= threads;
+     if( count > (ending - origin) / CSR_BLOCK )
+       count= (ending - origin) / CSR_BLOCK;
+
+     if( count < 2 )                // If not worth the overhead
+     {
+       sweep(origin, ending);
+       continue;
+     }
+
+     uint32_t blocks= (ending - origin + CSR_BLOCK - 1) / CSR_BLOCK;
+     pub::WorkerPool::parallel(count, blocks,
+       [this, origin, ending](size_t block)
+       {
+         uint32_t first= origin + uint32_t(block) * CSR_BLOCK;
+         uint32_t last= first + CSR_BLOCK;
+         if( last > ending )
+           last= ending;
+         sweep(first, last);
+       });
+   }
+
+   return value[initial];
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       NN_csr::load
+//
+// Purpose-
+//       Export the network reachable from a neuron.
+//
+// Implementation notes-
+//       Neurons are discovered breadth first, then leveled using an
+//       iterative depth first search (which also detects fanin cycles.)
+//       Neurons already evaluated in this clock cycle, and disabled
+//       neurons, are not evaluated: nnreadv uses their current value.
+//
+//----------------------------------------------------------------------------
+int                                 // Return code (RC)
+   NN_csr::load(                    // Export the network
+     NN::FileId        fileN,       // Initial neuron FileId
+     NN::Offset        offsetN,     // Initial neuron Offset
+     uint64_t          limit)       // Storage limit (bytes)
+{
+   std::unordered_map<uint64_t, uint32_t> map; // (FileId,Offset) => node
+   std::vector<NN::FileId>  nFile;  // Node FileId
+   std::vector<NN::Offset>  nOffset;// Node Offset
+   std::vector<unsigned char> nOp;  // Node operation
+   std::vector<NN::Value>   nValue; // Node (current) value
+   std::vector<uint32_t>    nFirst; // Node first (temporary) fanin
+   std::vector<uint32_t>    nCount; // Node fanin count
+   std::vector<uint32_t>    fNode;  // Fanin source node
+   std::vector<NN::Weight>  fWeight;// Fanin weight
+
+   reset();
+
+   //-------------------------------------------------------------------------
+   // Discover the network
+   //-------------------------------------------------------------------------
+   auto locate= [&](NN::FileId file, NN::Offset offset) -> uint32_t
+   {
+     uint64_t key= (uint64_t(file) << 48) | offset;
+     auto it= map.find(key);
+     if( it != map.end() )
+       return it->second;
+
+     uint32_t node= uint32_t(nFile.size());
+     map[key]= node;
+     nFile.push_back(file);
+     nOffset.push_back(offset);
+     return node;
+   };
+
+   locate(fileN, offsetN);
+   for(uint32_t node= 0; node < nFile.size(); node++)
+   {
+     if( (uint64_t(nFile.size()) * 64 + uint64_t(fNode.size()) * 16) > limit
+         || fNode.size() >= 0x7fffffffUL )
+       return RC_STORAGE;
+
+     NN::FileId file= nFile[node];
+     NN::Offset offset= nOffset[node];
+     Neuron* ptrN= ref_neuron(file, offset);
+     if( ptrN == NULL )
+       return RC_DAMAGED;
+
+     int type= opOf(ptrN->type);
+     if( type < 0 )
+     {
+       rel_neuron(file, offset);
+       return RC_UNSUPPORTED;
+     }
+
+     NN::Vaddr vaddr= ptrN->faninVaddr;
+     uint32_t total= ptrN->faninCount;
+     nValue.push_back(ptrN->value);
+     nFirst.push_back(uint32_t(fNode.size()));
+     if( ptrN->clock == NN_COM.clock || ptrN->ex.disabled )
+     {
+       type= OpCopy;                // Not evaluated
+       total= 0;
+     }
+     nOp.push_back((unsigned char)type);
+     nCount.push_back(total);
+     rel_neuron(file, offset);
+
+     unsigned count;                // Number of FANINs accessed
+     for(uint32_t fanix= 0; fanix < total; fanix += count)
+     {
+       count= total - fanix;
+       Fanin* ptrF= rng_fanin(file, vaddr, count);
+       if( ptrF == NULL )
+         return RC_DAMAGED;
+
+       for(unsigned i= 0; i<count; i++)
+       {
+         fNode.push_back(locate(ptrF[i].fileId, ptrF[i].neuron));
+         fWeight.push_back(ptrF[i].weight);
+       }
+       rel_fanin(file, vaddr);
+       vaddr += count * sizeof(Fanin);
+     }
+   }
+
+   //-------------------------------------------------------------------------
+   // Compute each node's level, detecting cycles
+   //-------------------------------------------------------------------------
+   uint32_t nodes= uint32_t(nFile.size());
+   std::vector<uint32_t> nLevel(nodes, 0); // Node level
+   std::vector<unsigned char> color(nodes, 0); // 0: new, 1: active, 2: done
+   std::vector<std::pair<uint32_t, uint32_t>> stack; // (node, next fanin)
+   uint32_t maxLevel= 0;
+
+   stack.push_back(std::make_pair(0, 0));
+   color[0]= 1;
+   while( !stack.empty() )
+   {
+     uint32_t node= stack.back().first;
+     uint32_t fanix= stack.back().second;
+     if( fanix < nCount[node] )
+     {
+       stack.back().second++;
+       uint32_t from= fNode[nFirst[node] + fanix];
+       if( color[from] == 1 )
+         return RC_CYCLE;
+
+       if( color[from] == 0 )
+       {
+         color[from]= 1;
+         stack.push_back(std::make_pair(from, 0));
+       }
+       continue;
+     }
+
+     uint32_t L= 0;
+     for(fanix= 0; fanix < nCount[node]; fanix++)
+     {
+       uint32_t from= fNode[nFirst[node] + fanix];
+       if( nLevel[from] + 1 > L )
+         L= nLevel[from] + 1;
+     }
+     nLevel[node]= L;
+     if( L > maxLevel )
+       maxLevel= L;
+     color[node]= 2;
+     stack.pop_back();
+   }
+
+   //-------------------------------------------------------------------------
+   // Allocate the arrays
+   //-------------------------------------------------------------------------
+   neurons= nodes;
+   fanins= uint32_t(fNode.size());
+   levels= maxLevel + 1;
+
+   level=  (uint32_t*)malloc(sizeof(uint32_t) * (levels + 1));
+   row=    (uint32_t*)malloc(sizeof(uint32_t) * (neurons + 1));
+   index=  (uint32_t*)malloc(sizeof(uint32_t) * (fanins + 1));
+   weight= (NN::Weight*)malloc(sizeof(NN::Weight) * (fanins + 1));
+   value=  (NN::Value*)malloc(sizeof(NN::Value) * neurons);
+   op=     (unsigned char*)malloc(sizeof(unsigned char) * neurons);
+   fileId= (NN::FileId*)malloc(sizeof(NN::FileId) * neurons);
+   offset= (NN::Offset*)malloc(sizeof(NN::Offset) * neurons);
+   if( level == NULL || row == NULL || index == NULL || weight == NULL
+       || value == NULL || op == NULL || fileId == NULL || offset == NULL )
+   {
+     reset();
+     return RC_STORAGE;
+   }
+
+   //-------------------------------------------------------------------------
+   // Order the nodes by level (counting sort)
+   //-------------------------------------------------------------------------
+   memset(level, 0, sizeof(uint32_t) * (levels + 1));
+   for(uint32_t node= 0; node < nodes; node++)
+     level[nLevel[node] + 1]++;
+   for(uint32_t L= 0; L<levels; L++)
+     level[L+1] += level[L];
+
+   std::vector<uint32_t> slot(level, level + levels); // Next row, per level
+   std::vector<uint32_t> rowOf(nodes); // Node => row
+   for(uint32_t node= 0; node < nodes; node++)
+     rowOf[node]= slot[nLevel[node]]++;
+
+   std::vector<uint32_t> nodeOf(nodes); // Row => node
+   for(uint32_t node= 0; node < nodes; node++)
+     nodeOf[rowOf[node]]= node;
+
+   //-------------------------------------------------------------------------
+   // Build the rows
+   //-------------------------------------------------------------------------
+   uint32_t k= 0;
+   reads= 1;                        // (The initial neuron)
+   for(uint32_t r= 0; r < nodes; r++)
+   {
+     uint32_t node= nodeOf[r];
+     row[r]= k;
+     value[r]= nValue[node];
+     op[r]= nOp[node];
+     fileId[r]= nFile[node];
+     offset[r]= nOffset[node];
+
+     uint32_t first= nFirst[node];
+     for(uint32_t fanix= 0; fanix < nCount[node]; fanix++)
+     {
+       index[k]= rowOf[fNode[first + fanix]];
+       weight[k]= fWeight[first + fanix];
+       k++;
+     }
+     reads += nCount[node];
+   }
+   row[nodes]= k;
+   initial= rowOf[0];
+
+   return RC_NORMAL;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       NN_csr::reset
+//
+// Purpose-
+//       Release the network.
+//
+//----------------------------------------------------------------------------
+void
+   NN_csr::reset( void )            // Release the network
+{
+   free(level);
+   free(row);
+   free(index);
+   free(weight);
+   free(value);
+   free(op);
+   free(fileId);
+   free(offset);
+
+   level= row= index= NULL;
+   weight= NULL;
+   value= NULL;
+   op= NULL;
+   fileId= NULL;
+   offset= NULL;
+
+   neurons= fanins= levels= initial= 0;
+   reads= 0;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       NN_csr::store
+//
+// Purpose-
+//       Store the evaluated values, as nnreadv would have.
+//
+//----------------------------------------------------------------------------
+void
+   NN_csr::store( void )            // Store evaluated values
+{
+   for(uint32_t r= 0; r < neurons; r++)
+   {
+     if( op[r] == OpCopy )          // If not evaluated
+       continue;
+
+     Neuron* ptrN= chg_neuron(fileId[r], offset[r]);
+     if( ptrN == NULL )
+       continue;
+
+     ptrN->clock= NN_COM.clock;
+     ptrN->value= value[r];
+     switch( op[r] )
+     {
+       case OpAnd:                  // (Booleans scan to end of file)
+       case OpOr:
+       case OpNand:
+       case OpNor:
+         ptrN->ex.eof= TRUE;
+         break;
+
+       case OpSub:                  // (fanin[0] read past end of file)
+       case OpMul:
+       case OpDiv:
+         if( row[r] == row[r+1] )
+           ptrN->ex.eof= TRUE;
+         break;
+
+       default:
+         break;
+     }
+     rel_neuron(fileId[r], offset[r]);
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       NN_csr::sweep
+//
+// Purpose-
+//       Evaluate a range of rows.
+//
+// Implementation notes-
+//       All fanins of the rows must already have been evaluated.
+//
+//----------------------------------------------------------------------------
+void
+   NN_csr::sweep(                   // Evaluate a range of rows
+     uint32_t          origin,      // First row
+     uint32_t          ending)      // Last row + 1
+{
+   uint32_t            first[CSR_LANES]; // First summed fanin, per lane
+   uint32_t            last[CSR_LANES]; // Last summed fanin + 1, per lane
+   NN::Value           sum[CSR_LANES]; // Sum, per lane
+
+#ifdef CSR_X86
+   static const int avx2= __builtin_cpu_supports("avx2");
+   const int simd= avx2 && NN_COM.sw_simd;
+#endif
+
+   for(uint32_t r= origin; r < ending; r += CSR_LANES)
+   {
+     unsigned lanes= CSR_LANES;
+     if( lanes > ending - r )
+       lanes= ending - r;
+
+     //-----------------------------------------------------------------------
+     // Compute the sums
+     //-----------------------------------------------------------------------
+     for(unsigned l= 0; l<lanes; l++)
+       span(op[r+l], row[r+l], row[r+l+1], first[l], last[l]);
+
+#ifdef CSR_X86
+     if( simd && lanes == CSR_LANES )
+       sigma_avx2(index, weight, value, first, last, sum);
+     else
+#endif
+     {
+       for(unsigned l= 0; l<lanes; l++)
+       {
+         NN::Value resultant= 0;
+         for(uint32_t k= first[l]; k < last[l]; k++)
+           resultant += weight[k] * value[index[k]];
+         sum[l]= resultant;
+       }
+     }
+
+     //-----------------------------------------------------------------------
+     // Compute the resultants
+     //-----------------------------------------------------------------------
+     for(unsigned l= 0; l<lanes; l++)
+     {
+       uint32_t R= r + l;
+       NN::Value inpsignal= sum[l];
+       NN::Value resultant;
+       switch( op[R] )
+       {
+         case OpInc:
+           resultant= inpsignal + 1.0;
+           break;
+
+         case OpDec:
+           resultant= inpsignal - 1.0;
+           break;
+
+         case OpSigma:
+           resultant= inpsignal;
+           break;
+
+         case OpSigmoid:
+           resultant= 1.0 / (1.0 + exp(-inpsignal));
+           break;
+
+         case OpSub:
+         case OpMul:
+         case OpDiv:
+         {
+           NN::Value element= 0;    // First element
+           if( row[R] < row[R+1] )
+             element= weight[row[R]] * value[index[row[R]]];
+
+           if( op[R] == OpSub )
+             resultant= element - inpsignal;
+           else if( op[R] == OpMul )
+             resultant= element * inpsignal;
+           else
+             resultant= element / inpsignal;
+           break;
+         }
+
+         case OpAnd:
+         case OpOr:
+         case OpNand:
+         case OpNor:
+         {
+           int zero= FALSE;         // TRUE if any input == 0
+           int nonz= FALSE;         // TRUE if any input != 0
+           for(uint32_t k= row[R]; k < row[R+1]; k++)
+           {
+             if( weight[k] * value[index[k]] == 0 )
+               zero= TRUE;
+             else
+               nonz= TRUE;
+           }
+
+           if( op[R] == OpAnd )
+             resultant= zero ? FALSE : TRUE;
+           else if( op[R] == OpOr )
+             resultant= nonz ? TRUE : FALSE;
+           else if( op[R] == OpNand )
+             resultant= zero ? TRUE : FALSE;
+           else
+             resultant= nonz ? FALSE : TRUE;
+           break;
+         }
+
+         default:                   // OpCopy, OpConst: unchanged
+           resultant= value[R];
+           break;
+       }
+       value[R]= resultant;
+     }
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       nncsr
+//
+// Purpose-
+//       Evaluate a network using the CSR engine.
+//
+// Implementation notes-
+//       The network is not evaluated (and FALSE is returned) if the CSR
+//       engine is disabled, debugging or tracing is active, or the network
+//       cannot be loaded. The caller then uses nnreadv.
+//
+//----------------------------------------------------------------------------
+extern int                          // TRUE if evaluated
+   nncsr(                           // Evaluate network (CSR)
+     NN::FileId        fileN,       // Initial neuron FileId
+     NN::Offset        offsetN,     // Initial neuron Offset
+     NN::Value&        resultant)   // (OUTPUT) Resultant
+{
+   static const char*  reason[]= {"", "unsupported neuron type",
+                                  "fanin cycle", "damaged network",
+                                  "network too large"};
+   NN_csr              csr;         // The CSR network
+   Interval            timer;       // Interval timer
+
+   if( !NN_COM.sw_csr || NN_debug || NN_trace )
+     return FALSE;
+
+   //-------------------------------------------------------------------------
+   // Load the network
+   //-------------------------------------------------------------------------
+   uint64_t limit= uint64_t(sysconf(_SC_PHYS_PAGES))
+                 * uint64_t(sysconf(_SC_PAGESIZE)) / 2;
+   timer.start();
+   int rc= csr.load(fileN, offsetN, limit);
+   timer.stop();
+   if( rc != NN_csr::RC_NORMAL )
+   {
+     if( NN_timer )
+       printf("CSR: %s, using nnreadv\n", reason[rc]);
+     return FALSE;
+   }
+   double loaded= timer.toDouble();
+
+   //-------------------------------------------------------------------------
+   // Evaluate the network
+   //-------------------------------------------------------------------------
+   unsigned threads= NN_COM.threads;
+   if( threads == 0 )
+     threads= unsigned(sysconf(_SC_NPROCESSORS_ONLN));
+
+   timer.start();
+   resultant= csr.evaluate(threads);
+   timer.stop();
+   csr.store();
+   if( threads > 1 )
+     pub::WorkerPool::reset();
+
+   //-------------------------------------------------------------------------
+   // Update the read_val() count
+   //-------------------------------------------------------------------------
+   uint64_t count= (uint64_t(uint32_t(NN_COM.read_val[0])) << 32)
+                 | uint32_t(NN_COM.read_val[1]);
+   count += csr.getReads();
+   NN_COM.read_val[0]= int32_t(count >> 32);
+   NN_COM.read_val[1]= int32_t(count);
+
+   if( NN_timer )
+   {
+     printf("CSR: %10u neurons %10u fanins %6u levels %3u threads\n",
+            csr.getNeurons(), csr.getFanins(), csr.getLevels(), threads);
+     printf("CSR: %14.3f Seconds load, %14.3f Seconds evaluation\n",
+            loaded, timer.toDouble());
+   }
+
+   return TRUE;
+}
@@ -0,0 +1,172 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       NN_csr.h
+//
+// Purpose-
+//       (NN) Neural Net: Compressed Sparse Row evaluation engine
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       The network reachable from an initial neuron is exported from the
+//       paging space into flat arrays: neurons are ordered by level (the
+//       length of the longest fanin path to a neuron that is not evaluated)
+//       and the fanins of each neuron are a contiguous row of (index,
+//       weight) pairs. Each level only depends upon the levels before it,
+//       so a level's rows are evaluated in parallel.
+//
+//       The evaluation produces the same values as nnreadv. Each row sum is
+//       accumulated in fanin order, so the vector kernel evaluates one row
+//       per lane rather than splitting a row across lanes.
+//
+//       Networks containing neurons with side effects (Clock, Store, While,
+//       Until), invalid or damaged neurons, or fanin cycles are rejected by
+//       load and must be evaluated using nnreadv.
+//
+//----------------------------------------------------------------------------
+#ifndef NN_CSR_H_INCLUDED
+#define NN_CSR_H_INCLUDED
+
+#include <stdint.h>
+
+#ifndef NN_H_INCLUDED
+#include "NN.h"
+#endif
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       NN_csr
+//
+// Purpose-
+//       Compressed Sparse Row network.
+//
+//----------------------------------------------------------------------------
+class NN_csr                        // Compressed Sparse Row network
+{
+//----------------------------------------------------------------------------
+// NN_csr::Enumerations and typedefs
+//----------------------------------------------------------------------------
+public:
+enum Op                             // Evaluation operation
+{  OpCopy= 0                        // Not evaluated (value unchanged)
+,  OpConst                          // Constant (fanins evaluated, ignored)
+,  OpSigma                          // SUM(weight[i] * value[i])
+,  OpInc                            // SUM + 1
+,  OpDec                            // SUM - 1
+,  OpSigmoid                        // 1 / (1 + exp(-SUM))
+,  OpSub                            // fanin[0] - SUM(1..n)
+,  OpMul                            // fanin[0] * SUM(1..n)
+,  OpDiv                            // fanin[0] / SUM(1..n)
+,  OpAnd                            // AND(fanin[i])
+,  OpOr                             // OR(fanin[i])
+,  OpNand                           // NAND(fanin[i])
+,  OpNor                            // NOR(fanin[i])
+,  OpCOUNT                          // The number of operations
+}; // enum Op
+
+enum RC                             // load return codes
+{  RC_NORMAL= 0                     // Normal, network loaded
+,  RC_UNSUPPORTED                   // Neuron type not supported
+,  RC_CYCLE                         // Fanin cycle
+,  RC_DAMAGED                       // Neuron or fanin access failure
+,  RC_STORAGE                       // Network too large
+}; // enum RC
+
+//----------------------------------------------------------------------------
+// NN_csr::Constructors
+//----------------------------------------------------------------------------
+public:
+   ~NN_csr( void );                 // Destructor
+   NN_csr( void );                  // Constructor
+
+private:                            // Bitwise copy is prohibited
+   NN_csr(const NN_csr&);           // Disallowed copy constructor
+   NN_csr& operator=(const NN_csr&);// Disallowed assignment operator
+
+//----------------------------------------------------------------------------
+// NN_csr::Accessors
+//----------------------------------------------------------------------------
+public:
+inline uint32_t                     // The number of fanins
+   getFanins( void ) const
+{  return fanins; }
+
+inline uint32_t                     // The number of levels
+   getLevels( void ) const
+{  return levels; }
+
+inline uint32_t                     // The number of neurons
+   getNeurons( void ) const
+{  return neurons; }
+
+inline uint64_t                     // The equivalent nnreadv count
+   getReads( void ) const
+{  return reads; }
+
+//----------------------------------------------------------------------------
+// NN_csr::Methods
+//----------------------------------------------------------------------------
+public:
+NN::Value                           // The initial neuron's value
+   evaluate(                        // Evaluate the network
+     unsigned          threads);    // Using this many threads
+
+int                                 // Return code (RC)
+   load(                            // Export the network
+     NN::FileId        fileId,      // Initial neuron FileId
+     NN::Offset        offset,      // Initial neuron Offset
+     uint64_t          limit);      // Storage limit (bytes)
+
+void
+   reset( void );                   // Release the network
+
+void
+   store( void );                   // Store evaluated values (and clocks)
+
+void
+   sweep(                           // Evaluate a range of rows
+     uint32_t          origin,      // First row
+     uint32_t          ending);     // Last row + 1
+
+//----------------------------------------------------------------------------
+// NN_csr::Attributes
+//----------------------------------------------------------------------------
+protected:
+   uint32_t            neurons;     // The number of neurons
+   uint32_t            fanins;      // The number of fanins
+   uint32_t            levels;      // The number of levels
+   uint32_t            initial;     // The initial neuron's row
+   uint64_t            reads;       // The equivalent nnreadv count
+
+   uint32_t*           level;       // Level origin row [levels + 1]
+   uint32_t*           row;         // Row origin fanin [neurons + 1]
+   uint32_t*           index;       // Fanin source neuron [fanins]
+   NN::Weight*         weight;      // Fanin weight [fanins]
+   NN::Value*          value;       // Neuron value [neurons]
+   unsigned char*      op;          // Neuron operation [neurons]
+   NN::FileId*         fileId;      // Neuron FileId [neurons]
+   NN::Offset*         offset;      // Neuron Offset [neurons]
+}; // class NN_csr
+
+//----------------------------------------------------------------------------
+// External routines
+//----------------------------------------------------------------------------
+extern int                          // TRUE if evaluated
+   nncsr(                           // Evaluate network (CSR)
+     NN::FileId        fileId,      // Initial neuron FileId
+     NN::Offset        offset,      // Initial neuron Offset
+     NN::Value&        resultant);  // (OUTPUT) Resultant
+
+#endif // NN_CSR_H_INCLUDED
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,10 +16,11 @@
 //       Neural Net Virtual Paging Subsystem extentions.
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
 //
 // Entry points-
 //       nnuchg     Access unit for change
+//       nnuran     Access unit range for reference
 //       nnuref     Access unit for reference
 //       nnurel     Release access
 //
@@ -99,6 +100,59 @@ extern void*
    return(ptrunit);
 }
 
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       nnuran
+//
+// Purpose-
+//       Access unit range for reference.
+//
+// Implementation notes-
+//       Only the units contained in the first frame of the range are
+//       accessed, and count is updated to reflect that number. A single
+//       nnurel(file, part, offset) releases them.
+//
+//       NULL is returned if the first unit spans a frame boundary.
+//
+//----------------------------------------------------------------------------
+extern void*
+   nnuran(                          // Access unit range for reference
+     NN::FileId        file,        // Target file identifier
+     NN::PartId        part,        // Target part identifier
+     NN::Offset        offset,      // Target offset
+     unsigned&         count,       // (IN) Unit count, (OUT) Units accessed
+     unsigned          size)        // Unit size
+{
+   unsigned char*      ptrunit;     // Pointer to unit
+
+   PGSVSIZE_T length= count * size; // The range length
+   ptrunit= (unsigned char*)
+            NN_COM.pgs.accessRange(fpo(file, part, offset), length);
+   if( ptrunit == NULL )
+   {
+     errorf("%.8lX=nnuran(%.2ld,%.2ld,0x%.8lX,%u)\n",
+            P2L(ptrunit), (long)file, (long)part, (long)offset, count);
+     exit(EXIT_FAILURE);
+   }
+
+   if( length < size )              // If the first unit spans frames
+   {
+     errorf("%.8lX=nnuran(%.2ld,%.2ld,0x%.8lX,%u) unit spans frames\n",
+            P2L(ptrunit), (long)file, (long)part, (long)offset, count);
+     NN_COM.pgs.release(fpo(file, part, offset));
+     return NULL;
+   }
+   count= length / size;
+
+   if( HCDM )
+     tracef("%.8lX=nnuran(%.2ld,%.2ld,0x%.8lX,%u) 0x%.2x%.2x%.2x%.2x\n",
+            P2L(ptrunit), (long)file, (long)part, (long)offset, count,
+            *(ptrunit+0), *(ptrunit+1), *(ptrunit+2), *(ptrunit+3));
+
+   return(ptrunit);
+}
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Neural Net: FANIN utility functions
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
 //
 // Entry points-
 //       nndamage   Indicate neuron damage
@@ -135,6 +135,7 @@ extern void
 {
    Fanin*              ptrF;        // -> Fanin (Internal address)
 
+   unsigned            count;       // Number of FANINs accessed
    unsigned            fanix;       // Current FANIN index
    NN::Offset          offset;      // -> Fanin (Internal, current)
 
@@ -142,19 +143,21 @@ extern void
    // Read (but ignore) the fanin values
    //-------------------------------------------------------------------------
    offset= ptrN->faninVaddr;        // Address the 1st fanin
-   for(fanix= 0; fanix < ptrN->faninCount; fanix++)
+   for(fanix= 0; fanix < ptrN->faninCount; fanix += count)
    {
-     ptrF= ref_fanin(fileN, offset);// Access the fanin
+     count= ptrN->faninCount - fanix;
+     ptrF= rng_fanin(fileN, offset, count); // Access the fanins
      if( ptrF == NULL )             // If invalid queue
      {
        nndamage(fileN, ptrN, offset); // Indicate damage
        return;
      }
 
-     nnreadv(ptrF->fileId, ptrF->neuron); // Read the NEURON
-     rel_fanin(fileN, offset);      // Release the current FANIN
+     for(unsigned i= 0; i<count; i++)
+       nnreadv(ptrF[i].fileId, ptrF[i].neuron); // Read the NEURON
+     rel_fanin(fileN, offset);      // Release the accessed FANINs
 
-     offset += sizeof(Fanin);       // Address the next FANIN
+     offset += count * sizeof(Fanin); // Address the next FANIN
    }
 }
 
@@ -175,6 +178,7 @@ extern NN::Value
    NN::Value           resultant;   // Resultant
    Fanin*              ptrF;        // -> Fanin (Internal address)
 
+   unsigned            count;       // Number of FANINs accessed
    unsigned            fanix;       // Current FANIN index
    NN::Offset          offset;      // -> Fanin (Internal, current)
 
@@ -184,15 +188,17 @@ extern NN::Value
    resultant= 0;                    // Initialize the resultant
 
    offset= ptrN->faninVaddr;        // Address the 1st fanin
-   for( fanix=0; fanix < ptrN->faninCount; fanix++) // Calculate resultant
+   for(fanix= 0; fanix < ptrN->faninCount; fanix += count) // For each frame
    {
-     ptrF= ref_fanin(fileN, offset);// Access the fanin
+     count= ptrN->faninCount - fanix;
+     ptrF= rng_fanin(fileN, offset, count); // Access the fanins
      if( ptrF == NULL )
        return(nndamage(fileN, ptrN, offset));
 
-     resultant += ptrF->weight * nnreadv(ptrF->fileId, ptrF->neuron);
-     rel_fanin(fileN, offset);     // Release the current FANIN
-     offset += sizeof(Fanin);      // Address the next FANIN
+     for(unsigned i= 0; i<count; i++)
+       resultant += ptrF[i].weight * nnreadv(ptrF[i].fileId, ptrF[i].neuron);
+     rel_fanin(fileN, offset);      // Release the accessed FANINs
+     offset += count * sizeof(Fanin); // Address the next FANIN
    }
 
    return(resultant);
@@ -219,6 +225,7 @@ extern NN::Value
    NN::Value           resultant;   // Resultant
    Fanin*              ptrF;        // -> Fanin (Internal address)
 
+   unsigned            count;       // Number of FANINs accessed
    unsigned            fanix;       // Current FANIN index
    NN::Offset          offset;      // -> Fanin (Internal, current)
 
@@ -228,15 +235,17 @@ extern NN::Value
    resultant= 0;                    // Initialize the resultant
 
    offset= ptrN->faninVaddr + sizeof(Fanin); // Address the 2nd fanin
-   for( fanix=1; fanix < ptrN->faninCount; fanix++) // Calculate resultant
+   for(fanix= 1; fanix < ptrN->faninCount; fanix += count) // For each frame
    {
-     ptrF= ref_fanin(fileN, offset);// Access the fanin
+     count= ptrN->faninCount - fanix;
+     ptrF= rng_fanin(fileN, offset, count); // Access the fanins
      if( ptrF == NULL )
        return(nndamage(fileN, ptrN, offset));
 
-     resultant += ptrF->weight * nnreadv(ptrF->fileId, ptrF->neuron);
-     rel_fanin(fileN, offset);     // Release the current FANIN
-     offset += sizeof(Fanin);      // Address the next FANIN
+     for(unsigned i= 0; i<count; i++)
+       resultant += ptrF[i].weight * nnreadv(ptrF[i].fileId, ptrF[i].neuron);
+     rel_fanin(fileN, offset);      // Release the accessed FANINs
+     offset += count * sizeof(Fanin); // Address the next FANIN
    }
 
    return(resultant);
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Neural Network Compiler control program.
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <ctype.h>
@@ -32,6 +32,7 @@
 #include <com/syslib.h>
 
 #include "NN_com.h"
+#include "NN_csr.h"
 #include "NN_psv.h"
 
 //----------------------------------------------------------------------------
@@ -155,7 +156,8 @@ extern int                          // Return code
    // Activate the net
    //-------------------------------------------------------------------------
    timer.start();                   // Start the wall clock timer
-   resultant= nnreadv(fileId, neuron); // Begin processing
+   if( !nncsr(fileId, neuron, resultant) ) // If CSR evaluation failed
+     resultant= nnreadv(fileId, neuron); // Begin processing
    timer.stop();                    // Stop the wall clock timer
 
    //-------------------------------------------------------------------------
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,9 +16,10 @@
 //       Neural Net Parameter analysis.
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -78,6 +79,10 @@ static void
        PARM_STR "t        Internal trace\n"
        PARM_STR "time     Development timer\n"
        PARM_STR "jig:     Development jig\n"
+       PARM_STR "csr      CSR evaluation engine (default)\n"
+       PARM_STR "csr-     Paged (nnreadv) evaluation\n"
+       PARM_STR "simd     CSR vector (AVX2) kernel\n"
+       PARM_STR "threads: CSR evaluation threads (default: one per processor)\n"
        );
 
    exit(EXIT_FAILURE);
@@ -110,6 +115,7 @@ extern void
    // Defaults
    //-------------------------------------------------------------------------
    verify= 0;                       // Default, no verification
+   NN_COM.sw_csr= TRUE;             // Default, CSR evaluation engine
 
    //-------------------------------------------------------------------------
    // Argument analysis
@@ -147,6 +153,25 @@ extern void
        else if (swname("jig:", argp))// If development jig
          NN_jig= swatol("jig:", argp);// Get parameter value
 
+       else if (swname("csr", argp))// If CSR evaluation switch
+         NN_COM.sw_csr= swatob("csr", argp);// Get switch value
+
+       else if (swname("simd", argp))// If CSR vector kernel switch
+         NN_COM.sw_simd= swatob("simd", argp);// Get switch value
+
+       else if (swname("threads:", argp))// If CSR evaluation threads
+       {
+         long threads= swatol("threads:", argp);// Get parameter value
+         if (threads <= 0 || threads > INT_MAX)// If invalid thread count
+         {
+           error= TRUE;
+           fprintf(stderr, "Invalid parameter '%s' ignored\n",
+                           argv[argi]);
+         }
+         else
+           NN_COM.threads= int(threads);
+       }
+
        else                         // If invalid switch
        {
          error= TRUE;
@@ -207,6 +232,9 @@ extern void
      fprintf(stderr,"%8s General Trace\n",   tf(NN_trace));
      fprintf(stderr,"%8s Timing Trace\n",    tf(NN_timer));
      fprintf(stderr,"%8d Development jig\n", NN_jig);
+     fprintf(stderr,"%8s CSR evaluation\n", tf(NN_COM.sw_csr));
+     fprintf(stderr,"%8s CSR vector kernel\n", tf(NN_COM.sw_simd));
+     fprintf(stderr,"%8d CSR threads\n",    NN_COM.threads);
      c= getchar();
      if (c == 27)
        exit(EXIT_FAILURE);
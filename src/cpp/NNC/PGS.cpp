@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007-2009 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       PGS object methods.
 //
 // Last change date-
-//       2009/01/01
+//       2026/10/18
 //
 // ControlFile-
 //       PGS.INI
@@ -25,6 +25,9 @@
 //           filename= filename   ; Trace filename, default "PGS.OUT")
 //           traceLevel = 0..19   ; Less..More tracing (> 10 HCDM)
 //
+//           [Paging]
+//           mode= LRU | CLOCK | MMAP ; Paging mode, default LRU
+//
 //----------------------------------------------------------------------------
 #define __STDC_FORMAT_MACROS        // For linux inttypes.h
 
@@ -37,6 +40,12 @@
 #include <unistd.h>
 #include <sys/stat.h>
 
+#ifndef _OS_WIN
+  #include <sys/mman.h>
+  #include <sys/resource.h>
+#endif
+
+#include <com/istring.h>
 #include <com/syslib.h>
 #include <com/Debug.h>
 #include <com/FileInfo.h>
@@ -83,6 +92,9 @@
 //----------------------------------------------------------------------------
 #define CONTROL_FRAMESZ         256 // The minimum framesize
 #define DIAGFILE_NAME     "PGS.INI" // The control file's name
+#define PGS_READAHEAD             4 // Number of accessRange read-ahead frames
+#define PGS_MAPLOG2              26 // LOG2(PGS_MAPSIZE)
+#define PGS_MAPSIZE (1 << PGS_MAPLOG2) // The MODE_MMAP segment size
 
 #define PGSINIT_DUPINIT        (-1) // Error: already initialized
 #define PGSINIT_COMPLETE          0 // Normal completion
@@ -148,11 +160,13 @@
 #define TRACE_REF_WORD 0
 #define TRACE_SCI_WORD 0
 #define TRACE_REL_WORD 0
+#define TRACE_RNG_WORD 0
 
 #define TRACE_CHG_MASK 0x01
 #define TRACE_REF_MASK 0x02
 #define TRACE_SCI_MASK 0x04
 #define TRACE_REL_MASK 0x10
+#define TRACE_RNG_MASK 0x20
 
 //----------------------------------------------------------------------------
 //
@@ -238,6 +252,11 @@ void
 // PGS_File::Methods
 //----------------------------------------------------------------------------
 public:
+void
+   advise(                          // Advise that a frame will be read
+     int32_t           dsize,       // Data size
+     PGSXADDR_T        xaddr);      // Data offset
+
 int                                 // Return code (0 OK)
    rd(                              // Read frame
      void*             daddr,       // Data address
@@ -281,6 +300,24 @@ struct PGS::IOD {                   // File Descriptor
    PGS_File            file;        // File descriptor
 }; // struct PGS::IOD
 
+//----------------------------------------------------------------------------
+//
+// Struct-
+//       PGS::MAP
+//
+// Purpose-
+//       Mapped File Descriptor (MODE_MMAP)
+//
+// Usage notes-
+//       Each file is mapped in PGS_MAPSIZE segments, as they are referenced.
+//       Segments remain mapped until the paging space is terminated.
+//
+//----------------------------------------------------------------------------
+struct PGS::MAP {                   // Mapped File Descriptor
+   char**              segment;     // -> Mapped segment array
+   uint64_t            segments;    // Number of segment array elements
+}; // struct PGS::MAP
+
 //----------------------------------------------------------------------------
 //
 // Struct-
@@ -307,6 +344,7 @@ enum FSM                            // Finite State Machine values
    unsigned char       chgi;        // Change indicator
    uint16_t            refc;        // Reference counter
 #define RFD_MAXREFC    0xFFFF       // Largest possible reference count
+   unsigned char       refb;        // Reference bit (MODE_CLOCK)
 }; // struct PGS::RFD
 
 //----------------------------------------------------------------------------
@@ -508,6 +546,33 @@ static inline void
    diag_trace.tracef("%10" PRId64 " %s\n", value, name);
 }
 
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       getFaults
+//
+// Purpose-
+//       Get the process page fault counters.
+//
+//----------------------------------------------------------------------------
+static void
+   getFaults(                       // Get page fault counters
+     uint64_t&         major,       // (OUTPUT) Major fault count
+     uint64_t&         minor)       // (OUTPUT) Minor fault count
+{
+   major= minor= 0;
+
+#ifndef _OS_WIN
+   struct rusage       usage;       // Resource usage
+
+   if( getrusage(RUSAGE_SELF, &usage) == 0 )
+   {
+     major= usage.ru_majflt;
+     minor= usage.ru_minflt;
+   }
+#endif
+}
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -689,6 +754,34 @@ void
    }
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       PGS::traceMap
+//
+// Purpose-
+//       Trace an access operation (MODE_MMAP)
+//
+//----------------------------------------------------------------------------
+void
+   PGS::traceMap(                   // Trace an access operation
+     const char*       opCode,      // Operation code
+     char*             raddr,       // Real address
+     PGSVADDR_T        vaddr)       // Virtual Address
+{
+   if( raddr == NULL )
+     tracef("**NULL**= %s(%.8lX.%.8lX) "
+            "[--------.--------] --------\n",
+            opCode, long(vaddr>>32), long(vaddr));
+   else
+     tracef("%.8lX= %s(%.8lX.%.8lX)"
+            " [*MAPPED*.*MAPPED*]"
+            " %.2x%.2x%.2x%.2x\n",
+            long(raddr), opCode, long(vaddr>>32), long(vaddr),
+            *(raddr+0)&0x00ff, *(raddr+1)&0x00ff,
+            *(raddr+2)&0x00ff, *(raddr+3)&0x00ff);
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -891,6 +984,10 @@ int                                 // Return code
 void
    PGS::statistics( void )          // Statistics display
 {
+   static const char*  modeName[]= {"LRU", "CLOCK", "MMAP"};
+
+   uint64_t            major;       // Major page faults
+   uint64_t            minor;       // Minor page faults
    unsigned            i;
 
    //-------------------------------------------------------------------------
@@ -909,6 +1006,7 @@ void
    tracef("\n");
    tracef("Global statistics\n"
           "-----------------\n");
+   tracef("%10s mode\n",      modeName[mode]);
    tracef("%10ld framesize\n", (long)framesize);
    tracef("%10ld rframes\n",   (long)rframes);
    tracef("%10ld vframeu\n",   (long)xframeu);
@@ -920,6 +1018,7 @@ void
    statistic(diag_trace, stat_opchg, "accessChg()");
    statistic(diag_trace, stat_opref, "accessRef()");
    statistic(diag_trace, stat_opsci, "accessSCI()");
+   statistic(diag_trace, stat_oprng, "accessRange()");
    statistic(diag_trace, stat_oprel, "release()");
 
    tracef("\n");
@@ -930,10 +1029,31 @@ void
    statistic(diag_trace, stat_recrd, "reclaimRead");
    statistic(diag_trace, stat_recwr, "reclaimWrite");
    statistic(diag_trace, stat_reuse, "reclaimInUse()");
+   statistic(diag_trace, stat_clock, "clockAdvance");
+   statistic(diag_trace, stat_mapseg, "mapSegment");
 
    tracef("\n");
    statistic(diag_trace, stat_opfrd, "frameRD()");
    statistic(diag_trace, stat_opfwr, "frameWR()");
+   statistic(diag_trace, stat_ahead, "readAhead");
+
+   //-------------------------------------------------------------------------
+   // Replacement policy comparison
+   //-------------------------------------------------------------------------
+   uint64_t hits= stat_recrd + stat_recwr + stat_reuse; // Resident accesses
+   uint64_t load= stat_alloc + stat_allru; // Loaded accesses
+   getFaults(major, minor);
+
+   tracef("\n");
+   tracef("Policy comparison\n"
+          "-----------------\n");
+   if( mode != MODE_MMAP )
+     tracef("%10.2f%% hit rate\n",
+            (hits + load) == 0 ? 0.0 : 100.0 * hits / (hits + load));
+   statistic(diag_trace, stat_opfrd * framesize, "bytes read");
+   statistic(diag_trace, stat_opfwr * framesize, "bytes written");
+   statistic(diag_trace, major - fault_major, "major faults");
+   statistic(diag_trace, minor - fault_minor, "minor faults");
 
    tracef("\n");
    tracef("Other statistics\n"
@@ -968,16 +1088,20 @@ void
 //
 //----------------------------------------------------------------------------
    PGS::PGS( void )                 // Constructor
-:  framesize(0), framemask(0), framelog2(0)
+:  framesize(0), framemask(0), framelog2(0), mode(MODE_LRU)
 ,  files(0), fileu(0), filen(0), fdlist(NULL)
 ,  rframes(0), rfdall(NULL), rfdfree(NULL), storage(NULL)
 ,  vframes(0), vfdhash(NULL)
 ,  xframes(0), xframeu(0), vfdall(NULL)
-,  reclaim_h(NULL), reclaim_t(NULL)
-,  stat_opchg(0), stat_opref(0), stat_oprel(0), stat_opsci(0)
-,  stat_opfrd(0), stat_opfwr(0)
+,  reclaim_h(NULL), reclaim_t(NULL), clock_hand(0)
+,  mapfiles(0), maplist(NULL)
+,  ahead_last(0)
+,  stat_opchg(0), stat_opref(0), stat_oprel(0), stat_opsci(0), stat_oprng(0)
+,  stat_opfrd(0), stat_opfwr(0), stat_ahead(0)
 ,  stat_alloc(0), stat_allru(0), stat_recrd(0), stat_recwr(0), stat_reuse(0)
+,  stat_clock(0), stat_mapseg(0)
 ,  stat_hashmiss(0), stat_reorders(0)
+,  fault_major(0), fault_minor(0)
 ,  diag_trace(), diag_level(0)
 ,  initialized(FALSE)
 ,  sw_debug(FALSE)
@@ -1273,17 +1397,17 @@ PGS::RC                             // Return code
 //----------------------------------------------------------------------------
 //
 // Method-
-//       PGS::accessLoad
+//       PGS::accessVFD
 //
 // Purpose-
-//       Access the RFD* associated with a virtual address
+//       Access the VFD* associated with a virtual address, allocating
+//       external storage if the frame is not mapped.
 //
 //----------------------------------------------------------------------------
-PGS::RFD*                           // -> RFD
-   PGS::accessLoad(                 // Virtual address to RFD*
+PGS::VFD*                           // -> VFD
+   PGS::accessVFD(                  // Virtual address to VFD*
      Vaddr             vaddr)       // Virtual Address
 {
-   RFD*                ptrrfd;      // -> Real Frame Descriptor
    VFD*                ptrvfd;      // -> Virtual Frame Descriptor
    long                H;           // Hash index
 
@@ -1306,15 +1430,7 @@ PGS::RFD*                           // -> RFD
    }
 
    if( ptrvfd == NULL )             // If the frame is not mapped
-   {
-     ptrvfd= allocateVFD(frame);
-     if( ptrvfd == NULL )
-       return NULL;
-
-     #ifdef PGS_hash_move_to_front
-       prvvfd= NULL;
-     #endif
-   }
+     return allocateVFD(frame);
 
    #ifdef PGS_hash_move_to_front    // Move hash to front of list
      if( prvvfd != NULL )           // Reorder the hashlist (for performance)
@@ -1327,6 +1443,72 @@ PGS::RFD*                           // -> RFD
      }
    #endif // PGS_hash_move_to_front
 
+   return ptrvfd;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       PGS::clockSelect
+//
+// Purpose-
+//       Select a replacement frame using the CLOCK (second chance) policy.
+//
+// Implementation notes-
+//       Unreferenced frames remain in place. The hand skips referenced
+//       frames and clears the reference bit of each unreferenced frame it
+//       passes, selecting the first unreferenced frame whose bit is clear.
+//       Two passes always find a frame if any is unreferenced.
+//
+//----------------------------------------------------------------------------
+PGS::RFD*                           // -> RFD
+   PGS::clockSelect( void )         // Select a CLOCK replacement frame
+{
+   RFD*                ptrrfd;      // -> Real Frame Descriptor
+
+   for(uint32_t count= 2 * rframes; count > 0; count--)
+   {
+     ptrrfd= &rfdall[clock_hand];
+     clock_hand++;
+     if( clock_hand >= rframes )
+       clock_hand= 0;
+     stat_clock++;
+
+     if( ptrrfd->fsm != ptrrfd->RFD_ONLRU ) // If referenced
+       continue;
+
+     if( ptrrfd->refb )             // If recently referenced
+     {
+       ptrrfd->refb= FALSE;         // Give it a second chance
+       continue;
+     }
+
+     return ptrrfd;
+   }
+
+   return NULL;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       PGS::accessLoad
+//
+// Purpose-
+//       Access the RFD* associated with a virtual address
+//
+//----------------------------------------------------------------------------
+PGS::RFD*                           // -> RFD
+   PGS::accessLoad(                 // Virtual address to RFD*
+     Vaddr             vaddr)       // Virtual Address
+{
+   RFD*                ptrrfd;      // -> Real Frame Descriptor
+   VFD*                ptrvfd;      // -> Virtual Frame Descriptor
+
+   ptrvfd= accessVFD(vaddr);        // Locate the virtual frame
+   if( ptrvfd == NULL )
+     return NULL;
+
    ptrrfd= ptrvfd->rfd;             // Address the real frame
    if( ptrrfd != NULL )             // If already associated with storage
    {
@@ -1349,15 +1531,18 @@ PGS::RFD*                           // -> RFD
 
      if( ptrrfd->fsm == ptrrfd->RFD_ONLRU ) // If on the LRU list
      {
-       if( ptrrfd->next == NULL )
-         reclaim_t= ptrrfd->prev;
-       else
-         ptrrfd->next->prev= ptrrfd->prev;
-
-       if( ptrrfd->prev == NULL )
-         reclaim_h= ptrrfd->next;
-       else
-         ptrrfd->prev->next= ptrrfd->next;
+       if( mode != MODE_CLOCK )     // (CLOCK frames are not on a list)
+       {
+         if( ptrrfd->next == NULL )
+           reclaim_t= ptrrfd->prev;
+         else
+           ptrrfd->next->prev= ptrrfd->prev;
+
+         if( ptrrfd->prev == NULL )
+           reclaim_h= ptrrfd->next;
+         else
+           ptrrfd->prev->next= ptrrfd->next;
+       }
 
        ptrrfd->fsm= ptrrfd->RFD_ALLOC;
 
@@ -1369,6 +1554,7 @@ PGS::RFD*                           // -> RFD
      else
        stat_reuse++;
 
+     ptrrfd->refb= TRUE;            // Indicate referenced
      return ptrrfd;                 // Function complete
    }
 
@@ -1384,9 +1570,12 @@ PGS::RFD*                           // -> RFD
    }
 
    //-------------------------------------------------------------------------
-   // Allocate a frame from the LRU list
+   // Allocate a frame from the LRU list (or the CLOCK)
    //-------------------------------------------------------------------------
-   ptrrfd= reclaim_h;
+   if( mode == MODE_CLOCK )
+     ptrrfd= clockSelect();
+   else
+     ptrrfd= reclaim_h;
    if(ptrrfd == NULL)
    {
      errorf("accessLoad: Too many frames referenced\n");
@@ -1399,11 +1588,14 @@ PGS::RFD*                           // -> RFD
               ptrrfd, ptrrfd->vfd, ptrrfd->refc);
    #endif
 
-   reclaim_h= ptrrfd->next;
-   if( reclaim_h != NULL )
-     reclaim_h->prev= NULL;
-   else
-     reclaim_t= NULL;
+   if( mode != MODE_CLOCK )
+   {
+     reclaim_h= ptrrfd->next;
+     if( reclaim_h != NULL )
+       reclaim_h->prev= NULL;
+     else
+       reclaim_t= NULL;
+   }
 
    if( ptrrfd->chgi )
      frameWR(ptrrfd);
@@ -1420,11 +1612,144 @@ associate:
    ptrvfd->rfd= ptrrfd;
    ptrrfd->chgi= FALSE;
    ptrrfd->refc= 0;
+   ptrrfd->refb= TRUE;
 
    frameRD(ptrrfd);                 // Read the frame
    return ptrrfd;
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       PGS::accessMap
+//
+// Purpose-
+//       Access the mapped frame associated with a virtual address.
+//       (MODE_MMAP)
+//
+//----------------------------------------------------------------------------
+PGSRADDR_T                          // -> Mapped frame
+   PGS::accessMap(                  // Virtual address to mapped frame
+     Vaddr             vaddr)       // Virtual Address
+{
+   VFD*                ptrvfd;      // -> Virtual Frame Descriptor
+
+   ptrvfd= accessVFD(vaddr);        // Locate the virtual frame
+   if( ptrvfd == NULL )
+     return NULL;
+
+   unsigned fileId= xaddrToFileId(ptrvfd->xaddr, framemask);
+   uint64_t offset= xaddrToOffset(ptrvfd->xaddr, framemask);
+   char* segment= mapSegment(fileId, offset >> PGS_MAPLOG2);
+   if( segment == NULL )
+     return NULL;
+
+   return segment + (offset & (PGS_MAPSIZE - 1));
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       PGS::mapSegment
+//
+// Purpose-
+//       Map a file segment. (MODE_MMAP)
+//
+// Implementation notes-
+//       The file is extended (sparsely) to include the segment, so frames
+//       that were never written read as zeros. PGS::term truncates it to
+//       the allocated frame count.
+//
+//----------------------------------------------------------------------------
+char*                               // -> Mapped segment
+   PGS::mapSegment(                 // Map a file segment
+     unsigned          fileId,      // The file index
+     uint64_t          segno)       // The segment number
+{
+#ifdef _OS_WIN
+   errorf("PGS::mapSegment: not supported\n");
+   (void)fileId; (void)segno;
+   return NULL;
+
+#else
+   MAP*                ptrmap;      // -> Mapped File Descriptor
+   long                size;        // Working size
+
+   //-------------------------------------------------------------------------
+   // If required, expand the maplist and segment arrays
+   //-------------------------------------------------------------------------
+   if( fileId >= mapfiles )
+   {
+     size= fileu * sizeof(MAP);
+     ptrmap= (MAP*)realloc(maplist, size);
+     if( ptrmap == NULL )
+     {
+       errorf("PGS::mapSegment: Storage shortage(%ld)\n", size);
+       return NULL;
+     }
+
+     memset(ptrmap + mapfiles, 0, (fileu - mapfiles) * sizeof(MAP));
+     maplist= ptrmap;
+     mapfiles= fileu;
+   }
+
+   ptrmap= &maplist[fileId];
+   if( segno >= ptrmap->segments )
+   {
+     uint64_t segments= segno + 16;
+     char** segment= (char**)realloc(ptrmap->segment,
+                                     segments * sizeof(char*));
+     if( segment == NULL )
+     {
+       errorf("PGS::mapSegment: Storage shortage(%ld)\n",
+              long(segments * sizeof(char*)));
+       return NULL;
+     }
+
+     memset(segment + ptrmap->segments, 0,
+            (segments - ptrmap->segments) * sizeof(char*));
+     ptrmap->segment= segment;
+     ptrmap->segments= segments;
+   }
+
+   if( ptrmap->segment[segno] != NULL ) // If already mapped
+     return ptrmap->segment[segno];
+
+   //-------------------------------------------------------------------------
+   // Map the segment
+   //-------------------------------------------------------------------------
+   int handle= fdlist[fileId].file.getHandle();
+   off_t origin= off_t(segno << PGS_MAPLOG2);
+   struct stat info;
+   if( fstat(handle, &info) != 0 )
+   {
+     errorf("PGS::mapSegment: fstat(%s) error\n", fdlist[fileId].name);
+     return NULL;
+   }
+
+   if( info.st_size < origin + PGS_MAPSIZE )
+   {
+     if( ftruncate(handle, origin + PGS_MAPSIZE) != 0 )
+     {
+       errorf("PGS::mapSegment: ftruncate(%s) error\n", fdlist[fileId].name);
+       return NULL;
+     }
+   }
+
+   void* addr= mmap(NULL, PGS_MAPSIZE, PROT_READ | PROT_WRITE, MAP_SHARED,
+                    handle, origin);
+   if( addr == MAP_FAILED )
+   {
+     errorf("PGS::mapSegment: mmap(%s) error\n", fdlist[fileId].name);
+     return NULL;
+   }
+
+   stat_mapseg++;
+   ptrmap->segment[segno]= (char*)addr;
+   return (char*)addr;
+#endif
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -1491,6 +1816,17 @@ PGSRADDR_T                          // Associated real address
    //-------------------------------------------------------------------------
    stat_opchg++;                    // Increment the operation count
 
+   if( mode == MODE_MMAP )          // If memory mapped
+   {
+     p= (char*)accessMap(vaddr);
+     if( p != NULL )
+       p += int32_t(vaddr & framemask); // Add element offset
+
+     if( diag_level > 5 || (diag_flags[TRACE_CHG_WORD]&TRACE_CHG_MASK) != 0 )
+       traceMap("CHG", p, vaddr);
+     return p;
+   }
+
    //-------------------------------------------------------------------------
    // Access for update
    //-------------------------------------------------------------------------
@@ -1545,6 +1881,17 @@ PGSRADDR_T                          // Associated real address
    //-------------------------------------------------------------------------
    stat_opref++;                    // Increment the operation count
 
+   if( mode == MODE_MMAP )          // If memory mapped
+   {
+     p= (char*)accessMap(vaddr);
+     if( p != NULL )
+       p += int32_t(vaddr & framemask); // Add element offset
+
+     if( diag_level > 5 || (diag_flags[TRACE_REF_WORD]&TRACE_REF_MASK) != 0 )
+       traceMap("REF", p, vaddr);
+     return p;
+   }
+
    //-------------------------------------------------------------------------
    // Access for reference
    //-------------------------------------------------------------------------
@@ -1571,6 +1918,140 @@ PGSRADDR_T                          // Associated real address
    return(p);
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       PGS::accessRange
+//
+// Purpose-
+//       Access virtual range for reading.
+//
+// Implementation notes-
+//       Only the frame containing vaddr is accessed. The returned length is
+//       the part of the range contained in that frame. The caller accesses
+//       the remainder of the range (if any) using additional calls.
+//
+//----------------------------------------------------------------------------
+PGSRADDR_T                          // Associated real address
+   PGS::accessRange(                // Access virtual range for reading
+     Vaddr             vaddr,       // Virtual Address
+     Vsize&            length)      // (IN) Range length, (OUT) Accessed length
+{
+   char*               p= NULL;     // Resultant
+   RFD*                ptrrfd;      // -> Real Frame Descriptor
+
+   //-------------------------------------------------------------------------
+   // Initialize
+   //-------------------------------------------------------------------------
+   if( !initialized )               // If not initialized
+     return NULL;                   // Cannot continue
+
+   //-------------------------------------------------------------------------
+   // Statistics
+   //-------------------------------------------------------------------------
+   stat_oprng++;                    // Increment the operation count
+
+   //-------------------------------------------------------------------------
+   // Access for reference
+   //-------------------------------------------------------------------------
+   ptrrfd= NULL;
+   if( mode == MODE_MMAP )          // If memory mapped
+   {
+     p= (char*)accessMap(vaddr);
+     if( p != NULL )
+       p += int32_t(vaddr & framemask); // Add element offset
+   }
+   else
+   {
+     ptrrfd= accessLoad(vaddr);
+     if( ptrrfd != NULL )           // If we accessed the frame
+     {
+       if( ptrrfd->refc == RFD_MAXREFC ) // If not at limit
+         errorf("PGS::accessRange: Too many references to frame\n");
+       else
+       {
+         ptrrfd->refc++;            // Increment the reference counter
+
+         p= (char*)ptrrfd->raddr;   // Real address of frame
+         p += int32_t(vaddr & framemask); // Add element offset
+       }
+     }
+   }
+
+   if( p != NULL )                  // If we accessed the frame
+   {
+     Vsize remain= framesize - Vsize(vaddr & framemask);
+     if( length > remain )          // If the range continues
+     {
+       PGSVADDR_T mask= ~(PGSVADDR_T)framemask; // Frame address mask
+       readAhead((vaddr & mask) + framesize, (vaddr + length - 1) & mask);
+       length= remain;
+     }
+   }
+
+   //-------------------------------------------------------------------------
+   // Trace
+   //-------------------------------------------------------------------------
+   if( diag_level > 5 || (diag_flags[TRACE_RNG_WORD]&TRACE_RNG_MASK) != 0 )
+   {
+     if( mode == MODE_MMAP )
+       traceMap("RNG", p, vaddr);
+     else
+       traceOp("RNG", ptrrfd, vaddr);
+   }
+
+   return(p);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       PGS::readAhead
+//
+// Purpose-
+//       Start read-ahead for the next frames of a range.
+//
+// Implementation notes-
+//       At most PGS_READAHEAD frames are considered. Frames that are
+//       resident, were never allocated, or were considered by the previous
+//       readAhead are skipped. The read is started by advising the
+//       operating system; the frames are not loaded into real storage.
+//
+//----------------------------------------------------------------------------
+void
+   PGS::readAhead(                  // Start frame read-ahead
+     Vaddr             frame,       // First Virtual Address
+     Vaddr             last)        // Last Virtual Address
+{
+   VFD*                ptrvfd;      // -> Virtual Frame Descriptor
+
+   if( last > frame + (PGS_READAHEAD - 1) * (PGSVADDR_T)framesize )
+     last= frame + (PGS_READAHEAD - 1) * (PGSVADDR_T)framesize;
+
+   if( ahead_last >= frame && ahead_last <= last ) // If partially started
+     frame= ahead_last + framesize; // Skip the started frames
+
+   for(; frame <= last; frame += framesize)
+   {
+     long H= hashf(frame, vframes);
+     for(ptrvfd= vfdhash[H]; ptrvfd != NULL; ptrvfd= ptrvfd->next)
+     {
+       if( ptrvfd->vaddr == frame )
+         break;
+     }
+
+     if( ptrvfd == NULL || ptrvfd->rfd != NULL ) // If unmapped or resident
+       continue;
+
+     long fileId= xaddrToFileId(ptrvfd->xaddr, framemask);
+     fdlist[fileId].file.advise(framesize,
+                                xaddrToOffset(ptrvfd->xaddr, framemask));
+     stat_ahead++;
+   }
+
+   ahead_last= last;
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -1599,6 +2080,17 @@ PGSRADDR_T                          // Associated real address
    //-------------------------------------------------------------------------
    stat_opsci++;                    // Increment the operation count
 
+   if( mode == MODE_MMAP )          // If memory mapped
+   {
+     p= (char*)accessMap(vaddr);
+     if( p != NULL )
+       p += int32_t(vaddr & framemask); // Add element offset
+
+     if( diag_level > 5 || (diag_flags[TRACE_SCI_WORD]&TRACE_SCI_MASK) != 0 )
+       traceMap("SCI", p, vaddr);
+     return p;
+   }
+
    //-------------------------------------------------------------------------
    // Set the change indicator
    //-------------------------------------------------------------------------
@@ -1647,6 +2139,13 @@ void
    //-------------------------------------------------------------------------
    stat_oprel++;                    // Increment the operation count
 
+   if( mode == MODE_MMAP )          // If memory mapped (nothing to release)
+   {
+     if( diag_level > 5 || (diag_flags[TRACE_REL_WORD]&TRACE_REL_MASK) != 0 )
+       traceMap("REL", (char*)accessMap(vaddr), vaddr);
+     return;
+   }
+
    //-------------------------------------------------------------------------
    // Release the frame
    //-------------------------------------------------------------------------
@@ -1665,7 +2164,9 @@ void
      #endif
 
      ptrrfd->refc--;                // Decrement the reference counter
-     if( ptrrfd->refc == 0 )        // If last reference
+     if( ptrrfd->refc == 0 && mode == MODE_CLOCK ) // If last CLOCK reference
+       ptrrfd->fsm= ptrrfd->RFD_ONLRU; // (The frame remains in place)
+     else if( ptrrfd->refc == 0 )   // If last reference
      {
        ptrrfd->next= NULL;
 
@@ -1732,6 +2233,9 @@ PGS::RC                             // Return code
    if( ptrvfd == NULL )             // If the frame is not mapped
      return RC_Vaddr_Invalid;
 
+   if( mode == MODE_MMAP )          // If memory mapped
+     return RC_NORMAL;              // (The operating system pages it)
+
    if( ptrvfd->rfd == NULL )        // If the frame is not resident
      return RC_Vaddr_On_Disk;
 
@@ -1912,6 +2416,35 @@ void
        errorf("PGS::term: Control file '%s' error\n", fdlist[0].name);
    }
 
+   //-------------------------------------------------------------------------
+   // Release the mapped segments, truncating the (extended) files
+   //-------------------------------------------------------------------------
+   #ifndef _OS_WIN
+     for(i=0; i<mapfiles; i++)
+     {
+       MAP* ptrmap= &maplist[i];
+       for(uint64_t segno= 0; segno<ptrmap->segments; segno++)
+       {
+         if( ptrmap->segment[segno] != NULL )
+           munmap(ptrmap->segment[segno], PGS_MAPSIZE);
+       }
+       free(ptrmap->segment);
+
+       if( ptrmap->segments > 0 && initialized )
+       {
+         int rc= ftruncate(fdlist[i].file.getHandle(),
+                           off_t(fdlist[i].allocFrameNo << framelog2));
+         if( rc != 0 )
+           errorf("PGS::term: File '%s' truncate error\n", fdlist[i].name);
+       }
+     }
+   #endif
+
+   if( maplist != NULL )            // If the mapped file list is present
+     free(maplist);                 // Delete it
+   maplist= NULL;
+   mapfiles= 0;
+
    //-------------------------------------------------------------------------
    // Release the file arrays
    //-------------------------------------------------------------------------
@@ -2005,23 +2538,91 @@ framesize_OK:
    rframes= 0; rfdall= NULL; rfdfree= NULL; storage= NULL;
    vframes= 0; vfdhash= NULL;
    xframes= xframeu= 0; vfdall= NULL;
-   reclaim_h= reclaim_t= NULL;
-   stat_opchg= stat_opref= stat_oprel= stat_opsci= 0;
-   stat_opfrd= stat_opfwr= 0;
+   reclaim_h= reclaim_t= NULL; clock_hand= 0;
+   mapfiles= 0; maplist= NULL;
+   ahead_last= 0;
+   stat_opchg= stat_opref= stat_oprel= stat_opsci= stat_oprng= 0;
+   stat_opfrd= stat_opfwr= stat_ahead= 0;
    stat_alloc= stat_allru= stat_recrd= stat_recwr= stat_reuse= 0;
+   stat_clock= stat_mapseg= 0;
    stat_hashmiss= stat_reorders= 0;
+   getFaults(fault_major, fault_minor);
    diag_trace.setName("PGS.OUT"); diag_level= 0;
    memset(diag_flags, 0, sizeof(diag_flags));
    sw_debug= sw_trace= sw_jig= 0;
 
+   //-------------------------------------------------------------------------
+   // Initialize diagnostics
+   //-------------------------------------------------------------------------
+   ParseINI            parseINI;    // File control parameters
+   const char*         parm;        // A generic parameter
+
+   //-------------------------------------------------------------------------
+   // Initialize the control file
+   //-------------------------------------------------------------------------
+   parseINI.construct();            // Build the object
+   parseINI.open(DIAGFILE_NAME);    // Open the trace file
+
+   //-------------------------------------------------------------------------
+   // Activate the trace file
+   //-------------------------------------------------------------------------
+   parm= parseINI.getValue("Debug", "filename"); // Get debug filename
+   if( parm != NULL )
+   {
+     diag_trace.setName(parm);
+     tracef("<%s> %s : %s\n", DIAGFILE_NAME, "filename   ", parm);
+   }
+
+   //-------------------------------------------------------------------------
+   // Set diagnostic level
+   //-------------------------------------------------------------------------
+   diag_level= 0;
+   parm= parseINI.getValue("Debug", "traceLevel"); // Get the debug control
+   if( parm != NULL )
+   {
+     diag_level= atoi(parm);
+     tracef("<%s> %s : %s\n", DIAGFILE_NAME, "traceLevel ", parm);
+
+     if( diag_level > 10 )
+     {
+       diag_level -= 10;
+       diag_trace.setMode(Debug::ModeIntensive);
+     }
+   }
+
+   // TODO: Set individual trace flags
+
+   //-------------------------------------------------------------------------
+   // Set paging mode
+   //-------------------------------------------------------------------------
+   mode= MODE_LRU;
+   parm= parseINI.getValue("Paging", "mode"); // Get the paging mode
+   if( parm != NULL )
+   {
+     if( stricmp(parm, "CLOCK") == 0 )
+       mode= MODE_CLOCK;
+     else if( stricmp(parm, "MMAP") == 0 )
+       mode= MODE_MMAP;
+     else if( stricmp(parm, "LRU") != 0 )
+       errorf("<%s> %s : %s ignored\n", DIAGFILE_NAME, "mode       ", parm);
+     tracef("<%s> %s : %s\n", DIAGFILE_NAME, "mode       ", parm);
+
+     #ifdef _OS_WIN
+       if( mode == MODE_MMAP )      // (Not supported)
+         mode= MODE_LRU;
+     #endif
+   }
+
    //-------------------------------------------------------------------------
    // Allocate and initialize the real frame array
    //-------------------------------------------------------------------------
    if( realframeno < 64 )
      realframeno= 64;
+   if( mode == MODE_MMAP )          // If memory mapped
+     realframeno= 0;                // Real frames are not used
    size= realframeno * sizeof(RFD); // sizeof(rfdall array)
    rfdall= (RFD*)malloc(size);      // Allocate the array
-   if( rfdall == NULL )             // If storage not available
+   if( rfdall == NULL && size > 0 ) // If storage not available
    {
      term();
      return PGSINIT_MEMORY;
@@ -2048,13 +2649,16 @@ framesize_OK:
    for(i=1; i<realframeno; i++)     // Create the free list
      rfdall[i-1].next= &rfdall[i];
 
-   rfdfree= &rfdall[0];
+   if( realframeno > 0 )
+     rfdfree= &rfdall[0];
 
    //-------------------------------------------------------------------------
    // Allocate and initialize the virtual frame array
    //-------------------------------------------------------------------------
    if( virtframeno < realframeno )
      virtframeno= realframeno;
+   if( virtframeno < 64 )
+     virtframeno= 64;
    size= virtframeno * sizeof(VFD); // sizeof(vfdall array)
    vfdall= (VFD*)malloc(size);      // Allocate the array
    if( vfdall == NULL )             // If storage not available
@@ -2092,47 +2696,6 @@ framesize_OK:
    files= fileno;
    fileu= 0;
 
-   //-------------------------------------------------------------------------
-   // Initialize diagnostics
-   //-------------------------------------------------------------------------
-   ParseINI            parseINI;    // File control parameters
-   const char*         parm;        // A generic parameter
-
-   //-------------------------------------------------------------------------
-   // Initialize the control file
-   //-------------------------------------------------------------------------
-   parseINI.construct();            // Build the object
-   parseINI.open(DIAGFILE_NAME);    // Open the trace file
-
-   //-------------------------------------------------------------------------
-   // Activate the trace file
-   //-------------------------------------------------------------------------
-   parm= parseINI.getValue("Debug", "filename"); // Get debug filename
-   if( parm != NULL )
-   {
-     diag_trace.setName(parm);
-     tracef("<%s> %s : %s\n", DIAGFILE_NAME, "filename   ", parm);
-   }
-
-   //-------------------------------------------------------------------------
-   // Set diagnostic level
-   //-------------------------------------------------------------------------
-   diag_level= 0;
-   parm= parseINI.getValue("Debug", "traceLevel"); // Get the debug control
-   if( parm != NULL )
-   {
-     diag_level= atoi(parm);
-     tracef("<%s> %s : %s\n", DIAGFILE_NAME, "traceLevel ", parm);
-
-     if( diag_level > 10 )
-     {
-       diag_level -= 10;
-       diag_trace.setMode(Debug::ModeIntensive);
-     }
-   }
-
-   // TODO: Set individual trace flags
-
    //-------------------------------------------------------------------------
    // Exit, function complete
    //-------------------------------------------------------------------------
@@ -2364,6 +2927,21 @@ long                                // The frame size
    return framesize;
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       PGS::getMode
+//
+// Purpose-
+//       Return the paging mode.
+//
+//----------------------------------------------------------------------------
+PGS::MODE                           // The paging mode
+   PGS::getMode( void )             // Retrieve the paging mode
+{
+   return mode;
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -2536,6 +3114,30 @@ int                                 // Return code (0 OK)
    return 0;
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       PGS_File::advise
+//
+// Purpose-
+//       Advise the operating system that a frame will be read.
+//
+//----------------------------------------------------------------------------
+void
+   PGS_File::advise(                // Advise that a frame will be read
+     int32_t           dsize,       // Data size
+     PGSXADDR_T        xaddr)       // Data offset
+{
+   if( xaddr >= maxXaddr )          // If the frame is not backed
+     return;                        // (It will not be read)
+
+#ifdef POSIX_FADV_WILLNEED
+   posix_fadvise(handle, xaddr, dsize, POSIX_FADV_WILLNEED);
+#else
+   (void)dsize;                     // (Advice not available)
+#endif
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
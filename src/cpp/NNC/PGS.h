@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007-2009 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Define Paging Space (PGS) Object
 //
 // Last change date-
-//       2009/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef PGS_H_INCLUDED
@@ -69,6 +69,18 @@
 //       The allocate method allocates disk storage from a particular file,
 //       but does not access it.
 //
+//       The paging mode is selected by the PGS.INI control file:
+//         MODE_LRU   Explicit frame I/O, least recently used replacement.
+//         MODE_CLOCK Explicit frame I/O, CLOCK (second chance) replacement.
+//         MODE_MMAP  The data files are memory mapped and the operating
+//                    system does the paging. Real frames are not used.
+//
+//       The accessRange method accesses (for read) the portion of a virtual
+//       range that is contained in one frame, returning its length. This
+//       lets users of arrays that span frames access each frame once rather
+//       than each element. It also starts read-ahead of the range's next
+//       frames. Each accessRange is released using release(vaddr).
+//
 //----------------------------------------------------------------------------
 class PGS {                         // Paging Space
 //----------------------------------------------------------------------------
@@ -87,6 +99,12 @@ enum RC                             // Return codes
 ,  RC_Paging_IO                     // Paging I/O error
 }; // enum RC
 
+enum MODE                           // Paging modes
+{  MODE_LRU= 0                      // Explicit I/O, LRU replacement
+,  MODE_CLOCK                       // Explicit I/O, CLOCK replacement
+,  MODE_MMAP                        // Memory mapped files
+}; // enum MODE
+
 //----------------------------------------------------------------------------
 // PGS::Typedefs
 //----------------------------------------------------------------------------
@@ -140,6 +158,9 @@ long                                // The frame count
 long                                // The frame size
    getFrameSize( void );            // Retrieve the size of each frame
 
+MODE                                // The paging mode
+   getMode( void );                 // Retrieve the paging mode
+
 //----------------------------------------------------------------------------
 // PGS::Methods
 //----------------------------------------------------------------------------
@@ -152,6 +173,12 @@ Raddr                               // Associated Real Address
    accessRef(                       // Access virtual address (for read)
      Vaddr             vaddr);      // Virtual Address
 
+Raddr                               // Associated Real Address
+   accessRange(                     // Access virtual range (for read)
+     Vaddr             vaddr,       // Virtual Address
+     Vsize&            length);     // (IN) Range length
+                                    // (OUT) Length accessed in this frame
+
 Raddr                               // Associated Read Address
    accessSCI(                       // Set change indicator (promote to update)
      Vaddr             vaddr);      // Virtual Address
@@ -191,6 +218,7 @@ void
 //----------------------------------------------------------------------------
 protected:
 struct IOD;                         // Forward reference, internal object
+struct MAP;                         // Forward reference, internal object
 struct RFD;                         // Forward reference, internal object
 struct VFD;                         // Forward reference, internal object
 
@@ -227,10 +255,18 @@ RFD*                                // -> RFD
    accessLoad(                      // Access a frame, loading if required
      Vaddr             vaddr);      // Virtual Address
 
+Raddr                               // -> Mapped frame
+   accessMap(                       // Access a frame (MODE_MMAP)
+     Vaddr             vaddr);      // Virtual Address
+
 RFD*                                // -> RFD
    accessRead(                      // Access a frame without loading it
      Vaddr             vaddr);      // Virtual Address
 
+VFD*                                // -> VFD
+   accessVFD(                       // Access a VFD, allocating if required
+     Vaddr             vaddr);      // Virtual Address
+
 VFD*                                // -> VFD
    allocateVFD(                     // Allocate virtual storage
      Vaddr             vaddr,       // Virtual Address
@@ -239,6 +275,9 @@ VFD*                                // -> VFD
 void
    buildHashArray( void );          // (Re)Build the VFD hash array
 
+RFD*                                // -> RFD (NULL if none available)
+   clockSelect( void );             // Select a CLOCK replacement frame
+
 void
    frameRD(                         // Read a frame
      RFD*              rfd);        // -> RFD
@@ -247,12 +286,28 @@ void
    frameWR(                         // Write a frame
      RFD*              rfd);        // -> RFD
 
+char*                               // -> Mapped segment (NULL if error)
+   mapSegment(                      // Map a file segment
+     unsigned          fileId,      // The file index
+     uint64_t          segno);      // The segment number
+
+void
+   readAhead(                       // Start frame read-ahead
+     Vaddr             frame,       // First Virtual Address
+     Vaddr             last);       // Last Virtual Address
+
 void
    traceOp(                         // Trace an access operation
      const char*       opCode,      // Operation code
      RFD*              ptrrfd,      // -> RFD
      Vaddr             vaddr);      // Virtual Address
 
+void
+   traceMap(                        // Trace an access operation (MODE_MMAP)
+     const char*       opCode,      // Operation code
+     char*             raddr,       // Real address
+     Vaddr             vaddr);      // Virtual Address
+
 //----------------------------------------------------------------------------
 // PGS::Attributes
 //----------------------------------------------------------------------------
@@ -264,6 +319,8 @@ protected:
    uint32_t            framemask;   // Frame element offset mask
    unsigned int        framelog2;   // LOG2(framesize)
 
+   MODE                mode;        // Paging mode
+
    //-------------------------------------------------------------------------
    // Translation controls
    //-------------------------------------------------------------------------
@@ -297,6 +354,18 @@ protected:
    //-------------------------------------------------------------------------
    RFD*                reclaim_h;   // Reclaim array header
    RFD*                reclaim_t;   // Reclaim array trailer
+   uint32_t            clock_hand;  // CLOCK replacement index
+
+   //-------------------------------------------------------------------------
+   // Mapping controls (MODE_MMAP)
+   //-------------------------------------------------------------------------
+   unsigned int        mapfiles;    // The number of MAP elements
+   MAP*                maplist;     // -> MAP array (indexed by file)
+
+   //-------------------------------------------------------------------------
+   // Read-ahead controls
+   //-------------------------------------------------------------------------
+   Vaddr               ahead_last;  // Last frame read-ahead started
 
    //-------------------------------------------------------------------------
    // Statistics
@@ -305,19 +374,26 @@ protected:
    uint64_t            stat_opref;  // Number of REF operations
    uint64_t            stat_oprel;  // Number of REL operations
    uint64_t            stat_opsci;  // Number of SCI operations
+   uint64_t            stat_oprng;  // Number of RANGE operations
 
    uint64_t            stat_opfrd;  // Number of FileRD operations
    uint64_t            stat_opfwr;  // Number of FileWR operations
+   uint64_t            stat_ahead;  // Number of frame read-aheads
 
    uint64_t            stat_alloc;  // Number of free frame allocations
    uint64_t            stat_allru;  // Number of LRU  frame allocations
    uint64_t            stat_recrd;  // REclaim (read)  counter
    uint64_t            stat_recwr;  // REclaim (write) counter
    uint64_t            stat_reuse;  // REuse (resident) counter
+   uint64_t            stat_clock;  // CLOCK hand advance counter
+   uint64_t            stat_mapseg; // Mapped segment counter
 
    uint64_t            stat_hashmiss; // Number of misses on the hash list
    uint64_t            stat_reorders; // Number of hash list reorder events
 
+   uint64_t            fault_major; // Major page faults at init
+   uint64_t            fault_minor; // Minor page faults at init
+
    //-------------------------------------------------------------------------
    // Diagnostic controls
    //-------------------------------------------------------------------------
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Mainline control.
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
 //
 // Working notes-
 //         1 M  Neurons
@@ -49,6 +49,7 @@
 #include <com/Interval.h>
 #include <com/Random.h>
 #include <com/Unconditional.h>
+#include <pub/Worker.h>             // For pub::WorkerPool
 
 #include "Allocator.h"              // (Compile-only test)
 #include "Dendrite.h"
@@ -77,80 +78,6 @@ static Random&         RNG= Random::standard; // Our random number generator
 //----------------------------------------------------------------------------
 extern void parm(int,char*[]);      // Parameter analysis
 
-//----------------------------------------------------------------------------
-//
-// Subroutine-
-//       bitString
-//
-// Purpose-
-//       Return the associated bit string
-//
-//----------------------------------------------------------------------------
-static inline char*                 // The associated bit string
-   bitString(                       // Get associated bit string
-     int               index)       // For this index
-{
-   static char result[16];          // The resultant string
-
-   int mask= 0x00000080;            // Bit mask
-   for(int i=0; i<8; i++)           // Set resultant string
-   {
-     result[i]= '0';
-     if( (index&mask) != 0 )
-       result[i]= '1';
-
-     mask >>= 1;
-   }
-   result[8]= '\0';
-
-   return result;
-}
-
-//----------------------------------------------------------------------------
-//
-// Subroutine-
-//       bitCount
-//
-// Purpose-
-//       Return number of bits in a value
-//
-//----------------------------------------------------------------------------
-static inline int                   // The number of bits
-   bitCount(                        // Get number of bits in an index
-     int               index)       // For this index
-{
-   int result= 0;
-   while( index != 0 )
-   {
-     if( (index&1) != 0 )
-       result++;
-
-     index >>= 1;
-   }
-
-   return result;
-}
-
-//----------------------------------------------------------------------------
-//
-// Subroutine-
-//       generateBitCount
-//
-// Purpose-
-//       Generate the index to bit count array for Synapse.cpp
-//
-//----------------------------------------------------------------------------
-static inline void
-   generateBitCount( void )         // Generate the index to bit count array
-{
-   printf("{  0 //   0 00000000\n"); // (Hard-coded first line)
-   for(int i= 1; i<256; i++)
-   {
-     printf(",  %d // %3d %s\n", bitCount(i), i, bitString(i));
-   }
-   printf("};\n");                  // (Hard-coded last line)
-}
-
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -942,6 +869,13 @@ static int                          // Return code
    SynapseBundle       b3(  32, INPS, OUTS);
    const int SIZE= 32 + 1024 + 1024 + 32; // Number of Synapses
 
+   long cpus= sysconf(_SC_NPROCESSORS_ONLN); // Update the large bundles
+   if( cpus > 1 )                   // using all available processors
+   {
+     b1.setThreads(cpus);
+     b2.setThreads(cpus);
+   }
+
    // Randomly enable synapse[0] set array
    srand(128);                      // Constant random seed
    for(int n= 0; n<((INPS*OUTS)/5); n++) // Enable 1/5 of total array
@@ -1207,10 +1141,12 @@ extern int                          // Return code
        break;
 
      default:
-       generateBitCount();          // Generate Synapse.cpp bitCount
+       fprintf(stderr, "Invalid testID(%d)\n", testID);
+       result= 2;
        break;
    }
 
+   pub::WorkerPool::reset();        // (SynapseBundle::update threads)
    return result;
 }
 
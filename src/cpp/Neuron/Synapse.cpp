@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2013 Frank Eskesen.
+//       Copyright (c) 2013-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,11 @@
 //       Synapse object methods.
 //
 // Last change date-
-//       2013/01/01
+//       2026/10/18
+//
+// Implementation notes-
+//       The weight plane popcount kernel is selected at run time. On x86
+//       processors AVX-512 VPOPCNTDQ or AVX2 kernels are used if available.
 //
 //----------------------------------------------------------------------------
 #include <assert.h>
@@ -27,267 +31,233 @@
 
 #include "Synapse.h"
 
+#if defined(__GNUC__) && defined(__x86_64__)
+  #define SYNAPSE_X86 1             // Use x86 popcount kernels
+  #include <immintrin.h>
+#endif
+
+//----------------------------------------------------------------------------
+// Internal types
+//----------------------------------------------------------------------------
+typedef uint64_t (*Kernel)(         // A weight plane popcount kernel
+     const unsigned char*,          // Input bit vector
+     const unsigned char*,          // Set (row) bit vector
+     const uint64_t*,               // Weight plane mask
+     unsigned int);                 // Number of 64-bit words
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       load
+//
+// Purpose-
+//       Load (possibly unaligned) 64-bit word
+//
+//----------------------------------------------------------------------------
+static inline uint64_t              // The 64-bit word
+   load(                            // Load 64-bit word
+     const unsigned char*
+                       addr)        // From this address
+{
+   uint64_t result;
+   memcpy(&result, addr, sizeof(result));
+   return result;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       pop_generic
+//
+// Purpose-
+//       Sigma(popcount(inps & sets & mask)), portable version
+//
+//----------------------------------------------------------------------------
+static uint64_t                     // The number of set bits
+   pop_generic(                     // Count set bits
+     const unsigned char*
+                       inps,        // Input bit vector
+     const unsigned char*
+                       sets,        // Set (row) bit vector
+     const uint64_t*   mask,        // Weight plane mask
+     unsigned int      W)           // Number of 64-bit words
+{
+   uint64_t result= 0;
+   for(unsigned i= 0; i<W; i++)
+     result += __builtin_popcountll(load(inps+8*i) & load(sets+8*i) & mask[i]);
+
+   return result;
+}
+
+#ifdef SYNAPSE_X86
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       pop_popcnt
+//
+// Purpose-
+//       Sigma(popcount(inps & sets & mask)), POPCNT instruction
+//
+//----------------------------------------------------------------------------
+__attribute__((target("popcnt")))
+static uint64_t                     // The number of set bits
+   pop_popcnt(                      // Count set bits
+     const unsigned char*
+                       inps,        // Input bit vector
+     const unsigned char*
+                       sets,        // Set (row) bit vector
+     const uint64_t*   mask,        // Weight plane mask
+     unsigned int      W)           // Number of 64-bit words
+{
+   uint64_t result= 0;
+   for(unsigned i= 0; i<W; i++)
+     result += __builtin_popcountll(load(inps+8*i) & load(sets+8*i) & mask[i]);
+
+   return result;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       pop_avx2
+//
+// Purpose-
+//       Sigma(popcount(inps & sets & mask)), AVX2 nibble lookup
+//
+//----------------------------------------------------------------------------
+__attribute__((target("avx2,popcnt")))
+static uint64_t                     // The number of set bits
+   pop_avx2(                        // Count set bits
+     const unsigned char*
+                       inps,        // Input bit vector
+     const unsigned char*
+                       sets,        // Set (row) bit vector
+     const uint64_t*   mask,        // Weight plane mask
+     unsigned int      W)           // Number of 64-bit words
+{
+   const __m256i table= _mm256_setr_epi8( // Nibble bit count table
+       0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+       0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+   const __m256i low= _mm256_set1_epi8(0x0f);
+   const __m256i zero= _mm256_setzero_si256();
+
+   __m256i sum= zero;               // Four 64-bit accumulators
+   unsigned i= 0;
+   for(; i+4 <= W; i += 4)
+   {
+     __m256i x= _mm256_and_si256(
+         _mm256_loadu_si256((const __m256i*)(inps+8*i)),
+         _mm256_loadu_si256((const __m256i*)(sets+8*i)));
+     x= _mm256_and_si256(x, _mm256_loadu_si256((const __m256i*)(mask+i)));
+
+     __m256i lo= _mm256_shuffle_epi8(table, _mm256_and_si256(x, low));
+     __m256i hi= _mm256_shuffle_epi8(table,
+                     _mm256_and_si256(_mm256_srli_epi16(x, 4), low));
+     sum= _mm256_add_epi64(sum, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), zero));
+   }
+
+   uint64_t result= (uint64_t)_mm256_extract_epi64(sum, 0)
+                  + (uint64_t)_mm256_extract_epi64(sum, 1)
+                  + (uint64_t)_mm256_extract_epi64(sum, 2)
+                  + (uint64_t)_mm256_extract_epi64(sum, 3);
+   for(; i<W; i++)
+     result += __builtin_popcountll(load(inps+8*i) & load(sets+8*i) & mask[i]);
+
+   return result;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       pop_avx512
+//
+// Purpose-
+//       Sigma(popcount(inps & sets & mask)), AVX-512 VPOPCNTDQ
+//
+//----------------------------------------------------------------------------
+__attribute__((target("avx512f,avx512vpopcntdq,popcnt")))
+static uint64_t                     // The number of set bits
+   pop_avx512(                      // Count set bits
+     const unsigned char*
+                       inps,        // Input bit vector
+     const unsigned char*
+                       sets,        // Set (row) bit vector
+     const uint64_t*   mask,        // Weight plane mask
+     unsigned int      W)           // Number of 64-bit words
+{
+   __m512i sum= _mm512_setzero_si512(); // Eight 64-bit accumulators
+   unsigned i= 0;
+   for(; i+8 <= W; i += 8)
+   {
+     __m512i x= _mm512_ternarylogic_epi64( // x= inps & sets & mask
+         _mm512_loadu_si512(inps+8*i),
+         _mm512_loadu_si512(sets+8*i),
+         _mm512_loadu_si512(mask+i), 0x80);
+     sum= _mm512_add_epi64(sum, _mm512_popcnt_epi64(x));
+   }
+
+   uint64_t part[8];                // (Avoids _mm512_reduce_add_epi64,
+   _mm512_storeu_si512(part, sum);  // which trips -Wuninitialized)
+   uint64_t result= 0;
+   for(int j= 0; j<8; j++)
+     result += part[j];
+
+   for(; i<W; i++)
+     result += __builtin_popcountll(load(inps+8*i) & load(sets+8*i) & mask[i]);
+
+   return result;
+}
+#endif // SYNAPSE_X86
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       pop_select
+//
+// Purpose-
+//       Select the weight plane popcount kernel
+//
+//----------------------------------------------------------------------------
+static Kernel                       // The popcount kernel
+   pop_select( void )               // Select popcount kernel
+{
+#ifdef SYNAPSE_X86
+   __builtin_cpu_init();
+   if( __builtin_cpu_supports("avx512vpopcntdq") )
+     return pop_avx512;
+   if( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt") )
+     return pop_avx2;
+   if( __builtin_cpu_supports("popcnt") )
+     return pop_popcnt;
+#endif
+
+   return pop_generic;
+}
+
 //----------------------------------------------------------------------------
 // Internal data areas
 //----------------------------------------------------------------------------
-static unsigned int    bitCount[256]= // Bit value to bit count conversion
-{  0                                //   0 00000000
-,  1                                //   1 00000001
-,  1                                //   2 00000010
-,  2                                //   3 00000011
-,  1                                //   4 00000100
-,  2                                //   5 00000101
-,  2                                //   6 00000110
-,  3                                //   7 00000111
-,  1                                //   8 00001000
-,  2                                //   9 00001001
-,  2                                //  10 00001010
-,  3                                //  11 00001011
-,  2                                //  12 00001100
-,  3                                //  13 00001101
-,  3                                //  14 00001110
-,  4                                //  15 00001111
-,  1                                //  16 00010000
-,  2                                //  17 00010001
-,  2                                //  18 00010010
-,  3                                //  19 00010011
-,  2                                //  20 00010100
-,  3                                //  21 00010101
-,  3                                //  22 00010110
-,  4                                //  23 00010111
-,  2                                //  24 00011000
-,  3                                //  25 00011001
-,  3                                //  26 00011010
-,  4                                //  27 00011011
-,  3                                //  28 00011100
-,  4                                //  29 00011101
-,  4                                //  30 00011110
-,  5                                //  31 00011111
-,  1                                //  32 00100000
-,  2                                //  33 00100001
-,  2                                //  34 00100010
-,  3                                //  35 00100011
-,  2                                //  36 00100100
-,  3                                //  37 00100101
-,  3                                //  38 00100110
-,  4                                //  39 00100111
-,  2                                //  40 00101000
-,  3                                //  41 00101001
-,  3                                //  42 00101010
-,  4                                //  43 00101011
-,  3                                //  44 00101100
-,  4                                //  45 00101101
-,  4                                //  46 00101110
-,  5                                //  47 00101111
-,  2                                //  48 00110000
-,  3                                //  49 00110001
-,  3                                //  50 00110010
-,  4                                //  51 00110011
-,  3                                //  52 00110100
-,  4                                //  53 00110101
-,  4                                //  54 00110110
-,  5                                //  55 00110111
-,  3                                //  56 00111000
-,  4                                //  57 00111001
-,  4                                //  58 00111010
-,  5                                //  59 00111011
-,  4                                //  60 00111100
-,  5                                //  61 00111101
-,  5                                //  62 00111110
-,  6                                //  63 00111111
-,  1                                //  64 01000000
-,  2                                //  65 01000001
-,  2                                //  66 01000010
-,  3                                //  67 01000011
-,  2                                //  68 01000100
-,  3                                //  69 01000101
-,  3                                //  70 01000110
-,  4                                //  71 01000111
-,  2                                //  72 01001000
-,  3                                //  73 01001001
-,  3                                //  74 01001010
-,  4                                //  75 01001011
-,  3                                //  76 01001100
-,  4                                //  77 01001101
-,  4                                //  78 01001110
-,  5                                //  79 01001111
-,  2                                //  80 01010000
-,  3                                //  81 01010001
-,  3                                //  82 01010010
-,  4                                //  83 01010011
-,  3                                //  84 01010100
-,  4                                //  85 01010101
-,  4                                //  86 01010110
-,  5                                //  87 01010111
-,  3                                //  88 01011000
-,  4                                //  89 01011001
-,  4                                //  90 01011010
-,  5                                //  91 01011011
-,  4                                //  92 01011100
-,  5                                //  93 01011101
-,  5                                //  94 01011110
-,  6                                //  95 01011111
-,  2                                //  96 01100000
-,  3                                //  97 01100001
-,  3                                //  98 01100010
-,  4                                //  99 01100011
-,  3                                // 100 01100100
-,  4                                // 101 01100101
-,  4                                // 102 01100110
-,  5                                // 103 01100111
-,  3                                // 104 01101000
-,  4                                // 105 01101001
-,  4                                // 106 01101010
-,  5                                // 107 01101011
-,  4                                // 108 01101100
-,  5                                // 109 01101101
-,  5                                // 110 01101110
-,  6                                // 111 01101111
-,  3                                // 112 01110000
-,  4                                // 113 01110001
-,  4                                // 114 01110010
-,  5                                // 115 01110011
-,  4                                // 116 01110100
-,  5                                // 117 01110101
-,  5                                // 118 01110110
-,  6                                // 119 01110111
-,  4                                // 120 01111000
-,  5                                // 121 01111001
-,  5                                // 122 01111010
-,  6                                // 123 01111011
-,  5                                // 124 01111100
-,  6                                // 125 01111101
-,  6                                // 126 01111110
-,  7                                // 127 01111111
-,  1                                // 128 10000000
-,  2                                // 129 10000001
-,  2                                // 130 10000010
-,  3                                // 131 10000011
-,  2                                // 132 10000100
-,  3                                // 133 10000101
-,  3                                // 134 10000110
-,  4                                // 135 10000111
-,  2                                // 136 10001000
-,  3                                // 137 10001001
-,  3                                // 138 10001010
-,  4                                // 139 10001011
-,  3                                // 140 10001100
-,  4                                // 141 10001101
-,  4                                // 142 10001110
-,  5                                // 143 10001111
-,  2                                // 144 10010000
-,  3                                // 145 10010001
-,  3                                // 146 10010010
-,  4                                // 147 10010011
-,  3                                // 148 10010100
-,  4                                // 149 10010101
-,  4                                // 150 10010110
-,  5                                // 151 10010111
-,  3                                // 152 10011000
-,  4                                // 153 10011001
-,  4                                // 154 10011010
-,  5                                // 155 10011011
-,  4                                // 156 10011100
-,  5                                // 157 10011101
-,  5                                // 158 10011110
-,  6                                // 159 10011111
-,  2                                // 160 10100000
-,  3                                // 161 10100001
-,  3                                // 162 10100010
-,  4                                // 163 10100011
-,  3                                // 164 10100100
-,  4                                // 165 10100101
-,  4                                // 166 10100110
-,  5                                // 167 10100111
-,  3                                // 168 10101000
-,  4                                // 169 10101001
-,  4                                // 170 10101010
-,  5                                // 171 10101011
-,  4                                // 172 10101100
-,  5                                // 173 10101101
-,  5                                // 174 10101110
-,  6                                // 175 10101111
-,  3                                // 176 10110000
-,  4                                // 177 10110001
-,  4                                // 178 10110010
-,  5                                // 179 10110011
-,  4                                // 180 10110100
-,  5                                // 181 10110101
-,  5                                // 182 10110110
-,  6                                // 183 10110111
-,  4                                // 184 10111000
-,  5                                // 185 10111001
-,  5                                // 186 10111010
-,  6                                // 187 10111011
-,  5                                // 188 10111100
-,  6                                // 189 10111101
-,  6                                // 190 10111110
-,  7                                // 191 10111111
-,  2                                // 192 11000000
-,  3                                // 193 11000001
-,  3                                // 194 11000010
-,  4                                // 195 11000011
-,  3                                // 196 11000100
-,  4                                // 197 11000101
-,  4                                // 198 11000110
-,  5                                // 199 11000111
-,  3                                // 200 11001000
-,  4                                // 201 11001001
-,  4                                // 202 11001010
-,  5                                // 203 11001011
-,  4                                // 204 11001100
-,  5                                // 205 11001101
-,  5                                // 206 11001110
-,  6                                // 207 11001111
-,  3                                // 208 11010000
-,  4                                // 209 11010001
-,  4                                // 210 11010010
-,  5                                // 211 11010011
-,  4                                // 212 11010100
-,  5                                // 213 11010101
-,  5                                // 214 11010110
-,  6                                // 215 11010111
-,  4                                // 216 11011000
-,  5                                // 217 11011001
-,  5                                // 218 11011010
-,  6                                // 219 11011011
-,  5                                // 220 11011100
-,  6                                // 221 11011101
-,  6                                // 222 11011110
-,  7                                // 223 11011111
-,  3                                // 224 11100000
-,  4                                // 225 11100001
-,  4                                // 226 11100010
-,  5                                // 227 11100011
-,  4                                // 228 11100100
-,  5                                // 229 11100101
-,  5                                // 230 11100110
-,  6                                // 231 11100111
-,  4                                // 232 11101000
-,  5                                // 233 11101001
-,  5                                // 234 11101010
-,  6                                // 235 11101011
-,  5                                // 236 11101100
-,  6                                // 237 11101101
-,  6                                // 238 11101110
-,  7                                // 239 11101111
-,  4                                // 240 11110000
-,  5                                // 241 11110001
-,  5                                // 242 11110010
-,  6                                // 243 11110011
-,  5                                // 244 11110100
-,  6                                // 245 11110101
-,  6                                // 246 11110110
-,  7                                // 247 11110111
-,  5                                // 248 11111000
-,  6                                // 249 11111001
-,  6                                // 250 11111010
-,  7                                // 251 11111011
-,  6                                // 252 11111100
-,  7                                // 253 11111101
-,  7                                // 254 11111110
-,  8                                // 255 11111111
-};
+static const Kernel    popcount= pop_select(); // The popcount kernel
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       weightOf
+//
+// Purpose-
+//       Convert weight vector byte to weight
+//
+//----------------------------------------------------------------------------
+static inline int                   // The weight
+   weightOf(                        // Get weight
+     unsigned char     byte)        // For this weight vector byte
+{
+   int weight= (signed char)byte;
+   if( weight >= 0 )
+     weight++;
+
+   return weight;
+}
 
 //----------------------------------------------------------------------------
 //
@@ -341,6 +311,18 @@ static unsigned int    bitCount[256]= // Bit value to bit count conversion
      free(trig);
      trig= NULL;
    }
+
+   if( wcpy != NULL )
+   {
+     free(wcpy);
+     wcpy= NULL;
+   }
+
+   if( plane != NULL )
+   {
+     free(plane);
+     plane= NULL;
+   }
 }
 
 //----------------------------------------------------------------------------
@@ -359,6 +341,7 @@ static unsigned int    bitCount[256]= // Bit value to bit count conversion
 ,  iCount(iCount), oCount(oCount)
 ,  inps(NULL), sets(NULL), outs(NULL)
 ,  inwv(NULL), rems(NULL), leak(NULL), trig(NULL)
+,  wcpy(NULL), plane(NULL), planes(0)
 {
    if( iCount == 0 || oCount == 0
        || (iCount & 7) != 0 || (oCount & 7) != 0 )
@@ -373,8 +356,12 @@ static unsigned int    bitCount[256]= // Bit value to bit count conversion
    leak= (unsigned char*)malloc(oCount);
    trig= (unsigned char*)malloc(oCount);
 
+   wcpy= (unsigned char*)malloc(iCount>>3);
+   plane= (uint64_t*)malloc(sizeof(uint64_t) * 16 * (iCount>>6));
+
    if( inps == NULL || inwv == NULL || sets == NULL || outs == NULL
-       || rems == NULL || leak == NULL || trig == NULL )
+       || rems == NULL || leak == NULL || trig == NULL
+       || wcpy == NULL || (plane == NULL && (iCount>>6) != 0) )
      throw "Synapse: Storage shortage";
 
    memset(inps, 0, iCount >> 3);    // Default: NO inputs
@@ -384,6 +371,7 @@ static unsigned int    bitCount[256]= // Bit value to bit count conversion
    memset(leak, 0, oCount);         // Default: NO leakage
    memset(trig, 0, oCount);         // Default: Trigger= 1
    memset(outs, 0, oCount >> 3);    // Default: NO outputs
+   analyze();                       // Default: One weight plane
 
    #if( 0 )
      int bytes= sizeof(*this);      // Overhead
@@ -394,6 +382,8 @@ static unsigned int    bitCount[256]= // Bit value to bit count conversion
      bytes += (oCount);             // leak
      bytes += (oCount);             // trig
      bytes += (oCount >> 3);        // outs
+     bytes += (iCount >> 3);        // wcpy
+     bytes += (iCount >> 6) * 128;  // plane
      printf("%8d sizeof(Synapse)\n", bytes);
    #endif
 }
@@ -418,13 +408,7 @@ int                                 // The total weight of set bits
 
    int result= 0;                   // Number of inputs
    for(int i= 0; i<M; i++)
-   {
-     int weight= ((signed char*)inwv)[i];
-     if( weight >= 0 )
-       weight++;
-
-     result += (bitCount[sets[i]] * weight);
-   }
+     result += __builtin_popcount(sets[i]) * weightOf(inwv[i]);
 
    return result;
 }
@@ -496,6 +480,68 @@ void
    inwv[index>>3]= weight;
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Synapse::analyze
+//
+// Purpose-
+//       Build the weight planes from the weight vector
+//
+// Implementation notes-
+//       Weight magnitudes range from 1..128, so there are at most eight
+//       positive and eight negative planes. Only planes that select some
+//       Axion byte are kept. Axion bytes beyond the last full 64-bit word
+//       are not included in any plane; update() evaluates them bytewise.
+//
+//----------------------------------------------------------------------------
+void
+   Synapse::analyze( void )         // Build weight planes from weights
+{
+   const int M= (iCount >> 3);      // Number of Axion bytes
+   const unsigned W= (iCount >> 6); // Number of Axion 64-bit words
+   memcpy(wcpy, inwv, M);
+
+   planes= 0;
+   if( W == 0 )                     // (All Axion bytes evaluated bytewise)
+     return;
+
+   int weight= weightOf(inwv[0]);   // Check for a single (common) weight
+   int i= 1;
+   while( i < (int)(W*8) && weightOf(inwv[i]) == weight )
+     i++;
+
+   if( i == (int)(W*8) )            // If all weights are the same
+   {
+     scale[0]= weight;
+     memset(plane, 0xff, W * sizeof(uint64_t));
+     planes= 1;
+     return;
+   }
+
+   for(int bit= 0; bit<16; bit++)   // For each possible plane
+   {
+     const int sign= (bit < 8) ? (+1) : (-1);
+     const int mask= 1 << (bit & 7);
+     uint64_t* const P= plane + planes*W;
+
+     int used= false;               // TRUE iff any Axion byte selected
+     memset(P, 0, W * sizeof(uint64_t));
+     for(i= 0; i < (int)(W*8); i++)
+     {
+       weight= weightOf(inwv[i]);
+       if( (weight * sign) > 0 && ((weight * sign) & mask) != 0 )
+       {
+         ((unsigned char*)P)[i]= 0xff;
+         used= true;
+       }
+     }
+
+     if( used )
+       scale[planes++]= sign * mask;
+   }
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -560,21 +606,14 @@ int                                 // The evaluation
    Synapse::evaluate(               // Get evaluation (without remainder)
      unsigned int      index) const // For this Neuron index
 {
-   assert( index < iCount );        // Verify parameter
+   assert( index < oCount );        // Verify parameter
    unsigned char* sets= getSets(index); // The associated set
 
    const int M= (iCount >> 3);      // Number of Axion bytes
 
    int gets= 0;                     // Ignore remainder
    for(int i= 0; i<M; i++)          // For each input Axion byte
-   {
-     int weight= ((signed char*)inwv)[i];
-     if( weight >= 0 )
-       weight++;
-
-     int mask= inps[i] & sets[i];
-     gets += (bitCount[mask] * weight);
-   }
+     gets += __builtin_popcount(inps[i] & sets[i]) * weightOf(inwv[i]);
 
    return gets;
 }
@@ -598,19 +637,19 @@ void
    unsigned char*      sets= this->sets; // Working sets pointer
 
    const int M= (iCount >> 3);      // Number of Axion bytes
+   const unsigned W= (iCount >> 6); // Number of Axion 64-bit words
+   if( memcmp(wcpy, inwv, M) != 0 ) // If the weights changed
+     analyze();                     // Rebuild the weight planes
+
    for(unsigned n= 0; n<oCount; n++) // For each Neuron
    {
      int gets= rems[n];             // Start with remainder
 
-     for(int i= 0; i<M; i++)        // For each input Axion byte
-     {
-       int weight= ((signed char*)inwv)[i];
-       if( weight >= 0 )
-         weight++;
+     for(unsigned p= 0; p<planes; p++) // For each weight plane
+       gets += scale[p] * (int)popcount(inps, sets, plane + p*W, W);
 
-       int mask= inps[i] & sets[i];
-       gets += (bitCount[mask] * weight);
-     }
+     for(int i= W*8; i<M; i++)      // For each remaining Axion byte
+       gets += __builtin_popcount(inps[i] & sets[i]) * weightOf(inwv[i]);
 
      int byteIndex= (n >> 3);       // Neuron byte index
      int bitsIndex= (n & 7);        // Neuron bit index
@@ -632,4 +671,3 @@ void
      sets += M;                     // Address next set
    }
 }
-
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2013 Frank Eskesen.
+//       Copyright (c) 2013-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,12 +16,14 @@
 //       Define the Synapse object.
 //
 // Last change date-
-//       2013/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef SYNAPSE_H_INCLUDED
 #define SYNAPSE_H_INCLUDED
 
+#include <stdint.h>
+
 #ifndef OBJECT_H_INCLUDED
 #include "Object.h"
 #endif
@@ -85,6 +87,17 @@
 //       Higher loss values inhibit delayed Neuron outputs.
 //       OUT= Trig >= (Inps + MAX(Rems - Loss, 0))
 //
+// Evaluation-
+//       update() evaluates the weights bit-sliced. Each weight magnitude
+//       bit (positive or negative) that is used by any Axion byte defines
+//       a weight plane, a mask selecting the Axion bytes that use it. Then
+//       Sigma(Inps*Weight) is Sigma(Scale*popcount(Inps & Sets & Plane)),
+//       evaluated 64 bits at a time. When all weights are equal there is
+//       only one plane, and its mask selects every Axion.
+//
+//       The planes are rebuilt by update() whenever the weight vector has
+//       changed, including changes made using the getWeight() vector.
+//
 //----------------------------------------------------------------------------
 class Synapse : public Object {     // Synapse descriptor
 //----------------------------------------------------------------------------
@@ -106,6 +119,11 @@ unsigned char*         rems;        // Neuron residue vector (Remainder)
 unsigned char*         leak;        // Neuron leakage vector
 unsigned char*         trig;        // Neuron firing threshold vector
 
+unsigned char*         wcpy;        // The weights used to build plane
+uint64_t*              plane;       // The weight plane masks
+unsigned int           planes;      // The number of weight planes
+int                    scale[16];   // The weight plane scale factors
+
 //----------------------------------------------------------------------------
 // Synapse::Constructor/Destructor
 //----------------------------------------------------------------------------
@@ -200,6 +218,10 @@ void
 //----------------------------------------------------------------------------
 // Synapse::Methods
 //----------------------------------------------------------------------------
+protected:
+void
+   analyze( void );                 // Build weight planes from weights
+
 public:
 int                                 // The evaluation
    evaluate(                        // Get evaluation
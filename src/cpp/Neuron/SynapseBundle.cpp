@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2013 Frank Eskesen.
+//       Copyright (c) 2013-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       SynapseBundle object methods.
 //
 // Last change date-
-//       2013/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <assert.h>
@@ -25,6 +25,8 @@
 #include <string.h>
 #include <unistd.h>
 
+#include <pub/Worker.h>             // For pub::WorkerPool
+
 #include "Synapse.h"
 #include "SynapseBundle.h"
 
@@ -67,7 +69,7 @@
      unsigned int      oCount)      // Number of output Neurons
 :  Object()
 ,  bCount(bCount),  iCount(iCount), oCount(oCount)
-,  bundle(NULL)
+,  threads(1), bundle(NULL)
 {
    if( iCount == 0 || oCount == 0 || (iCount&7) != 0 || (oCount&7) != 0 )
      throw "SynapseBundle: Parameter error";
@@ -93,11 +95,16 @@
 // Purpose-
 //       Read inputs, write outputs
 //
+// Implementation notes-
+//       The Synapses are updated in parallel. The calling thread also
+//       updates Synapses. The others are pub::WorkerPool threads, which are
+//       reused rather than created for each update.
+//
 //----------------------------------------------------------------------------
 void
    SynapseBundle::update( void )    // Read inputs, write outputs
 {
-   for(unsigned x= 0; x<bCount; x++)
-     bundle[x]->update();
+   pub::WorkerPool::parallel(threads, bCount,
+     [this](size_t x) { bundle[x]->update(); });
 }
 
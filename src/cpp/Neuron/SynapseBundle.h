@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2013 Frank Eskesen.
+//       Copyright (c) 2013-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Define the SynapseBundle object.
 //
 // Last change date-
-//       2013/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef SYNAPSEBUNDLE_H_INCLUDED
@@ -39,6 +39,10 @@ class Synapse;                      // The Synapse class
 // Purpose-
 //       SynapseBundle descriptor.
 //
+// Implementation notes-
+//       The bundled Synapses are independent, so update() may update them
+//       concurrently. By default, they're updated serially.
+//
 //----------------------------------------------------------------------------
 class SynapseBundle : public Object { // SynapseBundle descriptor
 //----------------------------------------------------------------------------
@@ -47,6 +51,7 @@ class SynapseBundle : public Object { // SynapseBundle descriptor
 unsigned int           bCount;      // Number of bundles
 unsigned int           iCount;      // Number of input Axions
 unsigned int           oCount;      // Number of output Neurons
+unsigned int           threads;     // Number of update threads
 
 Synapse**              bundle;      // The Synapse bundle
 
@@ -81,6 +86,15 @@ inline unsigned int                 // The number of output Neurons
    getOCount( void ) const          // Get number of output Neurons
 {  return oCount; }
 
+inline unsigned int                 // The number of update threads
+   getThreads( void ) const         // Get number of update threads
+{  return threads; }
+
+inline void
+   setThreads(                      // Set number of update threads
+     unsigned int      threads)     // To this value (0 or 1: serial)
+{  this->threads= threads; }
+
 inline Synapse*                     // The associated Synapse
    getSynapse(                      // Get associated Synapse
      unsigned int      index) const // For this bundle index
@@ -0,0 +1,73 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (C) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       HandEval.cpp
+//
+// Purpose-
+//       HandEval lookup tables.
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#include "HandEval.h"
+
+//----------------------------------------------------------------------------
+// Internal data areas
+//----------------------------------------------------------------------------
+static uint16_t        straightTable[HandEval::RANK_MASK+1]; // Straight table
+static uint16_t        topFiveTable[HandEval::RANK_MASK+1]; // Top five table
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       initialize
+//
+// Purpose-
+//       Initialize the lookup tables.
+//
+//----------------------------------------------------------------------------
+static const uint16_t*              // The straight table
+   initialize( void )               // Initialize the lookup tables
+{
+   uint32_t const wheel= (1 << Card::RANK_A) | 0x000f; // A, 2, 3, 4, 5
+
+   for(uint32_t ranks= 0; ranks <= HandEval::RANK_MASK; ranks++)
+   {
+     uint32_t top= ranks;           // The highest five Ranks
+     while( __builtin_popcount(top) > 5 )
+       top &= top - 1;
+     topFiveTable[ranks]= uint16_t(top);
+
+     uint16_t high= 0;              // The highest straight's high Rank bit
+     for(int rank= Card::RANK_A; rank >= Card::RANK_6; rank--)
+     {
+       uint32_t const five= 0x001f << (rank - 4);
+       if( (ranks & five) == five )
+       {
+         high= uint16_t(1 << rank);
+         break;
+       }
+     }
+     if( high == 0 && (ranks & wheel) == wheel )
+       high= uint16_t(1 << Card::RANK_5);
+     straightTable[ranks]= high;
+   }
+
+   return straightTable;
+}
+
+//----------------------------------------------------------------------------
+// HandEval::Static attributes
+//----------------------------------------------------------------------------
+const uint16_t*        HandEval::straight= initialize(); // Straight table
+const uint16_t*        HandEval::topFive= topFiveTable; // Top five table
@@ -0,0 +1,107 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (C) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       HandEval.h
+//
+// Purpose-
+//       Bitmask poker hand evaluator.
+//
+// Last change date-
+//       2026/10/18
+//
+// Notes-
+//       A set of Cards is a 64-bit mask. Each suit uses a 16-bit lane and
+//       each Card's bit within its lane is its Rank, so the mask of Card
+//       (rank, suit) is 1 << (suit*16 + rank).
+//
+//       evaluate() returns a 5, 6, or 7 card hand's value. Comparing two
+//       values gives the same result as PokerHand::compare. The value is:
+//         (PokerHand::Ranking << 26) | (major << 13) | minor
+//       where major and minor are Rank bit masks.
+//
+//----------------------------------------------------------------------------
+#ifndef HANDEVAL_H_INCLUDED
+#define HANDEVAL_H_INCLUDED
+
+#include <stdint.h>
+
+#include "Define.h"
+#include "Card.h"
+#include "Hand.h"
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       HandEval
+//
+// Purpose-
+//       Bitmask poker hand evaluator.
+//
+//----------------------------------------------------------------------------
+class HandEval                      // Bitmask poker hand evaluator
+{
+//----------------------------------------------------------------------------
+// HandEval::Typedefs and enumerations
+//----------------------------------------------------------------------------
+public:
+typedef uint64_t       Mask;        // A set of Cards
+typedef uint32_t       Value;       // A hand value
+
+enum                                // Generic enum
+{  RANK_COUNT= 13                   // The number of Ranks
+,  RANK_MASK= 0x1fff                // All Ranks
+,  SUIT_SHIFT= 16                   // The suit lane width
+,  MAJOR_SHIFT= 13                  // The major Rank mask shift
+,  RANKING_SHIFT= 26                // The Ranking shift
+}; // enum
+
+//----------------------------------------------------------------------------
+// HandEval::Static methods
+//----------------------------------------------------------------------------
+public:
+static inline Mask                  // The Card's Mask
+   toMask(                          // Get Mask
+     const Card*       card);       // For this Card
+
+static inline Mask                  // The Cards' Mask
+   toMask(                          // Get Mask
+     int               count,       // The number of Cards
+     Card* const       card[]);     // The Card* array
+
+static inline Value                 // The hand's Value
+   evaluate(                        // Evaluate a hand
+     Mask              hand);       // Containing 5, 6, or 7 Cards
+
+static inline PokerHand::Ranking    // The associated Ranking
+   getRanking(                      // Get the Ranking
+     Value             value);      // For this Value
+
+//----------------------------------------------------------------------------
+// HandEval::Static attributes
+//----------------------------------------------------------------------------
+protected:
+static const uint16_t* straight;    // [RANK_MASK+1] Straight high Rank bit
+static const uint16_t* topFive;     // [RANK_MASK+1] Highest five Rank bits
+
+//----------------------------------------------------------------------------
+// HandEval::Protected static methods
+//----------------------------------------------------------------------------
+protected:
+static inline uint32_t              // The highest count Rank bits
+   top(                             // Get highest Rank bits
+     uint32_t          ranks,       // From this Rank mask
+     int               count);      // The number of bits to keep
+}; // class HandEval
+
+#include "HandEval.i"
+
+#endif // HANDEVAL_H_INCLUDED
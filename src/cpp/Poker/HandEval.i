@@ -0,0 +1,151 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (C) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       HandEval.i
+//
+// Purpose-
+//       HandEval inline methods.
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#ifndef HANDEVAL_I_INCLUDED
+#define HANDEVAL_I_INCLUDED
+
+//----------------------------------------------------------------------------
+// HandEval::Static methods
+//----------------------------------------------------------------------------
+HandEval::Mask                      // The Card's Mask
+   HandEval::toMask(                // Get Mask
+     const Card*       card)        // For this Card
+{
+   return Mask(1) << (card->getSuit() * SUIT_SHIFT + card->getRank());
+}
+
+HandEval::Mask                      // The Cards' Mask
+   HandEval::toMask(                // Get Mask
+     int               count,       // The number of Cards
+     Card* const       card[])      // The Card* array
+{
+   Mask                result= 0;   // Resultant
+
+   for(int i= 0; i<count; i++)
+     result |= toMask(card[i]);
+
+   return result;
+}
+
+PokerHand::Ranking                  // The associated Ranking
+   HandEval::getRanking(            // Get the Ranking
+     Value             value)       // For this Value
+{
+   return PokerHand::Ranking(value >> RANKING_SHIFT);
+}
+
+uint32_t                            // The highest count Rank bits
+   HandEval::top(                   // Get highest Rank bits
+     uint32_t          ranks,       // From this Rank mask
+     int               count)       // The number of bits to keep
+{
+   while( __builtin_popcount(ranks) > count )
+     ranks &= ranks - 1;            // Remove the lowest Rank
+
+   return ranks;
+}
+
+//----------------------------------------------------------------------------
+//
+// Static method-
+//       HandEval::evaluate
+//
+// Purpose-
+//       Evaluate a 5, 6, or 7 card hand.
+//
+// Notes-
+//       Five of seven Cards in one suit leave too few Cards for a full house
+//       or four of a kind, so a flush is checked first.
+//
+//       The per-Rank card counts are computed by adding the four suit masks
+//       as bit vectors: bit0 and bit1 are the count's low binary digits.
+//
+//----------------------------------------------------------------------------
+HandEval::Value                     // The hand's Value
+   HandEval::evaluate(              // Evaluate a hand
+     Mask              hand)        // Containing 5, 6, or 7 Cards
+{
+   uint32_t const C= uint32_t(hand)                       & RANK_MASK;
+   uint32_t const D= uint32_t(hand >> (1 * SUIT_SHIFT))   & RANK_MASK;
+   uint32_t const H= uint32_t(hand >> (2 * SUIT_SHIFT))   & RANK_MASK;
+   uint32_t const S= uint32_t(hand >> (3 * SUIT_SHIFT))   & RANK_MASK;
+
+   // Flush or straight flush
+   uint32_t flush= 0;
+   if( __builtin_popcount(C) >= 5 ) flush= C;
+   else if( __builtin_popcount(D) >= 5 ) flush= D;
+   else if( __builtin_popcount(H) >= 5 ) flush= H;
+   else if( __builtin_popcount(S) >= 5 ) flush= S;
+   if( flush != 0 )
+   {
+     if( straight[flush] != 0 )
+       return (Value(PokerHand::StraightFlush) << RANKING_SHIFT)
+            | straight[flush];
+
+     return (Value(PokerHand::Flush) << RANKING_SHIFT) | topFive[flush];
+   }
+
+   // Count the Cards of each Rank
+   uint32_t const ranks= C | D | H | S;
+   uint32_t const CD= C ^ D;
+   uint32_t const HS= H ^ S;
+   uint32_t const carry= CD & HS;
+   uint32_t const bit0= CD ^ HS;
+   uint32_t const bit1= (C & D) ^ (H & S) ^ carry;
+   uint32_t const quads= C & D & H & S;
+   uint32_t const trips= bit0 & bit1;
+   uint32_t const pairs= bit1 & ~bit0 & ~quads;
+
+   if( quads != 0 )
+     return (Value(PokerHand::FourOfAKind) << RANKING_SHIFT)
+          | (quads << MAJOR_SHIFT) | top(ranks & ~quads, 1);
+
+   if( trips != 0 )
+   {
+     uint32_t const three= top(trips, 1);
+     uint32_t const two= top((trips & ~three) | pairs, 1);
+     if( two != 0 )
+       return (Value(PokerHand::FullHouse) << RANKING_SHIFT)
+            | (three << MAJOR_SHIFT) | two;
+   }
+
+   if( straight[ranks] != 0 )
+     return (Value(PokerHand::Straight) << RANKING_SHIFT) | straight[ranks];
+
+   if( trips != 0 )
+     return (Value(PokerHand::ThreeOfAKind) << RANKING_SHIFT)
+          | (trips << MAJOR_SHIFT) | top(ranks & ~trips, 2);
+
+   if( pairs != 0 )
+   {
+     uint32_t const two= top(pairs, 2);
+     if( __builtin_popcount(pairs) >= 2 )
+       return (Value(PokerHand::TwoPairs) << RANKING_SHIFT)
+            | (two << MAJOR_SHIFT) | top(ranks & ~two, 1);
+
+     return (Value(PokerHand::OnePair) << RANKING_SHIFT)
+          | (pairs << MAJOR_SHIFT) | top(ranks & ~pairs, 3);
+   }
+
+   return (Value(PokerHand::HighCard) << RANKING_SHIFT) | topFive[ranks];
+}
+
+#endif // HANDEVAL_I_INCLUDED
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2017 Frank Eskesen.
+//       Copyright (C) 2017-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,11 +16,17 @@
 //       Texas hold'em implementations.
 //
 // Last change date-
-//       2017/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
+#include <thread>
+#include <vector>
+
+#include <pub/Random.h>
+
 #include "Card.h"
 #include "Hand.h"
+#include "HandEval.h"
 #include "Player.h"
 #include "Rating.h"
 #include "Strategy.h"
@@ -309,36 +315,206 @@ static void
    }
 }
 
+//----------------------------------------------------------------------------
+//
+// Struct-
+//       Tally
+//
+// Purpose-
+//       Rating evaluation counters.
+//
+//----------------------------------------------------------------------------
+struct Tally                        // Rating evaluation counters
+{
+   long                noHand;      // The number of hands
+   long                noTies[2];   // The number of ties (two, all)
+   long                noWins[2];   // The number of wins (two, all)
+
+void
+   count(                           // Count a hand
+     int               two,         // Result against ONE player
+     int               all)         // Result against ALL players
+{
+   if( two >= 0 )
+   {
+     if( two > 0 )
+       noWins[0]++;
+     else
+       noTies[0]++;
+   }
+
+   if( all >= 0 )
+   {
+     if( all > 0 )
+       noWins[1]++;
+     else
+       noTies[1]++;
+   }
+
+   noHand++;
+}
+}; // struct Tally
+
+//----------------------------------------------------------------------------
+//
+// Struct-
+//       Simulation
+//
+// Purpose-
+//       Rating simulation parameters.
+//
+//----------------------------------------------------------------------------
+struct Simulation                   // Rating simulation parameters
+{
+   HandEval::Mask      down;        // The Player's down Cards
+   HandEval::Mask      board;       // The board Cards already dealt
+   int                 boardCount;  // The number of board Cards to deal
+   int                 playerCount; // The number of Players
+   int                 packCount;   // The number of Cards in the pack
+   HandEval::Mask      pack[52];    // The Cards in the pack
+}; // struct Simulation
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
-//       isMucked
+//       compare
 //
 // Purpose-
-//       Determine whether a card is mucked.
+//       Compare hand Values.
 //
 //----------------------------------------------------------------------------
-inline int                          // TRUE iff mucked
-   isMucked(                        // Is card mucked?
-     int               muckCount,   // Number of mucked Cards
-     Card**            muckArray,   // The mucked Cards
-     Card*             card)        // The Card
+static inline int                   // +1 (L better), =0, -1 (L worse)
+   compare(                         // Compare hand Values
+     HandEval::Value   L,           // Left Value
+     HandEval::Value   R)           // Right Value
 {
-   int                 result= FALSE; // Resultant
+   return (L > R) - (L < R);
+}
 
-   int                 i;
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       simulate
+//
+// Purpose-
+//       Monte Carlo simulation thread.
+//
+//----------------------------------------------------------------------------
+static void
+   simulate(                        // Monte Carlo simulation thread
+     const Simulation* sim,         // The simulation parameters
+     Tally*            tally,       // (OUTPUT) The evaluation counters
+     long              iterations,  // The number of iterations
+     uint64_t          seed)        // The random seed
+{
+   pub::Random         random;      // Our Random stream
+   random.set_seed(seed);
+
+   HandEval::Mask      pack[52];    // Our copy of the pack
+   int                 const n= sim->packCount;
+   for(int i= 0; i<n; i++)
+     pack[i]= sim->pack[i];
 
-   for(i= 0; i<muckCount; i++)
+   int                 const need= sim->boardCount + 2*(sim->playerCount-1);
+   for(long iteration= 0; iteration<iterations; iteration++)
    {
-     if( card->getRank() == muckArray[i]->getRank()
-         && card->getSuit() == muckArray[i]->getSuit() )
+     // Deal the cards: pack[0..need-1] is a random selection
+     for(int i= 0; i<need; i++)
      {
-       result= TRUE;
-       break;
+       int j= i + random.modulus(n - i);
+       HandEval::Mask card= pack[i];
+       pack[i]= pack[j];
+       pack[j]= card;
      }
+
+     HandEval::Mask board= sim->board;
+     int x= 0;
+     for(; x<sim->boardCount; x++)
+       board |= pack[x];
+
+     // Evaluate and compare the hands
+     HandEval::Value play= HandEval::evaluate(sim->down | board);
+     int two= compare(play, HandEval::evaluate(board | pack[x] | pack[x+1]));
+     int all= two;
+     for(int i= 2; i<sim->playerCount && all >= 0; i++)
+     {
+       x += 2;
+       int cc= compare(play, HandEval::evaluate(board | pack[x] | pack[x+1]));
+       if( cc < all )
+         all= cc;
+     }
+
+     tally->count(two, all);
    }
+}
 
-   return result;
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       enumerate
+//
+// Purpose-
+//       Exhaustive two player evaluation thread.
+//
+// Notes-
+//       The board completions are divided among the threads, and each board
+//       completion is evaluated against all remaining opponent hands.
+//
+//----------------------------------------------------------------------------
+static void
+   enumerate(                       // Exhaustive evaluation thread
+     const Simulation* sim,         // The simulation parameters
+     Tally*            tally,       // (OUTPUT) The evaluation counters
+     int               thread,      // This thread's index
+     int               threads)     // The number of threads
+{
+   const HandEval::Mask* pack= sim->pack;
+   int                 const n= sim->packCount;
+
+   int index= 0;                    // The board completion index
+   for(int b0= 0; b0<n; b0++)
+   {
+     for(int b1= b0+1; b1<=n; b1++)
+     {
+       // boardCount 0: (b0==0, b1==n) only
+       // boardCount 1: (b0, b1==n)
+       // boardCount 2: (b0, b1<n)
+       if( sim->boardCount == 0 && (b0 != 0 || b1 != n) )
+         continue;
+       if( sim->boardCount == 1 && b1 != n )
+         continue;
+       if( sim->boardCount == 2 && b1 == n )
+         continue;
+
+       if( (index++ % threads) != thread )
+         continue;
+
+       HandEval::Mask board= sim->board;
+       HandEval::Mask used= 0;
+       if( sim->boardCount > 0 )
+         used |= pack[b0];
+       if( sim->boardCount > 1 )
+         used |= pack[b1];
+       board |= used;
+
+       HandEval::Value play= HandEval::evaluate(sim->down | board);
+       for(int o0= 0; o0<n; o0++)
+       {
+         if( pack[o0] & used )
+           continue;
+
+         HandEval::Mask they= board | pack[o0];
+         for(int o1= o0+1; o1<n; o1++)
+         {
+           if( pack[o1] & used )
+             continue;
+
+           int cc= compare(play, HandEval::evaluate(they | pack[o1]));
+           tally->count(cc, cc);
+         }
+       }
+     }
+   }
 }
 
 //----------------------------------------------------------------------------
@@ -352,6 +528,9 @@ inline int                          // TRUE iff mucked
 // Description-
 //       For the deal, a pre-computed evaluation array is used.
 //
+//       Against one opponent after the flop, every board completion and
+//       opponent hand is evaluated.
+//
 //       Otherwise, he hand is rated using a monte-carlo simulation of
 //       ITERATIONS deals. For each deal, the player's hand is compared to
 //       each of he other player's hands. Each such comparison results in
@@ -362,6 +541,10 @@ inline int                          // TRUE iff mucked
 //       The player must defeat ALL other players for a win, at least tie ALL
 //       other players for a tie, and a loss against ANY player is a loss
 //
+//       Both evaluations are divided among the available hardware threads.
+//       Each Monte Carlo thread uses its own pub::Random stream, seeded
+//       using rand() so that srand() still controls repeatability.
+//
 //       There is no error checking. In particular, the player's cards and
 //       the mucked cards are not checked for duplicates.
 //
@@ -375,24 +558,11 @@ void
      int               muckCount,   // Number of mucked Cards
      Card**            muckArray)   // The mucked Cards
 {
-   Card*               card;        // Working Card
-   int                 cc;          // Comparison code
-   Deck                deck;        // Working Deck
-   Card*               downHi[PLAYERS]; // Second down card
-   Card*               downLo[PLAYERS]; // First down card
    int                 hand;        // max(Number of hands,1)
-   PokerHand           handPlay;    // The Player's hand
-   PokerHand           handThey;    // The Opponent's hand
-   int                 iteration;   // Iteration number
-   int                 loadCount;   // The number of cards in load
-   Card*               load[9];     // Working hand loader
-   int                 noHand;      // The number of hands
-   int                 noTies[2];   // The number of ties
-   int                 noWins[2];   // The number of wins
-   int                 winner[PLAYERS]; // The winner array
+   Simulation          sim;         // The simulation parameters
+   Tally               total;       // The evaluation totals
 
    int                 i;
-   int                 j;
 
    if( FALSE )
    {
@@ -455,133 +625,71 @@ void
    }
 
    //-------------------------------------------------------------------------
-   // Monte-carlo hand evaluator
+   // Hand evaluator
    //-------------------------------------------------------------------------
-   loadCount= cardCount;
-   for(i= 0; i<loadCount; i++)
-     load[i]= cardArray[i];
-
-   noHand= 0;
-   noTies[0]= 0;
-   noWins[0]= 0;
-   noTies[1]= 0;
-   noWins[1]= 0;
-
-   downHi[0]= load[0];
-   downLo[0]= load[1];
-   for(iteration= 0; iteration<ITERATIONS; iteration++)
+   sim.down= HandEval::toMask(2, cardArray);
+   sim.board= HandEval::toMask(cardCount-2, cardArray+2);
+   sim.boardCount= 7 - cardCount;
+   sim.playerCount= playerCount;
+
+   HandEval::Mask used= sim.down | sim.board
+                      | HandEval::toMask(muckCount, muckArray);
+   sim.packCount= 0;
+   for(int suit= Card::SUIT_MIN; suit<=Card::SUIT_MAX; suit++)
    {
-     // Suffle the deck
-     deck.shuffle();
-
-     // Deal the cards
-     for(i= loadCount; i<7; i++)
-     {
-       for(;;)
-       {
-         card= deck.deal();
-         for(j= 0; j<i; j++)
-         {
-           if( card->getRank() == load[j]->getRank()
-               && card->getSuit() == load[j]->getSuit() )
-           {
-             card= NULL;
-             break;
-           }
-         }
-         if( card == NULL || isMucked(muckCount, muckArray, card) )
-           continue;
-
-         break;
-       }
-
-       load[i]= card;
-     }
-
-     for(i= 1; i<playerCount; i++)
-     {
-       for(;;)
-       {
-         card= deck.deal();
-         for(j= 0; j<7; j++)
-         {
-           if( card->getRank() == load[j]->getRank()
-               && card->getSuit() == load[j]->getSuit() )
-           {
-             card= NULL;
-             break;
-           }
-         }
-         if( card == NULL || isMucked(muckCount, muckArray, card) )
-           continue;
-
-         break;
-       }
-
-       downHi[i]= card;
-     }
-
-     for(i= 1; i<playerCount; i++)
+     for(int rank= Card::RANK_MIN; rank<=Card::RANK_MAX; rank++)
      {
-       for(;;)
-       {
-         card= deck.deal();
-         for(j= 0; j<7; j++)
-         {
-           if( card->getRank() == load[j]->getRank()
-               && card->getSuit() == load[j]->getSuit() )
-           {
-             card= NULL;
-             break;
-           }
-         }
-         if( card == NULL || isMucked(muckCount, muckArray, card) )
-           continue;
-
-         break;
-       }
-
-       downLo[i]= card;
+       HandEval::Mask card= HandEval::Mask(1)
+                          << (suit * HandEval::SUIT_SHIFT + rank);
+       if( (used & card) == 0 )
+         sim.pack[sim.packCount++]= card;
      }
+   }
 
-     // Load and compare the hands
-     handPlay.load(7, &load[0]);
-     for(i= 1; i<playerCount; i++)
-     {
-       load[7]= downLo[i];
-       load[8]= downHi[i];
-       handThey.load(7, &load[2]);
-       winner[i]= handPlay.compare(handThey);
-     }
+   if( sim.packCount < sim.boardCount + 2*(playerCount-1) )
+   {
+     result.reset();                // Not enough cards left in the deck
+     return;
+   }
 
-     // Count result against ONE player (twoRate)
-     cc= winner[1];
-     if( cc >= 0 )
-     {
-       if( cc > 0 )
-         noWins[0]++;
-       else
-         noTies[0]++;
-     }
+   int threads= std::thread::hardware_concurrency();
+   if( threads < 1 )
+     threads= 1;
 
-     // Count result against ALL players (allRate)
-     for(i= 2; i<playerCount; i++)
-     {
-       if( cc > winner[i] )
-         cc= winner[i];
-     }
+   std::vector<Tally> tally(threads, Tally());
+   std::vector<std::thread> thread;
+   if( playerCount == 2 && sim.boardCount <= 2 )
+   {
+     for(i= 1; i<threads; i++)
+       thread.push_back(std::thread(enumerate, &sim, &tally[i], i, threads));
+     enumerate(&sim, &tally[0], 0, threads);
+   }
+   else
+   {
+     uint64_t seed= uint64_t(rand()) << 32 | uint64_t(rand());
+     long iterations= ITERATIONS / threads;
+     for(i= 1; i<threads; i++)
+       thread.push_back(std::thread(simulate, &sim, &tally[i], iterations,
+                                    seed + i * 0x9e3779b97f4a7c15ULL));
+     simulate(&sim, &tally[0], ITERATIONS - (threads-1) * iterations, seed);
+   }
 
-     if( cc >= 0 )
-     {
-       if( cc > 0 )
-         noWins[1]++;
-       else
-         noTies[1]++;
-     }
+   for(i= 0; i<int(thread.size()); i++)
+     thread[i].join();
 
-     noHand++;
+   total= Tally();
+   for(i= 0; i<threads; i++)
+   {
+     total.noHand += tally[i].noHand;
+     total.noTies[0] += tally[i].noTies[0];
+     total.noTies[1] += tally[i].noTies[1];
+     total.noWins[0] += tally[i].noWins[0];
+     total.noWins[1] += tally[i].noWins[1];
    }
 
+   long noHand= total.noHand;
+   const long* noTies= total.noTies;
+   const long* noWins= total.noWins;
    hand= noHand;
    if( hand == 0 )
      hand= 1;
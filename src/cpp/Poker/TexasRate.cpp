@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2017 Frank Eskesen.
+//       Copyright (C) 2017-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,13 +16,18 @@
 //       Texas Hold'em hand rater.
 //
 // Last change date-
-//       2017/01/01
+//       2026/10/18
 //
 // Notes-
 //       This program calculates a rating for a Texas poker hand using either
 //       a full evaluation or, for the deal, a monte-carlo simulation.
 //       The full evaluation is fast enough for real-time usage.
 //
+//       Hands are evaluated using HandEval bit masks. Each opponent hand is
+//       rated independently, so the opponent hands are divided among the
+//       hardware threads. Each thread uses its own pub::Random stream for
+//       the deal's monte-carlo simulation.
+//
 //       Cards are specified by a two character value/suit pair.
 //       Values: 2, 3, 4, 5, 6, 7, 8, 9, T, J, Q, K, A.
 //       Suits:  C, D, H, S.
@@ -51,10 +56,16 @@
 //       ranking= p(win) + p(tie), once per rank
 //
 //----------------------------------------------------------------------------
+#include <atomic>
+#include <thread>
+#include <vector>
 #include <time.h>
 #include <string.h>
 
+#include <pub/Random.h>
+
 #include "Poker.h"
+#include "HandEval.h"
 
 //----------------------------------------------------------------------------
 // Constants for parameterization
@@ -75,6 +86,44 @@
 //----------------------------------------------------------------------------
 static Deck            deck;        // The current Deck
 
+//----------------------------------------------------------------------------
+//
+// Struct-
+//       Opponent
+//
+// Purpose-
+//       Opponent hand rating.
+//
+//----------------------------------------------------------------------------
+struct Opponent                     // Opponent hand rating
+{
+   int                 x0;          // First pack index
+   int                 x1;          // Second pack index
+   int                 playHand;    // The number of hands played
+   int                 playTies;    // The number of hands tied
+   int                 playWins;    // The number of hands won
+}; // struct Opponent
+
+//----------------------------------------------------------------------------
+//
+// Struct-
+//       Evaluation
+//
+// Purpose-
+//       Opponent hand rating parameters.
+//
+//----------------------------------------------------------------------------
+struct Evaluation                   // Opponent hand rating parameters
+{
+   int                 cardCount;   // The number of Player cards
+   HandEval::Mask      down;        // The Player's down cards
+   HandEval::Mask      board;       // The board cards
+   int                 packCount;   // The number of cards in the pack
+   HandEval::Mask      pack[52];    // The cards left in the pack
+   std::vector<Opponent> opponent;  // The Opponent hands
+   std::atomic<size_t> next;        // The next Opponent index
+}; // struct Evaluation
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -249,30 +298,124 @@ static void
 //       Determine the results of a Hand.
 //
 //----------------------------------------------------------------------------
-inline void
+static inline void
    countHand(                       // Determine resultant
-     Card*             load[9],     // The hand loader
-     int&              playHand,    // The number of hands played
-     int&              playTies,    // The number of hands tied
-     int&              playWins)    // The number of hands won
+     HandEval::Mask    board,       // The board
+     HandEval::Mask    down,        // The Player's down cards
+     HandEval::Mask    they,        // The opponent's down cards
+     Opponent&         opponent)    // The opponent's counters
 {
-   int                 cc;          // Comparison code
-   PokerHand           handPlay;    // The Player's hand
-   PokerHand           handThey;    // The Opponent's hand
+   HandEval::Value     handPlay= HandEval::evaluate(board | down);
+   HandEval::Value     handThey= HandEval::evaluate(board | they);
 
-   // Compute winner
-   handPlay.load(7, &load[0]);
-   handThey.load(7, &load[2]);
-
-   cc= handPlay.compare(handThey);
-   if( cc >= 0 )
+   if( handPlay >= handThey )
    {
-     if( cc > 0 )
-       playWins++;
+     if( handPlay > handThey )
+       opponent.playWins++;
      else
-       playTies++;
+       opponent.playTies++;
+   }
+   opponent.playHand++;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       rateHand
+//
+// Purpose-
+//       Rate the Player's hand against an Opponent's hand.
+//
+//----------------------------------------------------------------------------
+static void
+   rateHand(                        // Rate against an Opponent hand
+     const Evaluation& eval,        // The rating parameters
+     Opponent&         opponent,    // The Opponent
+     pub::Random&      random)      // Our Random stream
+{
+   HandEval::Mask      they;        // The opponent's down cards
+   HandEval::Mask      play[52];    // The "in play" cards
+   int                 playCount;   // The number of "in play" cards
+
+   they= eval.pack[opponent.x0] | eval.pack[opponent.x1];
+   playCount= 0;
+   for(int i= 0; i<eval.packCount; i++)
+   {
+     if( (eval.pack[i] & they) == 0 )
+       play[playCount++]= eval.pack[i];
+   }
+   assert( playCount+2 == eval.packCount );
+
+   switch( eval.cardCount )
+   {
+     case 2:
+       for(int iteration= 0; iteration<ITERATIONS; iteration++)
+       {
+         // Deal the cards
+         HandEval::Mask board= 0;
+         for(int i= 0; i<5; i++)
+         {
+           int j= i + random.modulus(playCount - i);
+           HandEval::Mask card= play[j];
+           play[j]= play[i];
+           play[i]= card;
+           board |= card;
+         }
+
+         // Get the resultant
+         countHand(board, eval.down, they, opponent);
+       }
+       break;
+
+     case 5:
+       for(int x5= 0; x5<playCount; x5++)
+       {
+         for(int x6= x5+1; x6<playCount; x6++)
+           countHand(eval.board | play[x5] | play[x6], eval.down, they,
+                     opponent);
+       }
+       break;
+
+     case 6:
+       for(int x6= 0; x6<playCount; x6++)
+         countHand(eval.board | play[x6], eval.down, they, opponent);
+       break;
+
+     case 7:
+       countHand(eval.board, eval.down, they, opponent);
+       break;
+
+     default:
+       printf("Invalid cardCount(%d)\n", eval.cardCount);
+       throw "InvalidHand";
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       rateThread
+//
+// Purpose-
+//       Rate Opponent hands until none remain.
+//
+//----------------------------------------------------------------------------
+static void
+   rateThread(                      // Rate Opponent hands
+     Evaluation*       eval,        // The rating parameters
+     uint64_t          seed)        // Our Random seed
+{
+   pub::Random         random;      // Our Random stream
+   random.set_seed(seed);
+
+   for(;;)
+   {
+     size_t index= eval->next++;
+     if( index >= eval->opponent.size() )
+       break;
+
+     rateHand(*eval, eval->opponent[index], random);
    }
-   playHand++;
 }
 
 //----------------------------------------------------------------------------
@@ -292,13 +435,7 @@ static void
      Card*             muck[])      // The mucked cards
 {
    Card*               deal;        // The dealt card
-   Deck                deck;        // The deck of cards
-   int                 iteration;   // The iteration number
-   int                 iterPrint;   // The next print iteration number
-   Card*               load[9];     // The hand loader
-   int                 playHand;    // The number of hands played
-   int                 playTies;    // The number of hands tied
-   int                 playWins;    // The number of hands won
+   Evaluation          eval;        // The rating parameters
    int                 rankHand;    // The number of hands ranked
    int                 rankTies;    // The number of ranked ties
    int                 rankWins;    // The number of ranked wins
@@ -310,9 +447,6 @@ static void
    Deck                packDeck;    // The source cards for the pack
    Card*               pack[52];    // The cards left in the pack
 
-   int                 playCount;   // The count - 2
-   Card*               play[52];    // The "in play" cards
-
    int                 i;
    int                 j;
 
@@ -324,17 +458,6 @@ static void
    rateTies= 0;
    rateWins= 0;
 
-   for(i= 0; i<cardCount; i++)
-     load[i]= card[i];
-
-   iterPrint= 1;
-   if( 0 )
-   {
-     printf("\n");
-     printf("[iterations] Players:     1        2"
-            "        3        4        6        7\n");
-   }
-
    // Initialize the pack
    packCount= 0;
    for(i= 0; i<52; i++)
@@ -342,8 +465,8 @@ static void
      deal= packDeck.deal();
      for(j= 0; j<cardCount; j++)
      {
-       if( deal->getRank() == load[j]->getRank()
-           && deal->getSuit() == load[j]->getSuit() )
+       if( deal->getRank() == card[j]->getRank()
+           && deal->getSuit() == card[j]->getSuit() )
        {
          deal= NULL;
          break;
@@ -371,141 +494,78 @@ static void
      throw "InvalidHand";
    }
 
-   // Rank each hand separately
+   // Rate each opponent hand separately
+   eval.cardCount= cardCount;
+   eval.down= HandEval::toMask(2, card);
+   eval.board= HandEval::toMask(cardCount-2, card+2);
+   eval.packCount= packCount;
+   for(i= 0; i<packCount; i++)
+     eval.pack[i]= HandEval::toMask(pack[i]);
+
    for(int x0= 0; x0 < packCount; x0++)
    {
      for(int x1= x0+1; x1<packCount; x1++)
      {
-       load[7]= pack[x0];           // The opponent's hand
-       load[8]= pack[x1];
-
-       playHand= 0;                 // Initialize summary for hand
-       playTies= 0;
-       playWins= 0;
+       Opponent opponent= {x0, x1, 0, 0, 0};
+       eval.opponent.push_back(opponent);
+     }
+   }
+   eval.next= 0;
 
-       playCount= 0;
-       for(i= 0; i<packCount; i++)
-       {
-         deal= pack[i];
-         for(j= 7; j<9; j++)
-         {
-           if( deal->getRank() == load[j]->getRank()
-               && deal->getSuit() == load[j]->getSuit() )
-           {
-             deal= NULL;
-             break;
-           }
-         }
-         if( deal != NULL )
-           play[playCount++]= deal;
-       }
-       assert( playCount+2 == packCount );
+   int threads= std::thread::hardware_concurrency();
+   if( threads < 1 )
+     threads= 1;
 
-       switch( cardCount )
-       {
-         case 2:
-           {{{{
-           Deck playDeck(playCount, play); // The "in play" pack
-           for(iteration= 0; iteration<ITERATIONS; iteration++)
-           {
-             // Deal the cards
-             playDeck.shuffle();
-             for(i= cardCount; i<7; i++)
-               load[i]= playDeck.deal();
-
-             // Get the resultant
-             countHand(load, playHand, playTies, playWins);
-
-             // Display the results
-             if( 0 )
-             {
-               if( iteration == iterPrint )
-               {
-                 iterPrint *= 10;
-                 printf("[%10d]", iteration+1);
-
-                 if( 0 )
-                 {
-                   printf(" Wins: %8.5f", double(playWins)/double(playHand));
-                   printf(" Ties: %8.5f", double(playTies)/double(playHand));
-                 }
-
-                 if( 0 )
-                 {
-                   printf(" Wins %8d", playWins);
-                   printf(" Ties %8d", playTies);
-                   printf(" Hand %8d", playHand);
-                 }
-                 printf("\n");
-               }
-             }
-           }
-           }}}}
-           break;
+   uint64_t seed= uint64_t(rand()) << 32 | uint64_t(rand());
+   std::vector<std::thread> thread;
+   for(i= 1; i<threads; i++)
+     thread.push_back(std::thread(rateThread, &eval,
+                                  seed + i * 0x9e3779b97f4a7c15ULL));
+   rateThread(&eval, seed);
+   for(i= 0; i<int(thread.size()); i++)
+     thread[i].join();
 
-         case 5:
-           for(int x5= 0; x5<playCount; x5++)
-           {
-             load[5]= play[x5];
-             for(int x6= x5+1; x6<playCount; x6++)
-             {
-               load[6]= play[x6];
-               countHand(load, playHand, playTies, playWins);
-             }
-           }
-           break;
+   // Rank each hand separately
+   for(size_t x= 0; x<eval.opponent.size(); x++)
+   {
+     const Opponent& opponent= eval.opponent[x];
+     int playHand= opponent.playHand;
+     int playTies= opponent.playTies;
+     int playWins= opponent.playWins;
 
-         case 6:
-           for(int x6= 0; x6<playCount; x6++)
-           {
-             load[6]= play[x6];
-             countHand(load, playHand, playTies, playWins);
-           }
-           break;
+     // Update rating
+     rateHand += playHand;
+     rateWins += playWins;
+     rateTies += playTies;
 
-         case 7:
-           countHand(load, playHand, playTies, playWins);
-           break;
+     // Update ranking
+     int playLoss= playHand-playWins-playTies;
 
-         default:
-           printf("Invalid cardCount(%d)\n", cardCount);
-           throw "InvalidHand";
-       }
+     if( playWins > playLoss + playLoss/8
+         && playWins > playLoss + playTies/8 )
+       rankWins++;
+     else if( playWins + playWins/8 >= playLoss
+         || playWins + playTies/8 >= playLoss )
+       rankTies++;
 
-       // Update rating
-       rateHand += playHand;
-       rateWins += playWins;
-       rateTies += playTies;
+     rankHand++;
 
-       // Update ranking
-       int playLoss= playHand-playWins-playTies;
+     if( 0 )
+     {
+       char s7[32], s8[32];
+       printf("%s %s {%6d, %6d, %6d} %6d ",
+              pack[opponent.x0]->toShortString(s7),
+              pack[opponent.x1]->toShortString(s8),
+              playWins, playTies, playHand-playWins-playTies, playHand);
 
        if( playWins > playLoss + playLoss/8
            && playWins > playLoss + playTies/8 )
-         rankWins++;
+         printf("WIN\n");
        else if( playWins + playWins/8 >= playLoss
            || playWins + playTies/8 >= playLoss )
-         rankTies++;
-
-       rankHand++;
-
-       if( 0 )
-       {
-         char s7[32], s8[32];
-         printf("%s %s {%6d, %6d, %6d} %6d ",
-                load[7]->toShortString(s7),
-                load[8]->toShortString(s8),
-                playWins, playTies, playHand-playWins-playTies, playHand);
-
-         if( playWins > playLoss + playLoss/8
-             && playWins > playLoss + playTies/8 )
-           printf("WIN\n");
-         else if( playWins + playWins/8 >= playLoss
-             || playWins + playTies/8 >= playLoss )
-           printf("TIE\n");
-         else
-           printf("LOSS\n");
-       }
+         printf("TIE\n");
+       else
+         printf("LOSS\n");
      }
    }
 
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the MIT license.
 //       (See accompanying file LICENSE.MIT or the original contained
@@ -15,7 +15,7 @@
 //       Merge sorter.
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
 //
 // Implementation notes-
 //       10000 Timing: 6.76 (#2) Uses a duplicate array.
@@ -135,11 +135,12 @@ static void
      mergeIndex++;
    }
 
-   for(i=0; i<=count; i++)
+   for(i=0; i<count; i++)
    {
      array[top]= merge[top];
      top--;
-   }}
+   }
+}
 
 //----------------------------------------------------------------------------
 //
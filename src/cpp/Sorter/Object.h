@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the MIT license.
 //       (See accompanying file LICENSE.MIT or the original contained
@@ -15,7 +15,7 @@
 //       Sortable Object.
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef OBJECT_H_INCLUDED
@@ -47,6 +47,10 @@ int                                 // Comparitor (<0, =0, >0)
    compare(                         // Compare this object
      Object*           source);     // To this Object
 
+inline unsigned                     // The sort key
+   getKey( void ) const             // Get sort key
+{  return value; }
+
 //----------------------------------------------------------------------------
 // Object::Attributes
 //----------------------------------------------------------------------------
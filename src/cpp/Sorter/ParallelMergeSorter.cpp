@@ -0,0 +1,281 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the MIT license.
+//       (See accompanying file LICENSE.MIT or the original contained
+//       within https://opensource.org/licenses/MIT)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       ParallelMergeSorter.cpp
+//
+// Purpose-
+//       Parallel merge sorter.
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       The array is divided into one run per thread and the runs are sorted
+//       concurrently. Pairs of runs are then merged until one run remains.
+//       When there are fewer pairs than threads, each merge is divided into
+//       independent output ranges, located by binary search, so that every
+//       merge pass uses all the threads. The sort is stable.
+//
+//----------------------------------------------------------------------------
+#include <algorithm>
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "ParallelMergeSorter.h"
+
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+#define __SOURCE__       "PMERGE  " // Source file
+
+#define MIN_RUN                1024 // Minimum initial run length
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       lessObject, lessKey
+//
+// Purpose-
+//       Sort comparators.
+//
+//----------------------------------------------------------------------------
+static inline bool                  // TRUE iff L < R
+   lessObject(                      // Compare Objects
+     Object*           L,           // Left Object
+     Object*           R)           // Right Object
+{
+   return L->compare(R) < 0;
+}
+
+static inline bool                  // TRUE iff L < R
+   lessKey(                         // Compare SortKeys
+     const SortKey&    L,           // Left SortKey
+     const SortKey&    R)           // Right SortKey
+{
+   return L.key < R.key;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       coRank
+//
+// Purpose-
+//       Locate a merge output position within its inputs.
+//
+// Notes-
+//       Returns the number of A elements among the first k merge outputs.
+//       On equal elements, A elements precede B elements.
+//
+//----------------------------------------------------------------------------
+template<class T, class Less>
+static unsigned                     // The number of A elements used
+   coRank(                          // Locate merge output position
+     unsigned          k,           // The output position
+     const T*          A,           // The left input run
+     unsigned          m,           // The left input run length
+     const T*          B,           // The right input run
+     unsigned          n,           // The right input run length
+     Less              less)        // The comparator
+{
+   unsigned lo= (k > n) ? k - n : 0;
+   unsigned hi= (k < m) ? k : m;
+   while( lo < hi )
+   {
+     unsigned mid= (lo + hi) / 2;
+     if( !less(B[k-mid-1], A[mid]) ) // If A[mid] <= B[k-mid-1]
+       lo= mid + 1;
+     else
+       hi= mid;
+   }
+
+   return lo;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       sortArray
+//
+// Purpose-
+//       Parallel merge sort.
+//
+//----------------------------------------------------------------------------
+template<class T, class Less>
+static void
+   sortArray(                       // Parallel merge sort
+     SortPool&         pool,        // The thread pool
+     unsigned          count,       // Number of elements
+     T*                array,       // Element array
+     T*                merge,       // Merge array [count]
+     Less              less)        // The comparator
+{
+   unsigned runs= pool.getThreads();
+   if( runs > count / MIN_RUN )
+     runs= count / MIN_RUN;
+   if( runs <= 1 )
+   {
+     std::stable_sort(array, array + count, less);
+     return;
+   }
+
+   // Sort the initial runs
+   std::vector<unsigned> bound(runs + 1); // Run boundaries
+   for(unsigned i= 0; i<=runs; i++)
+     bound[i]= unsigned(uint64_t(count) * i / runs);
+
+   pool.run(runs, [&](unsigned r)
+   {
+     std::stable_sort(array + bound[r], array + bound[r+1], less);
+   });
+
+   // Merge pairs of runs
+   T* source= array;
+   T* target= merge;
+   while( runs > 1 )
+   {
+     unsigned pairs= (runs + 1) / 2;
+     unsigned split= pool.getThreads() / pairs;
+     if( split < 1 )
+       split= 1;
+
+     pool.run(pairs * split, [&](unsigned t)
+     {
+       unsigned p= t / split;
+       unsigned q= t % split;
+       unsigned lo= bound[2*p];
+       unsigned mid= bound[2*p+1];
+       unsigned hi= (2*p+2 <= runs) ? bound[2*p+2] : mid;
+       const T* A= source + lo;
+       const T* B= source + mid;
+       unsigned m= mid - lo;
+       unsigned n= hi - mid;
+
+       unsigned k0= unsigned(uint64_t(m + n) * q / split);
+       unsigned k1= unsigned(uint64_t(m + n) * (q + 1) / split);
+       unsigned a0= coRank(k0, A, m, B, n, less);
+       unsigned a1= coRank(k1, A, m, B, n, less);
+       std::merge(A + a0, A + a1, B + (k0 - a0), B + (k1 - a1),
+                  target + lo + k0, less);
+     });
+
+     for(unsigned i= 0; 2*i<runs; i++)
+       bound[i]= bound[2*i];
+     bound[pairs]= count;
+     runs= pairs;
+     std::swap(source, target);
+   }
+
+   if( source != array )
+     std::copy(source, source + count, array);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       ParallelMergeSorter::~ParallelMergeSorter
+//
+// Purpose-
+//       Destructor.
+//
+//----------------------------------------------------------------------------
+   ParallelMergeSorter::~ParallelMergeSorter( void ) // Destructor
+{
+   free(mergeArray);
+   free(keyArray);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       ParallelMergeSorter::ParallelMergeSorter
+//
+// Purpose-
+//       Constructor.
+//
+//----------------------------------------------------------------------------
+   ParallelMergeSorter::ParallelMergeSorter( // Constructor
+     unsigned          threads,     // Number of threads (0: hardware)
+     bool              keyed)       // Sort SortKey pairs?
+:  Sorter()
+,  pool(threads)
+,  keyed(keyed)
+,  mergeCount(0)
+,  mergeArray(NULL)
+,  keyArray(NULL)
+{
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       ParallelMergeSorter::getClassName
+//
+// Purpose-
+//       Get the class name.
+//
+//----------------------------------------------------------------------------
+const char*                         // The class name
+   ParallelMergeSorter::getClassName( void ) const
+{
+   if( keyed )
+     return "ParallelMergeSorter(keyed)";
+
+   return "ParallelMergeSorter";
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       ParallelMergeSorter::sort
+//
+// Purpose-
+//       Sort an array.
+//
+//----------------------------------------------------------------------------
+void
+   ParallelMergeSorter::sort(       // Sort an Object array
+     unsigned          count,       // Number of elements
+     Object**          array)       // Object array
+{
+   if( count < 2 )
+     return;
+
+   if( count > mergeCount )
+   {
+     free(mergeArray);
+     free(keyArray);
+     mergeArray= (Object**)malloc(count * sizeof(Object*));
+     keyArray= (SortKey*)malloc(2 * count * sizeof(SortKey));
+     mergeCount= count;
+     assert( mergeArray != NULL && keyArray != NULL );
+   }
+
+   if( !keyed )
+   {
+     sortArray(pool, count, array, mergeArray, lessObject);
+     return;
+   }
+
+   for(unsigned i= 0; i<count; i++)
+   {
+     keyArray[i].key= array[i]->getKey();
+     keyArray[i].object= array[i];
+   }
+
+   sortArray(pool, count, keyArray, keyArray + count, lessKey);
+
+   for(unsigned i= 0; i<count; i++)
+     array[i]= keyArray[i].object;
+}
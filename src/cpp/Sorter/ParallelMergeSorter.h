@@ -0,0 +1,72 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the MIT license.
+//       (See accompanying file LICENSE.MIT or the original contained
+//       within https://opensource.org/licenses/MIT)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       ParallelMergeSorter.h
+//
+// Purpose-
+//       Parallel merge sort object.
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#ifndef PARALLELMERGESORTER_H_INCLUDED
+#define PARALLELMERGESORTER_H_INCLUDED
+
+#ifndef SORTER_H_INCLUDED
+#include "Sorter.h"
+#endif
+
+#include "SortPool.h"
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       ParallelMergeSorter
+//
+// Purpose-
+//       Parallel merge sorter.
+//
+//----------------------------------------------------------------------------
+class ParallelMergeSorter : public Sorter { // Parallel merge sorter
+//----------------------------------------------------------------------------
+// ParallelMergeSorter::Constructors
+//----------------------------------------------------------------------------
+public:
+   ~ParallelMergeSorter( void );    // Destructor
+   ParallelMergeSorter(             // Constructor
+     unsigned          threads= 0,  // Number of threads (0: hardware)
+     bool              keyed= false); // Sort SortKey pairs?
+
+//----------------------------------------------------------------------------
+// ParallelMergeSorter::Methods
+//----------------------------------------------------------------------------
+public:
+virtual const char*                 // The class name
+   getClassName( void ) const;      // Get class name
+
+virtual void
+   sort(                            // Sort the objects
+     unsigned          count,       // Number of elements
+     Object**          array);      // Object array
+
+//----------------------------------------------------------------------------
+// ParallelMergeSorter::Attributes
+//----------------------------------------------------------------------------
+protected:
+   SortPool            pool;        // The thread pool
+   bool const          keyed;       // Sort SortKey pairs?
+   unsigned            mergeCount;  // Number of elements
+   Object**            mergeArray;  // Temporary array
+   SortKey*            keyArray;    // SortKey array [2*mergeCount]
+}; // class ParallelMergeSorter
+
+#endif // PARALLELMERGESORTER_H_INCLUDED
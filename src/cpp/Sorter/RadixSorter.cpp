@@ -0,0 +1,154 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the MIT license.
+//       (See accompanying file LICENSE.MIT or the original contained
+//       within https://opensource.org/licenses/MIT)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       RadixSorter.cpp
+//
+// Purpose-
+//       Radix sorter.
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       Sorts SortKey pairs, eight key bits per pass, least significant digit
+//       first. All four digit histograms are built in one scan, and a pass
+//       is skipped when every key has the same digit. The sort is stable.
+//
+//----------------------------------------------------------------------------
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "RadixSorter.h"
+
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+#define __SOURCE__       "RADIX   " // Source file
+
+#define DIGIT_BITS                8 // Bits per digit
+#define DIGIT_COUNT   (1 << DIGIT_BITS) // Values per digit
+#define PASS_COUNT   (32 / DIGIT_BITS) // Digits per key
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       RadixSorter::~RadixSorter
+//
+// Purpose-
+//       Destructor.
+//
+//----------------------------------------------------------------------------
+   RadixSorter::~RadixSorter( void ) // Destructor
+{
+   free(keyArray);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       RadixSorter::RadixSorter
+//
+// Purpose-
+//       Constructor.
+//
+//----------------------------------------------------------------------------
+   RadixSorter::RadixSorter( void ) // Constructor
+:  Sorter()
+,  radixCount(0)
+,  keyArray(NULL)
+{
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       RadixSorter::getClassName
+//
+// Purpose-
+//       Get the class name.
+//
+//----------------------------------------------------------------------------
+const char*                         // The class name
+   RadixSorter::getClassName( void ) const
+{
+   return "RadixSorter";
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       RadixSorter::sort
+//
+// Purpose-
+//       Sort an array.
+//
+//----------------------------------------------------------------------------
+void
+   RadixSorter::sort(               // Sort an Object array
+     unsigned          count,       // Number of elements
+     Object**          array)       // Object array
+{
+   unsigned            histogram[PASS_COUNT][DIGIT_COUNT]; // Digit counts
+
+   if( count < 2 )
+     return;
+
+   if( count > radixCount )
+   {
+     free(keyArray);
+     keyArray= (SortKey*)malloc(2 * count * sizeof(SortKey));
+     radixCount= count;
+     assert( keyArray != NULL );
+   }
+
+   // Extract the keys, counting the digits
+   memset(histogram, 0, sizeof(histogram));
+   SortKey* source= keyArray;
+   SortKey* target= keyArray + count;
+   for(unsigned i= 0; i<count; i++)
+   {
+     unsigned key= array[i]->getKey();
+     source[i].key= key;
+     source[i].object= array[i];
+     for(unsigned p= 0; p<PASS_COUNT; p++)
+       histogram[p][(key >> (p * DIGIT_BITS)) & (DIGIT_COUNT - 1)]++;
+   }
+
+   // Distribute by each digit
+   for(unsigned p= 0; p<PASS_COUNT; p++)
+   {
+     unsigned* const counter= histogram[p];
+     unsigned const shift= p * DIGIT_BITS;
+     if( counter[(source[0].key >> shift) & (DIGIT_COUNT - 1)] == count )
+       continue;                    // (All keys have the same digit)
+
+     unsigned position= 0;
+     for(unsigned d= 0; d<DIGIT_COUNT; d++)
+     {
+       unsigned n= counter[d];
+       counter[d]= position;
+       position += n;
+     }
+
+     for(unsigned i= 0; i<count; i++)
+       target[counter[(source[i].key >> shift) & (DIGIT_COUNT - 1)]++]=
+           source[i];
+
+     SortKey* swap= source;
+     source= target;
+     target= swap;
+   }
+
+   for(unsigned i= 0; i<count; i++)
+     array[i]= source[i].object;
+}
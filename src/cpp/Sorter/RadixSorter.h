@@ -0,0 +1,65 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the MIT license.
+//       (See accompanying file LICENSE.MIT or the original contained
+//       within https://opensource.org/licenses/MIT)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       RadixSorter.h
+//
+// Purpose-
+//       Radix sort object.
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#ifndef RADIXSORTER_H_INCLUDED
+#define RADIXSORTER_H_INCLUDED
+
+#ifndef SORTER_H_INCLUDED
+#include "Sorter.h"
+#endif
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       RadixSorter
+//
+// Purpose-
+//       LSD radix sorter, using Object::getKey.
+//
+//----------------------------------------------------------------------------
+class RadixSorter : public Sorter { // Radix sorter
+//----------------------------------------------------------------------------
+// RadixSorter::Constructors
+//----------------------------------------------------------------------------
+public:
+   ~RadixSorter( void );            // Destructor
+   RadixSorter( void );             // Constructor
+
+//----------------------------------------------------------------------------
+// RadixSorter::Methods
+//----------------------------------------------------------------------------
+public:
+virtual const char*                 // The class name
+   getClassName( void ) const;      // Get class name
+
+virtual void
+   sort(                            // Sort the objects
+     unsigned          count,       // Number of elements
+     Object**          array);      // Object array
+
+//----------------------------------------------------------------------------
+// RadixSorter::Attributes
+//----------------------------------------------------------------------------
+protected:
+   unsigned            radixCount;  // Number of elements
+   SortKey*            keyArray;    // SortKey array [2*radixCount]
+}; // class RadixSorter
+
+#endif // RADIXSORTER_H_INCLUDED
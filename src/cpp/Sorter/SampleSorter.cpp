@@ -0,0 +1,284 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the MIT license.
+//       (See accompanying file LICENSE.MIT or the original contained
+//       within https://opensource.org/licenses/MIT)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       SampleSorter.cpp
+//
+// Purpose-
+//       Parallel sample sorter.
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       Splitters are chosen from a sorted, oversampled subset of the array.
+//       Each thread assigns the elements of its slice to buckets and counts
+//       them; the counts give each thread's output position in every bucket.
+//       The elements are then scattered, and the buckets sorted concurrently.
+//
+//       Elements equal to a splitter have their own bucket, which needs no
+//       sorting. This keeps inputs with many duplicates balanced.
+//
+//----------------------------------------------------------------------------
+#include <algorithm>
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "SampleSorter.h"
+
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+#define __SOURCE__       "SAMPLE  " // Source file
+
+#define BUCKETS_PER_THREAD        4 // Sorted buckets per thread
+#define MIN_BUCKET             1024 // Minimum average bucket size
+#define OVERSAMPLE               32 // Samples per splitter
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       lessObject, lessKey
+//
+// Purpose-
+//       Sort comparators.
+//
+//----------------------------------------------------------------------------
+static inline bool                  // TRUE iff L < R
+   lessObject(                      // Compare Objects
+     Object*           L,           // Left Object
+     Object*           R)           // Right Object
+{
+   return L->compare(R) < 0;
+}
+
+static inline bool                  // TRUE iff L < R
+   lessKey(                         // Compare SortKeys
+     const SortKey&    L,           // Left SortKey
+     const SortKey&    R)           // Right SortKey
+{
+   return L.key < R.key;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       sortArray
+//
+// Purpose-
+//       Parallel sample sort.
+//
+// Notes-
+//       With S splitters there are 2*S+1 buckets. Bucket 2*j holds the
+//       elements between splitter j-1 and splitter j, and bucket 2*j+1 holds
+//       the elements equal to splitter j.
+//
+//----------------------------------------------------------------------------
+template<class T, class Less>
+static void
+   sortArray(                       // Parallel sample sort
+     SortPool&         pool,        // The thread pool
+     unsigned          count,       // Number of elements
+     T*                array,       // Element array
+     T*                target,      // Scatter array [count]
+     uint16_t*         bucket,      // Bucket index array [count]
+     Less              less)        // The comparator
+{
+   unsigned const threads= pool.getThreads();
+   unsigned sorted= threads * BUCKETS_PER_THREAD; // Number of sorted buckets
+   if( sorted > count / MIN_BUCKET )
+     sorted= count / MIN_BUCKET;
+   if( threads <= 1 || sorted <= 1 )
+   {
+     std::sort(array, array + count, less);
+     return;
+   }
+
+   // Select the splitters
+   unsigned const samples= sorted * OVERSAMPLE;
+   unsigned const stride= count / samples;
+   std::vector<T> sample(samples);
+   uint32_t seed= count;
+   for(unsigned i= 0; i<samples; i++)
+   {
+     seed= seed * 1103515245 + 12345;
+     sample[i]= array[i * stride + (seed >> 8) % stride];
+   }
+   std::sort(sample.begin(), sample.end(), less);
+
+   unsigned const splitters= sorted - 1;
+   std::vector<T> splitter(splitters);
+   for(unsigned j= 0; j<splitters; j++)
+     splitter[j]= sample[(j + 1) * OVERSAMPLE];
+
+   // Assign and count the buckets
+   unsigned const buckets= 2 * splitters + 1;
+   std::vector<unsigned> offset(threads * buckets, 0);
+   std::vector<unsigned> slice(threads + 1);
+   for(unsigned t= 0; t<=threads; t++)
+     slice[t]= unsigned(uint64_t(count) * t / threads);
+
+   pool.run(threads, [&](unsigned t)
+   {
+     unsigned* counter= &offset[t * buckets];
+     for(unsigned i= slice[t]; i<slice[t+1]; i++)
+     {
+       unsigned j= std::upper_bound(splitter.begin(), splitter.end(),
+                                    array[i], less) - splitter.begin();
+       unsigned b= 2 * j;
+       if( j > 0 && !less(splitter[j-1], array[i]) ) // If equal
+         b--;
+
+       bucket[i]= b;
+       counter[b]++;
+     }
+   });
+
+   // Convert the counts into output positions
+   std::vector<unsigned> start(buckets + 1);
+   unsigned position= 0;
+   for(unsigned b= 0; b<buckets; b++)
+   {
+     start[b]= position;
+     for(unsigned t= 0; t<threads; t++)
+     {
+       unsigned n= offset[t * buckets + b];
+       offset[t * buckets + b]= position;
+       position += n;
+     }
+   }
+   start[buckets]= position;
+   assert( position == count );
+
+   // Scatter the elements
+   pool.run(threads, [&](unsigned t)
+   {
+     unsigned* next= &offset[t * buckets];
+     for(unsigned i= slice[t]; i<slice[t+1]; i++)
+       target[next[bucket[i]]++]= array[i];
+   });
+
+   // Sort the buckets, copying them back into the array
+   pool.run(splitters + 1, [&](unsigned j)
+   {
+     unsigned lo= start[2*j];
+     unsigned hi= start[2*j+1];
+     std::sort(target + lo, target + hi, less);
+
+     if( j < splitters )            // Include the equal bucket
+       hi= start[2*j+2];
+     std::copy(target + lo, target + hi, array + lo);
+   });
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       SampleSorter::~SampleSorter
+//
+// Purpose-
+//       Destructor.
+//
+//----------------------------------------------------------------------------
+   SampleSorter::~SampleSorter( void ) // Destructor
+{
+   free(sampleArray);
+   free(keyArray);
+   free(bucketArray);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       SampleSorter::SampleSorter
+//
+// Purpose-
+//       Constructor.
+//
+//----------------------------------------------------------------------------
+   SampleSorter::SampleSorter(      // Constructor
+     unsigned          threads,     // Number of threads (0: hardware)
+     bool              keyed)       // Sort SortKey pairs?
+:  Sorter()
+,  pool(threads)
+,  keyed(keyed)
+,  sampleCount(0)
+,  sampleArray(NULL)
+,  keyArray(NULL)
+,  bucketArray(NULL)
+{
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       SampleSorter::getClassName
+//
+// Purpose-
+//       Get the class name.
+//
+//----------------------------------------------------------------------------
+const char*                         // The class name
+   SampleSorter::getClassName( void ) const
+{
+   if( keyed )
+     return "SampleSorter(keyed)";
+
+   return "SampleSorter";
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       SampleSorter::sort
+//
+// Purpose-
+//       Sort an array.
+//
+//----------------------------------------------------------------------------
+void
+   SampleSorter::sort(              // Sort an Object array
+     unsigned          count,       // Number of elements
+     Object**          array)       // Object array
+{
+   if( count < 2 )
+     return;
+
+   if( count > sampleCount )
+   {
+     free(sampleArray);
+     free(keyArray);
+     free(bucketArray);
+     sampleArray= (Object**)malloc(count * sizeof(Object*));
+     keyArray= (SortKey*)malloc(2 * count * sizeof(SortKey));
+     bucketArray= (uint16_t*)malloc(count * sizeof(uint16_t));
+     sampleCount= count;
+     assert( sampleArray != NULL && keyArray != NULL && bucketArray != NULL );
+   }
+
+   if( !keyed )
+   {
+     sortArray(pool, count, array, sampleArray, bucketArray, lessObject);
+     return;
+   }
+
+   for(unsigned i= 0; i<count; i++)
+   {
+     keyArray[i].key= array[i]->getKey();
+     keyArray[i].object= array[i];
+   }
+
+   sortArray(pool, count, keyArray, keyArray + count, bucketArray, lessKey);
+
+   for(unsigned i= 0; i<count; i++)
+     array[i]= keyArray[i].object;
+}
@@ -0,0 +1,75 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the MIT license.
+//       (See accompanying file LICENSE.MIT or the original contained
+//       within https://opensource.org/licenses/MIT)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       SampleSorter.h
+//
+// Purpose-
+//       Parallel sample sort object.
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#ifndef SAMPLESORTER_H_INCLUDED
+#define SAMPLESORTER_H_INCLUDED
+
+#include <stdint.h>
+
+#ifndef SORTER_H_INCLUDED
+#include "Sorter.h"
+#endif
+
+#include "SortPool.h"
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       SampleSorter
+//
+// Purpose-
+//       Parallel sample sorter.
+//
+//----------------------------------------------------------------------------
+class SampleSorter : public Sorter { // Parallel sample sorter
+//----------------------------------------------------------------------------
+// SampleSorter::Constructors
+//----------------------------------------------------------------------------
+public:
+   ~SampleSorter( void );           // Destructor
+   SampleSorter(                    // Constructor
+     unsigned          threads= 0,  // Number of threads (0: hardware)
+     bool              keyed= false); // Sort SortKey pairs?
+
+//----------------------------------------------------------------------------
+// SampleSorter::Methods
+//----------------------------------------------------------------------------
+public:
+virtual const char*                 // The class name
+   getClassName( void ) const;      // Get class name
+
+virtual void
+   sort(                            // Sort the objects
+     unsigned          count,       // Number of elements
+     Object**          array);      // Object array
+
+//----------------------------------------------------------------------------
+// SampleSorter::Attributes
+//----------------------------------------------------------------------------
+protected:
+   SortPool            pool;        // The thread pool
+   bool const          keyed;       // Sort SortKey pairs?
+   unsigned            sampleCount; // Number of elements
+   Object**            sampleArray; // Temporary array
+   SortKey*            keyArray;    // SortKey array [2*sampleCount]
+   uint16_t*           bucketArray; // Bucket index array
+}; // class SampleSorter
+
+#endif // SAMPLESORTER_H_INCLUDED
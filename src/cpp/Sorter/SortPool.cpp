@@ -0,0 +1,67 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the MIT license.
+//       (See accompanying file LICENSE.MIT or the original contained
+//       within https://opensource.org/licenses/MIT)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       SortPool.cpp
+//
+// Purpose-
+//       Sorter task runner, using pub::WorkerPool threads.
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#include <thread>
+
+#include <pub/Worker.h>             // For pub::WorkerPool
+
+#include "SortPool.h"
+
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+#define __SOURCE__       "SORTPOOL" // Source file
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       SortPool::SortPool
+//
+// Purpose-
+//       Constructor.
+//
+//----------------------------------------------------------------------------
+   SortPool::SortPool(              // Constructor
+     unsigned          threads)     // Number of threads (0: hardware)
+:  threads(threads)
+{
+   if( this->threads == 0 )
+     this->threads= std::thread::hardware_concurrency();
+   if( this->threads == 0 )
+     this->threads= 1;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       SortPool::run
+//
+// Purpose-
+//       Run tasks, returning when all are complete.
+//
+//----------------------------------------------------------------------------
+void
+   SortPool::run(                   // Run tasks
+     unsigned          count,       // Number of tasks
+     const Task&       task)        // The task
+{
+   pub::WorkerPool::parallel(threads, count,
+     [&task](size_t index) { task(unsigned(index)); });
+}
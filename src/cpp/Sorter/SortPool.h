@@ -0,0 +1,84 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the MIT license.
+//       (See accompanying file LICENSE.MIT or the original contained
+//       within https://opensource.org/licenses/MIT)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       SortPool.h
+//
+// Purpose-
+//       Sorter task runner, using pub::WorkerPool threads.
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       run(count, task) invokes task(0) .. task(count-1), returning when all
+//       of them complete. The calling thread also runs tasks, so a SortPool
+//       with one thread runs every task in the calling thread.
+//
+//       A SortPool owns no threads. The others are pub::WorkerPool threads,
+//       shared with everything else using that pool.
+//
+//----------------------------------------------------------------------------
+#ifndef SORTPOOL_H_INCLUDED
+#define SORTPOOL_H_INCLUDED
+
+#include <functional>
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       SortPool
+//
+// Purpose-
+//       Sorter task runner.
+//
+//----------------------------------------------------------------------------
+class SortPool {                    // Sorter task runner
+//----------------------------------------------------------------------------
+// SortPool::Enumerations and typedefs
+//----------------------------------------------------------------------------
+public:
+typedef std::function<void(unsigned)>
+                       Task;        // A task, given its index
+
+//----------------------------------------------------------------------------
+// SortPool::Constructors
+//----------------------------------------------------------------------------
+public:
+   ~SortPool( void ) {}             // Destructor
+   SortPool(                        // Constructor
+     unsigned          threads= 0); // Number of threads (0: hardware)
+
+private:                            // Bitwise copy is prohibited
+   SortPool(const SortPool&);       // Disallowed copy constructor
+SortPool&
+   operator=(const SortPool&);      // Disallowed assignment operator
+
+//----------------------------------------------------------------------------
+// SortPool::Methods
+//----------------------------------------------------------------------------
+public:
+inline unsigned                     // The number of threads
+   getThreads( void ) const         // Get number of threads
+{  return threads; }
+
+void
+   run(                             // Run tasks
+     unsigned          count,       // Number of tasks
+     const Task&       task);       // The task
+
+//----------------------------------------------------------------------------
+// SortPool::Attributes
+//----------------------------------------------------------------------------
+protected:
+   unsigned            threads;     // Number of threads, including caller
+}; // class SortPool
+
+#endif // SORTPOOL_H_INCLUDED
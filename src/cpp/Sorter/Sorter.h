@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the MIT license.
 //       (See accompanying file LICENSE.MIT or the original contained
@@ -15,7 +15,7 @@
 //       Bubble sort object.
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef SORTER_H_INCLUDED
@@ -25,6 +25,27 @@
 #include "Object.h"
 #endif
 
+//----------------------------------------------------------------------------
+//
+// Struct-
+//       SortKey
+//
+// Purpose-
+//       Key extracting sort element.
+//
+// Implementation notes-
+//       Keyed sorters copy each Object's key into a SortKey, sort the
+//       SortKey array, then copy the Object pointers back. Comparisons then
+//       use adjacent memory rather than following each Object pointer.
+//       Keys are ordered as unsigned values, the same as Object::compare
+//       for keys less than 0x80000000.
+//
+//----------------------------------------------------------------------------
+struct SortKey {                    // Key extracting sort element
+   unsigned            key;         // The Object's key
+   Object*             object;      // The Object
+}; // struct SortKey
+
 //----------------------------------------------------------------------------
 //
 // Class-
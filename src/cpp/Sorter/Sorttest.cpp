@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007-2023 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the MIT license.
 //       (See accompanying file LICENSE.MIT or the original contained
@@ -15,21 +15,34 @@
 //       Sort tester.
 //
 // Last change date-
-//       2023/01/11
+//       2026/10/18
+//
+// Usage-
+//       Sorttest {count {test}}
+//         Verify each Sorter, sorting every array size from count down to 0.
+//
+//       Sorttest bench {count}
+//         Time the Sorters over a matrix of array sizes (up to count) and
+//         input distributions.
 //
 //----------------------------------------------------------------------------
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <thread>
 #include <com/Interval.h>
 #include <com/Random.h>
+#include <pub/Worker.h>             // For pub::WorkerPool
 
 #include "Object.h"
 #include "BubbleSorter.h"
 #include "HeapSorter.h"
 #include "MergeSorter.h"
+#include "ParallelMergeSorter.h"
 #include "QuickSorter.h"
+#include "RadixSorter.h"
+#include "SampleSorter.h"
 #include "ShellSorter.h"
 
 //----------------------------------------------------------------------------
@@ -42,6 +55,10 @@
 #endif
 
 #define MAX_COUNT             4'096 // Largest sort size
+#define BENCH_COUNT       1'048'576 // Largest benchmark sort size
+#define BENCH_FIRST           1'024 // Smallest benchmark sort size
+#define QUADRATIC_COUNT      16'384 // Largest O(n**2) benchmark sort size
+#define TEST_THREADS              4 // Parallel Sorter test thread count
 
 //----------------------------------------------------------------------------
 // External references
@@ -180,6 +197,167 @@ static int                          // Error counter
    return 0;
 }
 
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       benchArray
+//
+// Purpose-
+//       Create a benchmark Object array.
+//
+//----------------------------------------------------------------------------
+enum Distribution                   // Benchmark input distribution
+{  DIST_RANDOM                      // Random values
+,  DIST_SORTED                      // Ascending values
+,  DIST_REVERSED                    // Descending values
+,  DIST_DUPLICATES                  // Random values, 16 distinct
+,  DIST_COUNT                       // Number of distributions
+}; // enum Distribution
+
+static const char*     distName[DIST_COUNT]= // Distribution names
+{  "random"
+,  "sorted"
+,  "reversed"
+,  "duplicates"
+};
+
+static Object**                     // The Object array
+   benchArray(                      // Create a benchmark Object array
+     int               dist,        // Distribution
+     unsigned          count)       // Number of Objects
+{
+   Object** result= new Object*[count];
+   for(unsigned i= 0; i<count; i++)
+   {
+     unsigned value= 0;
+     switch( dist )
+     {
+       case DIST_RANDOM:
+         value= RNG.get() & 0x7fffffff;
+         break;
+
+       case DIST_SORTED:
+         value= i;
+         break;
+
+       case DIST_REVERSED:
+         value= count - i;
+         break;
+
+       case DIST_DUPLICATES:
+         value= RNG.get() % 16;
+         break;
+
+       default:
+         break;
+     }
+
+     result[i]= new Object(value);
+   }
+
+   return result;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       benchmark
+//
+// Purpose-
+//       Time each Sorter over a matrix of sizes and input distributions.
+//
+// Notes-
+//       The O(n**2) cases (BubbleSorter, ShellSorter, and QuickSorter with
+//       ordered or duplicate inputs) are limited to QUADRATIC_COUNT elements.
+//
+//----------------------------------------------------------------------------
+static int                          // Error counter
+   benchmark(                       // Run the benchmark matrix
+     unsigned          maxCount)    // Largest sort size
+{
+   int                 errorCount= 0; // Error counter
+
+   struct Entry                     // Benchmark Sorter entry
+   {  Sorter*          sorter;      // The Sorter
+      bool             quadratic;   // O(n**2) for all inputs?
+      bool             ordered;     // O(n**2) for ordered inputs?
+   }; // struct Entry
+
+   Entry entry[]=
+   {  {new BubbleSorter(),              true,  false}
+   ,  {new HeapSorter(),                false, false}
+   ,  {new MergeSorter(),               false, false}
+   ,  {new QuickSorter(),               false, true }
+   ,  {new ShellSorter(),               true,  false}
+   ,  {new ParallelMergeSorter(),       false, false}
+   ,  {new ParallelMergeSorter(0, true), false, false}
+   ,  {new SampleSorter(),              false, false}
+   ,  {new SampleSorter(0, true),       false, false}
+   ,  {new RadixSorter(),               false, false}
+   };
+   unsigned const entries= sizeof(entry) / sizeof(entry[0]);
+
+   printf("Benchmark: milliseconds, %u hardware threads\n",
+          std::thread::hardware_concurrency());
+   printf("%-28s %-10s", "Sorter", "Input");
+   for(unsigned n= BENCH_FIRST; n<=maxCount; n *= 4)
+     printf(" %9u", n);
+   printf("\n");
+
+   for(int dist= 0; dist<DIST_COUNT; dist++)
+   {
+     for(unsigned e= 0; e<entries; e++)
+     {
+       Sorter* sorter= entry[e].sorter;
+       printf("%-28s %-10s", sorter->getClassName(), distName[dist]);
+       fflush(stdout);
+
+       for(unsigned n= BENCH_FIRST; n<=maxCount; n *= 4)
+       {
+         bool ordered= (dist != DIST_RANDOM);
+         if( n > QUADRATIC_COUNT
+             && (entry[e].quadratic || (entry[e].ordered && ordered)) )
+         {
+           printf(" %9s", "-");
+           continue;
+         }
+
+         Object** object= benchArray(dist, n);
+         Object** work= new Object*[n];
+         memcpy(work, object, n * sizeof(Object*));
+
+         Interval interval;
+         sorter->sort(n, work);
+         double time= interval.stop();
+         printf(" %9.2f", time * 1000.0);
+         fflush(stdout);
+
+         for(unsigned i= 1; i<n; i++)
+         {
+           if( work[i-1]->compare(work[i]) > 0 )
+           {
+             fprintf(stderr, "\nSort(%s) %s %u error\n",
+                     sorter->getClassName(), distName[dist], n);
+             errorCount++;
+             break;
+           }
+         }
+
+         for(unsigned i= 0; i<n; i++)
+           delete object[i];
+         delete [] object;
+         delete [] work;
+       }
+       printf("\n");
+     }
+   }
+
+   for(unsigned e= 0; e<entries; e++)
+     delete entry[e].sorter;
+
+   return errorCount;
+}
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -198,6 +376,18 @@ extern int                          // Return code
    Sorter*           sorter;        // The current Sorter
    const char*       test;          // Specific test
 
+   // Benchmark
+   if( argc > 1 && strcmp(argv[1], "bench") == 0 )
+   {
+     count= BENCH_COUNT;
+     if( argc > 2 )
+       count= atol(argv[2]);
+
+     errorCount= benchmark(count);
+     printf("Errorcount: %d\n", errorCount);
+     return errorCount;
+   }
+
    // Initialize
    count= MAX_COUNT;
    test= NULL;
@@ -238,8 +428,37 @@ extern int                          // Return code
      errorCount += verify(sorter);
    delete sorter;
 
+   // Test ParallelMergeSorter
+   sorter= new ParallelMergeSorter(TEST_THREADS);
+   if( test == NULL || strcmp(test, "pmerge") == 0 )
+     errorCount += verify(sorter);
+   delete sorter;
+
+   sorter= new ParallelMergeSorter(TEST_THREADS, true);
+   if( test == NULL || strcmp(test, "pmerge-key") == 0 )
+     errorCount += verify(sorter);
+   delete sorter;
+
+   // Test SampleSorter
+   sorter= new SampleSorter(TEST_THREADS);
+   if( test == NULL || strcmp(test, "sample") == 0 )
+     errorCount += verify(sorter);
+   delete sorter;
+
+   sorter= new SampleSorter(TEST_THREADS, true);
+   if( test == NULL || strcmp(test, "sample-key") == 0 )
+     errorCount += verify(sorter);
+   delete sorter;
+
+   // Test RadixSorter
+   sorter= new RadixSorter();
+   if( test == NULL || strcmp(test, "radix") == 0 )
+     errorCount += verify(sorter);
+   delete sorter;
+
    // Terminate
    deleteArray();
+   pub::WorkerPool::reset();        // (SortPool threads)
 
    printf("Errorcount: %d\n", errorCount);
    return errorCount;
@@ -1,42 +0,0 @@
-//----------------------------------------------------------------------------
-//
-//       Copyright (c) 2007 Frank Eskesen.
-//
-//       This file is free content, distributed under the GNU General
-//       Public License, version 3.0.
-//       (See accompanying file LICENSE.GPL-3.0 or the original
-//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
-//
-//----------------------------------------------------------------------------
-//
-// Title-
-//       Fanin.cpp
-//
-// Purpose-
-//       Fanin methods.
-//
-// Last change date-
-//       2007/01/01
-//
-//----------------------------------------------------------------------------
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-
-#include <com/Debug.h>
-#include <com/define.h>
-
-#include "Fanin.h"
-
-//----------------------------------------------------------------------------
-// Constants for parameterization
-//----------------------------------------------------------------------------
-#define __SOURCE__       "FANIN   " // Source file, for debugging
-
-//----------------------------------------------------------------------------
-// Constants for parameterization
-//----------------------------------------------------------------------------
-#ifndef HCDM
-#undef  HCDM                        // If defined, Hard Core Debug Mode
-#endif
-
@@ -0,0 +1,176 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       Mesh.cpp
+//
+// Purpose-
+//       Dense evaluation network.
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#include <math.h>
+#include <string.h>
+#include <memory>                   // For std::unique_ptr
+
+#include <com/Debug.h>
+#include <com/define.h>
+
+#include "Mesh.h"
+
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+#define __SOURCE__       "MESH    " // Source file name
+
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+#ifndef HCDM                        // If defined, hard-core debug mode
+#undef  HCDM                        // If defined, hard-core debug mode
+#endif
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       sigmoid
+//
+// Purpose-
+//       SIGMOID: Compute Neuron value.
+//
+//----------------------------------------------------------------------------
+static inline Value                 // The Neuron value
+   sigmoid(                         // Compute Neuron value
+     Value           sigma)         // From the sum of inputs
+{
+   return 1.0 / (1.0 + exp(-sigma));
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       layer
+//
+// Purpose-
+//       Compute one layer.
+//
+// Implementation notes-
+//       The BLOCK accumulators stay in vector registers while the input
+//       loop streams one contiguous weight block. The accumulation order
+//       within each output is the input order.
+//
+//----------------------------------------------------------------------------
+static void
+   layer(                           // Compute one layer
+     const Value*    inp,           // The input array
+     const Weight*   weight,        // The weight array
+     unsigned        rows,          // The number of inputs
+     unsigned        cols,          // The number of outputs (BLOCK multiple)
+     Value*          out)           // The output array
+{
+   for(unsigned col= 0; col<cols; col += Mesh::BLOCK)
+   {
+     Value           sum[Mesh::BLOCK]; // The accumulators
+
+     for(unsigned k= 0; k<Mesh::BLOCK; k++)
+       sum[k]= 0.0;
+
+     for(unsigned row= 0; row<rows; row++)
+     {
+       const Value   value= inp[row];
+
+       for(unsigned k= 0; k<Mesh::BLOCK; k++)
+         sum[k] += value * weight[k];
+
+       weight += Mesh::BLOCK;
+     }
+
+     for(unsigned k= 0; k<Mesh::BLOCK; k++)
+       out[col + k]= sigmoid(sum[k]);
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Mesh::~Mesh
+//
+// Purpose-
+//       Destructor.
+//
+//----------------------------------------------------------------------------
+   Mesh::~Mesh( void )              // Destructor
+{
+   #ifdef HCDM
+     debugf("Mesh(%p)::~Mesh()\n", this);
+   #endif
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Mesh::Mesh
+//
+// Purpose-
+//       Constructor.
+//
+//----------------------------------------------------------------------------
+   Mesh::Mesh( void )               // Constructor
+{
+   #ifdef HCDM
+     debugf("Mesh(%p)::Mesh()\n", this);
+   #endif
+
+   memset((void*)this, 0, sizeof(*this)); // (Padding weights must be zero)
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Mesh::local
+//
+// Purpose-
+//       Get the current Thread's Mesh.
+//
+// Notes-
+//       Each Thread has its own Mesh, allocated when first used.
+//
+//----------------------------------------------------------------------------
+Mesh&                               // The Mesh
+   Mesh::local( void )              // Get the current Thread's Mesh
+{
+   static thread_local std::unique_ptr<Mesh> mesh; // The Thread's Mesh
+
+   if( !mesh )
+     mesh.reset(new Mesh());
+
+   return *mesh;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Mesh::resolve
+//
+// Purpose-
+//       Compute the outputs from the inputs.
+//
+//----------------------------------------------------------------------------
+void
+   Mesh::resolve( void )            // Compute the outputs
+{
+   layer(inp, w3, DIM_USED, MESH_COLS(DIM_L3),  l3);
+   layer(l3,  w2, DIM_L3,   MESH_COLS(DIM_L2),  l2);
+   layer(l2,  w1, DIM_L2,   MESH_COLS(DIM_L1),  l1);
+   layer(l1,  w0, DIM_L1,   MESH_COLS(DIM_OUT), out);
+}
@@ -0,0 +1,106 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       Mesh.h
+//
+// Purpose-
+//       Define the Mesh object, the dense evaluation network.
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       The Mesh is the evaluation network. (It replaced the Neuron/Fanin
+//       pointer network.) It contains the same INP -> L3 -> L2 -> L1 -> OUT layers, with each
+//       layer computed as a matrix-vector product followed by the sigmoid.
+//
+//       Weights are stored in column blocks of BLOCK outputs, so each block
+//       is one contiguous [rows][BLOCK] array. Each output is summed in input
+//       order, exactly as the pointer network did, giving identical results.
+//       Column counts are rounded up to a BLOCK multiple. The padding weights
+//       are zero and the padding outputs are never used.
+//
+//       A Mesh is not shared. Use Mesh::local() to get the current Thread's.
+//
+//----------------------------------------------------------------------------
+#ifndef MESH_H_INCLUDED
+#define MESH_H_INCLUDED
+
+#ifndef STOCK_H_INCLUDED
+#include "Stock.h"
+#endif
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       Mesh
+//
+// Purpose-
+//       Dense evaluation network.
+//
+//----------------------------------------------------------------------------
+class Mesh {                        // Dense evaluation network
+//----------------------------------------------------------------------------
+// Mesh::Enumerations and typedefs
+//----------------------------------------------------------------------------
+public:
+enum                                // Generic constants
+{  BLOCK= 32                        // Output block size (Values)
+}; // enum
+
+#define MESH_COLS(n) (((n) + Mesh::BLOCK - 1) / Mesh::BLOCK * Mesh::BLOCK)
+
+//----------------------------------------------------------------------------
+// Mesh::Constructors
+//----------------------------------------------------------------------------
+public:
+   ~Mesh( void );                   // Destructor
+   Mesh( void );                    // Constructor
+
+private:                            // Bitwise copy is prohibited
+   Mesh(const Mesh&);               // Disallowed copy constructor
+   Mesh& operator=(const Mesh&);    // Disallowed assignment operator
+
+//----------------------------------------------------------------------------
+// Mesh::Methods
+//----------------------------------------------------------------------------
+public:
+static inline unsigned              // The weight index
+   index(                           // Get weight index
+     unsigned        rows,          // The number of layer inputs
+     unsigned        row,           // The input index
+     unsigned        col)           // The output index
+{  return ((col / BLOCK) * rows + row) * BLOCK + (col % BLOCK); }
+
+static Mesh&                        // The Mesh
+   local( void );                   // Get the current Thread's Mesh
+
+void
+   resolve( void );                 // Compute the outputs from the inputs
+
+//----------------------------------------------------------------------------
+// Mesh::Attributes
+//----------------------------------------------------------------------------
+public:
+alignas(64) Value    inp[DIM_INP];  // The input array
+alignas(64) Value    l3[MESH_COLS(DIM_L3)]; // The L3 array
+alignas(64) Value    l2[MESH_COLS(DIM_L2)]; // The L2 array
+alignas(64) Value    l1[MESH_COLS(DIM_L1)]; // The L1 array
+alignas(64) Value    out[MESH_COLS(DIM_OUT)]; // The output array
+
+alignas(64) Weight   w3[DIM_USED * MESH_COLS(DIM_L3)]; // The  L3 -> INP mesh
+alignas(64) Weight   w2[DIM_L3 * MESH_COLS(DIM_L2)];   // The  L2 ->  L3 mesh
+alignas(64) Weight   w1[DIM_L2 * MESH_COLS(DIM_L1)];   // The  L1 ->  L2 mesh
+alignas(64) Weight   w0[DIM_L1 * MESH_COLS(DIM_OUT)];  // The OUT ->  L1 mesh
+}; // class Mesh
+
+#endif // MESH_H_INCLUDED
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,26 +16,32 @@
 //       Stock data analyzer.
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <assert.h>
+#include <ctype.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#ifndef _OS_WIN
+  #include <sys/mman.h>
+#endif
 
 #include <com/Debug.h>
 #include <com/define.h>
 #include <com/Julian.h>
-#include <com/Reader.h>
+#include <com/nativeio.h>
 #include <com/ParseINI.h>
 #include <com/Random.h>
 #include <com/Reader.h>
 #include <com/Writer.h>
 
-#include "Fanin.h"
-#include "Neuron.h"
 #include "Stock.h"
 
 //----------------------------------------------------------------------------
@@ -43,27 +49,33 @@
 //----------------------------------------------------------------------------
 #define __SOURCE__       "STOCK   " // Source file, for debugging
 
-//----------------------------------------------------------------------------
-// Inlines
-//----------------------------------------------------------------------------
-#include "Fanin.i"
-#include "Neuron.i"
+#define CACHE_NAME        "pgm.bin" // The history cache file name
+#define CACHE_TEMP    "pgm.bin.tmp" // The history cache work file name
+#define CACHE_IDENT      "STOCKHIS" // The history cache identifier
+#define CACHE_VERSION             1 // The history cache version
 
 //----------------------------------------------------------------------------
 //
-// NEURAL NET (Global)
+// Struct-
+//       HistHeader
+//
+// Purpose-
+//       The history cache (CACHE_NAME) header.
+//
+// Implementation notes-
+//       The header is followed by histJulian[count+1] (padded to a multiple
+//       of 8 bytes), histPrice[count] and histVolume[count]. The cache is
+//       only used when the history file's size and modification time match
+//       the saved values. It is rewritten whenever the history file changes.
 //
 //----------------------------------------------------------------------------
-NeuronValue*         inpArrayN= NULL; // The input value array
-Neuron*              l3ArrayN=  NULL; // The L3 array
-Neuron*              l2ArrayN=  NULL; // The L2 array
-Neuron*              l1ArrayN=  NULL; // The L1 array
-Neuron*              outArrayN= NULL; // The output array
-
-Fanin**              l3ArrayF=  NULL; // The  L3 -> INP mesh
-Fanin**              l2ArrayF=  NULL; // The  L2 ->  L3 mesh
-Fanin**              l1ArrayF=  NULL; // The  L1 ->  L2 mesh
-Fanin**              outArrayF= NULL; // The OUT ->  L1 mesh
+struct HistHeader {                 // History cache header
+   char              ident[8];      // CACHE_IDENT (not '\0' terminated)
+   uint32_t          version;       // CACHE_VERSION
+   uint32_t          count;         // The number of history data points
+   int64_t           size;          // The history file size
+   int64_t           mtime;         // The history file modification time
+}; // struct HistHeader
 
 //----------------------------------------------------------------------------
 //
@@ -81,9 +93,9 @@ static Plex          plex(DIM_UNIT);// The evaluation group
 unsigned             histIndex0;    // Minimum history index
 unsigned             histIndexN;    // Maximum history index
 unsigned             histIndexU;    // Number of index points to use
-int                  histJulian[DIM_HIST+1]; // History Date data
-double               histPrice[DIM_HIST]; // History Price data
-double               histVolume[DIM_HIST]; // History Volume data
+const int*           histJulian;    // History Date data
+const double*        histPrice;     // History Price data
+const double*        histVolume;    // History Volume data
 
 //----------------------------------------------------------------------------
 //
@@ -221,7 +233,7 @@ static int                          // Resultant number
    c= reader.prior();
 
    result= 0;
-   while( c != ' ' )
+   while( isdigit(c) || c == '.' )
    {
      if( c == '.' )
      {
@@ -319,6 +331,7 @@ static void
    global.revalControl=          1; // "re-evaluate"+
    global.seedControl=           1; // "randomize"+
    global.traceControl=          0; // "trace"-
+   global.threadControl=         0; // One Thread per processor
 
    //-------------------------------------------------------------------------
    // Load the parameters
@@ -353,6 +366,10 @@ static void
    if( parm != NULL )
      global.transferFee= atol(parm);
 
+   parm= ini.getValue("Controls", "threads");
+   if( parm != NULL )
+     global.threadControl= atol(parm);
+
    parm= ini.getValue("Debugging","randomize");
    if( parm != NULL )
      global.seedControl= atol(parm);
@@ -390,6 +407,7 @@ static void
    debugf("%10u = Controls.initialBalance\n", global.initialBalance);
    debugf("%10u = Controls.minimumBalance\n", global.minimumBalance);
    debugf("%10u = Controls.transferFee\n", global.transferFee);
+   debugf("%10u = Controls.threads\n", global.threadControl);
    debugf("%10u = Debugging.randomize\n", global.seedControl);
    debugf("%10u = Debugging.re-evaluate\n", global.revalControl);
    debugf("%10u = Debugging.trace\n",       global.traceControl);
@@ -424,19 +442,185 @@ static double                       // Resultant
 //----------------------------------------------------------------------------
 //
 // Subroutine-
-//       loadHistory
+//       cacheLength
 //
 // Purpose-
-//       Load the history file.
+//       Get the history cache length.
+//
+//----------------------------------------------------------------------------
+static inline size_t                // The cache length
+   cacheLength(                     // Get the cache length
+     unsigned        count)         // For this many data points
+{
+   size_t length= sizeof(HistHeader);
+   length += ((count + 1) * sizeof(int) + 7) & ~7;
+   length += count * sizeof(double) * 2;
+   return length;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       loadCache
+//
+// Purpose-
+//       Load the history data from the history cache.
+//
+// Implementation notes-
+//       The history arrays are used directly from the (read-only) mapping,
+//       which is never released.
+//
+//----------------------------------------------------------------------------
+static unsigned                     // The number of data points (0 if none)
+   loadCache(                       // Load the history cache
+     const struct stat&
+                     info)          // The history file's information
+{
+   HistHeader        header;        // The cache header
+   struct stat       cache;         // The cache file's information
+   size_t            length;        // The cache length
+   char*             origin;        // The cache origin
+   int               handle;        // The cache file handle
+
+   handle= open(CACHE_NAME, O_RDONLY|O_BINARY);
+   if( handle < 0 )
+     return 0;
+
+   if( fstat(handle, &cache) != 0
+       || read(handle, &header, sizeof(header)) != (ssize_t)sizeof(header)
+       || memcmp(header.ident, CACHE_IDENT, sizeof(header.ident)) != 0
+       || header.version != CACHE_VERSION
+       || header.count == 0 || header.count > DIM_HIST
+       || header.size != (int64_t)info.st_size
+       || header.mtime != (int64_t)info.st_mtime )
+   {
+     close(handle);
+     return 0;
+   }
+
+   length= cacheLength(header.count);
+   if( (size_t)cache.st_size != length )
+   {
+     close(handle);
+     return 0;
+   }
+
+   #ifdef _OS_WIN
+     origin= (char*)malloc(length);
+     if( origin != NULL )
+     {
+       if( lseek(handle, 0, SEEK_SET) != 0
+           || read(handle, origin, length) != (ssize_t)length )
+       {
+         free(origin);
+         origin= NULL;
+       }
+     }
+   #else
+     origin= (char*)::mmap(0, length, PROT_READ, MAP_SHARED, handle, 0);
+     if( origin == (char*)MAP_FAILED )
+       origin= NULL;
+   #endif
+   close(handle);
+   if( origin == NULL )
+     return 0;
+
+   origin += sizeof(HistHeader);
+   histJulian= (const int*)origin;
+   origin += ((header.count + 1) * sizeof(int) + 7) & ~7;
+   histPrice= (const double*)origin;
+   origin += header.count * sizeof(double);
+   histVolume= (const double*)origin;
+
+   return header.count;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       saveCache
+//
+// Purpose-
+//       Save the history data in the history cache.
+//
+// Implementation notes-
+//       The cache is written into a work file, then renamed. Errors are
+//       reported, but otherwise ignored. (The cache is then rebuilt on the
+//       next run.)
 //
 //----------------------------------------------------------------------------
 static void
-   loadHistory( void )              // Initialize the history data
+   saveCache(                       // Save the history cache
+     const struct stat&
+                     info,          // The history file's information
+     unsigned        count)         // The number of data points
+{
+   static const char zero[8]= {};   // Padding
+   HistHeader        header;        // The cache header
+   size_t            length;        // The histJulian length
+   size_t            pad;           // The histJulian padding length
+   size_t            array;         // The histPrice/histVolume length
+   int               handle;        // The cache file handle
+   int               error;         // TRUE if an error occurred
+
+   memset(&header, 0, sizeof(header));
+   memcpy(header.ident, CACHE_IDENT, sizeof(header.ident));
+   header.version= CACHE_VERSION;
+   header.count= count;
+   header.size= info.st_size;
+   header.mtime= info.st_mtime;
+
+   handle= open(CACHE_TEMP,         // Open the work file
+                O_WRONLY|O_BINARY|O_TRUNC|O_CREAT, // (write-only binary)
+                S_IREAD|S_IWRITE);  // (with full write access)
+   if( handle < 0 )
+   {
+     fprintf(stderr, "Open(%s) failed, cache not saved\n", CACHE_TEMP);
+     return;
+   }
+
+   length= (count + 1) * sizeof(int);
+   pad= (8 - length % 8) % 8;
+   array= count * sizeof(double);
+   error= write(handle, &header, sizeof(header)) != (ssize_t)sizeof(header)
+       || write(handle, histJulian, length) != (ssize_t)length
+       || write(handle, zero, pad) != (ssize_t)pad
+       || write(handle, histPrice, array) != (ssize_t)array
+       || write(handle, histVolume, array) != (ssize_t)array;
+   error |= close(handle) != 0;
+
+   if( !error )
+   {
+     remove(CACHE_NAME);
+     error= rename(CACHE_TEMP, CACHE_NAME) != 0;
+   }
+
+   if( error )
+   {
+     fprintf(stderr, "Write(%s) failed, cache not saved\n", CACHE_NAME);
+     remove(CACHE_TEMP);
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       parseHistory
+//
+// Purpose-
+//       Load the history data from the history file.
+//
+//----------------------------------------------------------------------------
+static unsigned                     // The number of data points
+   parseHistory( void )             // Parse the history file
 {
    FileWriter        histOut;       // History output file
-   LineReader        histFile("pgm.inp"); // History data file
+   LineReader        histFile;      // History data file
    int               c;             // Current character
 
+   int*              julianArray;   // The Julian date array
+   double*           priceArray;    // The Price array
+   double*           volumeArray;   // The Volume array
    unsigned          index;         // History index
    int               date;          // Date
    int               yyyy, mm, dd;  // Date components
@@ -454,14 +638,26 @@ static void
      exit(EXIT_FAILURE);
    }
 
-   debugf("\n");
-   debugf("Loading history files...");
    if( swHist )
      histOut.open("PGM.OUT", FileWriter::MODE_WRITE);
 
-   skipLine(histFile);
-   for(index=0; index<DIM_HIST; index++)
+   julianArray= new int[DIM_HIST+1];
+   priceArray=  new double[DIM_HIST];
+   volumeArray= new double[DIM_HIST];
+
+   skipLine(histFile);              // Skip the heading line
+   for(index=0; ; index++)
    {
+     c= skipBlank(histFile);
+     if( c < 0 )                    // If end of file
+       break;
+
+     if( index >= DIM_HIST )
+     {
+       fprintf(stderr, "DIM_HIST too small\n");
+       exit(EXIT_FAILURE);
+     }
+
      date= toNumber(histFile);
 
      yyyy= date / 10000;
@@ -469,51 +665,99 @@ static void
      dd=   mm   % 100;
      mm=   mm   / 100;
 
-     histJulian[index]= julian(yyyy,mm,dd);
-     if( index > 1 && histJulian[index] <= histJulian[index-1] )
+     julianArray[index]= julian(yyyy,mm,dd);
+     if( index > 1 && julianArray[index] <= julianArray[index-1] )
      {
        badData("pgm.inp", histFile, date, "Date out of order");
      }
-     dow= histJulian[index] % 7;
+     dow= julianArray[index] % 7;
      if( dow > 4 )
      {
        badData("pgm.inp", histFile, date, "Market open on weekend");
      }
 
      skipBlank(histFile);
-     histPrice[index]= normalize(toNumber(histFile),
-                                 MINPRICEVALUE, MAXPRICEVALUE);
+     priceArray[index]= normalize(toNumber(histFile),
+                                  MINPRICEVALUE, MAXPRICEVALUE);
 
      skipBlank(histFile);
-     histVolume[index]= normalize(toNumber(histFile),
-                                  MINVOLUMEVALUE, MAXVOLUMEVALUE);
+     volumeArray[index]= normalize(toNumber(histFile),
+                                   MINVOLUMEVALUE, MAXVOLUMEVALUE);
 
      if( swHist )
      {
        histOut.printf("[%5d] %8d %.6g %.6g\n",
                       index, date,
-                      histPrice[index], histVolume[index]);
+                      priceArray[index], volumeArray[index]);
      }
 
-     c= skipLine(histFile);
-     if( c == EOF )
-       break;
+     if( histFile.prior() != '\n' ) // If not already at the next line
+       skipLine(histFile);
    }
-   if( index == DIM_HIST )
+   if( index == 0 )
    {
-     fprintf(stderr, "DIM_HIST too small\n");
+     fprintf(stderr, "No history data\n");
      exit(EXIT_FAILURE);
    }
-   printf("done(%d)\n", index);
 
    // Set the next day in the history, an input parameter
-   if( (histJulian[index]%7) == 4 )
-     histJulian[index]= histJulian[index-1]+3;
+   if( (julianArray[index-1]%7) == 4 ) // (Friday => Monday)
+     julianArray[index]= julianArray[index-1]+3;
    else
-     histJulian[index]= histJulian[index-1]+1;
+     julianArray[index]= julianArray[index-1]+1;
+
+   histJulian= julianArray;
+   histPrice=  priceArray;
+   histVolume= volumeArray;
+
+   return index;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       loadHistory
+//
+// Purpose-
+//       Load the history file.
+//
+// Implementation notes-
+//       The history cache is used unless the history file changed since it
+//       was written or the history display (-h) is wanted.
+//
+//----------------------------------------------------------------------------
+static void
+   loadHistory( void )              // Initialize the history data
+{
+   struct stat       info;          // The history file's information
+   unsigned          index;         // The number of data points
+
+   //-------------------------------------------------------------------------
+   // Load the history data
+   //-------------------------------------------------------------------------
+   if( stat("pgm.inp", &info) != 0 )
+   {
+     fprintf(stderr, "Unable to open history file\n");
+     exit(EXIT_FAILURE);
+   }
+
+   debugf("\n");
+   debugf("Loading history files...");
+   index= 0;
+   if( !swHist )
+     index= loadCache(info);
+
+   if( index > 0 )
+     printf("cached(%d)\n", index);
+   else
+   {
+     index= parseHistory();
+     saveCache(info, index);
+     printf("done(%d)\n", index);
+   }
 
    #if 0
-     for(i=0; i<index; i++)
+     for(unsigned i=0; i<index; i++)
      {
        printf("[%5d] (%10d) %8f %8f\n",
               i, histJulian[i], histPrice[i], histVolume[i]);
@@ -561,164 +805,42 @@ static void
 //----------------------------------------------------------------------------
 //
 // Subroutine-
-//       initFaninArray
+//       init
 //
 // Purpose-
-//       Initialize the Fanin array.
+//       Initialize.
 //
 //----------------------------------------------------------------------------
 static void
-   initFaninArray( void )           // Initialize the Fanin array
+   init( void )                     // Initialize
 {
-   int               i;
-   int               j;
-
-   //-------------------------------------------------------------------------
-   // Allocate the Fanin array
-   //-------------------------------------------------------------------------
-   l3ArrayF= new Fanin*[DIM_L3];
-   for(i= 0; i<DIM_L3; i++)
-     l3ArrayF[i]= new Fanin[DIM_INP];
-
-   l2ArrayF= new Fanin*[DIM_L2];
-   for(i= 0; i<DIM_L2; i++)
-     l2ArrayF[i]= new Fanin[DIM_L3];
-
-   l1ArrayF= new Fanin*[DIM_L1];
-   for(i= 0; i<DIM_L1; i++)
-     l1ArrayF[i]= new Fanin[DIM_L2];
+   long              threads;       // The number of evaluation Threads
 
-   outArrayF= new Fanin*[DIM_OUT];
-   for(i= 0; i<DIM_OUT; i++)
-     outArrayF[i]= new Fanin[DIM_L1];
-
-   //-------------------------------------------------------------------------
-   // Initialize the Fanin array
-   //-------------------------------------------------------------------------
-   printf("\n");
-   printf("Initialize Fanin pointers...");
-   for(i=0; i<DIM_L3; i++)
-   {
-     l3ArrayN[i].setFanin(DIM_USED, l3ArrayF[i]);
-     for(j=0; j<DIM_USED; j++)
-     {
-       l3ArrayF[i][j].set(&inpArrayN[j], 1.0);
-     }
-   }
-
-   for(i=0; i<DIM_L2; i++)
-   {
-     l2ArrayN[i].setFanin(DIM_L3, l2ArrayF[i]);
-     for(j=0; j<DIM_L3; j++)
-     {
-       l2ArrayF[i][j].set(&l3ArrayN[j], 1.0);
-     }
-   }
-
-   for(i=0; i<DIM_L1; i++)
-   {
-     l1ArrayN[i].setFanin(DIM_L2, l1ArrayF[i]);
-     for(j=0; j<DIM_L2; j++)
-     {
-       l1ArrayF[i][j].set(&l2ArrayN[j], 1.0);
-     }
-   }
-
-   for(i=0; i<DIM_OUT; i++)
-   {
-     outArrayN[i].setFanin(DIM_L1, outArrayF[i]);
-     for(j=0; j<DIM_L1; j++)
-     {
-       outArrayF[i][j].set(&l1ArrayN[j], 1.0);
-     }
-   }
-   printf("done\n");
+   RNG.randomize();                 // Default, random seed
+   loadParameters();                // Load the parameter file
+   loadHistory();                   // Load the history file
 
    //-------------------------------------------------------------------------
-   // Restore the Fanin array
+   // Restore the Units
    //-------------------------------------------------------------------------
-   for(i=0; i<DIM_UNIT; i++)
+   for(int i=0; i<DIM_UNIT; i++)
    {
      plex.setUnit(&unit[i]);
    }
    plex.restore();
-}
 
-//----------------------------------------------------------------------------
-//
-// Subroutine-
-//       initNeuronArray
-//
-// Purpose-
-//       Initialize the Neuron array.
-//
-//----------------------------------------------------------------------------
-static void
-   initNeuronArray( void )          // Initialize the Neuron array
-{
    //-------------------------------------------------------------------------
-   // Allocate the Neuron array
+   // Evaluate the Units concurrently, unless tracing
    //-------------------------------------------------------------------------
-   inpArrayN= new NeuronValue[DIM_INP];
-   l3ArrayN=  new Neuron[DIM_L3];
-   l2ArrayN=  new Neuron[DIM_L2];
-   l1ArrayN=  new Neuron[DIM_L1];
-   outArrayN= new Neuron[DIM_OUT];
-}
-
-//----------------------------------------------------------------------------
-//
-// Subroutine-
-//       test
-//
-// Purpose-
-//       Test sigmoid function.
-//
-//----------------------------------------------------------------------------
-static void
-   test( void )                     // Test
-{
-#if 0
-   NeuronValue       sourceN;
-
-   Neuron            targetN;
-   Fanin             targetF(&sourceN, 1.0);
-
-   Value             value;
-   Value             result;
-
-   targetN.setFanin(1, &targetF);
-
-   for(value= -10.0; value<=10.0; value+=1.0)
-   {
-     Neuron::globalClock++;
-     sourceN.setValue(value);
-     result= targetN.resolve();
-
-     printf("%f= sigmoid(%f)\n", result, value);
-   }
-
-   printf("%ld Reads\n", Neuron::globalCount);
-#endif
-}
-
-//----------------------------------------------------------------------------
-//
-// Subroutine-
-//       init
-//
-// Purpose-
-//       Initialize.
-//
-//----------------------------------------------------------------------------
-static void
-   init( void )                     // Initialize
-{
-   RNG.randomize();                 // Default, random seed
-   loadParameters();                // Load the parameter file
-   loadHistory();                   // Load the history file
-   initNeuronArray();               // Initialize the Neuron array
-   initFaninArray();                // Initialize the Fanin array
+   threads= global.threadControl;
+   if( threads == 0 )               // Default, one per processor
+     threads= sysconf(_SC_NPROCESSORS_ONLN);
+   if( threads > DIM_UNIT )
+     threads= DIM_UNIT;
+   if( global.traceControl )        // (Keep the trace readable)
+     threads= 1;
+   if( threads > 1 )
+     plex.setThreads(threads);
 }
 
 //----------------------------------------------------------------------------
@@ -807,16 +929,11 @@ int                                 // Return coe
    // Sizes
    //-------------------------------------------------------------------------
    #if 0
-     printf("%10ld= Per Fanin\n",   (long)sizeof(Fanin));
-     printf("%10ld= Per Neuron\n",  (long)sizeof(Neuron));
      printf("%10ld= Per Unit\n",    (long)sizeof(Unit));
+     printf("%10ld= Per Rule\n",    (long)RULE_SIZE);
 
      printf("\n");
-     printf("%10ld= Fanins\n",  (long)sizeof(Fanin)  * FANIN_COUNT);
-     printf("%10ld= Neurons\n", (long)sizeof(Neuron) * NEURON_COUNT);
-     printf("%10ld= Units\n",   (long)sizeof(Unit)   * DIM_UNIT);
-     printf("---------- ----------\n");
-     printf("%10ld= Total\n",   (long)sizeof(Unit)   * DIM_UNIT);
+     printf("%10ld= Units\n",   (long)(sizeof(Unit) + RULE_SIZE) * DIM_UNIT);
    #endif
 
    //-------------------------------------------------------------------------
@@ -824,7 +941,6 @@ int                                 // Return coe
    //-------------------------------------------------------------------------
    parm(argc, argv);
    init();
-   test();
 
    //-------------------------------------------------------------------------
    // Train
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Define the Stock objects.
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef STOCK_H_INCLUDED
@@ -29,8 +29,10 @@
 #include "com/DarwinPlex.h"
 #include "com/DarwinUnit.h"
 
-#include "Fanin.h"
-#include "Neuron.h"
+//----------------------------------------------------------------------------
+// Forward references
+//----------------------------------------------------------------------------
+class Mesh;
 
 //----------------------------------------------------------------------------
 // Constants for parameterization
@@ -70,6 +72,7 @@ struct Global                       // Globals
    unsigned          seedControl;   // Seed control
    unsigned          traceControl;  // TraceMode control
    unsigned          revalControl;  // Forced Re-evaluation control
+   unsigned          threadControl; // Evaluation Thread count
 
    double            changeProb;    // Change probability
    unsigned          transferFee;   // The transfer fee
@@ -87,20 +90,9 @@ extern Global        global;        // Globals
 extern unsigned      histIndex0;    // First used data point
 extern unsigned      histIndexN;    // Last  used data point
 extern unsigned      histIndexU;    // Number of index points to use
-extern int           histJulian[DIM_HIST+1]; // Julian date on day
-extern double        histPrice[DIM_HIST];  // NYSE composite price on day
-extern double        histVolume[DIM_HIST]; // NYSE composite volume on day
-
-extern NeuronValue*  inpArrayN;     // The input value array
-extern Neuron*       l3ArrayN;      // The L3 array
-extern Neuron*       l2ArrayN;      // The L2 array
-extern Neuron*       l1ArrayN;      // The L1 array
-extern Neuron*       outArrayN;     // The output array
-
-extern Fanin**       l3ArrayF;      // The  L3 -> INP mesh
-extern Fanin**       l2ArrayF;      // The  L2 ->  L3 mesh
-extern Fanin**       l1ArrayF;      // The  L1 ->  L2 mesh
-extern Fanin**       outArrayF;     // The OUT ->  L1 mesh
+extern const int*    histJulian;    // Julian date on day [count+1]
+extern const double* histPrice;     // NYSE composite price on day
+extern const double* histVolume;    // NYSE composite volume on day
 
 #define FANIN_COUNT ( (DIM_L3*DIM_INP) + (DIM_L2*DIM_L3) + \
                       (DIM_L1*DIM_L2) + (DIM_OUT*DIM_L1) )
@@ -155,10 +147,12 @@ virtual void
 //----------------------------------------------------------------------------
 public:
 void
-   loadFaninArray( void );          // Load the Fanin array
+   loadFaninArray(                  // Load the Fanin (weight) array
+     Mesh&           mesh) const;   // Into this Mesh
 
 static void
    loadInputArray(                  // Load the Input array
+     Mesh&           mesh,          // Into this Mesh
      unsigned        x);            // For this day
 
 void
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Stock evaluation unit.
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
 //
 // Input array-
 //       [  0]..[ 19] Composite index daily
@@ -56,8 +56,7 @@
 #include <com/Random.h>
 #include <com/syslib.h>
 
-#include "Fanin.h"
-#include "Neuron.h"
+#include "Mesh.h"
 #include "Stock.h"
 
 //----------------------------------------------------------------------------
@@ -108,12 +107,6 @@ static Random&         RNG= Random::standard; // Our random number generator
 static const char    className[]= "Unit::DarwinUnit"; // The class name
 static const double  scaleFactor= 5.0 / (double)0x00007fff; // Scaling factor
 
-//----------------------------------------------------------------------------
-// Inlines
-//----------------------------------------------------------------------------
-#include "Fanin.i"
-#include "Neuron.i"
-
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -216,11 +209,16 @@ static inline double                // Resultant
 //       Unit::loadFaninArray
 //
 // Function-
-//       Load the Fanin array from the Rule.
+//       Load the Fanin (weight) array from the Rule.
+//
+// Notes-
+//       The Rule is ordered [output][input] within each layer. Rule weights
+//       for the unattached inputs [DIM_USED]..[DIM_INP-1] are not used.
 //
 //----------------------------------------------------------------------------
 void
-   Unit::loadFaninArray( void )     // Externalize the Rule
+   Unit::loadFaninArray(            // Externalize the Rule
+     Mesh&           mesh) const    // Into this Mesh
 {
    int               i, j;
    int               x;
@@ -231,90 +229,36 @@ void
 
    x= 0;
    for(i=0; i<DIM_L3; i++)
-     for(j=0; j<DIM_INP; j++)
-       l3ArrayF[i][j].weight= toDouble(rule[x++]);
+   {
+     for(j=0; j<DIM_USED; j++)
+       mesh.w3[Mesh::index(DIM_USED, j, i)]= toDouble(rule[x++]);
+     x += DIM_INP - DIM_USED;
+   }
 
    for(i=0; i<DIM_L2; i++)
      for(j=0; j<DIM_L3; j++)
-       l2ArrayF[i][j].weight= toDouble(rule[x++]);
+       mesh.w2[Mesh::index(DIM_L3, j, i)]= toDouble(rule[x++]);
 
    for(i=0; i<DIM_L1; i++)
      for(j=0; j<DIM_L2; j++)
-       l1ArrayF[i][j].weight= toDouble(rule[x++]);
+       mesh.w1[Mesh::index(DIM_L2, j, i)]= toDouble(rule[x++]);
 
    for(i=0; i<DIM_OUT; i++)
      for(j=0; j<DIM_L1; j++)
-       outArrayF[i][j].weight= toDouble(rule[x++]);
+       mesh.w0[Mesh::index(DIM_L1, j, i)]= toDouble(rule[x++]);
 
    assert( x == FANIN_COUNT );
 
    #if 0
-     int             k;
-
      debugf("L3ArrayF\n");
      for(i= 0; i<DIM_L3; i++)
      {
-       k= 0;
-       for(j= 0; j<DIM_INP; j++)
-       {
-         if( k == 4 )
-         {
-           k= 0;
-           tracef("\n");
-         }
-         k++;
-         tracef("[%4d][%4d] %6.3f ", i, j, l3ArrayF[i][j].weight);
-       }
-       tracef("\n");
-     }
-
-     debugf("L2ArrayF\n");
-     for(i= 0; i<DIM_L2; i++)
-     {
-       k= 0;
-       for(j= 0; j<DIM_L3; j++)
-       {
-         if( k == 4 )
-         {
-           k= 0;
-           tracef("\n");
-         }
-         k++;
-         tracef("[%4d][%4d] %6.3f ", i, j, l2ArrayF[i][j].weight);
-       }
-       tracef("\n");
-     }
-
-     debugf("L1ArrayF\n");
-     for(i= 0; i<DIM_L1; i++)
-     {
-       k= 0;
-       for(j= 0; j<DIM_L2; j++)
-       {
-         if( k == 4 )
-         {
-           k= 0;
-           tracef("\n");
-         }
-         k++;
-         tracef("[%4d][%4d] %6.3f ", i, j, l1ArrayF[i][j].weight);
-       }
-       tracef("\n");
-     }
-
-     debugf("L0ArrayF\n");
-     for(i= 0; i<DIM_OUT; i++)
-     {
-       k= 0;
-       for(j= 0; j<DIM_L1; j++)
+       for(j= 0; j<DIM_USED; j++)
        {
-         if( k == 4 )
-         {
-           k= 0;
+         if( j != 0 && (j % 4) == 0 )
            tracef("\n");
-         }
-         k++;
-         tracef("[%4d][%4d] %6.3f ", i, j, outArrayF[i][j].weight);
+         tracef("[%4d][%4d] %6.3f ", i, j,
+                mesh.w3[Mesh::index(DIM_USED, j, i)]);
        }
        tracef("\n");
      }
@@ -335,8 +279,12 @@ void
 //----------------------------------------------------------------------------
 void
    Unit::loadInputArray(            // Load the input array
+     Mesh&           mesh,          // Into this Mesh
      unsigned        x)             // For this day
 {
+   Value*            inp= mesh.inp; // The input array
+   const Value*      out= mesh.out; // The output array (prior day)
+
    int               today;         // Today's julian date
    int               days;
    int               i;
@@ -347,47 +295,46 @@ void
 
    for(i=0; i<20; i++)
    {
-     inpArrayN[i+  0].setValue(histPrice[x-i-1]);
-     inpArrayN[i+ 20].setValue(histPrice[x-i*DAYS_PER_WEEK-DAYS_PER_WEEK]);
-     inpArrayN[i+100].setValue(histVolume[x-i-1]);
-     inpArrayN[i+120].setValue(inpArrayN[i+0].getValue() *
-                               inpArrayN[i+100].getValue());
-     inpArrayN[i+140].setValue(outArrayN[i].getValue()); // Feedbacks
+     inp[i+  0]= histPrice[x-i-1];
+     inp[i+ 20]= histPrice[x-i*DAYS_PER_WEEK-DAYS_PER_WEEK];
+     inp[i+100]= histVolume[x-i-1];
+     inp[i+120]= inp[i+0] * inp[i+100];
+     inp[i+140]= out[i];          // Feedbacks
    }
 
    for(i=0; i<60; i++)
-     inpArrayN[i+ 40].setValue(histPrice[x-i*DAYS_PER_MONTH-DAYS_PER_MONTH]);
-
-   inpArrayN[160].setValue(1.0);
-   inpArrayN[161].setValue(10.0);
-   inpArrayN[162].setValue(100.0);
-   inpArrayN[163].setValue(1000.0);
-   inpArrayN[164].setValue(10000.0);
-   inpArrayN[165].setValue(100000.0);
-   inpArrayN[166].setValue(1000000.0);
-   inpArrayN[167].setValue(10000000.0);
-   inpArrayN[168].setValue(100000000.0);
-   inpArrayN[169].setValue(1000000000.0);
+     inp[i+ 40]= histPrice[x-i*DAYS_PER_MONTH-DAYS_PER_MONTH];
+
+   inp[160]= 1.0;
+   inp[161]= 10.0;
+   inp[162]= 100.0;
+   inp[163]= 1000.0;
+   inp[164]= 10000.0;
+   inp[165]= 100000.0;
+   inp[166]= 1000000.0;
+   inp[167]= 10000000.0;
+   inp[168]= 100000000.0;
+   inp[169]= 1000000000.0;
 
    today= histJulian[x];
    days=  histJulian[x+1] - today;
-   inpArrayN[X_DUO].setValue(days);
-   inpArrayN[X_DUO_F0].setValue((double)days * outArrayN[0].getValue());
-   inpArrayN[X_DUO_F1].setValue((double)days * outArrayN[1].getValue());
-   inpArrayN[X_DUO_F2].setValue((double)days * global.dailyInterest);
+   inp[X_DUO]= days;
+   inp[X_DUO_F0]= (double)days * out[0];
+   inp[X_DUO_F1]= (double)days * out[1];
+   inp[X_DUO_F2]= (double)days * global.dailyInterest;
 
-   inpArrayN[X_DOW].setValue(today % 7);
-   inpArrayN[X_DOQ].setValue(today % 91);
-   inpArrayN[X_DOY].setValue(today % 365);
-   inpArrayN[X_DIR].setValue(global.dailyInterest);
-   inpArrayN[X_FEE].setValue(global.transferFee);
+   inp[X_DOW]= today % 7;
+   inp[X_DOQ]= today % 91;
+   inp[X_DOY]= today % 365;
+   inp[X_DIR]= global.dailyInterest;
+   inp[X_FEE]= global.transferFee;
 
    assert( DIM_USED == (X_FEE+1) );
 
    #if 0
      for(i= 0; i<DIM_USED; i++)
      {
-       debugf("[%3d] %f\n", i, inpArrayN[i].getValue());
+       debugf("[%3d] %f\n", i, inp[i]);
      }
      exit(EXIT_SUCCESS);
    #endif
@@ -452,6 +399,7 @@ Unit::Evaluation                    // Evaluation
    double            share;         // Number of shares
    double            today, prior;  // Valuations
 
+   Mesh&             mesh= Mesh::local(); // The evaluation Mesh
    int               i;
    unsigned          x;
 
@@ -462,7 +410,7 @@ Unit::Evaluation                    // Evaluation
    //-------------------------------------------------------------------------
    // Load the Fanin array
    //-------------------------------------------------------------------------
-   loadFaninArray();
+   loadFaninArray(mesh);
 
    //-------------------------------------------------------------------------
    // Load the Initial outputs
@@ -475,34 +423,29 @@ Unit::Evaluation                    // Evaluation
      isTrace= TRUE;                 // TRACING is active
 
      for(i= 0; i<DIM_OUT; i++)      // Load initial outputs
-       outArrayN[i].setValue(outs[i]); // (Current values)
+       mesh.out[i]= outs[i];        // (Current values)
    }
    else
    {
      for(i= 0; i<DIM_OUT; i++)        // Load initial outputs
-       outArrayN[i].setValue(0.5);    // (Default values)
+       mesh.out[i]= 0.5;            // (Default values)
    }
 
    //-------------------------------------------------------------------------
    // Evaluate the initial outputs
    //-------------------------------------------------------------------------
    x= histIndex0;                   // First history index
-   loadInputArray(x);               // Load data for today
-   inpArrayN[X_FEE].setValue(0.0);  // No transaction fee today
-
-   Neuron::globalClock++;
-   for(i=0; i<DIM_OUT; i++)
-   {
-     outArrayN[i].resolve();
-   }
+   loadInputArray(mesh, x);         // Load data for today
+   mesh.inp[X_FEE]= 0.0;            // No transaction fee today
+   mesh.resolve();
 
    //-------------------------------------------------------------------------
    // Make the initial transfer
    //-------------------------------------------------------------------------
    lastTransfer= histJulian[x];
    stock= transfer(0, opening,
-                   outArrayN[0].getValue(),
-                   outArrayN[1].getValue());
+                   mesh.out[0],
+                   mesh.out[1]);
    cash= opening - stock;
    if( isTrace )
      debugf("[%5d] V(%12ld) S(%10ld) C(%10ld)\n",
@@ -532,19 +475,14 @@ Unit::Evaluation                    // Evaluation
      //-----------------------------------------------------------------------
      // Make today's investment decision
      //-----------------------------------------------------------------------
-     loadInputArray(x);
-
-     Neuron::globalClock++;
-     for(i=0; i<DIM_OUT; i++)
-     {
-       outArrayN[i].resolve();
-     }
+     loadInputArray(mesh, x);
+     mesh.resolve();
 
-     if( outArrayN[2].getValue() < 0.5 )
+     if( mesh.out[2] < 0.5 )
      {
        xferAmount= transfer(stock, cash,
-                            outArrayN[0].getValue(),
-                            outArrayN[1].getValue());
+                            mesh.out[0],
+                            mesh.out[1]);
        if( xferAmount != 0 )
        {
          if( (stock+cash) < global.minimumBalance )
@@ -582,7 +520,7 @@ Unit::Evaluation                    // Evaluation
    this->stock= stock;
    this->fee=   fee;
    for(i=0; i<DIM_OUT; i++)
-     outs[i]= outArrayN[i].getValue();
+     outs[i]= mesh.out[i];
 
    if( isTrace )
    {
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Instantiate Base64Codec Object.
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
 //
 /* Description, from RFC 2045:
 RFC 2045                Internet Message Bodies            November 1996
@@ -98,8 +98,11 @@ RFC 2045                Internet Message Bodies            November 1996
 #include <com/Barrier.h>
 #include <com/Reader.h>
 #include <com/Writer.h>
+#include <pub/Coding.h>             // For namespace pub::coding
 #include "Base64Codec.h"
 
+using namespace _LIBPUB_NAMESPACE::coding;
+
 //----------------------------------------------------------------------------
 // Constants for parameterization
 //----------------------------------------------------------------------------
@@ -107,6 +110,9 @@ RFC 2045                Internet Message Bodies            November 1996
 #undef  HCDM                        // If defined, Hard Core Debug Mode
 #endif
 
+#define LINE_BYTES 57               // Input bytes per output line
+#define LINE_COUNT 1024             // Output lines per input buffer
+
 //----------------------------------------------------------------------------
 // Macros
 //----------------------------------------------------------------------------
@@ -154,6 +160,28 @@ static int                          // Resultant character
    return result;
 }
 
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       rdline
+//
+// Purpose-
+//       Decode the complete character groups in an input line.
+//
+//----------------------------------------------------------------------------
+static char*                        // The first character not decoded
+   rdline(                          // Decode complete character groups
+     char*             C,           // From this input line
+     Writer&           out)         // Into this Writer
+{
+   char                outBuff[96]; // Output buffer (Input line < 128)
+   size_t              used;        // Number of characters decoded
+
+   size_t L= base64_decode(C, strlen(C), outBuff, used);
+   out.write(outBuff, L);
+   return C + used;
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -228,7 +256,7 @@ int                                 // Return code (0 OK)
    if( rc < 0 )                     // End of file or error
      return DC_NOH;
 
-   C= inpLine;
+   C= rdline(inpLine, out);
 
    //-------------------------------------------------------------------------
    // Decode
@@ -251,6 +279,7 @@ int                                 // Return code (0 OK)
        if( *C == PAD_CHAR )         // If end of valid data
          break;
 
+       C= rdline(inpLine, out);     // (Decode its complete groups)
        continue;
      }
 
@@ -339,21 +368,31 @@ int                                 // Return code (0 OK)
      Reader&           inp,         // Input file
      Writer&           out)         // Output file
 {
-   char                inpBuff[57]; // Input buffer
-   char                outBuff[80]; // Output buffer
-   unsigned            outWord;     // Output word
-
-   int                 iX;          // Input index
-   int                 oX;          // Output index
+   char*               inpBuff;     // Input buffer
+   char*               outBuff;     // Output buffer
+   char                outLine[80]; // Output line
    int                 L;           // Number of bytes read
 
+   //-------------------------------------------------------------------------
+   // Allocate buffers
+   //-------------------------------------------------------------------------
+   inpBuff= (char*)malloc(LINE_BYTES * LINE_COUNT);
+   outBuff= (char*)malloc(base64_length(LINE_BYTES * LINE_COUNT));
+   if( inpBuff == NULL || outBuff == NULL )
+   {
+     free(inpBuff);
+     free(outBuff);
+     setEcode(EC_FAULT);
+     return RC_NG;
+   }
+
    //-------------------------------------------------------------------------
    // Encode
    //-------------------------------------------------------------------------
    setEcode(EC_0);                  // Set the default error code
    for(;;)                          // Encode the data
    {
-     L= inp.read(inpBuff, sizeof(inpBuff));
+     L= inp.read(inpBuff, LINE_BYTES * LINE_COUNT);
      if( L <= 0 )                   // If error or end of file
      {
        if( L < 0 )                  // If error
@@ -365,68 +404,22 @@ int                                 // Return code (0 OK)
        break;
      }
 
-     oX= 0;
-     for(iX=0; iX<=(L-3); iX+=3)
+     // Encode the buffer, then split it into lines
+     size_t oL= base64_encode(inpBuff, L, outBuff);
+     for(size_t oX= 0; oX<oL; oX += LINE_BYTES / 3 * 4)
      {
-       outWord  = (inpBuff[iX+0] & 0x00FF) << 16;
-       outWord |= (inpBuff[iX+1] & 0x00FF) <<  8;
-       outWord |= (inpBuff[iX+2] & 0x00FF);
-
-       outBuff[oX++]= ENCODE[(outWord >> 18) & 0x003F];
-       outBuff[oX++]= ENCODE[(outWord >> 12) & 0x003F];
-       outBuff[oX++]= ENCODE[(outWord >>  6) & 0x003F];
-       outBuff[oX++]= ENCODE[(outWord      ) & 0x003F];
-       #if 0
-         printf("{%.8X= I(%2d,%2d,%2d,%2d) [%c%c%c%c]}",
-                 outWord,
-                        (outWord >> 18) & 0x003F,
-                        (outWord >> 12) & 0x003F,
-                        (outWord >>  6) & 0x003F,
-                        (outWord      ) & 0x003F,
-                 ENCODE[(outWord >> 18) & 0x003F],
-                 ENCODE[(outWord >> 12) & 0x003F],
-                 ENCODE[(outWord >>  6) & 0x003F],
-                 ENCODE[(outWord      ) & 0x003F]);
-       #endif
-     }
-     #if 0
-       printf("\n");
-     #endif
+       size_t size= oL - oX;
+       if( size > LINE_BYTES / 3 * 4 )
+         size= LINE_BYTES / 3 * 4;
 
-     outWord  = (inpBuff[iX+0] & 0x00FF) << 16;
-     outWord |= (inpBuff[iX+1] & 0x00FF) <<  8;
-     outWord |= (inpBuff[iX+2] & 0x00FF);
-     if( size_t(iX) < sizeof(inpBuff) ) // Short last line
-     {
-       switch(L-iX)                 // Number of bytes remaining to process
-       {
-         case 0:
-           break;
-
-         case 1:
-           outBuff[oX++]= ENCODE[(outWord >> 18) & 0x003F];
-           outBuff[oX++]= ENCODE[(outWord >> 12) & 0x003F];
-           outBuff[oX++]= PAD_CHAR;
-           outBuff[oX++]= PAD_CHAR;
-
-           break;
-
-         case 2:
-           outBuff[oX++]= ENCODE[(outWord >> 18) & 0x003F];
-           outBuff[oX++]= ENCODE[(outWord >> 12) & 0x003F];
-           outBuff[oX++]= ENCODE[(outWord >>  6) & 0x003F];
-           outBuff[oX++]= PAD_CHAR;
-           break;
-
-         default:                   // OK, I can't code
-           fprintf(stderr, "%s %4d: bug(%d)\n", __FILE__, __LINE__, L-iX);
-       }
+       memcpy(outLine, outBuff + oX, size);
+       outLine[size++]= '\n';
+       out.write(outLine, size);
      }
-
-     outBuff[oX++]= '\0';
-     out.printf("%s\n", outBuff);
    }
 
+   free(inpBuff);
+   free(outBuff);
    if( getEcode() != EC_0 )
      return RC_NG;
    return RC_OK;
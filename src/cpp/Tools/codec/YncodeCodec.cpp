@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Instantiate yEnc Codec Object.
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <stdio.h>
@@ -24,12 +24,13 @@
 #include <string.h>
 
 #include <com/AutoPointer.h>
-#include <com/Barrier.h>
-#include <com/Debug.h>
 #include <com/Reader.h>
 #include <com/Writer.h>
+#include <pub/Coding.h>             // For namespace pub::coding
 #include "YncodeCodec.h"
 
+using namespace _LIBPUB_NAMESPACE::coding;
+
 //----------------------------------------------------------------------------
 // Constants for parameterization
 //----------------------------------------------------------------------------
@@ -37,35 +38,9 @@
 #undef  HCDM                        // If defined, Hard Core Debug Mode
 #endif
 
-#define CODEA 42
-#define CODEB 106
-
 #define LINE_SIZE 128               // Nominal line size
 #define BUFF_SIZE 8192              // Buffer size
 
-#ifndef FALSE
-#define FALSE 0
-#endif
-
-#ifndef TRUE
-#define TRUE 1
-#endif
-
-//----------------------------------------------------------------------------
-// Macros
-//----------------------------------------------------------------------------
-#define ELEMENTS(x) (sizeof(x) / sizeof(x[0]))
-
-//----------------------------------------------------------------------------
-// Local data areas
-//----------------------------------------------------------------------------
-static Barrier         barrier= BARRIER_INIT; // Barrier
-static int             init= 0;     // Non-zero when initialized
-
-static int             ENCODE[256]; // Encoding table
-static int             DECODE[256]; // Decoding table
-static int             RECODE[256]; // Recoding table
-
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -87,48 +62,15 @@ static int             RECODE[256]; // Recoding table
 // Purpose-
 //       Default constructor.
 //
+// Implementation notes-
+//       The encoding and decoding kernels are in namespace pub::coding.
+//
 //----------------------------------------------------------------------------
    YncodeCodec::YncodeCodec( void ) // Default constructor
 :  Codec()
 ,  checksum()
 ,  size(0)
 {
-   unsigned            i;
-
-   // Only initialize static areas once
-   if( init != 0 )
-     return;
-
-   AutoBarrier lock(barrier);
-   if( init == 0 )
-   {
-     for(i=0; i<ELEMENTS(ENCODE); i++)
-       ENCODE[i]= (i + CODEA) & 0x00ff;
-
-     for(i=0; i<ELEMENTS(DECODE); i++)
-       DECODE[i]= (i - CODEA) & 0x00ff;
-
-     memset(RECODE, 0, sizeof(RECODE));
-     RECODE[(int)'\0']= 2;
-     RECODE[(int)'\n']= 2;
-     RECODE[(int)'\r']= 2;
-     RECODE[(int)'=' ]= 2;
-     RECODE[(int)'\t']= 1;
-     RECODE[(int)' ' ]= 1;
-     RECODE[(int)'.' ]= 1;
-
-     init= 1;
-     #ifdef HCDM
-       tracef("ENCODE:\n");
-       dump(ENCODE, sizeof(ENCODE));
-
-       tracef("DECODE:\n");
-       dump(DECODE, sizeof(DECODE));
-
-       tracef("RECODE:\n");
-       dump(RECODE, sizeof(RECODE));
-     #endif
-   }
 }
 
 //----------------------------------------------------------------------------
@@ -146,14 +88,11 @@ int                                 // Return code (0 OK)
      Writer&           out)         // Output file
 {
    int                 resultant;   // Resulant
+   char*               input;       // Input buffer
    char*               buffer;      // Working buffer
-   int                 C;           // Current character
-   int                 L;           // Write length
+   int                 L;           // Read/write length
    const char*         ptrC;        // Working message
-   int                 swEscape;    // ESCAPE character
-
-// int                 iX;          // Input index
-   int                 oX;          // Output index
+   bool                swEscape;    // ESCAPE character
 
    //-------------------------------------------------------------------------
    // Decode
@@ -162,7 +101,7 @@ int                                 // Return code (0 OK)
    checksum.reset();
    size= 0;
 
-   buffer= (char*)malloc(BUFF_SIZE); // Allocate buffer
+   buffer= (char*)malloc(2 * BUFF_SIZE); // Allocate buffers
    if( buffer == NULL )
    {
      perror("No storage");
@@ -170,89 +109,55 @@ int                                 // Return code (0 OK)
      return DC_ERR;
    }
    AutoPointer aptr(buffer);
+   input= buffer + BUFF_SIZE;
 
    resultant= DC_OK;
-   swEscape= FALSE;
-// iX= oX= 0;
-   oX= 0;
+   swEscape= false;
    for(;;)                          // Decode the data
    {
-     if( oX >= BUFF_SIZE )
+     L= inp.read(input, BUFF_SIZE);
+     if( L <= 0 )                   // If error or end of file
      {
-       checksum.accumulate(buffer, oX);
-       size += oX;
-       L= out.write(buffer, oX);    // Write the data
-       if( L != oX )
+       if( L < 0 )                  // If error
        {
          resultant= DC_ERR;
-         setEcode(EC_WTR);
+         setEcode(EC_RDR);
+         out.printf("\n=yend ");
+         out.printf("==== READ ERROR\n");
          perror("I/O error");
-         break;
        }
-       oX= 0;
+       break;
      }
 
-     C= inp.get();
-     if( C < 0 )                    // If error or EOF
+     size_t used;
+     int oX= (int)yenc_decode(input, L, buffer, used, swEscape);
+     if( oX > 0 )
      {
-       if( C == EC_EOF )
+       checksum.accumulate(buffer, oX);
+       size += oX;
+       if( (int)out.write(buffer, oX) != oX ) // Write the data
        {
-         if( oX > 0 )
-         {
-           checksum.accumulate(buffer, oX);
-           size += oX;
-           L= out.write(buffer, oX); // Write the data
-           if( L != oX )
-           {
-             setEcode(EC_WTR);
-             perror("I/O error");
-           }
-         }
+         resultant= DC_ERR;
+         setEcode(EC_WTR);
+         perror("I/O error");
          break;
        }
-
-       resultant= DC_ERR;
-       setEcode(EC_RDR);
-       out.printf("\n=yend ");
-       out.printf("==== READ ERROR\n");
-       perror("I/O error");
-       break;
      }
 
-     if( swEscape )
+     if( used < size_t(L) )         // If invalid escape sequence
      {
-       if( C == '\n' || C == '\r' || C == 'y' )
-       {
-         resultant= DC_ICS;
-
-         ptrC= "y";
-         if( C == '\n' )
-           ptrC= "\\n";
+       resultant= DC_ICS;
 
-         else if( C == '\r' )
-           ptrC= "\\r";
-         fprintf(stdout, "%4d: Sequence: '=%s'\n", __LINE__, ptrC);
+       ptrC= "y";
+       if( input[used] == '\n' )
+         ptrC= "\\n";
 
-         break;
-       }
+       else if( input[used] == '\r' )
+         ptrC= "\\r";
+       fprintf(stdout, "%4d: Sequence: '=%s'\n", __LINE__, ptrC);
 
-       C= (C - CODEB) & 0x00ff;
-       swEscape= FALSE;
-     }
-     else if( C == '\n' || C == '\r' )
-     {
-//     iX= 0;
-       continue;
-     }
-     else if( C == '=' )
-     {
-       swEscape= TRUE;
-       continue;
+       break;
      }
-     else
-       C= DECODE[C];
-
-     buffer[oX++]= C;
    }
 
    return resultant;
@@ -273,11 +178,9 @@ int                                 // Return code (0 OK)
      Writer&           out)         // Output file
 {
    char*               buffer;      // Working buffer
-   int                 C;           // Current character
+   char*               output;      // Output buffer
    int                 L;           // Read length
-
-   int                 iX;          // Input index
-   int                 oX;          // Output index
+   size_t              column;      // Output column
 
    //-------------------------------------------------------------------------
    // Encode
@@ -286,22 +189,18 @@ int                                 // Return code (0 OK)
    checksum.reset();
    size= 0;
 
-   buffer= (char*)malloc(BUFF_SIZE); // Allocate buffer
+   buffer= (char*)malloc(BUFF_SIZE + yenc_length(BUFF_SIZE, LINE_SIZE));
    if( buffer == NULL )
    {
      setEcode(EC_FAULT);
      return RC_NG;
    }
+   output= buffer + BUFF_SIZE;
 
-   L= inp.read(buffer, BUFF_SIZE);
-   if( L > 0 )
-   {
-     checksum.accumulate(buffer, L);
-     size= L;
-   }
-   iX= 0;
+   column= 0;
    for(;;)                          // Encode the data
    {
+     L= inp.read(buffer, BUFF_SIZE);
      if( L <= 0 )                   // If error or end of file
      {
        if( L < 0 )                  // If error
@@ -314,35 +213,13 @@ int                                 // Return code (0 OK)
        break;
      }
 
-     for(oX= 0; oX<LINE_SIZE; oX++)
-     {
-       if( iX >= L )
-       {
-         L= inp.read(buffer, BUFF_SIZE);
-         iX= 0;
-         if( L <= 0 )
-           break;
-
-         checksum.accumulate(buffer, L);
-         size += L;
-       }
+     checksum.accumulate(buffer, L);
+     size += L;
+     out.write(output, yenc_encode(buffer, L, output, column, LINE_SIZE));
+   }
 
-       C= buffer[iX] & 0x00ff;
-       C= ENCODE[C];
-       if( RECODE[C] != 0 )
-       {
-         if( RECODE[C] == 2 || oX == 0 || oX >= (LINE_SIZE-1) )
-         {
-           out.put('=');
-           oX++;
-           C= (buffer[iX] + CODEB) & 0x00ff;
-         }
-       }
-       out.put(C);
-       iX++;
-     }
+   if( size > 0 )                   // Complete the last line
      out.put('\n');
-   }
 
    free(buffer);
    if( getEcode() != EC_0 )
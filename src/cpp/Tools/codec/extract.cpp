@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,19 +16,45 @@
 //       Extract encoded files from a set of files.
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
+//
+// Implementation notes-
+//       Extraction is a three stage pipeline:
+//       - The input files are scanned concurrently, each into its own list
+//         of Content and encoded Segment data. Scanning stays within one
+//         file per thread of the merge.
+//       - The per file lists are merged, in input file order, detecting
+//         duplicate Segments just as a sequential scan would. Content is
+//         queued for decoding as soon as it is complete, when its part
+//         order is settled, so its Segment data is released while the
+//         remaining files are scanned. Incomplete Content is queued last.
+//       - The Content is decoded concurrently. A complete multipart yEnc
+//         file is decoded one part at a time, verifying each part's CRC32
+//         and writing it at its position in the output file. Other Content
+//         is decoded one file at a time.
 //
 //----------------------------------------------------------------------------
 #include <assert.h>
 #include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
 #include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <com/define.h>
+#include <com/AutoPointer.h>
 #include <com/Buffer.h>
+#include <com/CRC32.h>
 #include <com/Debug.h>
 #include <com/istring.h>
 #include <com/params.h>
@@ -38,6 +64,7 @@
 #include <com/Reader.h>
 #include <com/Unconditional.h>
 #include <com/Writer.h>
+#include <pub/Coding.h>
 
 #include "Codec.h"
 #include "Base64Codec.h"
@@ -52,6 +79,7 @@
 #undef  HCDM                        // If defined, Hard Core Debug Mode
 #endif
 
+#define BUFF_SIZE             32768 // Part decode buffer size
 #define INP_SIZE              32768 // Input buffer size
 #define NAME_SIZE              1024 // Maximum size of a filename
 #define PROPSIZE                512 // Property size
@@ -92,6 +120,12 @@ struct Segment {                    // File Segment
    Segment*            next;        // Chain pointer
    unsigned            index;       // Index number
    TempBuffer          temp;        // Segment data
+
+   unsigned long       begin;       // For CodeYN, first part byte (1 origin)
+   unsigned long       end;         // For CodeYN, last part byte
+   uint32_t            crc;         // For CodeYN, part CRC32
+   int                 hasCRC;      // TRUE iff crc is present
+   int                 rc;          // Part decode return code
 }; // struct Segment
 
 //----------------------------------------------------------------------------
@@ -127,6 +161,13 @@ enum Code                           // Encoding
 int                                 // TRUE if all Segments are present
    isComplete( void ) const;        // Are all Segments present?
 
+int                                 // TRUE if parts decode independently
+   isPositional( void ) const;      // Can parts be decoded independently?
+
+int                                 // TRUE if inserted, FALSE if duplicate
+   insert(                          // Insert Segment
+     Segment*          segment);    // -> Segment
+
 Segment*                            // -> Segment
    open(                            // Open Segment
      unsigned          index);      // Segment index
@@ -135,16 +176,29 @@ void
    close(                           // Close Segment
      Segment*          segment);    // -> Segment
 
+int                                 // Return code (0 OK)
+   create( void );                  // Create the positional output file
+
 void
    decode(                          // Decode a file
      Reader&           inp);        // Input unit
 
+void
+   decodePart(                      // Decode and write a part
+     Segment*          segment);    // -> Segment
+
 void
    empty( void );                   // Empty the Content
 
 void
    extract( void );                 // Extract the Content
 
+void
+   finish( void );                  // Complete the positional output file
+
+int                                 // Return code (0 OK)
+   prepare( void );                 // Prepare (uniquely name) the output file
+
 //----------------------------------------------------------------------------
 // Content: Attributes
 //----------------------------------------------------------------------------
@@ -153,7 +207,12 @@ void
    int                 code;        // Encoding
    unsigned            count;       // Number of Segments
    unsigned            size;        // For CODEYN, file size
+   uint32_t            crc;         // For CODEYN, file CRC32 (multipart)
+   int                 hasCRC;      // TRUE iff crc is present
    Segment*            head;        // First Segment
+   int                 fd;          // Positional output file handle
+   std::atomic<unsigned>
+                       pending;     // Positional parts not yet decoded
 }; // struct Content
 
 //----------------------------------------------------------------------------
@@ -291,13 +350,22 @@ void
 //----------------------------------------------------------------------------
 // Local data areas
 //----------------------------------------------------------------------------
-static Content*        outs= NULL;  // The sorted list of output files
-static FileReader      reader;      // Working FileReader
-static char*           fileName;    // Working file name
-static char*           inpLine;     // Input line
-static char*           inpProp;     // Input property (continuation) line
+// The scan state is thread local. Each scan thread builds its own list of
+// output files, which is later merged into the main thread's list.
+static thread_local Content*
+                       outs= NULL;  // The list of output files
+static thread_local FileReader
+                       reader;      // Working FileReader
+static thread_local char
+                       fileName[INP_SIZE]; // Working file name
+static thread_local char
+                       inpLine[INP_SIZE]; // Input line
+static thread_local char
+                       inpProp[INP_SIZE]; // Input property line
 static int             todaysMajor= 0; // Today's major number
-static int             todaysMinor= 0; // Today's minor number
+static std::atomic<int>
+                       todaysMinor(0); // Today's minor number
+static unsigned        threads;     // The number of worker threads
 
 static int             sw_allowany; // Allow any filename?
 static int             sw_allowdup; // Allow duplicates?
@@ -345,7 +413,8 @@ static int             propSize[] = // Length(property names)
    , 0                              // Subject
    };
 
-static char            propData[][PROPSIZE] = // Property values area
+static thread_local char
+                       propData[][PROPSIZE] = // Property values area
    { {""}                           // Article
    , {""}                           // Content-Type
    , {""}                           // From
@@ -353,7 +422,8 @@ static char            propData[][PROPSIZE] = // Property values area
    };
 
 // propValue[i]= propData[i] if present, NULL if not
-static char*           propValue[] =// Property values
+static thread_local char*
+                       propValue[] =// Property values
    { NULL                           // Article
    , NULL                           // Content-Type
    , NULL                           // From
@@ -625,6 +695,24 @@ static int                          // Return code
    return rc;
 }
 
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       writeLine
+//
+// Purpose-
+//       Write a data line into a Segment.
+//
+//----------------------------------------------------------------------------
+static void
+   writeLine(                       // Write a data line
+     Segment*          segment,     // Into this Segment
+     const char*       line)        // The data line
+{
+   segment->temp.write(line, strlen(line));
+   segment->temp.put('\n');
+}
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -803,6 +891,11 @@ static const char*                  // Next non-whitespace character
 :  next(NULL)
 ,  index(0)
 ,  temp()
+,  begin(0)
+,  end(0)
+,  crc(0)
+,  hasCRC(FALSE)
+,  rc(0)
 {
    #ifdef HCDM
      printf("Segment(%p)::Segment()\n", this);
@@ -843,7 +936,11 @@ static const char*                  // Next non-whitespace character
 ,  code(CodeRESET)
 ,  count(0)
 ,  size(0)
+,  crc(0)
+,  hasCRC(FALSE)
 ,  head(NULL)
+,  fd(-1)
+,  pending(0)
 {
    #ifdef HCDM
      printf("Content(%p)::Content()\n", this);
@@ -878,6 +975,88 @@ int                                 // TRUE if all Segments are present
    return TRUE;
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Content::isPositional
+//
+// Purpose-
+//       Can the parts be decoded independently?
+//
+// Implementation notes-
+//       Only complete yEnc content qualifies, and only when the parts,
+//       ordered by position, exactly tile the file: the first part begins
+//       at byte 1, each part begins where the prior part ended and the last
+//       part ends at the file size.
+//
+//----------------------------------------------------------------------------
+int                                 // TRUE if parts decode independently
+   Content::isPositional( void ) const // Can parts be decoded independently?
+{
+   std::vector<const Segment*> part; // The parts, in position order
+   unsigned long       end;         // The prior part's end
+
+   if( code != CodeYN || size == 0 || !isComplete() )
+     return FALSE;
+
+   for(const Segment* segment= head; segment != NULL; segment= segment->next)
+     part.push_back(segment);
+
+   std::sort(part.begin(), part.end(),
+             [](const Segment* L, const Segment* R)
+             { return L->begin < R->begin; });
+
+   end= 0;
+   for(size_t i= 0; i<part.size(); i++)
+   {
+     if( part[i]->begin != end + 1 || part[i]->end < part[i]->begin )
+       return FALSE;
+
+     end= part[i]->end;
+   }
+
+   return (end == size);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Content::insert
+//
+// Purpose-
+//       Insert a Segment, in index order.
+//
+//----------------------------------------------------------------------------
+int                                 // TRUE if inserted, FALSE if duplicate
+   Content::insert(                 // Insert Segment
+     Segment*          segment)     // -> Segment
+{
+   Segment*            ptrS;        // -> Segment
+
+   for(ptrS= head; ptrS != NULL; ptrS= ptrS->next)
+   {
+     if( ptrS->index == segment->index )
+       return FALSE;
+   }
+
+   ptrS= head;
+   if( ptrS == NULL || ptrS->index > segment->index )
+   {
+     segment->next= ptrS;
+     head= segment;
+   }
+   else
+   {
+     while( ptrS->next != NULL && ptrS->next->index < segment->index )
+       ptrS= ptrS->next;
+
+     segment->next= ptrS->next;
+     ptrS->next= segment;
+   }
+
+   return TRUE;
+}
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -892,40 +1071,18 @@ Segment*                            // -> Segment
      unsigned          index)       // Segment index
 {
    Segment*            segment;     // Resultant
-   Segment*            ptrS;        // -> Segment
 
    segment= NULL;
    if( code != CodeEMPTY )
    {
-     ptrS= head;
-     while( ptrS != NULL )
-     {
-       if( ptrS->index == index )
-         break;
-
-       ptrS= ptrS->next;
-     }
-
-     if( ptrS == NULL )
-     {
-       segment= new Segment();
-       segment->index= index;
+     segment= new Segment();
+     segment->index= index;
+     if( insert(segment) )
        segment->temp.open(name, Media::MODE_WRITE);
-
-       ptrS= head;
-       if( ptrS == NULL || ptrS->index > index )
-       {
-         segment->next= ptrS;
-         head= segment;
-       }
-       else
-       {
-         while( ptrS->next != NULL && ptrS->next->index < index )
-           ptrS= ptrS->next;
-
-         segment->next= ptrS->next;
-         ptrS->next= segment;
-       }
+     else
+     {
+       delete segment;
+       segment= NULL;
      }
    }
 
@@ -944,6 +1101,9 @@ Segment*                            // -> Segment
 // Purpose-
 //       Close a Segment.
 //
+// Implementation notes-
+//       Complete Content is extracted after its input file is merged.
+//
 //----------------------------------------------------------------------------
 void
    Content::close(                  // Close a Segment
@@ -957,11 +1117,42 @@ void
      return;
 
    segment->temp.close();
+}
 
-   if( !isComplete() )
-     return;
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Content::create
+//
+// Purpose-
+//       Create the positional output file.
+//
+//----------------------------------------------------------------------------
+int                                 // Return code (0 OK)
+   Content::create( void )          // Create the positional output file
+{
+   #ifdef HCDM
+     printf("Content(%p)::create()\n", this);
+   #endif
+
+   int rc= prepare();
+   if( rc != 0 )
+     return rc;
+
+   fd= ::open(name, O_RDWR | O_CREAT | O_TRUNC, 0666);
+   if( fd < 0 || ftruncate(fd, size) != 0 )
+   {
+     fprintf(stderr, "%4d: SNO: File(%s) wtr open failure(%d)\n",
+                     __LINE__, name, errno);
+     if( fd >= 0 )
+     {
+       ::close(fd);
+       fd= -1;
+     }
+     return -1;
+   }
 
-   extract();
+   return 0;
 }
 
 //----------------------------------------------------------------------------
@@ -980,27 +1171,15 @@ void
    Base64Codec         codec64;     // 64 Codec
    UuCodeCodec         codecUU;     // UU Codec
    YncodeCodec         codecYN;     // yEnc Codec
-   FileInfo            info(name);  // File information
+   FileInfo            info;        // File information
    FileWriter          writer;      // Writer
    const char*         status;      // Status
    char                string[64];  // Working string
 
    int                 rc;
 
-   if( info.exists() )
-   {
-     if( !sw_allowdup )             // If duplicates not allowed
-     {
-       fprintf(stderr, "%4d: File(%s) rejected: No -D\n", __LINE__, name);
-       return;
-     }
-
-     fprintf(stdout, "%4d: File(%s) Exists\n", __LINE__, name);
-     uniqueFilename(fileName, name);
-     name= Unconditional::replace(name, fileName);
-     assert( name != NULL );
-     fprintf(stdout, "%4d: ===>(%s)\n", __LINE__, name);
-   }
+   if( prepare() != 0 )
+     return;
 
    rc= reader.open(name);
    if( rc != 0 )
@@ -1060,6 +1239,112 @@ void
    fprintf(stdout, "%4d: File(%s) Decode: %s\n", __LINE__, name, status);
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Content::decodePart
+//
+// Purpose-
+//       Decode a yEnc part, writing it at its position in the output file.
+//
+// Implementation notes-
+//       Different parts of the same Content may be decoded concurrently.
+//       The part's return code is left in segment->rc.
+//
+//----------------------------------------------------------------------------
+void
+   Content::decodePart(             // Decode and write a part
+     Segment*          segment)     // -> Segment
+{
+   CRC32               checksum;    // Part checksum
+   unsigned long       length;      // Part length
+   unsigned long       total;       // Decoded length
+   bool                escape;      // Escape sequence pending
+
+   int                 rc;
+
+   #ifdef HCDM
+     printf("Content(%p)::decodePart(%p)\n", this, segment);
+   #endif
+
+   char* buffer= (char*)malloc(2 * BUFF_SIZE);
+   if( buffer == NULL )
+   {
+     perror("No storage");
+     segment->rc= Codec::DC_ERR;
+     return;
+   }
+   AutoPointer aptr(buffer);
+   char* input= buffer + BUFF_SIZE;
+
+   rc= Codec::DC_OK;
+   length= segment->end - segment->begin + 1;
+   total= 0;
+   escape= false;
+   segment->temp.open(name, Media::MODE_READ);
+   for(;;)
+   {
+     size_t L= segment->temp.read(input, BUFF_SIZE);
+     if( L == 0 )
+       break;
+
+     size_t used;
+     size_t size= pub::coding::yenc_decode(input, L, buffer, used, escape);
+     if( (total + size) > length )
+     {
+       fprintf(stdout, "%4d: File(%s) Part(%d) overlength\n", __LINE__,
+                       name, segment->index);
+       rc= Codec::DC_ICS;
+       break;
+     }
+
+     checksum.accumulate(buffer, size);
+     if( pwrite(fd, buffer, size, segment->begin - 1 + total)
+         != ssize_t(size) )
+     {
+       fprintf(stderr, "File(%s) ", name);
+       perror("I/O error");
+       rc= Codec::DC_ERR;
+       break;
+     }
+     total += size;
+
+     if( used < L )                 // If invalid escape sequence
+     {
+       const char* ptrC= "y";
+       if( input[used] == '\n' )
+         ptrC= "\\n";
+       else if( input[used] == '\r' )
+         ptrC= "\\r";
+
+       fprintf(stdout, "%4d: File(%s) Part(%d) Sequence: '=%s'\n", __LINE__,
+                       name, segment->index, ptrC);
+       rc= Codec::DC_ICS;
+       break;
+     }
+   }
+   segment->temp.close();
+   segment->temp.truncate();
+
+   if( rc == Codec::DC_OK && total != length )
+   {
+     fprintf(stdout, "%4d: File(%s) Part(%d) size(%lu) expected(%lu)\n",
+                     __LINE__, name, segment->index, total, length);
+     rc= Codec::DC_ICS;
+   }
+
+   if( rc == Codec::DC_OK && segment->hasCRC
+       && checksum.getValue() != segment->crc )
+   {
+     fprintf(stdout, "%4d: File(%s) Part(%d) CRC(%.8X) expected(%.8X)\n",
+                     __LINE__, name, segment->index,
+                     (unsigned)checksum.getValue(), (unsigned)segment->crc);
+     rc= Codec::DC_ICS;
+   }
+
+   segment->rc= rc;
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -1099,7 +1384,7 @@ void
    Segment*            segment;     // -> Current Segment
    TempBuffer          temp;        // Temporary
    unsigned            index;       // Current file index
-   int                 C;           // Current character
+   char                buffer[BUFF_SIZE]; // Copy buffer
 
    #ifdef HCDM
      printf("Content(%p)::extract()\n", this);
@@ -1136,11 +1421,11 @@ void
      segment->temp.open(name, Media::MODE_READ);
      for(;;)
      {
-       C= segment->temp.get();
-       if( C == EOF )
+       size_t L= segment->temp.read(buffer, sizeof(buffer));
+       if( L == 0 )
          break;
 
-       temp.put(C);
+       temp.write(buffer, L);
      }
      segment->temp.close();
      segment->temp.truncate();
@@ -1155,6 +1440,130 @@ void
    fprintf(stdout, "\n");
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Content::finish
+//
+// Purpose-
+//       Complete the positional output file.
+//
+// Implementation notes-
+//       When every part decoded and the "=yend" line supplied the whole
+//       file's crc32, the output file is read back to verify it.
+//
+//----------------------------------------------------------------------------
+void
+   Content::finish( void )          // Complete the positional output file
+{
+   Segment*            segment;     // -> Current Segment
+   const char*         status;      // Status
+   char                string[64];  // Working string
+
+   int                 rc;
+
+   #ifdef HCDM
+     printf("Content(%p)::finish()\n", this);
+   #endif
+
+   if( fd < 0 )
+     return;
+
+   rc= Codec::DC_OK;
+   for(segment= head; segment != NULL; segment= segment->next)
+   {
+     if( segment->rc != Codec::DC_OK )
+       rc= segment->rc;
+   }
+
+   if( rc == Codec::DC_OK && hasCRC )
+   {
+     CRC32 checksum;                // File checksum
+     char* buffer= (char*)malloc(BUFF_SIZE);
+     if( buffer == NULL )
+     {
+       perror("No storage");
+       rc= Codec::DC_ERR;
+     }
+     else
+     {
+       AutoPointer aptr(buffer);
+       off_t offset= 0;
+       for(;;)
+       {
+         ssize_t L= pread(fd, buffer, BUFF_SIZE, offset);
+         if( L <= 0 )
+         {
+           if( L < 0 )
+           {
+             fprintf(stderr, "File(%s) ", name);
+             perror("I/O error");
+             rc= Codec::DC_ERR;
+           }
+           break;
+         }
+
+         checksum.accumulate(buffer, L);
+         offset += L;
+       }
+
+       if( rc == Codec::DC_OK && checksum.getValue() != crc )
+       {
+         fprintf(stdout, "%4d: File(%s) CRC(%.8X) expected(%.8X)\n",
+                         __LINE__, name,
+                         (unsigned)checksum.getValue(), (unsigned)crc);
+         rc= Codec::DC_ICS;
+       }
+     }
+   }
+
+   ::close(fd);
+   fd= -1;
+
+   status= "YN";
+   if( rc != 0 )
+   {
+     sprintf(string, "Failed(%d), kept", rc);
+     status= string;
+   }
+
+   fprintf(stdout, "%4d: File(%s) Decode: %s\n", __LINE__, name, status);
+   empty();
+   fprintf(stdout, "\n");
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Content::prepare
+//
+// Purpose-
+//       Prepare the output file name, making it unique if it exists.
+//
+//----------------------------------------------------------------------------
+int                                 // Return code (0 OK)
+   Content::prepare( void )         // Prepare (uniquely name) the output file
+{
+   FileInfo            info(name);  // File information
+
+   if( info.exists() )
+   {
+     if( !sw_allowdup )             // If duplicates not allowed
+     {
+       fprintf(stderr, "%4d: File(%s) rejected: No -D\n", __LINE__, name);
+       return -1;
+     }
+
+     fprintf(stdout, "%4d: File(%s) Exists\n", __LINE__, name);
+     uniqueFilename(fileName, name);
+     name= Unconditional::replace(name, fileName);
+     assert( name != NULL );
+     fprintf(stdout, "%4d: ===>(%s)\n", __LINE__, name);
+   }
+
+   return 0;
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -1360,7 +1769,7 @@ int                                 // New mode
      }
 
      if( segment != NULL )          // If handling this data
-       segment->temp.printf("%s\n", inpLine);
+       writeLine(segment, inpLine);
    }
 
    if( content != NULL )
@@ -1827,6 +2236,12 @@ int                                 // New mode
            unsigned long size= atol(C);
            if( content->size == 0 )
              content->size= size;
+
+           if( total == 1 )         // (Single part, no "=ypart" needed)
+           {
+             segment->begin= 1;
+             segment->end= size;
+           }
          }
 
          if( index == 1 )
@@ -1842,6 +2257,27 @@ int                                 // New mode
      {
        if( memicmp(inpLine, "=yend ", 6) == 0 )
        {
+         LineParser lp(inpLine);
+         if( segment != NULL )
+         {
+           if( lp.isPresent(" pcrc32=") )
+           {
+             segment->crc= lp.getHex32(" pcrc32=");
+             segment->hasCRC= TRUE;
+           }
+           else if( content->count == 1 && lp.isPresent(" crc32=") )
+           {
+             segment->crc= lp.getHex32(" crc32=");
+             segment->hasCRC= TRUE;
+           }
+
+           if( content->count > 1 && lp.isPresent(" crc32=") )
+           {
+             content->crc= lp.getHex32(" crc32=");
+             content->hasCRC= TRUE;
+           }
+         }
+
          content->close(segment);
          content= NULL;
          segment= NULL;
@@ -1850,7 +2286,15 @@ int                                 // New mode
 
        // Handle "=ypart" line
        if( memicmp(inpLine, "=ypart ", 7) == 0 )
+       {
+         if( segment != NULL )
+         {
+           LineParser lp(inpLine);
+           segment->begin= lp.getDec64(" begin=");
+           segment->end= lp.getDec64(" end=");
+         }
          continue;
+       }
      }
      else
      {
@@ -1901,9 +2345,9 @@ int                                 // New mode
      if( segment != NULL )          // If handling this data
      {
        if( inpLine[0] != '.' || inpLine[1] != '.' )
-         segment->temp.printf("%s\n", inpLine);
+         writeLine(segment, inpLine);
        else
-         segment->temp.printf("%s\n", inpLine+1);
+         writeLine(segment, inpLine+1);
      }
    }
 
@@ -2112,6 +2556,7 @@ static void
    fprintf(stderr, "Options:\n");
    fprintf(stderr, "\t-A\tAllow all file names\n");
    fprintf(stderr, "\t-D\tAllow duplicate file extraction\n");
+   fprintf(stderr, "\t-T:n\tUse n worker threads\n");
    fprintf(stderr, "\t-U\tAllow Unnamed file extraction\n");
    fprintf(stderr, "\t-V\tVerbose mode\n");
    exit(EXIT_FAILURE);
@@ -2149,6 +2594,7 @@ static void
    sw_allowdup= FALSE;
    sw_unnamed= FALSE;
    sw_verbose= FALSE;
+   threads= std::thread::hardware_concurrency();
 
    //-------------------------------------------------------------------------
    // Argument analysis
@@ -2170,6 +2616,17 @@ static void
        else if( swname("D", argp) )      // Allow duplicates?
          sw_allowdup= swatob("D", argp);
 
+       else if( swname("T:", argp) ) // Thread count?
+       {
+         long T= swatol("T:", argp);
+         threads= unsigned(T);
+         if( T <= 0 )
+         {
+           error= TRUE;
+           fprintf(stderr, "Invalid thread count '%s'\n", argv[argi]);
+         }
+       }
+
        else if( swname("U", argp) ) // Allow unnamed?
          sw_unnamed= swatob("U", argp);
 
@@ -2198,6 +2655,9 @@ static void
      fprintf(stderr, "No filename specified\n");
    }
 
+   if( threads == 0 )               // If hardware_concurrency unknown
+     threads= 1;
+
    if( error )                      // If error encountered
      info();
 }
@@ -2221,11 +2681,6 @@ static void
      printf("%4d: init()\n", __LINE__);
    #endif
 
-   // Allocate input lines
-   fileName= (char*)Unconditional::malloc(INP_SIZE);
-   inpLine= (char*)Unconditional::malloc(INP_SIZE);
-   inpProp= (char*)Unconditional::malloc(INP_SIZE);
-
    // Initialize propSize array
    for(unsigned i= 0; i<ELEMENTS(propSize); i++)
      propSize[i]= strlen(propName[i]);
@@ -2239,35 +2694,251 @@ static void
    todaysMinor= 0;
 }
 
+//----------------------------------------------------------------------------
+//
+// Struct-
+//       Job
+//
+// Purpose-
+//       Describe a decode job.
+//
+//----------------------------------------------------------------------------
+struct Job {                        // Decode job
+   Content*            content;     // The Content
+   Segment*            segment;     // The part Segment, NULL for all
+}; // struct Job
+
+//----------------------------------------------------------------------------
+// Pipeline data areas (Protected by pipeMutex)
+//----------------------------------------------------------------------------
+static std::mutex      pipeMutex;   // The pipeline mutex
+static std::condition_variable
+                       pipeEvent;   // Signalled on any pipeline change
+static std::deque<Job> jobList;     // The decode job queue
+static int             jobsEnded= FALSE; // TRUE when no more jobs are queued
+
+static std::vector<const char*>
+                       inpFile;     // The input file list
+static std::vector<Content*>
+                       inpFound;    // The Content lists, by file
+static std::vector<int>
+                       inpResult;   // The return codes, by file
+static std::vector<int>
+                       inpReady;    // TRUE when scanned, by file
+static size_t          nextFile= 0; // The next file index to scan
+static size_t          mergedFile= 0; // The number of merged files
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
-//       term
+//       decode
 //
 // Purpose-
-//       Write the extracted and sorted output files.
+//       Run a decode job.
+//
+// Implementation notes-
+//       The job's Content is deleted when its last job completes. The last
+//       part of a positional file also completes the output file.
 //
 //----------------------------------------------------------------------------
 static void
-   term( void )                     // Write the output files
+   decode(                          // Run a decode job
+     Job&              J)           // The decode job
 {
-   Content*            content;     // -> Current Content
+   try {
+     if( J.segment == NULL )
+       J.content->extract();
+     else
+       J.content->decodePart(J.segment);
+   } catch(const char* E) {
+     fprintf(stderr, "Exception(const char* '%s')\n", E);
+   } catch(...) {
+     fprintf(stderr, "Exception(...)\n");
+   }
+
+   if( J.segment == NULL )
+     delete J.content;
+   else if( --J.content->pending == 0 )
+   {
+     J.content->finish();
+     delete J.content;
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       merge
+//
+// Purpose-
+//       Merge an input file's Content list into the output file list.
+//
+// Implementation notes-
+//       Files are merged in input file order, so duplicate Segments are
+//       handled as if all the files had been scanned sequentially.
+//
+//----------------------------------------------------------------------------
+static void
+   merge(                           // Merge an input file's Content list
+     Content*          list)        // The input file's Content list
+{
+   Content*            content;     // -> Current (output) Content
+   Content*            found;       // -> Current (input) Content
+   Content*            head;        // The input list, in creation order
+   Segment*            segment;     // -> Current Segment
 
    #ifdef HCDM
-     printf("%4d: term()\n", __LINE__);
+     printf("%4d: merge(%p)\n", __LINE__, list);
    #endif
 
-   while( outs != NULL )
+   head= NULL;
+   while( list != NULL )
    {
-     content= outs;
-     content->extract();
-     outs= content->next;
-     delete content;
+     found= list;
+     list= found->next;
+     found->next= head;
+     head= found;
+   }
+
+   while( head != NULL )
+   {
+     found= head;
+     head= found->next;
+     found->next= NULL;
+
+     for(content= outs; content != NULL; content= content->next)
+     {
+       if( strcmp(content->name, found->name) == 0 )
+         break;
+     }
+
+     if( content == NULL )
+     {
+       found->next= outs;
+       outs= found;
+       continue;
+     }
+
+     if( found->count != content->count )
+       fprintf(stdout, "%4d content(%s) old(%d) new(%d) count\n", __LINE__,
+                       content->name, content->count, found->count);
+
+     if( content->code == Content::CodeRESET )
+       content->code= found->code;
+     if( content->size == 0 )
+       content->size= found->size;
+     if( !content->hasCRC )
+     {
+       content->crc= found->crc;
+       content->hasCRC= found->hasCRC;
+     }
+
+     while( found->head != NULL )
+     {
+       segment= found->head;
+       found->head= segment->next;
+       segment->next= NULL;
+       if( content->code != Content::CodeEMPTY && content->insert(segment) )
+         continue;
+
+       // A duplicate single part file is extracted using a unique name
+       if( found->count == 1 && found->code != Content::CodeYN )
+       {
+         segment->next= found->head;
+         found->head= segment;
+         fprintf(stdout, "%4d: File(%s) dup\n", __LINE__, found->name);
+         uniqueFilename(fileName, found->name);
+         found->name= Unconditional::replace(found->name, fileName);
+         found->next= outs;
+         outs= found;
+         break;
+       }
+
+       fprintf(stdout, "%4d: File(%s) (%d/%d) dup\n", __LINE__,
+                       content->name, segment->index, content->count);
+       delete segment;
+     }
+
+     if( found != outs )
+       delete found;
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       dispatch
+//
+// Purpose-
+//       Queue the decode jobs for merged Content.
+//
+// Implementation notes-
+//       Unless all is TRUE, only complete Content is dispatched. Its part
+//       order is then settled, and any later Segment is a duplicate.
+//
+//       The dispatched Segments move into a new Content, owned by its decode
+//       jobs. The merged Content is left empty (CodeEMPTY), so later
+//       duplicates are handled as if all the files had been scanned
+//       sequentially.
+//
+//       Complete multipart yEnc files are decoded one part per job. Other
+//       Content is decoded one file per job.
+//
+//----------------------------------------------------------------------------
+static void
+   dispatch(                        // Queue decode jobs
+     int               all)         // TRUE to include incomplete Content
+{
+   Content*            content;     // -> Current (merged) Content
+   Content*            owned;       // -> Current (dispatched) Content
+   Segment*            segment;     // -> Current Segment
+   std::vector<Job>    job;         // The new jobs
+
+   #ifdef HCDM
+     printf("%4d: dispatch(%d)\n", __LINE__, all);
+   #endif
+
+   for(content= outs; content != NULL; content= content->next)
+   {
+     if( content->code == Content::CodeEMPTY )
+       continue;
+     if( !all && !content->isComplete() )
+       continue;
+
+     owned= new Content();
+     owned->name= strdup(content->name);
+     owned->code= content->code;
+     owned->count= content->count;
+     owned->size= content->size;
+     owned->crc= content->crc;
+     owned->hasCRC= content->hasCRC;
+     owned->head= content->head;
+     content->head= NULL;
+     content->code= Content::CodeEMPTY;
+
+     if( owned->isPositional() )
+     {
+       if( owned->create() != 0 )
+       {
+         delete owned;
+         continue;
+       }
+
+       for(segment= owned->head; segment != NULL; segment= segment->next)
+         owned->pending++;
+       for(segment= owned->head; segment != NULL; segment= segment->next)
+         job.push_back({owned, segment});
+     }
+     else
+       job.push_back({owned, NULL});
    }
 
-   free(inpProp);
-   free(inpLine);
-   free(fileName);
+   if( job.size() > 0 )
+   {
+     std::lock_guard<std::mutex> lock(pipeMutex);
+     jobList.insert(jobList.end(), job.begin(), job.end());
+     pipeEvent.notify_all();
+   }
 }
 
 //----------------------------------------------------------------------------
@@ -2481,6 +3152,69 @@ static int                          // Return code
    return 0;                        // Decode complete
 }
 
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       work
+//
+// Purpose-
+//       Pipeline worker thread.
+//
+// Implementation notes-
+//       Queued decode jobs run first, releasing their Segment data. Otherwise
+//       the next input file is scanned, but no more than threads files ahead
+//       of the merge. This bounds the Segment data held awaiting the merge.
+//
+//       Each input file's thread local Content list is saved in inpFound[],
+//       leaving the thread's own list empty.
+//
+//----------------------------------------------------------------------------
+static void
+   work( void )                     // Pipeline worker thread
+{
+   std::unique_lock<std::mutex> lock(pipeMutex);
+   for(;;)
+   {
+     if( !jobList.empty() )
+     {
+       Job J= jobList.front();
+       jobList.pop_front();
+       lock.unlock();
+       decode(J);
+       lock.lock();
+     }
+     else if( nextFile < inpFile.size() && nextFile < mergedFile + threads )
+     {
+       size_t index= nextFile++;
+       lock.unlock();
+
+       int rc;
+       try {
+         rc= extract(inpFile[index]);
+       } catch(const char* E) {
+         fprintf(stderr, "Exception(const char* '%s')\n", E);
+         rc= -1;
+       } catch(...) {
+         fprintf(stderr, "Exception(...)\n");
+         rc= -1;
+       }
+
+       Content* list= outs;
+       outs= NULL;
+
+       lock.lock();
+       inpFound[index]= list;
+       inpResult[index]= rc;
+       inpReady[index]= TRUE;
+       pipeEvent.notify_all();
+     }
+     else if( jobsEnded )
+       break;
+     else
+       pipeEvent.wait(lock);
+   }
+}
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -2495,7 +3229,6 @@ int                                 // Main return code
      int               argc,        // Argument count
      char*             argv[])      // Argument array
 {
-   int                 rc;          // Called routine's return code
    int                 returncd;    // This routine's return code
 
    //-------------------------------------------------------------------------
@@ -2505,33 +3238,69 @@ int                                 // Main return code
    init();
 
    //-------------------------------------------------------------------------
-   // Initialize
+   // Start the pipeline
    //-------------------------------------------------------------------------
-   returncd= 0;
-   try {
-     for(int i=1; i<argc; i++)
-     {
-       if( argv[i][0] == '-' )      // If this parameter is in switch format
-         continue;
+   for(int i=1; i<argc; i++)
+   {
+     if( argv[i][0] != '-' )        // If this parameter is not a switch
+       inpFile.push_back(argv[i]);
+   }
+
+   inpFound.resize(inpFile.size(), NULL);
+   inpResult.resize(inpFile.size(), 0);
+   inpReady.resize(inpFile.size(), FALSE);
 
-       rc= extract(argv[i]);        // Copy the file to the content buffer
-       if( rc != 0 )                // If failure
+   std::vector<std::thread> thread;
+   for(unsigned t= 0; t<threads; t++)
+     thread.push_back(std::thread(work));
+
+   //-------------------------------------------------------------------------
+   // Merge the Content lists, in input file order, decoding complete Content
+   //-------------------------------------------------------------------------
+   returncd= 0;
+   for(size_t i= 0; i<inpFile.size(); i++)
+   {
+     Content* list;
+     {{{{
+       std::unique_lock<std::mutex> lock(pipeMutex);
+       while( !inpReady[i] )
+         pipeEvent.wait(lock);
+
+       list= inpFound[i];
+       if( inpResult[i] != 0 )      // If failure
          returncd= 1;               // Indicate it
-     }
-   } catch(const char* E) {
-     fprintf(stderr, "Exception(const char* '%s')\n", E);
-   } catch(...) {
-     fprintf(stderr, "Exception(...)\n");
+     }}}}
+
+     merge(list);
+     dispatch(FALSE);
+
+     std::lock_guard<std::mutex> lock(pipeMutex);
+     mergedFile= i + 1;
+     pipeEvent.notify_all();
    }
 
    //-------------------------------------------------------------------------
-   // Write the output files
+   // Write the remaining (incomplete) output files
    //-------------------------------------------------------------------------
-   term();
+   dispatch(TRUE);
+   {{{{
+     std::lock_guard<std::mutex> lock(pipeMutex);
+     jobsEnded= TRUE;
+     pipeEvent.notify_all();
+   }}}}
+
+   for(unsigned t= 0; t<thread.size(); t++)
+     thread[t].join();
+
+   while( outs != NULL )            // Delete the (empty) merged Content
+   {
+     Content* content= outs;
+     outs= content->next;
+     delete content;
+   }
 
    //-------------------------------------------------------------------------
    // Return
    //-------------------------------------------------------------------------
    return returncd;
 }
-
@@ -0,0 +1,679 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       Highway.cpp
+//
+// Purpose-
+//       Highway object implementation.
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#include <algorithm>
+#include <thread>
+#include <stdio.h>
+#include <stdlib.h>
+#include <com/Debug.h>
+#include <pub/Worker.h>             // For pub::WorkerPool
+
+#include "Highway.h"
+
+//----------------------------------------------------------------------------
+// Constants
+//----------------------------------------------------------------------------
+static const double    SECONDS_PER_HOUR= 3600; // Number of seconds per hour
+static const double    CAR_LENGTH= 0.005; // Minimum following distance (miles)
+static const double    SAFE_GAP= 0.010; // Minimum lane change gap (miles)
+static const double    EPSILON= 0.01; // Allowed error delta
+static const double    INFINITE= 1.0e300; // No limit
+
+static const size_t    SORT_MIN= 16; // Arrivals needing std::stable_sort
+
+//----------------------------------------------------------------------------
+//
+// Struct-
+//       Arrival
+//
+// Purpose-
+//       A Vehicle entering a Lane during commit.
+//
+//----------------------------------------------------------------------------
+struct Arrival {                    // A Vehicle entering a Lane
+double                 pos;         // New position
+double                 vel;         // New velocity
+const Highway::Fields* from;        // Source Fields
+size_t                 index;       // Source index
+}; // struct Arrival
+
+static inline bool                  // TRUE iff L sorts before R
+   isAhead(                         // Compare Arrivals
+     const Arrival&    L,           // Left Arrival
+     const Arrival&    R)           // Right Arrival
+{
+   return L.pos > R.pos;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Highway::Fields::append
+//
+// Purpose-
+//       Append a Vehicle.
+//
+//----------------------------------------------------------------------------
+void
+   Highway::Fields::append(         // Append a Vehicle
+     const Fields&     from,        // From these Fields
+     size_t            index,       // At this index
+     double            pos,         // Using this position
+     double            vel)         // And this velocity
+{
+   this->pos.push_back(pos);
+   this->vel.push_back(vel);
+   desire.push_back(from.desire[index]);
+   exit.push_back(from.exit[index]);
+   passes.push_back(from.passes[index]);
+   passed.push_back(from.passed[index]);
+   changes.push_back(from.changes[index]);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Highway::Fields::clear
+//
+// Purpose-
+//       Remove all Vehicles.
+//
+//----------------------------------------------------------------------------
+void
+   Highway::Fields::clear( void )   // Remove all Vehicles
+{
+   pos.clear();
+   vel.clear();
+   desire.clear();
+   exit.clear();
+   passes.clear();
+   passed.clear();
+   changes.clear();
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Highway::~Highway
+//
+// Purpose-
+//       Destructor.
+//
+//----------------------------------------------------------------------------
+   Highway::~Highway( void )        // Destructor
+{
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Highway::Highway
+//
+// Purpose-
+//       Constructor.
+//
+//----------------------------------------------------------------------------
+   Highway::Highway(                // Constructor
+     int               segments,    // Number of Segments
+     int               lanes,       // Number of Lanes per Segment
+     double            length,      // Segment length
+     unsigned          threads)     // Number of Threads (0: hardware)
+:  segments(segments)
+,  lanes(lanes)
+,  length(length)
+,  lane(segments * lanes)
+,  threads(threads)
+,  counter(0)
+,  time(0.0)
+,  updates(0)
+{
+   if( this->threads == 0 )
+     this->threads= std::thread::hardware_concurrency();
+   if( this->threads == 0 )
+     this->threads= 1;
+
+   for(size_t i= 0; i<lane.size(); i++)
+   {
+     lane[i].reach= 0.0;
+     lane[i].fast= false;
+     lane[i].exits= 0;
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Highway::getCount
+//
+// Purpose-
+//       Get the number of Vehicles.
+//
+//----------------------------------------------------------------------------
+size_t                              // The number of Vehicles
+   Highway::getCount( void ) const  // Get number of Vehicles
+{
+   size_t result= 0;
+   for(size_t i= 0; i<lane.size(); i++)
+     result += lane[i].cur.size() + lane[i].out[(counter - 1) & 1].size();
+
+   return result;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Highway::getExits
+//
+// Purpose-
+//       Get the number of exited Vehicles.
+//
+//----------------------------------------------------------------------------
+uint64_t                            // The number of exited Vehicles
+   Highway::getExits( void ) const  // Get number of exited Vehicles
+{
+   uint64_t result= 0;
+   for(size_t i= 0; i<lane.size(); i++)
+     result += lane[i].exits;
+
+   return result;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Highway::getThreads
+//
+// Purpose-
+//       Get the number of Threads.
+//
+//----------------------------------------------------------------------------
+unsigned                            // The number of Threads
+   Highway::getThreads( void ) const// Get number of Threads
+{
+   return threads;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Highway::check
+//
+// Purpose-
+//       Debugging check
+//
+//----------------------------------------------------------------------------
+void
+   Highway::check( void ) const     // Debugging check
+{
+   int errorCount= 0;
+   for(int s= 0; s<segments; s++)
+   {
+     for(int x= 0; x<lanes; x++)
+     {
+       const Fields& F= getLane(s, x).cur;
+       for(size_t i= 0; i<F.size(); i++)
+       {
+         if( F.pos[i] < s * length - EPSILON
+             || F.pos[i] > (s + 1) * length + EPSILON
+             || (i > 0 && (F.pos[i] - F.pos[i-1]) > EPSILON) )
+         {
+           debugf("Highway(%p)::check() [%d,%d][%zd] %10.4f\n", this,
+                  s, x, i, F.pos[i]);
+           errorCount++;
+         }
+       }
+     }
+   }
+
+   if( errorCount )
+     throw "Highway::check";
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Highway::insert
+//
+// Purpose-
+//       Add a Vehicle.
+//
+//----------------------------------------------------------------------------
+void
+   Highway::insert(                 // Add a Vehicle
+     int               segment,     // Segment index
+     int               index,       // Lane index
+     double            pos,         // Position (mile marker)
+     double            vel,         // Desired velocity
+     double            exit)        // Exit mile marker
+{
+   Fields& F= lane[segment * lanes + index].cur;
+
+   // Find the first Vehicle behind pos
+   size_t x= std::upper_bound(F.pos.begin(), F.pos.end(), pos,
+                              std::greater<double>()) - F.pos.begin();
+
+   F.pos.insert(F.pos.begin() + x, pos);
+   F.vel.insert(F.vel.begin() + x, vel);
+   F.desire.insert(F.desire.begin() + x, vel);
+   F.exit.insert(F.exit.begin() + x, exit);
+   F.passes.insert(F.passes.begin() + x, 0);
+   F.passed.insert(F.passed.begin() + x, 0);
+   F.changes.insert(F.changes.begin() + x, 0);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Highway::interval
+//
+// Purpose-
+//       Process Highway interval
+//
+//----------------------------------------------------------------------------
+void
+   Highway::interval(               // Process Highway interval
+     double            deltaT)      // Of this length
+{
+   int const tasks= segments * lanes;
+
+   for(int i= 0; i<tasks; i++)
+     updates += lane[i].cur.size();
+
+   run(&Highway::prepare, deltaT);
+   run(&Highway::count, deltaT);
+   run(&Highway::commit, deltaT);
+
+   for(int i= 0; i<tasks; i++)
+   {
+     Lane& L= lane[i];
+     if( L.fast )                   // If updated in place
+     {
+       std::swap(L.cur.pos, L.newPos);
+       std::swap(L.cur.vel, L.newVel);
+     }
+     else
+       std::swap(L.cur, L.next);
+   }
+
+   counter++;
+   time += deltaT;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Highway::prepare
+//
+// Purpose-
+//       Prepare phase: Determine each Vehicle's new position and Lane.
+//
+// Notes-
+//       Only this Lane is updated. The adjacent Lane is read.
+//
+//----------------------------------------------------------------------------
+void
+   Highway::prepare(                // Prepare phase
+     int               task,        // Lane task index
+     double            deltaT)      // Interval (in seconds)
+{
+   Lane&               L= lane[task];
+   Fields&             F= L.cur;
+   size_t const        n= F.size();
+   double const        hours= deltaT / SECONDS_PER_HOUR;
+   double const        perHour= SECONDS_PER_HOUR / deltaT;
+
+   L.newPos.resize(n);
+   L.newVel.resize(n);
+   L.move.resize(n);
+   L.movers.clear();
+
+   // The adjacent Lane, if any
+   int const dir= (counter & 1) ? +1 : -1;
+   int const x= task % lanes + dir;
+   const Fields* N= NULL;
+   if( x >= 0 && x < lanes )
+     N= &lane[task + dir].cur;
+
+   bool   front= false;             // Is there a Vehicle ahead?
+   double frontPos= 0.0;            // Its new position
+   double reach= 0.0;               // Largest position change
+   size_t j= 0;                     // First adjacent Vehicle behind p
+   for(size_t i= 0; i<n; i++)
+   {
+     double const p= F.pos[i];
+     double np= p + F.desire[i] * hours;
+     signed char mv= 0;
+
+     if( front && np > frontPos - CAR_LENGTH ) // If blocked
+     {
+       double const limit= std::max(p, frontPos - CAR_LENGTH);
+
+       // Is there room in the adjacent Lane?
+       double room= -INFINITE;
+       if( N != NULL )
+       {
+         while( j < N->size() && N->pos[j] >= p ) // (p is non-increasing)
+           j++;
+         bool ahead= (j == 0 || N->pos[j-1] - p >= SAFE_GAP);
+         bool behind= (j == N->size() || p - N->pos[j] >= SAFE_GAP);
+         if( ahead && behind )
+         {
+           room= INFINITE;
+           if( j > 0 )
+             room= N->pos[j-1] + N->vel[j-1] * hours - CAR_LENGTH;
+         }
+       }
+
+       if( room > limit + CAR_LENGTH )
+       {
+         mv= dir;
+         np= std::max(p, std::min(np, room));
+         F.changes[i]++;
+         L.movers.push_back(i);
+       }
+       else
+         np= limit;
+     }
+
+     L.newPos[i]= np;
+     L.newVel[i]= (np - p) * perHour;
+     L.move[i]= mv;
+     reach= std::max(reach, np - p);
+     if( mv == 0 )
+     {
+       front= true;
+       frontPos= np;
+     }
+   }
+
+   L.reach= reach;
+
+   // The staying Vehicles' new positions are in order. (See count.)
+   L.stayPos.clear();
+   L.stayNew.clear();
+   if( !L.movers.empty() )
+   {
+     for(size_t i= 0; i<n; i++)
+     {
+       if( L.move[i] == 0 )
+       {
+         L.stayPos.push_back(F.pos[i]);
+         L.stayNew.push_back(L.newPos[i]);
+       }
+     }
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Highway::count
+//
+// Purpose-
+//       Count phase: Count the passes made by this Lane's Vehicles.
+//
+// Notes-
+//       Each Vehicle is compared with the Vehicles in its own and adjacent
+//       Lanes. It passes a Vehicle ahead of it that ends up behind it, and
+//       it's passed by a Vehicle behind it that ends up ahead of it.
+//
+//       Vehicles that remain in a Lane keep their order, so if no Vehicle
+//       leaves this Lane, it isn't checked.
+//
+//       Vehicles in the prior Segment's out arrays are not counted.
+//
+// Implementation notes-
+//       No Vehicle moves backward, and a Lane's staying Vehicles keep
+//       their order. For those Vehicles, the ones ahead of pos and the ones
+//       ahead of newPos are both leading subsequences, so only their
+//       lengths need be found. A cursor finds the first, and the second is
+//       almost always the same. The (few) Lane changing Vehicles are
+//       checked individually.
+//
+//----------------------------------------------------------------------------
+void
+   Highway::count(                  // Count phase
+     int               task,        // Lane task index
+     double)                        // Interval (in seconds)
+{
+   Lane&               L= lane[task];
+   Fields&             F= L.cur;
+   size_t const        n= F.size();
+   int const           first= task - task % lanes;
+
+   for(int x= std::max(first, task - 1);
+       x <= std::min(first + lanes - 1, task + 1); x++)
+   {
+     if( x == task && L.movers.empty() ) // (No Vehicle leaves this Lane)
+       continue;
+
+     // The staying Vehicles' positions and new positions
+     const Lane&       B= lane[x];
+     const double*     P= B.cur.pos.data();
+     const double*     Q= B.newPos.data();
+     size_t            m= B.cur.size();
+     if( !B.movers.empty() )
+     {
+       P= B.stayPos.data();
+       Q= B.stayNew.data();
+       m= B.stayPos.size();
+     }
+
+     size_t a= 0;                   // Number ahead of pos
+     for(size_t i= 0; i<n; i++)
+     {
+       double const pos= F.pos[i];
+       double const newPos= L.newPos[i];
+       while( a < m && P[a] > pos )
+         a++;
+
+       size_t b= a;                 // Number at or ahead of newPos
+       while( b > 0 && Q[b-1] < newPos )
+         b--;
+       while( b < m && Q[b] >= newPos )
+         b++;
+
+       if( a > b )                  // Passed by this Vehicle
+         F.passes[i] += int(a - b);
+       else if( b > a )             // Passing this Vehicle
+       {
+         size_t at= a;              // (Skip any Vehicle at pos)
+         while( at < b && P[at] == pos )
+           at++;
+         size_t by= b;              // (Skip any Vehicle at newPos)
+         while( by > at && Q[by-1] == newPos )
+           by--;
+         F.passed[i] += int(by - at);
+       }
+
+       for(size_t k= 0; k<B.movers.size(); k++)
+       {
+         size_t const j= B.movers[k];
+         if( B.cur.pos[j] > pos && B.newPos[j] < newPos )
+           F.passes[i]++;
+         else if( B.cur.pos[j] < pos && B.newPos[j] > newPos )
+           F.passed[i]++;
+       }
+     }
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Highway::commit
+//
+// Purpose-
+//       Commit phase: Build this Lane's next Vehicle arrays.
+//
+// Notes-
+//       Only this Lane is updated. Its adjacent Lane and prior Segment Lane
+//       are read.
+//
+//       If no Vehicle arrives, changes Lanes, leaves the Segment, or exits,
+//       the Lane isn't copied. interval() swaps in its new positions and
+//       velocities.
+//
+//----------------------------------------------------------------------------
+void
+   Highway::commit(                 // Commit phase
+     int               task,        // Lane task index
+     double            deltaT)      // Interval (in seconds)
+{
+   Lane&               L= lane[task];
+   Fields&             F= L.cur;
+   size_t const        n= F.size();
+   double const        hours= deltaT / SECONDS_PER_HOUR;
+   int const           segment= task / lanes;
+   double const        end= (segment + 1) * length;
+   bool const          last= (segment + 1 == segments);
+
+   Fields&             next= L.next;
+   Fields&             out= L.out[counter & 1];
+   next.clear();
+   out.clear();
+   L.fast= false;
+
+   // Collect the arriving Vehicles
+   static thread_local std::vector<Arrival> arrival; // (Storage reused)
+   arrival.clear();
+   int const dir= (counter & 1) ? +1 : -1;
+   int const x= task % lanes - dir;
+   if( x >= 0 && x < lanes && !lane[task - dir].movers.empty() ) // From the adjacent Lane
+   {
+     const Lane& A= lane[task - dir];
+     for(size_t i= 0; i<A.cur.size(); i++)
+     {
+       if( A.move[i] == dir )
+       {
+         Arrival a= {A.newPos[i], A.newVel[i], &A.cur, i};
+         arrival.push_back(a);
+       }
+     }
+   }
+
+   if( segment > 0 )                // From the prior Segment
+   {
+     const Fields& P= lane[task - lanes].out[(counter - 1) & 1];
+     for(size_t i= 0; i<P.size(); i++)
+     {
+       Arrival a= {P.pos[i] + P.vel[i] * hours, P.vel[i], &P, i};
+       arrival.push_back(a);
+     }
+   }
+   if( arrival.size() >= SORT_MIN )
+     std::stable_sort(arrival.begin(), arrival.end(), isAhead);
+   else                             // (Usually none, or nearly sorted)
+   {
+     for(size_t k= 1; k<arrival.size(); k++)
+     {
+       Arrival const item= arrival[k];
+       size_t j= k;
+       for(; j > 0 && isAhead(item, arrival[j-1]); j--)
+         arrival[j]= arrival[j-1];
+       arrival[j]= item;
+     }
+   }
+
+   if( arrival.empty() && L.movers.empty() && (n == 0 || L.newPos[0] < end) )
+   {
+     size_t i= 0;                   // (Any exits?)
+     while( i < n && L.newPos[i] <= F.exit[i] )
+       i++;
+
+     if( i == n )                   // Update in place
+     {
+       L.fast= true;
+       return;
+     }
+   }
+
+   // Merge the remaining and arriving Vehicles
+   size_t i= 0;
+   size_t a= 0;
+   for(;;)
+   {
+     while( i < n && L.move[i] != 0 )
+       i++;
+
+     const Fields* from;
+     size_t index;
+     double pos, vel;
+     if( i < n && (a == arrival.size() || L.newPos[i] >= arrival[a].pos) )
+     {
+       from= &F;
+       index= i;
+       pos= L.newPos[i];
+       vel= L.newVel[i];
+       i++;
+     }
+     else if( a < arrival.size() )
+     {
+       from= arrival[a].from;
+       index= arrival[a].index;
+       pos= arrival[a].pos;
+       vel= arrival[a].vel;
+       a++;
+     }
+     else
+       break;
+
+     if( pos > from->exit[index] )
+       L.exits++;
+     else if( pos >= end )
+     {
+       if( last )
+         L.exits++;
+       else
+       {
+         out.append(*from, index, pos, vel);
+       }
+     }
+     else
+     {
+       next.append(*from, index, pos, vel);
+     }
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Highway::run
+//
+// Purpose-
+//       Run a phase's Lane tasks.
+//
+// Notes-
+//       The calling thread also runs tasks. The others run on (shared)
+//       pub::WorkerPool threads.
+//
+//----------------------------------------------------------------------------
+void
+   Highway::run(                    // Run Lane tasks
+     void (Highway::*phase)(int, double), // This phase method
+     double            deltaT)      // Interval (in seconds)
+{
+   int const tasks= segments * lanes;
+   pub::WorkerPool::parallel(threads, size_t(tasks),
+     [this, phase, deltaT](size_t index)
+     {  (this->*phase)(int(index), deltaT); });
+}
@@ -0,0 +1,220 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       Highway.h
+//
+// Purpose-
+//       Multi-lane, multi-segment traffic engine.
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       A Highway is a chain of equal length Segments, each with the same
+//       number of Lanes. Vehicle state is kept in per-Lane arrays (a
+//       structure of arrays) ordered by descending position, so a Lane is
+//       updated by scanning contiguous memory from its front to its back.
+//
+//       Each interval has three phases, and within a phase every Lane of
+//       every Segment is an independent task:
+//         prepare: Each Vehicle follows the Vehicle ahead of it in its Lane.
+//                  A blocked Vehicle changes to an adjacent Lane if there
+//                  is room. The new positions, velocities, and Lane changes
+//                  are written into the Lane's own arrays; other Lanes'
+//                  positions are only read.
+//         count:   Passes are counted, where every Lane's old and new
+//                  positions can be read. Each Lane only updates the counts
+//                  of its own Vehicles.
+//         commit:  Each Lane builds its next arrays from its own remaining
+//                  Vehicles, the Vehicles that moved into it, and the
+//                  Vehicles that left the prior Segment in the prior
+//                  interval. Vehicles past their exit are removed.
+//       Lane changes alternate direction by interval, so that a Lane only
+//       receives Vehicles from one neighbor each interval.
+//
+//       Most Lanes neither gain nor lose a Vehicle in an interval. The commit
+//       phase doesn't copy such a Lane. Its new positions and velocities
+//       are swapped into place once the phase completes. Vehicles in a Lane
+//       without Lane changes can't pass each other, so only the adjacent
+//       Lanes are checked for their passes.
+//
+//       Lane tasks run on pub::WorkerPool threads. The calling thread also
+//       runs tasks.
+//
+//       Units are those of Vehicle: miles, miles per hour, and seconds.
+//
+//----------------------------------------------------------------------------
+#ifndef HIGHWAY_H_INCLUDED
+#define HIGHWAY_H_INCLUDED
+
+#include <stdint.h>
+#include <vector>
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       Highway
+//
+// Purpose-
+//       Multi-lane, multi-segment traffic engine.
+//
+//----------------------------------------------------------------------------
+class Highway {                     // Multi-lane traffic engine
+//----------------------------------------------------------------------------
+// Highway::Typedefs and enumerations
+//----------------------------------------------------------------------------
+public:
+struct Fields {                     // Vehicle state arrays
+std::vector<double>    pos;         // Position (mile marker)
+std::vector<double>    vel;         // Velocity (mph)
+std::vector<double>    desire;      // Desired velocity (mph)
+std::vector<double>    exit;        // Exit mile marker
+std::vector<int>       passes;      // Number of vehicles passed
+std::vector<int>       passed;      // Number of times passed
+std::vector<int>       changes;     // Number of lane changes
+
+inline size_t                       // The number of Vehicles
+   size( void ) const
+{  return pos.size(); }
+
+void
+   clear( void );                   // Remove all Vehicles
+
+void
+   append(                          // Append a Vehicle
+     const Fields&     from,        // From these Fields
+     size_t            index,       // At this index
+     double            pos,         // Using this position
+     double            vel);        // And this velocity
+}; // struct Fields
+
+struct Lane {                       // Lane descriptor
+Fields                 cur;         // The current Vehicles
+Fields                 next;        // The next Vehicles (commit output)
+Fields                 out[2];      // Vehicles leaving the Segment
+std::vector<double>    newPos;      // (prepare) New position
+std::vector<double>    newVel;      // (prepare) New velocity
+std::vector<signed char>
+                       move;        // (prepare) Lane change (-1, 0, +1)
+double                 reach;       // (prepare) Largest position change
+std::vector<size_t>    movers;      // (prepare) Lane changing Vehicles
+std::vector<double>    stayPos;     // (prepare) Position, if staying
+std::vector<double>    stayNew;     // (prepare) New position, if staying
+bool                   fast;        // (commit) Positions updated in place?
+uint64_t               exits;       // Number of Vehicles exited
+}; // struct Lane
+
+//----------------------------------------------------------------------------
+// Highway::Attributes
+//----------------------------------------------------------------------------
+protected:
+int                    segments;    // Number of Segments
+int                    lanes;       // Number of Lanes per Segment
+double                 length;      // Segment length
+std::vector<Lane>      lane;        // [segments*lanes] Lane array
+unsigned               threads;     // Number of Threads, including caller
+
+uint64_t               counter;     // The interval counter
+double                 time;        // Current time
+uint64_t               updates;     // Number of Vehicle updates
+
+//----------------------------------------------------------------------------
+// Highway::Constructors
+//----------------------------------------------------------------------------
+public:
+virtual
+   ~Highway( void );                // Destructor
+   Highway(                         // Constructor
+     int               segments,    // Number of Segments
+     int               lanes,       // Number of Lanes per Segment
+     double            length,      // Segment length
+     unsigned          threads= 0); // Number of Threads (0: hardware)
+
+private:                            // Bitwise copy is prohibited
+   Highway(const Highway&);         // Disallowed copy constructor
+   Highway& operator=(const Highway&);// Disallowed assignment operator
+
+//----------------------------------------------------------------------------
+// Highway::Accessor methods
+//----------------------------------------------------------------------------
+public:
+inline const Lane&                  // The Lane
+   getLane(                         // Get Lane
+     int               segment,     // Segment index
+     int               index) const // Lane index
+{
+   return lane[segment * lanes + index];
+}
+
+inline double
+   getTime( void ) const            // Get current time
+{
+   return time;
+}
+
+inline uint64_t
+   getUpdates( void ) const         // Get number of Vehicle updates
+{
+   return updates;
+}
+
+size_t                              // The number of Vehicles
+   getCount( void ) const;          // Get number of Vehicles
+
+uint64_t                            // The number of exited Vehicles
+   getExits( void ) const;          // Get number of exited Vehicles
+
+unsigned                            // The number of Threads
+   getThreads( void ) const;        // Get number of Threads
+
+//----------------------------------------------------------------------------
+// Highway::Methods
+//----------------------------------------------------------------------------
+public:
+void
+   check( void ) const;             // Debugging check
+
+void
+   insert(                          // Add a Vehicle
+     int               segment,     // Segment index
+     int               index,       // Lane index
+     double            pos,         // Position (mile marker)
+     double            vel,         // Desired velocity
+     double            exit);       // Exit mile marker
+
+void
+   interval(                        // Process interval
+     double            deltaT);     // Interval (in seconds)
+
+protected:
+void
+   prepare(                         // Prepare phase
+     int               task,        // Lane task index
+     double            deltaT);     // Interval (in seconds)
+
+void
+   count(                           // Count phase
+     int               task,        // Lane task index
+     double            deltaT);     // Interval (in seconds)
+
+void
+   commit(                          // Commit phase
+     int               task,        // Lane task index
+     double            deltaT);     // Interval (in seconds)
+
+void
+   run(                             // Run Lane tasks
+     void (Highway::*phase)(int, double), // This phase method
+     double            deltaT);     // Interval (in seconds)
+}; // class Highway
+
+#endif // HIGHWAY_H_INCLUDED
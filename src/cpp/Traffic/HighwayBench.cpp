@@ -0,0 +1,236 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       HighwayBench.cpp
+//
+// Purpose-
+//       Headless Highway benchmark.
+//
+// Last change date-
+//       2026/10/18
+//
+// Usage-
+//       HighwayBench {segments {lanes {length {density {seconds {threads}}}}}}
+//         segments: The number of Segments              (Default 16)
+//         lanes:    The number of Lanes per Segment     (Default 4)
+//         length:   The Segment length, in miles        (Default 1.0)
+//         density:  Vehicles per mile per Lane          (Default 64)
+//         seconds:  The simulated time, in seconds      (Default 60)
+//         threads:  The number of Threads (0: hardware) (Default 0)
+//
+//       The same Vehicles are also run on a (single lane) Roadway, the
+//       linked list engine, for comparison.
+//
+//----------------------------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <com/Interval.h>
+#include <com/Random.h>
+#include <pub/Worker.h>             // For pub::WorkerPool
+
+#include "Highway.h"
+#include "Roadway.h"
+#include "Vehicle.h"
+
+//----------------------------------------------------------------------------
+// Constants
+//----------------------------------------------------------------------------
+static const double    INTERVAL= (1.0/16.0); // Simulation interval
+static const double    ROADWAY_LIMIT= 65.0; // Speed limit
+static const double    ROADWAY_LANES= 2.0; // Roadway lane count
+
+//----------------------------------------------------------------------------
+// Internal data areas
+//----------------------------------------------------------------------------
+static int             segments= 16; // The number of Segments
+static int             lanes= 4;    // The number of Lanes per Segment
+static double          length= 1.0; // The Segment length
+static double          density= 64.0; // Vehicles per mile per Lane
+static double          seconds= 60.0; // The simulated time
+static unsigned        threads= 0;  // The number of Threads
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       velocity
+//
+// Purpose-
+//       Get random desired velocity.
+//
+//----------------------------------------------------------------------------
+static double                       // Random desired velocity
+   velocity( void )                 // Get desired velocity
+{
+   return ROADWAY_LIMIT + double(Random::standard.get() % 25) - 5.0;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       runHighway
+//
+// Purpose-
+//       Run the Highway benchmark.
+//
+//----------------------------------------------------------------------------
+static void
+   runHighway( void )               // Run the Highway benchmark
+{
+   Highway highway(segments, lanes, length, threads);
+
+   double const total= segments * length;
+   double const space= 1.0 / density;
+   size_t count= 0;
+   for(int x= 0; x<lanes; x++)
+   {
+     for(double pos= 0.0; pos < total; pos += space)
+     {
+       int s= int(pos / length);
+       if( s >= segments )
+         s= segments - 1;
+       highway.insert(s, x, pos, velocity(), total);
+       count++;
+     }
+   }
+   highway.check();
+
+   int const intervals= int(seconds / INTERVAL);
+   Interval interval;
+   interval.start();
+   for(int i= 0; i<intervals; i++)
+     highway.interval(INTERVAL);
+   interval.stop();
+   highway.check();
+
+   uint64_t passes= 0;
+   uint64_t changes= 0;
+   for(int s= 0; s<segments; s++)
+   {
+     for(int x= 0; x<lanes; x++)
+     {
+       const Highway::Fields& F= highway.getLane(s, x).cur;
+       for(size_t i= 0; i<F.size(); i++)
+       {
+         passes += F.passes[i];
+         changes += F.changes[i];
+       }
+     }
+   }
+
+   double const elapsed= interval.toDouble();
+   printf("Highway: %d segments, %d lanes, %zd vehicles, %u threads\n",
+          segments, lanes, count, highway.getThreads());
+   printf("%12d intervals\n", intervals);
+   printf("%12lu updates\n", (unsigned long)highway.getUpdates());
+   printf("%12.3f seconds\n", elapsed);
+   printf("%12.0f updates/second\n", highway.getUpdates() / elapsed);
+   printf("%12lu passes (remaining vehicles)\n", (unsigned long)passes);
+   printf("%12lu lane changes (remaining vehicles)\n", (unsigned long)changes);
+   printf("%12lu exits\n", (unsigned long)highway.getExits());
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       runRoadway
+//
+// Purpose-
+//       Run the Roadway (linked list) benchmark.
+//
+//----------------------------------------------------------------------------
+static void
+   runRoadway( void )               // Run the Roadway benchmark
+{
+   double const total= segments * length;
+   double const POS_ENTRY[]= {0.0};
+   double const POS_EXITS[]= {total};
+   double const POS_LANES[]= {0.0, ROADWAY_LANES, total, ROADWAY_LANES};
+   double const POS_LIMIT[]= {0.0, ROADWAY_LIMIT, total, ROADWAY_LIMIT};
+   Roadway roadway(1, 1, total, POS_ENTRY, POS_EXITS, POS_LANES, POS_LIMIT);
+
+   // Insert by ascending position, so that each insert is at the head
+   double const space= 1.0 / (density * lanes);
+   size_t count= 0;
+   for(double pos= space; pos < total; pos += space)
+   {
+     roadway.insert(new Vehicle(total, 0.0, pos, velocity()));
+     count++;
+   }
+
+   int const intervals= int(seconds / INTERVAL);
+   uint64_t updates= 0;
+   Interval interval;
+   interval.start();
+   for(int i= 0; i<intervals; i++)
+   {
+     for(Vehicle* v= roadway.getVehicle(); v != NULL; v= v->getNext())
+       updates++;
+     roadway.interval(INTERVAL);
+   }
+   interval.stop();
+
+   double const elapsed= interval.toDouble();
+   printf("Roadway: %zd vehicles\n", count);
+   printf("%12d intervals\n", intervals);
+   printf("%12lu updates\n", (unsigned long)updates);
+   printf("%12.3f seconds\n", elapsed);
+   printf("%12.0f updates/second\n", updates / elapsed);
+
+   Vehicle* vehicle= roadway.getVehicle();
+   while( vehicle != NULL )
+   {
+     roadway.remove(vehicle);
+     delete vehicle;
+     vehicle= roadway.getVehicle();
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       main
+//
+// Purpose-
+//       Mainline code.
+//
+//----------------------------------------------------------------------------
+extern int                          // Return code
+   main(                            // Mainline code
+     int               argc,        // Argument count
+     char*             argv[])      // Argument array
+{
+   if( argc > 1 ) segments= atoi(argv[1]);
+   if( argc > 2 ) lanes= atoi(argv[2]);
+   if( argc > 3 ) length= atof(argv[3]);
+   if( argc > 4 ) density= atof(argv[4]);
+   if( argc > 5 ) seconds= atof(argv[5]);
+   if( argc > 6 ) threads= atoi(argv[6]);
+   if( segments < 1 || lanes < 1 || length <= 0.0 || density <= 0.0 )
+   {
+     fprintf(stderr, "HighwayBench {segments {lanes {length {density "
+                     "{seconds {threads}}}}}}\n");
+     return 1;
+   }
+
+   try {
+     runHighway();
+     printf("\n");
+     runRoadway();
+   } catch(const char* X) {
+     fprintf(stderr, "Exception(%s)\n", X);
+     pub::WorkerPool::reset();
+     return 1;
+   }
+
+   pub::WorkerPool::reset();
+   return 0;
+}
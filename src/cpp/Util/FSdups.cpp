@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2010 Frank Eskesen.
+//       Copyright (c) 2010-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,10 +16,18 @@
 //       File system search for duplicates
 //
 // Last change date-
-//       2010/02/01
+//       2026/10/18
 //
 // Usage-
-//       FSdups
+//       FSdups {-c:cache-file} {-v}
+//
+// Implementation notes-
+//       Files of the same size are compared using their SHA-256 digests.
+//       When a cache file is specified, digests of unchanged files are
+//       taken from it rather than recomputed. (See com/HashCache.h)
+//       Files with matching digests are reported as duplicates. With -v,
+//       they are also compared byte by byte, so a duplicate is never
+//       reported because of a digest collision or a stale cache Entry.
 //
 //----------------------------------------------------------------------------
 #include <stdarg.h>
@@ -38,7 +46,9 @@ typedef std::string string;
 #include <com/FileInfo.h>
 #include <com/FileList.h>
 #include <com/FileName.h>
+#include <com/HashCache.h>
 #include <com/List.h>
+#include <com/params.h>
 
 #ifdef _OS_BSD
   #include <netinet/in.h>          // For ntohl, htonl
@@ -109,6 +119,8 @@ static char**          argv;       // Argument array
 RecordList             list;       // The list of Records
 unsigned long          count;      // Number of records
 Record**               array;      // Sorted record array
+HashCache*             cache;      // The digest cache (if any)
+int                    sw_verify;  // Verify digest matches byte by byte?
 
 //----------------------------------------------------------------------------
 //
@@ -251,7 +263,8 @@ static void
           "Duplicate file names are written to stdout\n"
           "\n"
           "Options:\n"
-          "  <None available>\n"
+          "  -c:cache-file\tUse (and update) this SHA-256 digest cache\n"
+          "  -v\t\tVerify digest matches, comparing the files\n"
           , argv[0]);
 
    exit(EXIT_FAILURE);
@@ -278,7 +291,17 @@ static void
      if( *argv[argx] != '-' )       // If not a switch
        break;                       // List of types found
 
-     usage(argc, argv);
+     char* argp= argv[argx] + 1;    // Skip over the switch char
+     if( swname("c:", argp) && argp[2] != '\0' && cache == NULL )
+     {
+       cache= new HashCache(argp + 2);
+       if( !cache->isOpen() )
+         fprintf(stderr, "Cache(%s) unavailable, not used\n", argp + 2);
+     }
+     else if( strcmp("v", argp) == 0 )
+       sw_verify= TRUE;
+     else
+       usage(argc, argv);
    }
 
    if( argx != argc )
@@ -351,6 +374,29 @@ static void
    outHCDM("\n");
 }
 
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       compare
+//
+// Function-
+//       Compare Records, ordering by file size then file name
+//
+//----------------------------------------------------------------------------
+static int                          // Resultant (<0, =0, >0)
+   compare(                         // Compare Records
+     const void*       L,           // -> Record* (left)
+     const void*       R)           // -> Record* (right)
+{
+   Record* lRec= *(Record**)L;
+   Record* rRec= *(Record**)R;
+
+   if( lRec->getFileSize() != rRec->getFileSize() )
+     return lRec->getFileSize() < rRec->getFileSize() ? -1 : 1;
+
+   return strcmp(lRec->fileName, rRec->fileName);
+}
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -366,7 +412,7 @@ static void
    dbLoad(".");                     // Begin with the current directory
 
    RecordLink*         link;        // -> RecordLink
-   unsigned long       i, j;
+   unsigned long       i;
 
    ::count= 0;
    link= list.getTail();
@@ -391,27 +437,7 @@ static void
      }
 
      // Sort the Record* array
-     for(i= 0; i < ::count; i++)
-     {
-       for(j= i+1;j < ::count; j++)
-       {
-         if( array[i]->getFileSize() > array[j]->getFileSize() )
-         {
-           Record* swap= array[i];
-           array[i]= array[j];
-           array[j]= swap;
-         }
-         else if( array[i]->getFileSize() == array[j]->getFileSize() )
-         {
-           if( strcmp(array[i]->fileName, array[j]->fileName) > 0 )
-           {
-             Record* swap= array[i];
-             array[i]= array[j];
-             array[j]= swap;
-           }
-         }
-       }
-     }
+     qsort(array, ::count, sizeof(Record*), compare);
 
      // Display the sorted Record* array
      #ifdef HCDM
@@ -441,34 +467,67 @@ static void
    if( array == NULL )
      return;
 
-   for(unsigned long i= 0; i < ::count; i++)
+   typedef uint8_t Digest[HashCache::DIGEST_SIZE];
+   Digest* digest= (Digest*)malloc(::count * sizeof(Digest));
+   int* valid= (int*)malloc(::count * sizeof(int));
+   if( digest == NULL || valid == NULL )
+     throw "Storage shortage";
+
+   unsigned long next;              // The first Record of the next group
+   for(unsigned long head= 0; head < ::count; head= next)
    {
-     Record* iRec= array[i];
-     if( iRec == NULL )
+     // Locate the group of same size files
+     for(next= head+1; next < ::count; next++)
+     {
+       if( array[head]->getFileSize() != array[next]->getFileSize() )
+         break;
+     }
+     if( next - head < 2 )          // No duplicates possible
        continue;
 
-     outHCDM("%8ld %s\n", iRec->getFileSize(), iRec->fileName);
-     FileData iFile(iRec->fileName);
+     // Digest each file in the group
+     for(unsigned long i= head; i < next; i++)
+     {
+       outHCDM("%8ld %s\n", array[i]->getFileSize(), array[i]->fileName);
+       if( cache != NULL )
+         valid[i]= cache->digest(array[i]->fileName, digest[i]) == 0;
+       else
+         valid[i]= HashCache::getHash(array[i]->fileName, digest[i]) == 0;
+     }
 
-     for(unsigned long j= i+1; j < ::count; j++)
+     // Compare the digests
+     for(unsigned long i= head; i < next; i++)
      {
-       Record* jRec= array[j];
-       if( jRec == NULL )
+       Record* iRec= array[i];
+       if( iRec == NULL || !valid[i] )
          continue;
 
-       outHCDM("..%8ld %s\n", jRec->getFileSize(), jRec->fileName);
-       if( iRec->getFileSize() != jRec->getFileSize() )
-         break;
-
-       // Compare the files
-       FileData jFile(jRec->fileName);
-       if( iFile == jFile )
+       FileData iFile(iRec->fileName); // (Only read if verifying)
+       for(unsigned long j= i+1; j < next; j++)
        {
-         printf("%s == %s\n", iRec->fileName, jRec->fileName);
-         array[j]= NULL;
+         Record* jRec= array[j];
+         if( jRec == NULL || !valid[j] )
+           continue;
+
+         outHCDM("..%8ld %s\n", jRec->getFileSize(), jRec->fileName);
+         if( memcmp(digest[i], digest[j], sizeof(Digest)) == 0 )
+         {
+           if( sw_verify )          // If verifying, compare the files
+           {
+             FileData jFile(jRec->fileName);
+             if( !(iFile == jFile) )
+               continue;
+           }
+
+           printf("%s == %s\n", iRec->fileName, jRec->fileName);
+           array[j]= NULL;
+         }
        }
      }
    }
+
+   free(valid);
+   free(digest);
 }
 
 //----------------------------------------------------------------------------
@@ -504,6 +563,8 @@ int
      std::cerr << "SYSTEM exception" << std::endl;
    }
 
+   delete cache;                    // (Writes the digest cache)
+
    return 0;
 }
 
@@ -0,0 +1,281 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       Cache.cpp
+//
+// Purpose-
+//       Cache implementation.
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#include "Cache.h"                  // For Cache (implemented here)
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Cache::~Cache
+//
+// Purpose-
+//       Destructor.
+//
+//----------------------------------------------------------------------------
+   Cache::~Cache( void )            // Destructor
+{
+   {{{{
+     std::lock_guard<std::mutex> lock(mutex);
+     operational= false;
+     pending.clear();
+   }}}}
+   work_cv.notify_all();
+
+   for(auto& worker : workers)
+     worker.join();
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Cache::Cache
+//
+// Purpose-
+//       Constructor.
+//
+//----------------------------------------------------------------------------
+   Cache::Cache(                    // Constructor
+     size_t            budget,      // The decoded size budget, in bytes
+     unsigned          threads)     // The number of worker threads
+:  budget(budget)
+{
+   for(unsigned i= 0; i<threads; i++)
+     workers.emplace_back(&Cache::work, this);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Cache::get
+//
+// Purpose-
+//       Get decoded Image.
+//
+//----------------------------------------------------------------------------
+Cache::Image_ptr                    // The decoded Image
+   Cache::get(                      // Get decoded Image
+     const std::string&name)        // For this file name
+{
+   std::unique_lock<std::mutex> lock(mutex);
+
+   LRU_map::iterator it= map.find(name);
+   if( it != map.end() ) {          // If cached or being decoded
+     Image_ptr image= *it->second;
+     lru.splice(lru.begin(), lru, it->second); // (Now most recently used)
+     done_cv.wait(lock, [image]{ return image->ready; });
+     return image;
+   }
+
+   // Not present, decode it now
+   Image_ptr image= insert(name);
+   uint32_t width= max_width;
+   uint32_t height= max_height;
+   lock.unlock();
+   int rc= decoder.decode(name.c_str(), width, height);
+   lock.lock();
+   complete(image.get(), decoder, rc);
+   return image;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Cache::prefetch
+//
+// Purpose-
+//       Replace the prefetch list.
+//
+// Implementation notes-
+//       Names are decoded in list order. Names already in the Cache (or being
+//       decoded) are ignored.
+//
+//----------------------------------------------------------------------------
+void
+   Cache::prefetch(                 // Replace the prefetch list
+     const std::vector<std::string>&
+                       names)       // With these file names
+{
+   {{{{
+     std::lock_guard<std::mutex> lock(mutex);
+     pending.clear();
+     for(const std::string& name : names) {
+       if( map.find(name) == map.end() )
+         pending.push_back(name);
+     }
+   }}}}
+   work_cv.notify_all();
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Cache::set_limit
+//
+// Purpose-
+//       Set the decode size limit.
+//
+// Implementation notes-
+//       When the limit changes, the Cache is emptied. (Images being decoded
+//       complete normally, but are not added to the Cache.)
+//
+//----------------------------------------------------------------------------
+void
+   Cache::set_limit(                // Set the decode size limit
+     uint32_t          width,       // Maximum width  (0: no limit)
+     uint32_t          height)      // Maximum height (0: no limit)
+{
+   std::lock_guard<std::mutex> lock(mutex);
+
+   if( width == max_width && height == max_height )
+     return;
+
+   max_width= width;
+   max_height= height;
+   for(Image_ptr& image : lru)
+     image->cached= false;
+   lru.clear();
+   map.clear();
+   pending.clear();
+   used= 0;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Cache::insert
+//
+// Purpose-
+//       Insert a new (not yet decoded) Image. (mutex held)
+//
+//----------------------------------------------------------------------------
+Cache::Image_ptr                    // The new (not ready) Image
+   Cache::insert(                   // Insert a new Image
+     const std::string&name)        // For this file name
+{
+   Image_ptr image= std::make_shared<Image>();
+   image->name= name;
+   image->cached= true;
+   lru.push_front(image);
+   map[name]= lru.begin();
+   return image;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Cache::complete
+//
+// Purpose-
+//       Complete an Image decode. (mutex held)
+//
+// Implementation notes-
+//       The Image takes ownership of the Decoder's buffer.
+//
+//----------------------------------------------------------------------------
+void
+   Cache::complete(                 // Complete an Image decode
+     Image*            image,       // The Image
+     Decoder&          decoder,     // The (completed) Decoder
+     int               rc)          // The Decoder's return code
+{
+   image->rc= rc;
+   if( rc == 0 ) {
+     image->buffer= decoder.buffer;
+     image->width=  decoder.width;
+     image->height= decoder.height;
+     decoder.buffer= nullptr;
+   }
+   image->ready= true;
+
+   if( image->cached ) {
+     used += image->size();
+     trim();
+   }
+   done_cv.notify_all();
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Cache::trim
+//
+// Purpose-
+//       Remove the least recently used Images exceeding the budget.
+//       (mutex held)
+//
+// Implementation notes-
+//       The most recently used Image and Images not yet decoded are kept.
+//
+//----------------------------------------------------------------------------
+void
+   Cache::trim( void )              // Remove Images exceeding the budget
+{
+   LRU_list::iterator it= lru.end();
+   while( used > budget && it != lru.begin() ) {
+     --it;
+     if( it == lru.begin() )        // Keep the most recently used Image
+       break;
+
+     Image_ptr& image= *it;
+     if( !image->ready )            // Keep Images being decoded
+       continue;
+
+     used -= image->size();
+     image->cached= false;
+     map.erase(image->name);
+     it= lru.erase(it);
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       Cache::work
+//
+// Purpose-
+//       Worker thread loop: decode prefetch list Images.
+//
+//----------------------------------------------------------------------------
+void
+   Cache::work( void )              // Worker thread loop
+{
+   JpegDecoder         decoder;     // This worker's decoder
+
+   std::unique_lock<std::mutex> lock(mutex);
+   for(;;) {
+     work_cv.wait(lock, [this]{ return !operational || !pending.empty(); });
+     if( !operational )
+       break;
+
+     std::string name= pending.front();
+     pending.pop_front();
+     if( map.find(name) != map.end() ) // If already present
+       continue;
+
+     Image_ptr image= insert(name);
+     uint32_t width= max_width;
+     uint32_t height= max_height;
+     lock.unlock();
+     int rc= decoder.decode(name.c_str(), width, height);
+     lock.lock();
+     complete(image.get(), decoder, rc);
+   }
+}
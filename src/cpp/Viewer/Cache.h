@@ -0,0 +1,159 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       Cache.h
+//
+// Purpose-
+//       Decoded image cache, with background prefetch.
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       Images are decoded at the limit size (see Decoder::decode) and kept
+//       in least recently used order. When the total decoded size exceeds
+//       the budget, the least recently used Images are removed. (An Image
+//       remains valid while any Image_ptr refers to it.)
+//
+//       prefetch() replaces the list of Images waiting to be decoded by the
+//       worker threads. get() returns an Image, waiting for it if a worker
+//       is already decoding it, or decoding it immediately if not.
+//
+//       get() must only be used by one (the display) thread.
+//
+//----------------------------------------------------------------------------
+#ifndef CACHE_H_INCLUDED
+#define CACHE_H_INCLUDED
+
+#include <condition_variable>       // For std::condition_variable
+#include <deque>                    // For std::deque
+#include <list>                     // For std::list
+#include <memory>                   // For std::shared_ptr
+#include <mutex>                    // For std::mutex
+#include <string>                   // For std::string
+#include <thread>                   // For std::thread
+#include <unordered_map>            // For std::unordered_map
+#include <vector>                   // For std::vector
+#include <stdint.h>                 // For uint32_t
+#include <stdlib.h>                 // For free
+
+#include "JpegDecoder.h"            // For JpegDecoder
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       Cache
+//
+// Purpose-
+//       Decoded image cache.
+//
+//----------------------------------------------------------------------------
+class Cache {                       // Decoded image cache
+//----------------------------------------------------------------------------
+// Cache::Image
+//----------------------------------------------------------------------------
+public:
+struct Image {                      // A decoded image
+std::string            name;        // The file name
+uint32_t*              buffer= nullptr; // Image buffer (0x00rrggbb)
+uint32_t               width= 0;    // Image width
+uint32_t               height= 0;   // Image height
+int                    rc= 0;       // Decoder return code (0 OK)
+bool                   ready= false; // TRUE when decoded
+bool                   cached= false; // TRUE while counted in Cache::used
+
+   ~Image( void )                   // Destructor
+{  free(buffer); }
+
+size_t                              // The decoded size, in bytes
+   size( void ) const
+{  return size_t(width) * height * sizeof(uint32_t); }
+}; // struct Image
+
+typedef std::shared_ptr<Image>     Image_ptr;
+
+//----------------------------------------------------------------------------
+// Cache::Attributes
+//----------------------------------------------------------------------------
+protected:
+typedef std::list<Image_ptr>       LRU_list;
+typedef std::unordered_map<std::string, LRU_list::iterator> LRU_map;
+
+std::mutex             mutex;       // Protects everything below
+std::condition_variable
+                       work_cv;     // Signals pending work (or shutdown)
+std::condition_variable
+                       done_cv;     // Signals Image decode completion
+
+LRU_list               lru;         // The Images, most recently used first
+LRU_map                map;         // The Images, by name
+std::deque<std::string>
+                       pending;     // The prefetch list
+std::vector<std::thread>
+                       workers;     // The worker threads
+
+JpegDecoder            decoder;     // The get() decoder
+size_t                 budget;      // The decoded size budget, in bytes
+size_t                 used= 0;     // The decoded size, in bytes
+uint32_t               max_width= 0; // Decode width limit
+uint32_t               max_height= 0; // Decode height limit
+bool                   operational= true; // TRUE until destroyed
+
+//----------------------------------------------------------------------------
+// Cache::Constructors
+//----------------------------------------------------------------------------
+public:
+   ~Cache( void );                  // Destructor
+   Cache(                           // Constructor
+     size_t            budget,      // The decoded size budget, in bytes
+     unsigned          threads);    // The number of worker threads
+
+private:                            // Bitwise copy is prohibited
+   Cache(const Cache&) = delete;    // Disallowed copy constructor
+Cache& operator=(const Cache&) = delete; // Disallowed assignment operator
+
+//----------------------------------------------------------------------------
+// Cache::Methods
+//----------------------------------------------------------------------------
+public:
+Image_ptr                           // The decoded Image
+   get(                             // Get decoded Image
+     const std::string&name);       // For this file name
+
+void
+   prefetch(                        // Replace the prefetch list
+     const std::vector<std::string>&
+                       names);      // With these file names
+
+void
+   set_limit(                       // Set the decode size limit
+     uint32_t          width,       // Maximum width  (0: no limit)
+     uint32_t          height);     // Maximum height (0: no limit)
+
+protected:
+Image_ptr                           // The new (not ready) Image
+   insert(                          // Insert a new Image
+     const std::string&name);       // For this file name
+
+void
+   complete(                        // Complete an Image decode
+     Image*            image,       // The Image
+     Decoder&          decoder,     // The (completed) Decoder
+     int               rc);         // The Decoder's return code
+
+void
+   trim( void );                    // Remove Images exceeding the budget
+
+void
+   work( void );                    // Worker thread loop
+}; // class Cache
+#endif // CACHE_H_INCLUDED
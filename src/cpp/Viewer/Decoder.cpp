@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007-2021 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Decoder implementation.
 //
 // Last change date-
-//       2021/01/28
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <stdlib.h>
@@ -63,8 +63,11 @@
 //----------------------------------------------------------------------------
 int                                 // Return code (0 OK)
    Decoder::decode(                 // Decode a file
-     const char*       name)        // File name
+     const char*       name,        // File name
+     uint32_t          max_width,   // Maximum width  (0: no limit)
+     uint32_t          max_height)  // Maximum height (0: no limit)
 {
-   (void)name; return (-1);         // Need derived class
+   (void)name; (void)max_width; (void)max_height;
+   return (-1);                     // Need derived class
 }
 
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007-2021 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,15 @@
 //       Decoder base class.
 //
 // Last change date-
-//       2021/01/28
+//       2026/10/18
+//
+// Implementation notes-
+//       When a maximum width and height are specified, the decoder may
+//       reduce the image so that it fits within them. (It never enlarges.)
+//       The image width and height are then the reduced values.
+//
+//       The buffer may be taken by the caller, who then becomes responsible
+//       for free()ing it. The caller then sets buffer to nullptr.
 //
 //----------------------------------------------------------------------------
 #ifndef DECODER_H_INCLUDED
@@ -52,7 +60,9 @@ private:                            // Bitwise copy is prohibited
 public:
 virtual int                         // Return code (0 OK)
    decode(                          // Decode a file
-     const char*       name);       // File name
+     const char*       name,        // File name
+     uint32_t          max_width= 0, // Maximum width  (0: no limit)
+     uint32_t          max_height= 0); // Maximum height (0: no limit)
 
 //----------------------------------------------------------------------------
 // Decoder::Attributes
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007-2021 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,12 +16,21 @@
 //       JpegDecoder implementation.
 //
 // Last change date-
-//       2021/01/28
+//       2026/10/18
+//
+// Implementation notes-
+//       Reduced images use libjpeg's DCT scaling, so the reduction costs less
+//       than a full decode rather than more. The scale is M/8, using the
+//       largest M (1..8) for which the image fits. (Libraries that don't
+//       support M/8 scaling use their nearest supported scale.) If the image
+//       does not fit even at 1/8 scale, the 1/8 scale image is used.
+//
+//       decode() may be used concurrently by separate JpegDecoder objects.
 //
 //----------------------------------------------------------------------------
 #include <setjmp.h>                 // For jpeg library interface
 #include <stdio.h>                  // For fprintf
-#include <stdlib.h>                 // For standard library (free, exit)
+#include <stdlib.h>                 // For standard library (malloc, free)
 #include <sys/types.h>              // (Needed by jpeglib.h)
 #include <jpeglib.h>                // For jpeg library
 
@@ -113,8 +122,11 @@ my_error_exit (j_common_ptr cinfo)
 //----------------------------------------------------------------------------
 int                                 // Return code (0 OK)
    JpegDecoder::decode(             // Decode a file
-     const char*       fileName)    // File name
+     const char*       fileName,    // File name
+     uint32_t          max_width,   // Maximum width  (0: no limit)
+     uint32_t          max_height)  // Maximum height (0: no limit)
 {
+   enum { ROWS= 4 };                // Maximum rows per read_scanlines
    struct jpeg_decompress_struct
                        cinfo;
    struct my_error_mgr jerr;
@@ -144,6 +156,7 @@ int                                 // Return code (0 OK)
      free(buffer);
      buffer= nullptr;
    }
+   width= height= 0;
 
    //-------------------------------------------------------------------------
    // Decode step 1: allocate and initialize JPEG decompression object
@@ -157,6 +170,11 @@ int                                 // Return code (0 OK)
       */
      jpeg_destroy_decompress(&cinfo);
      fclose(infile);
+     if( buffer ) {
+       free(buffer);
+       buffer= nullptr;
+     }
+     width= height= 0;
      return 2;
    }
 
@@ -181,12 +199,21 @@ int                                 // Return code (0 OK)
    //-------------------------------------------------------------------------
    // Decode step 4: set decompression parameters
    //-------------------------------------------------------------------------
-   width= cinfo.image_width;
-   height= cinfo.image_height;
-   buffer= (uint32_t*)malloc( width * height * sizeof(uint32_t));
-   if( buffer == nullptr ) {
-     fprintf(stderr, "No storage\n");
-     exit(EXIT_FAILURE);
+   cinfo.out_color_space= JCS_RGB;  // (Also converts grayscale)
+   if( max_width && max_height ) {  // If size limited, select DCT scale
+     for(unsigned m= 8; m > 1; m--) {
+       cinfo.scale_num= m;
+       cinfo.scale_denom= 8;
+       jpeg_calc_output_dimensions(&cinfo);
+       if( cinfo.output_width <= max_width
+           && cinfo.output_height <= max_height )
+         break;
+     }
+     if( cinfo.output_width > max_width
+         || cinfo.output_height > max_height ) {
+       cinfo.scale_num= 1;
+       cinfo.scale_denom= 8;
+     }
    }
 
    //-------------------------------------------------------------------------
@@ -197,6 +224,17 @@ int                                 // Return code (0 OK)
     * with the stdio data source.
     */
 
+   width= cinfo.output_width;
+   height= cinfo.output_height;
+   buffer= (uint32_t*)malloc(size_t(width) * height * sizeof(uint32_t));
+   if( buffer == nullptr ) {
+     fprintf(stderr, "%s: No storage\n", fileName);
+     jpeg_destroy_decompress(&cinfo);
+     fclose(infile);
+     width= height= 0;
+     return 3;
+   }
+
    /* We may need to do some setup of our own at this point before reading
     * the data.  After jpeg_start_decompress() we have the correct scaled
     * output image dimensions available, as well as the output colormap
@@ -205,9 +243,9 @@ int                                 // Return code (0 OK)
     */
    /* JSAMPLEs per row in output buffer */
    row_stride = cinfo.output_width * cinfo.output_components;
-   /* Make a one-row-high sample array that will go away when done with image */
+   /* Make a ROWS-high sample array that will go away when done with image */
    outrow = (*cinfo.mem->alloc_sarray)
-                 ((j_common_ptr) &cinfo, JPOOL_IMAGE, row_stride, 1);
+                 ((j_common_ptr) &cinfo, JPOOL_IMAGE, row_stride, ROWS);
 
    //-------------------------------------------------------------------------
    // Decode step 6: operate decompressor
@@ -219,19 +257,19 @@ int                                 // Return code (0 OK)
    uint32_t* pixel= buffer;
    while (cinfo.output_scanline < cinfo.output_height) {
      /* jpeg_read_scanlines expects an array of pointers to scanlines.
-      * Here the array is only one element long, but you could ask for
-      * more than one scanline at a time if that's more convenient.
+      * Reading several rows at once lets the library process complete
+      * row groups (when scaling, a row group can be more than one row.)
       */
-     (void) jpeg_read_scanlines(&cinfo, outrow, 1);
-
-     /* Assume put_scanline_someplace wants a pointer and sample count. */
-//// put_scanline_someplace(outrow[0], row_stride);
-     col= outrow[0];
-     for(unsigned x= 0; x<width; x++)
-     {
-       *pixel= (col[0] << 16) | (col[1] << 8) | col[2];
-       pixel++;
-       col += 3;
+     unsigned rows= jpeg_read_scanlines(&cinfo, outrow, ROWS);
+
+     for(unsigned y= 0; y<rows; y++) {
+       col= outrow[y];
+       for(unsigned x= 0; x<width; x++)
+       {
+         *pixel= (col[0] << 16) | (col[1] << 8) | col[2];
+         pixel++;
+         col += 3;
+       }
      }
    }
 
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007-2021 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       JPEG decoder class.
 //
 // Last change date-
-//       2021/01/28
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef JPEGDECODER_H_INCLUDED
@@ -48,7 +48,9 @@ virtual
 public:
 virtual int                         // Return code (0 OK)
    decode(                          // Decode a file
-     const char*       name);       // File name
+     const char*       name,        // File name
+     uint32_t          max_width= 0, // Maximum width  (0: no limit)
+     uint32_t          max_height= 0); // Maximum height (0: no limit)
 
 //----------------------------------------------------------------------------
 // JpegDecoder::Attributes
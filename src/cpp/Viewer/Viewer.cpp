@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007-2021 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,31 +16,67 @@
 //       Viewer master control.
 //
 // Last change date-
-//       2021/02/09
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <cstdio>
 #include <stdlib.h>
-#include <string.h>                 // For memset
+#include <string.h>                 // For memcpy
+#include <strings.h>                // For strcasecmp
 #include <unistd.h>
+#include <sys/stat.h>               // For stat
 #include <xcb/xcb.h>                // For xcb definitions
 #include <xcb/xproto.h>             // For xcb prototypes
 
 #include <gui/Device.h>             // For gui::Device
 #include <gui/Global.h>             // For gui::get_image_order
+#include <gui/Keysym.h>             // For X11/keysymdef
 #include <gui/Window.h>             // For gui::Window
 #include <pub/Debug.h>              // For Debug, namespace pub::debugging
+#include <pub/Fileman.h>            // For pub::fileman::Path
 
-#include "JpegDecoder.h"            // For JpegDecoder
+#include "Cache.h"                  // For Cache
 #include "Viewer.h"                 // For Viewer (implemented here)
 
 using namespace pub::debugging;     // For debugging subroutines
 
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+enum
+{  CACHE_BUDGET= 256 * 1024 * 1024  // Decoded image cache budget, in bytes
+,  PREFETCH_AHEAD= 3                // Images prefetched in the step direction
+,  PREFETCH_BEHIND= 1               // Images prefetched behind
+,  PREFETCH_THREADS= 4              // Maximum number of prefetch threads
+}; // enum
+
 //----------------------------------------------------------------------------
 // Internal data areas
 //----------------------------------------------------------------------------
 static const int opt_hcdm= false;   // Option: Hard Core Debug Mode
 
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       prefetch_threads
+//
+// Purpose-
+//       Get the number of prefetch threads.
+//
+//----------------------------------------------------------------------------
+static unsigned                     // The number of prefetch threads
+   prefetch_threads( void )         // Get number of prefetch threads
+{
+   unsigned threads= std::thread::hardware_concurrency();
+   if( threads > 1 )                // (Leave one for the display thread)
+     threads--;
+   if( threads < 1 )
+     threads= 1;
+   if( threads > PREFETCH_THREADS )
+     threads= PREFETCH_THREADS;
+   return threads;
+}
+
 //----------------------------------------------------------------------------
 //
 // Class-
@@ -70,17 +106,30 @@ static const int opt_hcdm= false;   // Option: Hard Core Debug Mode
 
    Viewer::Viewer(
      Widget*           widget,      // Our parent Widget
-     const char*       name)        // The Window's name
-:  gui::Window(widget, name)
+     const std::vector<std::string>&
+                       names,       // The image file names
+     uint32_t          width,       // The maximum Window width
+     uint32_t          height)      // The maximum Window height
+:  gui::Window(widget, names.empty() ? nullptr : names[0].c_str())
+,  cache(CACHE_BUDGET, prefetch_threads())
+,  names(names)
 {
    if( opt_hcdm )
      debugh("Tester(%p)::Tester\n", this);
 
-   load(name);                      // Load the file
+   // Images are decoded to fit the screen until the Window is resized
+   cache.set_limit(width, height);
+   for(index= 0; index<names.size(); index++) {
+     if( load(index) == 0 )
+       break;
+   }
+   if( index >= names.size() )      // If none
+     return;
 
-   use_size.width=  decoder.width;
-   use_size.height= decoder.height;
+   use_size.width=  current->width;
+   use_size.height= current->height;
    min_size= use_size;
+   prefetch();
 }
 
 void
@@ -99,6 +148,8 @@ void
    emask |= XCB_EVENT_MASK_STRUCTURE_NOTIFY;
 
    Window::configure();
+   if( current )
+     set_main_name(current->name.c_str());
    flush();
 
    // Create a Graphic Context, not used for much
@@ -118,24 +169,31 @@ void
    if( opt_hcdm )
      debugh("Tester(%p)::draw(%s)\n", this, get_name().c_str());
 
-   ENQUEUE("xcb_image_put", xcb_image_put
-          (c, widget_id, drawGC, &image, 0, 0, 0) );
+   ENQUEUE("xcb_clear_area", xcb_clear_area
+          (c, 0, widget_id, 0, 0, rect.width, rect.height) );
+
+   if( image.base )
+     ENQUEUE("xcb_image_put", xcb_image_put
+            (c, widget_id, drawGC, &image, 0, 0, 0) );
 
    flush();
 }
 
 int                                 // Return code (0 OK)
    Viewer::load(                    // Load a JPEG file
-     const char*       name)        // File name
+     size_t            index)       // The names index
 {
    reset();                         // Reset the Viewer
-   int rc= decoder.decode(name);    // Decode the JPEG file
-   if( rc )
-     return rc;                     // If error, return
+   current= cache.get(names[index]); // Get the decoded Image
+   int rc= current->rc;
+   if( rc ) {                       // If error, return
+     current= nullptr;
+     return rc;
+   }
 
    // Initialize the XCB image
-   image.width= decoder.width;      // Width, in pixels
-   image.height= decoder.height;    // Height, in pixels
+   image.width= current->width;     // Width, in pixels
+   image.height= current->height;   // Height, in pixels
    image.format= XCB_IMAGE_FORMAT_Z_PIXMAP; // Format type
    image.scanline_pad= 32;          // Scanline pad (bits)
    image.depth= 24;                 // Depth (bits)
@@ -144,22 +202,38 @@ int                                 // Return code (0 OK)
    image.plane_mask= 0;             // (Unused here)
    image.byte_order= gui::get_image_order(); // Byte order
    image.bit_order=  XCB_IMAGE_ORDER_MSB_FIRST; // Bit order
-   image.stride= decoder.width * 4; // Bytes per image row
-   image.size= decoder.width * decoder.height * 4; // Size of image (bytes)
+   image.stride= current->width * 4; // Bytes per image row
+   image.size= current->size();     // Size of image (bytes)
    image.base= malloc(image.size);  // Allocated storage
-   image.data= (uint8_t*)decoder.buffer; // The actual image
-   memset(image.base, 0, image.size); // Initialize the allocated storage
+   image.data= (uint8_t*)image.base; // The actual image
 
-   for(unsigned h= 0; h<decoder.height; h++) {
-     uint32_t* pixel= decoder.buffer + h * decoder.width;
-     for(unsigned w= 0; w<decoder.width; w++) {
-       xcb_image_put_pixel(&image, w, h, pixel[w]);
-     }
-   }
+   // The Cache Image is shared, so it's copied rather than converted in
+   // place. Since image.byte_order is the host byte order, the copy is the
+   // same as using xcb_image_put_pixel for each pixel.
+   memcpy(image.base, current->buffer, image.size);
 
    return 0;                        // Alles in ordnung
 }
 
+void
+   Viewer::prefetch( void )         // Prefetch the neighboring images
+{
+   std::vector<std::string> list;   // The prefetch list
+
+   for(int i= 1; i<=PREFETCH_AHEAD; i++) {
+     size_t x= index + i * direction;
+     if( x < names.size() )         // (Also false if index - i < 0)
+       list.push_back(names[x]);
+   }
+   for(int i= 1; i<=PREFETCH_BEHIND; i++) {
+     size_t x= index - i * direction;
+     if( x < names.size() )
+       list.push_back(names[x]);
+   }
+
+   cache.prefetch(list);
+}
+
 void
    Viewer::reset( void )            // Reset the Viewer
 {
@@ -167,6 +241,52 @@ void
    if( image.base ) {
      free(image.base);
      image.base= nullptr;
+     image.data= nullptr;
+   }
+}
+
+void
+   Viewer::step(                    // Display another image
+     int               count)       // Relative to the current index
+{
+   long next= long(index) + count;
+   if( next < 0 )
+     next= 0;
+   if( next >= long(names.size()) )
+     next= long(names.size()) - 1;
+   if( next < 0 || size_t(next) == index )
+     return;
+
+   direction= (count < 0) ? -1 : +1;
+   index= next;
+   if( load(index) )
+     fprintf(stderr, "%s: Not displayable\n", names[index].c_str());
+   set_main_name(names[index].c_str());
+   draw();
+   prefetch();
+}
+
+void
+   Viewer::configure_notify(        // Handle this
+     xcb_configure_notify_event_t* E) // Configure notify event
+{
+   if( opt_hcdm )
+     debugh("Tester(%p)::configure_notify(%d,%d)\n", this
+           , E->width, E->height);
+
+   // (Ignore anything other than a window size change, e.g. window movement)
+   if( rect.width == E->width && rect.height == E->height )
+     return;
+
+   // Decode images to fit the resized Window
+   rect.width=  E->width;
+   rect.height= E->height;
+   cache.set_limit(E->width, E->height);
+   if( current ) {
+     if( load(index) )
+       fprintf(stderr, "%s: Not displayable\n", names[index].c_str());
+     draw();
+     prefetch();
    }
 }
 
@@ -180,8 +300,69 @@ void
    Viewer::key_input(               // Handle this
      xcb_keysym_t      key,         // Key input event
      int               state)       // Alt/Ctl/Shift state mask
-{  (void)key; (void)state;          // Parameters currently unused
-   device->operational= false;      // Any key terminates
+{  (void)state;                     // Parameter currently unused
+
+   switch( key ) {
+     case ' ':                      // Next image
+     case XK_Right:
+     case XK_Down:
+     case XK_Page_Down:
+     case XK_KP_Right:
+     case XK_KP_Down:
+     case XK_KP_Page_Down:
+       step(+1);
+       break;
+
+     case XK_BackSpace:             // Prior image
+     case XK_Left:
+     case XK_Up:
+     case XK_Page_Up:
+     case XK_KP_Left:
+     case XK_KP_Up:
+     case XK_KP_Page_Up:
+       step(-1);
+       break;
+
+     case XK_Home:                  // First image
+     case XK_KP_Home:
+       step(-int(index));
+       break;
+
+     case XK_End:                   // Last image
+     case XK_KP_End:
+       step(int(names.size() - 1 - index));
+       break;
+
+     case 'q':                      // Terminate
+     case 'Q':
+     case XK_Escape:
+       device->operational= false;
+       break;
+
+     default:                       // Other keys are ignored
+       break;
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       is_jpeg
+//
+// Purpose-
+//       Is this a JPEG file name?
+//
+//----------------------------------------------------------------------------
+static bool                         // TRUE if JPEG file name
+   is_jpeg(                         // Is this a JPEG file name?
+     const std::string&name)        // The file name
+{
+   size_t dot= name.rfind('.');
+   if( dot == std::string::npos )
+     return false;
+
+   const char* type= name.c_str() + dot + 1;
+   return strcasecmp(type, "jpg") == 0 || strcasecmp(type, "jpeg") == 0;
 }
 
 //----------------------------------------------------------------------------
@@ -198,12 +379,34 @@ extern int                          // Return code
      int               argc,        // Argument count
      char*             argv[])      // Argument array
 {
-   (void)argc;                      // Unused parameter
    unsigned int        errorCount= 0;
+   std::vector<std::string> names;  // The image file names
+
+   // Each argument is a file or a directory containing JPEG files
+   for(int argx= 1; argx<argc; argx++) {
+     struct stat st;
+     if( stat(argv[argx], &st) == 0 && S_ISDIR(st.st_mode) ) {
+       std::string path= argv[argx];
+       pub::fileman::Path dir(path);
+       for(pub::fileman::File* file= dir.list.get_head(); file;
+           file= file->get_next()) {
+         if( S_ISREG(file->st.st_mode) && is_jpeg(file->name) )
+           names.push_back(path + "/" + file->name);
+       }
+     } else {
+       names.push_back(argv[argx]);
+     }
+   }
+   if( names.empty() ) {
+     fprintf(stderr, "Usage: Viewer {file.jpg | directory} ...\n");
+     return 1;
+   }
+
    gui::Device         device;
-   Viewer              window(&device, argv[1]);
+   Viewer              window(&device, names,
+                              device.geom.width, device.geom.height);
 
-   if( window.decoder.buffer )      // If decoder successful
+   if( window.current )             // If decoder successful
    {
      device.configure();
      device.draw();
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2021 Frank Eskesen.
+//       Copyright (c) 2021-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,17 +16,19 @@
 //       Viewer classes.
 //
 // Last change date-
-//       2021/01/28
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef VIEWER_H_INCLUDED
 #define VIEWER_H_INCLUDED
 
+#include <string>                    // For std::string
+#include <vector>                    // For std::vector
 #include <xcb/xproto.h>              // For xcb prototypes, etc.
 #include <xcb/xcb_image.h>           // For struct xcb_image
 #include <gui/Window.h>              // Viewer base class
 
-#include "JpegDecoder.h"             // Jpeg decoder
+#include "Cache.h"                   // Decoded image cache
 
 //----------------------------------------------------------------------------
 //
@@ -42,7 +44,12 @@ class Viewer : public gui::Window { // Viewer Window
 // Viewer::Attributes
 //----------------------------------------------------------------------------
 public:
-JpegDecoder            decoder;     // Image decoder
+Cache                  cache;       // Decoded image cache
+Cache::Image_ptr       current;     // The displayed Image
+std::vector<std::string>
+                       names;       // The image file names
+size_t                 index= 0;    // The displayed names index
+int                    direction= 1; // The last step direction (+1 or -1)
 
 // XCB fields
 xcb_gcontext_t         drawGC= 0;   // The default graphic context
@@ -55,8 +62,11 @@ public:
 virtual
    ~Viewer( void );                 // Destructor
    Viewer(                          // Constructor
-     Widget*           widget= nullptr, // Our parent Widget
-     const char*       name= nullptr); // The Window's name
+     Widget*           widget,      // Our parent Widget
+     const std::vector<std::string>&
+                       names,       // The image file names
+     uint32_t          width,       // The maximum Window width
+     uint32_t          height);     // The maximum Window height
 
 private:                            // Bitwise copy is prohibited
    Viewer(const Viewer&) = delete;  // Disallowed copy constructor
@@ -74,14 +84,25 @@ virtual void
 
 int                                 // Return code (0 OK)
    load(                            // Load a JPEG file
-     const char*       name);       // File name
+     size_t            index);      // The names index
+
+void
+   prefetch( void );                // Prefetch the neighboring images
 
 void
    reset( void );                   // Reset the Viewer
 
+void
+   step(                            // Display another image
+     int               count);      // Relative to the current index
+
 //----------------------------------------------------------------------------
 // Viewer::Event handlers
 //----------------------------------------------------------------------------
+virtual void
+   configure_notify(                // Handle this
+     xcb_configure_notify_event_t* E) override; // Configure notify event
+
 virtual void
    expose(                          // (Partially) (re)draw this Window
      const
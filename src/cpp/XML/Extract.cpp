@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2012-2018 Frank Eskesen.
+//       Copyright (c) 2012-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Read the diagnostic log, extracting sample data items.
 //
 // Last change date-
-//       2018/01/01
+//       2026/10/18
 //
 // Parameters-
 //       Optional: Name of input file. Default is Extract.inp
@@ -42,8 +42,8 @@ using std::string;
 
 #include <com/Debug.h>
 #include <com/Reader.h>
-#include "com/XmlNode.h"
-#include "com/XmlParser.h"
+#include "com/XmlPull.h"
+#include "com/XmlTree.h"
 
 //----------------------------------------------------------------------------
 // Constant for parameterization
@@ -121,22 +121,22 @@ static void
    if( rc == Reader::RC_EOF )
      throwf("File(%s), missing \"Port opened\" line\n", SOURCE_FILE);
 
-   XmlParser parser;
+   XmlPull pull(reader);            // (Reads the remaining input)
+   XmlTree tree;                    // (Reuses its arena for each <msg>)
    for(;;)
    {
-//   XmlNode* root= XmlNode::parse(reader);
-     XmlNode* root= parser.parse(reader);
+     const XmlTree::Node* root= tree.parse(pull);
      if( root == NULL )
        break;
 
-     if( root->getName() != "msg" )
-       throwf("Root name(%s) not 'msg'", root->getName().c_str());
+     if( strcmp(root->name, "msg") != 0 )
+       throwf("Root name(%s) not 'msg'", root->name);
 
-     const XmlNode* time= root->getChild("time");
+     const XmlTree::Node* time= root->getChild("time");
      if( time != NULL )
      {
-       const XmlNode* channel[10];
-       const XmlNode* sensor= root->getChild("sensor");
+       const XmlTree::Node* channel[10];
+       const XmlTree::Node* sensor= root->getChild("sensor");
 
        int FOUND= FALSE;
        if( sensor != NULL )
@@ -146,7 +146,7 @@ static void
            channel[i]= NULL;
            char buffer[32];
            sprintf(buffer, "ch%d", i+1);
-           const XmlNode* node= root->getChild(buffer);
+           const XmlTree::Node* node= root->getChild(buffer);
            if( node != NULL )
            {
              channel[i]= node->getChild("watts");
@@ -159,21 +159,17 @@ static void
        if( FOUND )
        {
          printf("%s, %s",
-//              time->getText().c_str(), sensor->getText().c_str());
-                parser.getText(time).c_str(), parser.getText(sensor).c_str());
+                tree.getText(time).c_str(), tree.getText(sensor).c_str());
          for(int i= 0; i<10; i++)
          {
            if( channel[i] == NULL )
              printf(", N/A");
            else
-//           printf(", %s", channel[i]->getText().c_str());
-             printf(", %s", parser.getText(channel[i]).c_str());
+             printf(", %s", tree.getText(channel[i]).c_str());
          }
          printf("\n");
        }
      }
-
-//   XmlNode::delTree(root);
    }
 
    reader.close();
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the Lesser GNU
 //       General Public License, version 3.0.
@@ -16,7 +16,20 @@
 //       DarwinPlex base class.
 //
 // Last change date-
-//       2007/01/01
+//       2026/10/18
+//
+// Usage notes-
+//       By default, DarwinUnits are evaluated sequentially by the thread that
+//       calls evaluate(). After setThreads(n) with n > 1, DarwinUnits are
+//       evaluated by a pool of n Threads. This requires that a DarwinUnit's
+//       evaluate() method only update that DarwinUnit. DarwinUnits should use
+//       DarwinPlex::getRandom() rather than a shared Random object. It is
+//       seeded before each evaluation from the seed, the generation, and the
+//       DarwinUnit's index, so results do not depend on the Thread count.
+//
+//       When pipeline is also set, generate() dispatches each new DarwinUnit
+//       for evaluation as soon as it is created. This requires that a
+//       DarwinUnit's evaluation not depend on the other DarwinUnits.
 //
 //----------------------------------------------------------------------------
 #ifndef DARWINPLEX_H_INCLUDED
@@ -26,12 +39,18 @@
 #include "inline.h"
 #endif
 
+#include <stdint.h>
 #include "Random.h"
 
 #ifndef DARWINUNIT_H_INCLUDED
 #include "DarwinUnit.h"
 #endif
 
+//----------------------------------------------------------------------------
+// Forward references
+//----------------------------------------------------------------------------
+class DarwinPool;                   // DarwinPlex evaluation Thread pool
+
 //----------------------------------------------------------------------------
 //
 // Class-
@@ -42,6 +61,7 @@
 //
 //----------------------------------------------------------------------------
 class DarwinPlex {                  // DarwinUnit group
+friend class DarwinPool;            // Uses evaluateUnit()
 //----------------------------------------------------------------------------
 // DarwinPlex::Enumerations and typedefs
 //----------------------------------------------------------------------------
@@ -61,10 +81,14 @@ DarwinUnit**           unit;        // The array of DarwinUnit pointers
 
 Generation             generation;  // The current generation
 unsigned int           mutation;    // The mutation count
+DarwinPool*            pool;        // The evaluation Thread pool
+unsigned char*         dispatched;  // Units dispatched by generate()
 
 public:
 double                 probCull;    // The cull probability
 double                 probMute;    // The mutation probability
+uint64_t               seed;        // The evaluation seed
+int                    pipeline;    // Evaluate new Units in generate()?
 
 //----------------------------------------------------------------------------
 // DarwinPlex::Constructors
@@ -108,6 +132,16 @@ INLINE unsigned int                 // The allocated element index
 INLINE unsigned int                 // The number of used elements
    getUsed( void ) const;           // Get number of used elements
 
+unsigned int                        // The number of evaluation Threads
+   getThreads( void ) const;        // Get number of evaluation Threads
+
+void
+   setThreads(                      // Set number of evaluation Threads
+     unsigned int      threads);    // (1 for sequential evaluation)
+
+static Random&                      // The evaluation Random object
+   getRandom( void );               // Get evaluation Random object
+
 //----------------------------------------------------------------------------
 // DarwinPlex::Virtual methods
 //----------------------------------------------------------------------------
@@ -121,6 +155,11 @@ virtual void
 public:
 void
    generate( void );                // Create a new generation
+
+protected:
+void
+   evaluateUnit(                    // Evaluate one DarwinUnit
+     unsigned int      index);      // The DarwinUnit index
 }; // class DarwinPlex
 
 #if INLINING
@@ -0,0 +1,168 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the Lesser GNU
+//       General Public License, version 3.0.
+//       (See accompanying file LICENSE.LGPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/lgpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       HashCache.h
+//
+// Purpose-
+//       Persistent file checksum cache.
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       The cache is a memory mapped file containing an open addressing
+//       hash table keyed by (device, inode). An Entry is only valid while
+//       the file's size, modification time and change time all match, so
+//       a file that changes is simply rehashed and its Entry replaced.
+//
+//       The cache file is exclusively locked (flock) while open. When the
+//       lock cannot be obtained isOpen() is FALSE and the cache is unused:
+//       fetch() always fails and store() does nothing.
+//
+//       The cache file is marked in use while open. If a process using it
+//       terminates without closing it, the next open discards its content.
+//
+//       Each open begins a new cache session. An Entry records the last
+//       session that used it, and Entries not used during the last
+//       PRUNE_AGE sessions are removed when the cache is closed. Entries for
+//       deleted or renamed files therefore age out of the cache.
+//
+//
+//----------------------------------------------------------------------------
+#ifndef HASHCACHE_H_INCLUDED
+#define HASHCACHE_H_INCLUDED
+
+#include <stdint.h>
+
+#ifndef BARRIER_H_INCLUDED
+#include "Barrier.h"
+#endif
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       HashCache
+//
+// Purpose-
+//       Persistent file checksum cache.
+//
+//----------------------------------------------------------------------------
+class HashCache {                   // Persistent file checksum cache
+//----------------------------------------------------------------------------
+// HashCache::Enumerations and typedefs
+//----------------------------------------------------------------------------
+public:
+enum                                // Generic enum
+{  DIGEST_SIZE= 32                  // The SHA-256 digest length
+,  PRUNE_AGE= 8                     // Unused Entry lifetime, in sessions
+}; // Generic enum
+
+enum FLAG                           // Entry flags
+{  F_KSUM= 0x00000001               // Entry.ksum is valid
+,  F_HASH= 0x00000002               // Entry.hash is valid
+}; // enum FLAG
+
+struct Key {                        // File identifier
+uint64_t               device;      // The file's device
+uint64_t               inode;       // The file's inode
+uint64_t               size;        // The file's size
+uint64_t               mtime;       // The file's modification time (ns)
+uint64_t               ctime;       // The file's change time (ns)
+}; // struct Key
+
+struct Entry {                      // Cache entry
+Key                    key;         // The file identifier
+uint8_t                hash[DIGEST_SIZE]; // The SHA-256 digest
+uint64_t               ksum;        // The (caller defined) 64 bit checksum
+uint32_t               flags;       // Validity flags (FLAG)
+uint32_t               session;     // The last session using this Entry
+}; // struct Entry
+
+struct Header;                      // Cache file header (internal)
+
+//----------------------------------------------------------------------------
+// HashCache::Attributes
+//----------------------------------------------------------------------------
+protected:
+Barrier                barrier;     // Mutual exclusion latch
+int                    handle;      // The cache file handle
+Header*                header;      // The mapped cache file
+uint64_t               length;      // The mapped length
+
+//----------------------------------------------------------------------------
+// HashCache::Constructors
+//----------------------------------------------------------------------------
+public:
+   ~HashCache( void );              // Destructor
+   HashCache(                       // Constructor
+     const char*       fileName);   // The cache file name
+
+private:                            // Bitwise copy prohibited
+   HashCache(const HashCache&);
+HashCache&
+   operator=(const HashCache&);
+
+//----------------------------------------------------------------------------
+// HashCache::Accessors
+//----------------------------------------------------------------------------
+public:
+inline int                          // TRUE iff the cache is usable
+   isOpen( void ) const             // Is the cache usable?
+{  return header != NULL; }
+
+//----------------------------------------------------------------------------
+// HashCache::Methods
+//----------------------------------------------------------------------------
+public:
+static int                          // Return code (0 OK)
+   getKey(                          // Get file identifier
+     const char*       fileName,    // The file name
+     Key&              key);        // (OUTPUT) The file identifier
+
+static int                          // Return code (0 OK)
+   getHash(                         // Compute SHA-256 file digest
+     const char*       fileName,    // The file name
+     uint8_t*          hash);       // (OUTPUT) The digest[DIGEST_SIZE]
+
+int                                 // Return code (0 OK)
+   digest(                          // Get SHA-256 file digest, using cache
+     const char*       fileName,    // The file name
+     uint8_t*          hash);       // (OUTPUT) The digest[DIGEST_SIZE]
+
+int                                 // Return code (0 iff found)
+   fetch(                           // Fetch Entry
+     const Key&        key,         // For this file identifier
+     Entry&            entry);      // (OUTPUT) The cached Entry
+
+void
+   store(                           // Store (merge) Entry
+     const Entry&      entry);      // The Entry to store
+
+void
+   sync( void );                    // Write the cache to disk
+
+protected:
+void
+   close( void );                   // Close the cache file
+
+int                                 // Return code (0 OK)
+   expand( void );                  // Double the table capacity
+
+Entry*                              // -> Entry slot (NULL if table full)
+   locate(                          // Locate Entry slot
+     const Key&        key);        // For this file identifier
+
+void
+   prune( void );                   // Remove aged Entries
+}; // class HashCache
+
+#endif // HASHCACHE_H_INCLUDED
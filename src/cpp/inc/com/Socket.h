@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007-2020 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the Lesser GNU
 //       General Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Socket descriptor.
 //
 // Last change date-
-//       2020/10/03
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef SOCKET_H_INCLUDED
@@ -96,6 +96,7 @@ enum SocketSO                       // Socket option
 ,  SO_OOBINLINE                     // Leave received OOB data in line (boolean)
 ,  SO_REUSEADDR                     // Allow local address reuse (boolean)
 ,  SO_ACCEPTCONN                    // Socket has had listen() (boolean)
+,  SO_NODELAY                       // Send without coalescing (boolean, TCP)
 
 ,  SO_MAX                           // Number of SocketOption values
 }; // enum SocketSO
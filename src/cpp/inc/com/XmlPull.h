@@ -0,0 +1,206 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the Lesser GNU
+//       General Public License, version 3.0.
+//       (See accompanying file LICENSE.LGPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/lgpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       XmlPull.h
+//
+// Purpose-
+//       Describe the XML pull (streaming) parser.
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       The XmlPull parser has the same XML limitations as the XmlParser.
+//
+//       Input is read in BUFFER_SIZE blocks and scanned in place, so each
+//       event costs no per-character virtual calls and no allocation. The
+//       buffer only grows when a single token (a tag or a text run) does
+//       not fit, so memory use is bounded by the largest token.
+//
+//       Event names and text are Spans that reference the input buffer.
+//       They remain valid only until the next call to next().
+//
+//       A self-contained element <name .../> returns EVENT_ELEM followed by
+//       EVENT_END. Text is not normalized and entities are not replaced.
+//       Attribute values do not include their bounding quotes.
+//
+//----------------------------------------------------------------------------
+#ifndef XMLPULL_H_INCLUDED
+#define XMLPULL_H_INCLUDED
+
+#include <string>
+#include <vector>
+#include <stddef.h>
+
+//----------------------------------------------------------------------------
+// Forward references
+//----------------------------------------------------------------------------
+class Reader;
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       XmlPull
+//
+// Purpose-
+//       The XML pull parser.
+//
+//----------------------------------------------------------------------------
+class XmlPull {                     // The XML pull parser
+//----------------------------------------------------------------------------
+// XmlPull::Typedefs and enumerations
+//----------------------------------------------------------------------------
+public:
+enum EVENT                          // Parser events
+{  EVENT_EOF                        // End of input
+,  EVENT_ELEM                       // Element start  <name ...>
+,  EVENT_END                        // Element end    </name>
+,  EVENT_TEXT                       // Text
+,  EVENT_COMMENT                    // Comment        <!-- ... -->
+,  EVENT_CDATA                      // CData          <![CDATA[ ... ]]>
+,  EVENT_DECL                       // Declarative    <! ... >
+,  EVENT_DESC                       // Descriptive    <? ... ?>
+}; // enum EVENT
+
+enum                                // Generic enum
+{  BUFFER_SIZE= 65536               // The default input buffer size
+}; // enum
+
+struct Span {                       // A (non-terminated) string reference
+const char*            addr;        // The string address
+size_t                 size;        // The string length
+
+bool                                // TRUE if equal
+   operator==(                      // Compare
+     const char*       text) const; // To this ('\0' terminated) string
+
+std::string                         // The string
+   toString( void ) const           // Get string
+{  return std::string(addr, size); }
+}; // struct Span
+
+struct Attr {                       // An attribute
+Span                   name;        // The attribute name
+Span                   value;       // The attribute value
+}; // struct Attr
+
+//----------------------------------------------------------------------------
+// XmlPull::Attributes
+//----------------------------------------------------------------------------
+protected:
+Reader*                reader;      // The Reader, NULL if buffer input
+char*                  buffer;      // The input buffer
+size_t                 length;      // The input buffer length
+size_t                 used;        // The number of buffer bytes used
+size_t                 origin;      // The current token's buffer offset
+size_t                 offset;      // The next token's buffer offset
+
+int                    event;       // The current event
+bool                   empty;       // EVENT_END pending for <name .../>
+Span                   name;        // The current element name
+Span                   text;        // The current event text
+std::vector<Attr>      attrib;      // The current element attributes
+std::vector<std::string>
+                       stack;       // The open element names
+
+//----------------------------------------------------------------------------
+// XmlPull::Constructors
+//----------------------------------------------------------------------------
+public:
+   ~XmlPull( void );                // Destructor
+
+   XmlPull(                         // Constructor
+     Reader&           reader);     // Read from this Reader
+
+   XmlPull(                         // Constructor
+     const char*       addr,        // Parse this buffer
+     size_t            size);       // Of this length
+
+private:                            // Bitwise copy prohibited
+   XmlPull(const XmlPull&);
+XmlPull&
+   operator=(const XmlPull&);
+
+//----------------------------------------------------------------------------
+// XmlPull::Accessors
+//----------------------------------------------------------------------------
+public:
+const Attr&                         // The associated attribute
+   getAttrib(                       // Get associated attribute
+     size_t            index) const // For this attribute index
+{  return attrib[index]; }
+
+size_t                              // The number of attributes
+   getAttribCount( void ) const     // Get number of attributes
+{  return attrib.size(); }
+
+size_t                              // The number of open elements
+   getDepth( void ) const           // Get number of open elements
+{  return stack.size(); }
+
+int                                 // The current event
+   getEvent( void ) const           // Get current event
+{  return event; }
+
+const Span&                         // The current element name
+   getName( void ) const            // Get current element name
+{  return name; }                   // (EVENT_ELEM, EVENT_END)
+
+const Span&                         // The current event text
+   getText( void ) const            // Get current event text
+{  return text; }                   // (All other events)
+
+//----------------------------------------------------------------------------
+// XmlPull::Methods
+//----------------------------------------------------------------------------
+public:
+int                                 // The next event
+   next( void );                    // Get next event
+
+void
+   skip( void );                    // Skip the current element's content
+
+//----------------------------------------------------------------------------
+// XmlPull::Internal methods
+//----------------------------------------------------------------------------
+protected:
+bool                                // TRUE if at least size bytes available
+   ensure(                          // Ensure token bytes are available
+     size_t            size);       // This many, from origin
+
+bool                                // TRUE if data was added
+   fill( void );                    // Add buffer data
+
+size_t                              // Offset from origin, npos if EOF
+   find(                            // Locate a character
+     size_t            from,        // Starting at this offset from origin
+     int               C);          // This character
+
+size_t                              // Offset from origin, npos if EOF
+   find(                            // Locate a string
+     size_t            from,        // Starting at this offset from origin
+     const char*       term);       // This ('\0' terminated) string
+
+int                                 // EVENT_ELEM
+   genElem( void );                 // Handle element start
+
+int                                 // EVENT_END
+   genEnd( void );                  // Handle element end
+
+int                                 // The event
+   genMark(                         // Handle markup
+     int               event,       // With this event type
+     size_t            from,        // Start search at this offset
+     const char*       term);       // Using this terminator
+}; // class XmlPull
+
+#endif // XMLPULL_H_INCLUDED
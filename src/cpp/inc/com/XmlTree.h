@@ -0,0 +1,170 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the Lesser GNU
+//       General Public License, version 3.0.
+//       (See accompanying file LICENSE.LGPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/lgpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       XmlTree.h
+//
+// Purpose-
+//       Describe an arena allocated XML node tree.
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       An XmlTree is built from XmlPull events. All Nodes and their strings
+//       are allocated from a single arena, which is reused by each parse.
+//       Nodes are never individually deleted. They remain valid until the
+//       next parse, reset, or destructor call.
+//
+//       Node types are XmlNode::TYPE values. Text and markup data values
+//       are the same as the XmlParser's, except that attribute values do
+//       not include their bounding quotes.
+//
+//----------------------------------------------------------------------------
+#ifndef XMLTREE_H_INCLUDED
+#define XMLTREE_H_INCLUDED
+
+#include <string>
+#include <vector>
+#include <stddef.h>
+
+#ifndef XMLPARSER_H_INCLUDED
+#include "XmlParser.h"              // For XmlParser, XmlNode::TYPE
+#endif
+
+#ifndef XMLPULL_H_INCLUDED
+#include "XmlPull.h"
+#endif
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       XmlTree
+//
+// Purpose-
+//       An arena allocated XML node tree.
+//
+//----------------------------------------------------------------------------
+class XmlTree {                     // An arena allocated XML node tree
+//----------------------------------------------------------------------------
+// XmlTree::Typedefs and enumerations
+//----------------------------------------------------------------------------
+public:
+enum                                // Generic enum
+{  CHUNK_SIZE= 65536                // The default arena chunk size
+}; // enum
+
+struct Node {                       // An XML tree node
+int                    type;        // The XmlNode::TYPE
+const char*            name;        // The node name
+const char*            data;        // The node value
+Node*                  parent;      // The parent Node
+Node*                  attrib;      // The first attribute Node
+Node*                  child;       // The first child Node
+Node*                  next;        // The next sibling Node
+
+const Node*                         // The first associated attribute
+   getAttrib(                       // Get first associated attribute
+     const char*       name) const; // With this name
+
+const Node*                         // The first associated child
+   getChild(                        // Get first associated child
+     const char*       name) const; // With this name
+}; // struct Node
+
+protected:
+struct Chunk {                      // An arena chunk
+Chunk*                 next;        // The next Chunk
+size_t                 size;        // The data length
+size_t                 used;        // The number of data bytes used
+}; // struct Chunk (Data follows)
+
+//----------------------------------------------------------------------------
+// XmlTree::Attributes
+//----------------------------------------------------------------------------
+protected:
+Chunk*                 head;        // The first arena Chunk
+Chunk*                 chunk;       // The current arena Chunk
+Node*                  root;        // The root element Node
+XmlParser              parser;      // (For entity evaluation)
+std::vector<Node*>     tail;        // The last child Node, by depth
+
+//----------------------------------------------------------------------------
+// XmlTree::Constructors
+//----------------------------------------------------------------------------
+public:
+   ~XmlTree( void );                // Destructor
+   XmlTree( void );                 // Default constructor
+
+private:                            // Bitwise copy prohibited
+   XmlTree(const XmlTree&);
+XmlTree&
+   operator=(const XmlTree&);
+
+//----------------------------------------------------------------------------
+// XmlTree::Accessors
+//----------------------------------------------------------------------------
+public:
+Node*                               // The associated root node
+   getRoot( void ) const            // Get associated root node
+{  return root; }
+
+void
+   setEntity(                       // Set associated entity value
+     const std::string&name,        // For this entity name
+     const char*       value)       // To this value (NULL to remove)
+{  parser.setEntity(name, value); }
+
+//----------------------------------------------------------------------------
+// XmlTree::Methods
+//----------------------------------------------------------------------------
+public:
+std::string                         // Associated text
+   getText(                         // Get normalized text
+     const Node*       node) const; // For this Node
+
+std::string                         // Associated value
+   getValue(                        // Get evaluated value
+     const Node*       node) const; // For this Node
+
+Node*                               // The root node, NULL at end of input
+   parse(                           // Extract next complete node tree
+     XmlPull&          pull);       // From this XmlPull
+
+void
+   reset( void );                   // Reset the XmlTree (Reuse the arena)
+
+//----------------------------------------------------------------------------
+// XmlTree::Internal methods
+//----------------------------------------------------------------------------
+protected:
+void*                               // The allocated storage
+   allocate(                        // Allocate arena storage
+     size_t            size,        // Of this length
+     size_t            align);      // With this alignment
+
+const char*                         // The allocated ('\0' terminated) string
+   allocate(                        // Allocate arena string
+     const XmlPull::Span&
+                       span);       // Containing this Span
+
+Node*                               // The allocated Node
+   allocate(                        // Allocate arena Node
+     int               type,        // With this type
+     const char*       name,        // And this (arena or constant) name
+     const char*       data);       // And this (arena or constant) value
+
+void
+   append(                          // Append a child Node
+     Node*             node);       // The child Node (parent set)
+}; // class XmlTree
+
+#endif // XMLTREE_H_INCLUDED
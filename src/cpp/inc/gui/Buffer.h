@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2021 Frank Eskesen.
+//       Copyright (C) 2021-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the Lesser GNU
 //       General Public License, version 3.0.
@@ -16,7 +16,23 @@
 //       Container for pixel data.
 //
 // Last change date-
-//       2021/02/01
+//       2026/10/18
+//
+// Implementation notes-
+//       Pixels are drawn using MIT-SHM (xcb_shm_put_image) when the X server
+//       supports it and shares our memory, otherwise using xcb_put_image.
+//       The shared memory segment is attached on first use, so the Buffer
+//       need not be associated with a connection when it's constructed.
+//
+//       The X server reads the shared segment asynchronously. Each MIT-SHM
+//       draw is followed by a GetInputFocus request, and its reply (which
+//       the server sends only after it's finished with the put) is awaited
+//       before the next pixel update. The pixel update methods and resize
+//       do this automatically; use sync() before writing pixels directly.
+//
+//       Pixels changed using put_xy are not tracked. Use damage() to mark
+//       the changed rectangle, or use fill(), which does so automatically.
+//       The refresh() method then draws only the damaged area.
 //
 //----------------------------------------------------------------------------
 #ifndef BUFFER_H_INCLUDED
@@ -24,6 +40,7 @@
 
 #include <xcb/xproto.h>             // For xcb_expose_event_t, ...
 #include <xcb/xcb_image.h>          // For xcb_image_t, associated functions
+#include <xcb/shm.h>                // For xcb_shm_seg_t
 
 #include <gui/Types.h>              // For gui::Pixel
 #include <gui/Pixmap.h>             // For gui::Pixmap
@@ -43,11 +60,35 @@ class Buffer {                      // Pixel container
 // gui::Buffer::Attributes
 //----------------------------------------------------------------------------
 public:
+enum SHM_STATE                      // MIT-SHM state
+{  SHM_RESET                        // Not (yet) attached
+,  SHM_ACTIVE                       // Attached, buffer is shared
+,  SHM_FAILED                       // Unavailable, use xcb_put_image
+}; // enum SHM_STATE
+
+struct Damage {                     // The damaged (modified) rectangle
+unsigned               x0= 0;       // Left   (inclusive)
+unsigned               y0= 0;       // Top    (inclusive)
+unsigned               x1= 0;       // Right  (exclusive)
+unsigned               y1= 0;       // Bottom (exclusive)
+}; // struct Damage
+
 Pixel_t*               buffer= nullptr; // The pixel buffer
 unsigned               width= 0;    // Width  (X) size
 unsigned               height= 0;   // Height (Y) length
 
 xcb_image_t            image= {};   // XCB image manipulator
+Damage                 damaged;     // The damaged rectangle
+
+bool                   use_shm= true; // Use MIT-SHM, if available?
+
+protected:
+xcb_connection_t*      shm_conn= nullptr; // The MIT-SHM connection
+xcb_shm_seg_t          shm_seg= 0;  // The MIT-SHM segment
+SHM_STATE              shm_state= SHM_RESET; // The MIT-SHM state
+bool                   shm_pending= false; // MIT-SHM draw in progress?
+xcb_get_input_focus_cookie_t
+                       shm_sync= {}; // The MIT-SHM completion cookie
 
 //----------------------------------------------------------------------------
 // gui::Buffer::Constructor/Destructor/Operators
@@ -76,6 +117,22 @@ void
    clear(                           // Clear the Buffer
      Pixel_t           p);          // Setting all Pixels to this
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       gui::Buffer::damage
+//
+// Purpose-
+//       Add a rectangle to the damaged area
+//
+//----------------------------------------------------------------------------
+void
+   damage(                          // Add to damaged area
+     unsigned          x,           // Left
+     unsigned          y,           // Top
+     unsigned          w,           // Width
+     unsigned          h);          // Height
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -92,6 +149,23 @@ void
      xcb_expose_event_t*
                        event);      // The expose event
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       gui::Buffer::fill
+//
+// Purpose-
+//       Fill a rectangle, adding it to the damaged area
+//
+//----------------------------------------------------------------------------
+void
+   fill(                            // Fill rectangle
+     unsigned          x,           // Left
+     unsigned          y,           // Top
+     unsigned          w,           // Width
+     unsigned          h,           // Height
+     Pixel_t           p);          // Setting all its Pixels to this
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -107,14 +181,32 @@ Pixel_t                             // The Pixel
    get_xy(                          // Get Pixel at location
      unsigned          x,           // X (Width) index  (from left)
      unsigned          y)           // Y (Height) index (from top)
-{  return buffer[y*height + x]; }
+{  return buffer[y*width + x]; }
 
 void
    put_xy(                          // Set Pixel at location
      unsigned          x,           // X (Width) index  (from left)
      unsigned          y,           // Y (Height) index (from top)
      Pixel_t           p)           // The Pixel to set
-{  buffer[y*height + x]= p; }
+{
+   if( shm_pending )                // If the server may be reading
+     sync();
+   buffer[y*width + x]= p;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       gui::Buffer::refresh
+//
+// Purpose-
+//       Draw the damaged area on a Pixmap, then reset it
+//
+//----------------------------------------------------------------------------
+void
+   refresh(                         // Draw the damaged area
+     Pixmap*           pixmap,      // Pixmap (or Window)
+     xcb_gcontext_t    gc);         // The graphic context
 
 //----------------------------------------------------------------------------
 //
@@ -130,6 +222,38 @@ void
      unsigned          x,           // X (Width)
      unsigned          y,           // Y (Height)
      Pixel_t           p= 0);       // Background Pixel
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       gui::Buffer::sync
+//
+// Purpose-
+//       Wait until the X server has finished reading the shared segment
+//
+//----------------------------------------------------------------------------
+void
+   sync( void );                    // Wait for MIT-SHM draw completion
+
+//----------------------------------------------------------------------------
+// gui::Buffer::Internal methods
+//----------------------------------------------------------------------------
+protected:
+void
+   draw(                            // Draw a rectangle
+     Pixmap*           pixmap,      // On this Pixmap (or Window)
+     xcb_gcontext_t    gc,          // Using this graphic context
+     unsigned          x,           // Left
+     unsigned          y,           // Top
+     unsigned          w,           // Width
+     unsigned          h);          // Height
+
+bool                                // TRUE if MIT-SHM is active
+   shm_attach(                      // Attach MIT-SHM segment
+     xcb_connection_t* conn);       // For this connection
+
+void
+   shm_detach( void );              // Detach MIT-SHM segment
 }; // class gui::Buffer
 }  // namespace gui
 #endif // BUFFER_H_INCLUDED
@@ -0,0 +1,179 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the Lesser GNU
+//       General Public License, version 3.0.
+//       (See accompanying file LICENSE.LGPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/lgpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       Coding.h
+//
+// Purpose-
+//       Base64 and yEnc encoding/decoding kernels.
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       These are buffer to buffer kernels, used by the Codec implementations.
+//       They do not allocate storage. The caller provides an output buffer of
+//       at least the documented length. (Vector stores may write, but do not
+//       use, bytes beyond the returned length within that buffer.)
+//
+//       The kernel level (AVX2, SSE4.1 or scalar) is selected at startup
+//       using the CPU's capabilities. set_level cannot raise it beyond that,
+//       and is intended for testing and timing comparisons.
+//
+//       Base64 uses the RFC 2045 alphabet. The encoder adds PAD_CHARs but not
+//       line breaks. The decoder only decodes complete, valid 4 character
+//       groups, leaving line breaks, padding and errors to the caller.
+//
+//       yEnc uses the standard +42 offset, escaping '\0', '\n', '\r' and '='
+//       and also '\t', ' ' and '.' at the beginning or end of a line.
+//
+//----------------------------------------------------------------------------
+#ifndef _LIBPUB_CODING_H_INCLUDED
+#define _LIBPUB_CODING_H_INCLUDED
+
+#include <stddef.h>                 // For size_t
+
+#include "config.h"                 // For _LIBPUB_ macros
+
+_LIBPUB_BEGIN_NAMESPACE_VISIBILITY(default)
+//----------------------------------------------------------------------------
+//
+// Namespace-
+//       coding
+//
+// Purpose-
+//       Base64 and yEnc kernels.
+//
+//----------------------------------------------------------------------------
+namespace coding {
+enum LEVEL                          // Kernel levels
+{  LEVEL_SCALAR                     // Scalar (table driven) kernels
+,  LEVEL_SSE41                      // SSE4.1 kernels
+,  LEVEL_AVX2                       // AVX2 kernels
+}; // enum LEVEL
+
+//----------------------------------------------------------------------------
+// Kernel level controls
+//----------------------------------------------------------------------------
+int                                 // The current LEVEL
+   get_level( void );               // Get current LEVEL
+
+const char*                         // The LEVEL name
+   get_name(                        // Get LEVEL name
+     int               level);      // For this LEVEL
+
+int                                 // The resultant LEVEL
+   set_level(                       // Set the kernel LEVEL
+     int               level);      // (No higher than the CPU supports)
+
+//----------------------------------------------------------------------------
+// Output buffer lengths
+//----------------------------------------------------------------------------
+static inline size_t                // The maximum encoded length
+   base64_length(                   // Get maximum base64_encode length
+     size_t            size)        // For this input length
+{  return (size + 2) / 3 * 4; }
+
+static inline size_t                // The maximum encoded length
+   yenc_length(                     // Get maximum yenc_encode length
+     size_t            size,        // For this input length
+     size_t            line)        // And this line length
+{  return 2 * size + (2 * size) / line + 1; }
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       base64_decode
+//
+// Purpose-
+//       Decode complete, valid Base64 character groups.
+//
+// Implementation notes-
+//       Decoding stops at the first group containing any character not in
+//       the Base64 alphabet (including PAD_CHAR and line breaks) or at the
+//       last complete group. The output buffer length must be at least
+//       (size / 4) * 3.
+//
+//----------------------------------------------------------------------------
+size_t                              // The decoded (output) length
+   base64_decode(                   // Decode Base64 groups
+     const char*       inp,         // The input buffer
+     size_t            size,        // The input length
+     void*             out,         // The output buffer
+     size_t&           used);       // (OUTPUT) The input length decoded
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       base64_encode
+//
+// Purpose-
+//       Encode Base64, including any trailing PAD_CHARs.
+//
+// Implementation notes-
+//       The output buffer length must be at least base64_length(size).
+//
+//----------------------------------------------------------------------------
+size_t                              // The encoded (output) length
+   base64_encode(                   // Encode Base64
+     const void*       inp,         // The input buffer
+     size_t            size,        // The input length
+     char*             out);        // The output buffer
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       yenc_decode
+//
+// Purpose-
+//       Decode yEnc data.
+//
+// Implementation notes-
+//       Line breaks are ignored. An escape sequence may span calls, using the
+//       escape state. Decoding stops at an invalid escape sequence ("=\n",
+//       "=\r" or "=y"), with used indexing the character following the '='
+//       and escape remaining true. The output buffer length must be at least
+//       the input length.
+//
+//----------------------------------------------------------------------------
+size_t                              // The decoded (output) length
+   yenc_decode(                     // Decode yEnc data
+     const char*       inp,         // The input buffer
+     size_t            size,        // The input length
+     void*             out,         // The output buffer
+     size_t&           used,        // (OUTPUT) The input length decoded
+     bool&             escape);     // (IN/OUT) Escape sequence pending
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       yenc_encode
+//
+// Purpose-
+//       Encode yEnc data.
+//
+// Implementation notes-
+//       A '\n' is written whenever the current line length reaches the line
+//       length. (An escape sequence may extend the line by one character.)
+//       A line may span calls, using the column state. The output buffer
+//       length must be at least yenc_length(size, line).
+//
+//----------------------------------------------------------------------------
+size_t                              // The encoded (output) length
+   yenc_encode(                     // Encode yEnc data
+     const void*       inp,         // The input buffer
+     size_t            size,        // The input length
+     char*             out,         // The output buffer
+     size_t&           column,      // (IN/OUT) The current line length
+     size_t            line);       // The line length (at least 2)
+}  // namespace coding
+_LIBPUB_END_NAMESPACE
+#endif // _LIBPUB_CODING_H_INCLUDED
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2018-2024 Frank Eskesen.
+//       Copyright (c) 2018-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the Lesser GNU
 //       General Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Work dispatcher.
 //
 // Last change date-
-//       2024/10/04
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef _LIBPUB_DISPATCH_H_INCLUDED
@@ -65,6 +65,7 @@ public:
 //----------------------------------------------------------------------------
 // Disp::Methods
 //----------------------------------------------------------------------------
+public:
 static void
    debug( void );                    // Debugging display
 
@@ -73,6 +74,8 @@ static void
 //
 // Call this method to cancel a timer workUnit. If cancelled, the associated
 // Item COMPLETES with a completion code of Item::CC_PURGE.
+// Cancelling a delay that already completed (or was already cancelled) has
+// no effect. Both delay() and cancel() run in constant time.
 //----------------------------------------------------------------------------
 static void
    cancel(                          // Cancel delay
@@ -90,6 +93,19 @@ static void*                        // Cancellation token
      double            seconds,     // This many seconds, then
      Item*             item);       // Complete this work Item
 
+//----------------------------------------------------------------------------
+// Disp::delay() (Task version)
+//
+// After the specified number of seconds, the associated Item is enqueued
+// onto the Task rather than completed. If cancelled (or purged), the Item
+// COMPLETES with a completion code of Item::CC_PURGE.
+//----------------------------------------------------------------------------
+static void*                        // Cancellation token
+   delay(                           // Delay for
+     double            seconds,     // This many seconds, then
+     Task*             task,        // Enqueue onto this Task
+     Item*             item);       // This work Item
+
 //----------------------------------------------------------------------------
 // Disp::enqueue()
 //
@@ -119,6 +135,10 @@ static void
 //----------------------------------------------------------------------------
 static void
    shutdown( void );                // Terminate delay processing
+
+private:
+static Timers*                      // The Timers Thread
+   get_timers( void );              // Get (or create) the Timers Thread
 }; // class Disp
 
 //----------------------------------------------------------------------------
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2019-2022 Frank Eskesen.
+//       Copyright (c) 2019-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the Lesser GNU
 //       General Public License, version 3.0.
@@ -16,12 +16,14 @@
 //       Define a Worker used to handle discrete units of work.
 //
 // Last change date-
-//       2022/09/02
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef _LIBPUB_WORKER_H_INCLUDED
 #define _LIBPUB_WORKER_H_INCLUDED
 
+#include <functional>               // For std::function
+#include <stddef.h>                 // For size_t
 #include <pub/bits/pubconfig.h>     // For _LIBPUB_ macros
 
 _LIBPUB_BEGIN_NAMESPACE_VISIBILITY(default)
@@ -53,6 +55,11 @@ virtual void                        // ** OVERRIDE THIS METHOD **
 //       The maximum number of WorkerThreads pooled for later re-use is
 //       implementation defined.
 //
+//       parallel(threads, count, task) invokes task(0) .. task(count-1),
+//       returning when all of them complete. The calling thread also runs
+//       tasks, using at most threads-1 WorkerThreads. Tasks are handed out
+//       one index at a time, so a task may be a block of smaller work items.
+//
 //----------------------------------------------------------------------------
 class WorkerPool {
 //----------------------------------------------------------------------------
@@ -66,6 +73,13 @@ static void
    debug(                            // Debugging display (statistics)
      const char*       info= nullptr); // Caller info (adds detail)
 
+static void
+   parallel(                         // Run tasks in parallel
+     unsigned          threads,      // Using at most this many threads
+     size_t            count,        // The number of tasks
+     const std::function<void(size_t)>&
+                       task);        // The task, given its index
+
 static void
    reset( void );                    // Reset (Empty) the WorkerThread pool
 
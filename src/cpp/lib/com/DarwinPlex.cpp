@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007-2020 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,16 +16,21 @@
 //       DarwinPlex methods.
 //
 // Last change date-
-//       2020/10/03
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
+#include <algorithm>
 #include <assert.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <com/define.h>
+#include <com/Barrier.h>
 #include <com/Debug.h>
 #include <com/Interval.h>
 #include <com/Random.h>
+#include <com/Semaphore.h>
+#include <com/Thread.h>
 
 #include "com/DarwinUnit.h"
 #include "com/DarwinPlex.h"
@@ -45,6 +50,288 @@
 //----------------------------------------------------------------------------
 static Random&         RNG= Random::standard; // Our random number generator
 
+//----------------------------------------------------------------------------
+//
+// Class-
+//       DarwinThread
+//
+// Purpose-
+//       DarwinPlex evaluation Thread.
+//
+//----------------------------------------------------------------------------
+class DarwinThread : public Thread { // DarwinPlex evaluation Thread
+//----------------------------------------------------------------------------
+// DarwinThread::Attributes
+//----------------------------------------------------------------------------
+protected:
+DarwinPool&            pool;        // The associated DarwinPool
+
+//----------------------------------------------------------------------------
+// DarwinThread::Constructors
+//----------------------------------------------------------------------------
+public:
+virtual
+   ~DarwinThread( void ) {}         // Destructor
+   DarwinThread(                    // Constructor
+     DarwinPool&       pool)        // The associated DarwinPool
+:  Thread(), pool(pool) {}
+
+//----------------------------------------------------------------------------
+// DarwinThread::Methods
+//----------------------------------------------------------------------------
+protected:
+virtual long                        // Return code (always 0)
+   run( void );                     // Evaluate dispatched DarwinUnits
+}; // class DarwinThread
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       DarwinPool
+//
+// Purpose-
+//       DarwinPlex evaluation Thread pool.
+//
+// Implementation notes-
+//       DarwinUnit indexes are dispatched onto a ring. Each index posts the
+//       ready Semaphore once and, after evaluation, the done Semaphore once.
+//       The ring is large enough for every DarwinUnit plus one termination
+//       entry (NO_UNIT) for each Thread.
+//
+//----------------------------------------------------------------------------
+class DarwinPool {                  // DarwinPlex evaluation Thread pool
+//----------------------------------------------------------------------------
+// DarwinPool::Enumerations and typedefs
+//----------------------------------------------------------------------------
+public:
+enum { NO_UNIT= 0xffffffff };       // Termination index
+
+//----------------------------------------------------------------------------
+// DarwinPool::Attributes
+//----------------------------------------------------------------------------
+public:
+DarwinPlex&            plex;        // The associated DarwinPlex
+unsigned int           threads;     // The number of Threads
+DarwinThread**         thread;      // The Thread array
+
+Barrier                barrier;     // Protects the ring
+unsigned int           size;        // The number of ring entries
+unsigned int*          ring;        // The dispatch ring
+unsigned int           head;        // The next ring entry to remove
+unsigned int           tail;        // The next ring entry to insert
+unsigned int           active;      // The number of incomplete indexes
+
+Semaphore              ready;       // Posted once for each ring entry
+Semaphore              done;        // Posted once for each evaluation
+
+//----------------------------------------------------------------------------
+// DarwinPool::Constructors
+//----------------------------------------------------------------------------
+public:
+   ~DarwinPool( void );             // Destructor
+   DarwinPool(                      // Constructor
+     DarwinPlex&       plex,        // The associated DarwinPlex
+     unsigned int      threads);    // The number of Threads
+
+private:                            // Bitwise copy is prohibited
+   DarwinPool(const DarwinPool&);   // Disallowed copy constructor
+   DarwinPool& operator=(const DarwinPool&); // Disallowed assignment operator
+
+//----------------------------------------------------------------------------
+// DarwinPool::Methods
+//----------------------------------------------------------------------------
+public:
+void
+   dispatch(                        // Dispatch an evaluation
+     unsigned int      index);      // For this DarwinUnit index
+
+unsigned int                        // The next DarwinUnit index
+   remove( void );                  // Remove the next DarwinUnit index
+
+void
+   wait( void );                    // Wait for all evaluations to complete
+
+void
+   work( void );                    // Evaluate until NO_UNIT is removed
+}; // class DarwinPool
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       DarwinThread::run
+//
+// Purpose-
+//       Evaluate dispatched DarwinUnits.
+//
+//----------------------------------------------------------------------------
+long                                // Return code (always 0)
+   DarwinThread::run( void )        // Evaluate dispatched DarwinUnits
+{
+   pool.work();
+   return 0;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       DarwinPool::~DarwinPool
+//
+// Purpose-
+//       Destructor.
+//
+//----------------------------------------------------------------------------
+   DarwinPool::~DarwinPool( void )  // Destructor
+{
+   unsigned int        i;
+
+   wait();                          // Complete outstanding evaluations
+   for(i= 0; i<threads; i++)        // Terminate the Threads
+     dispatch(NO_UNIT);
+
+   for(i= 0; i<threads; i++)
+   {
+     thread[i]->wait();
+     delete thread[i];
+   }
+
+   delete [] thread;
+   delete [] ring;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       DarwinPool::DarwinPool
+//
+// Purpose-
+//       Constructor.
+//
+//----------------------------------------------------------------------------
+   DarwinPool::DarwinPool(          // Constructor
+     DarwinPlex&       plex,        // The associated DarwinPlex
+     unsigned int      threads)     // The number of Threads
+:  plex(plex)
+,  threads(threads)
+,  thread(NULL)
+,  size(plex.count + threads)
+,  ring(NULL)
+,  head(0)
+,  tail(0)
+,  active(0)
+,  ready(0)
+,  done(0)
+{
+   unsigned int        i;
+
+   barrier.reset();
+   ring= new unsigned int[size];
+   thread= new DarwinThread*[threads];
+   for(i= 0; i<threads; i++)
+   {
+     thread[i]= new DarwinThread(*this);
+     thread[i]->start();
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       DarwinPool::dispatch
+//
+// Purpose-
+//       Dispatch a DarwinUnit evaluation.
+//
+//----------------------------------------------------------------------------
+void
+   DarwinPool::dispatch(            // Dispatch an evaluation
+     unsigned int      index)       // For this DarwinUnit index
+{
+   {{{{
+     AutoBarrier lock(barrier);
+
+     ring[tail]= index;
+     tail= (tail + 1) % size;
+     if( index != NO_UNIT )
+       active++;
+   }}}}
+
+   ready.post();
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       DarwinPool::remove
+//
+// Purpose-
+//       Remove the next DarwinUnit index, waiting if required.
+//
+//----------------------------------------------------------------------------
+unsigned int                        // The next DarwinUnit index
+   DarwinPool::remove( void )       // Remove the next DarwinUnit index
+{
+   unsigned int        index;       // Resultant
+
+   ready.wait();
+
+   AutoBarrier lock(barrier);
+   index= ring[head];
+   head= (head + 1) % size;
+
+   return index;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       DarwinPool::wait
+//
+// Purpose-
+//       Wait for all dispatched evaluations to complete.
+//
+//----------------------------------------------------------------------------
+void
+   DarwinPool::wait( void )         // Wait for all evaluations to complete
+{
+   unsigned int        count;       // The number of incomplete indexes
+
+   {{{{
+     AutoBarrier lock(barrier);
+
+     count= active;
+     active= 0;
+   }}}}
+
+   while( count > 0 )
+   {
+     done.wait();
+     count--;
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       DarwinPool::work
+//
+// Purpose-
+//       Evaluate DarwinUnits until a termination index is removed.
+//
+//----------------------------------------------------------------------------
+void
+   DarwinPool::work( void )         // Evaluate until NO_UNIT is removed
+{
+   for(;;)
+   {
+     unsigned int index= remove();
+     if( index == NO_UNIT )
+       break;
+
+     plex.evaluateUnit(index);
+     done.post();
+   }
+}
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -56,6 +343,8 @@ static Random&         RNG= Random::standard; // Our random number generator
 //----------------------------------------------------------------------------
    DarwinPlex::~DarwinPlex( void )  // Destructor
 {
+   delete pool;
+   delete [] dispatched;
    delete [] unit;
 }
 
@@ -75,8 +364,12 @@ static Random&         RNG= Random::standard; // Our random number generator
 ,  used(0)
 ,  generation(0)
 ,  mutation(0)
+,  pool(NULL)
+,  dispatched(NULL)
 ,  probCull(0.5)
 ,  probMute(0.0)
+,  seed(0)
+,  pipeline(FALSE)
 {
    unsigned int        i;
 
@@ -88,6 +381,119 @@ static Random&         RNG= Random::standard; // Our random number generator
    assert(unit != NULL);
    for(i=0; i<elements; i++)
      unit[i]= NULL;
+
+   dispatched= new unsigned char[elements];
+   memset(dispatched, 0, elements);
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       DarwinPlex::getRandom
+//
+// Purpose-
+//       Get the evaluation Random object.
+//
+// Notes-
+//       Each Thread has its own evaluation Random object.
+//
+//----------------------------------------------------------------------------
+Random&                             // The evaluation Random object
+   DarwinPlex::getRandom( void )    // Get evaluation Random object
+{
+   static thread_local Random random; // The evaluation Random object
+
+   return random;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       DarwinPlex::getThreads
+//
+// Purpose-
+//       Get the number of evaluation Threads.
+//
+//----------------------------------------------------------------------------
+unsigned int                        // The number of evaluation Threads
+   DarwinPlex::getThreads( void ) const // Get number of evaluation Threads
+{
+   if( pool == NULL )
+     return 1;
+
+   return pool->threads;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       DarwinPlex::setThreads
+//
+// Purpose-
+//       Set the number of evaluation Threads.
+//
+//----------------------------------------------------------------------------
+void
+   DarwinPlex::setThreads(          // Set number of evaluation Threads
+     unsigned int      threads)     // (1 for sequential evaluation)
+{
+   #ifdef HCDM
+     debugf("DarwinPlex(%p)::setThreads(%u)\n", this, threads);
+   #endif
+
+   if( threads == getThreads() )
+     return;
+
+   delete pool;                     // (Completes dispatched evaluations)
+   pool= NULL;
+   if( threads > 1 )
+     pool= new DarwinPool(*this, threads);
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       DarwinPlex::evaluateUnit
+//
+// Purpose-
+//       Evaluate one DarwinUnit.
+//
+// Notes-
+//       The evaluation Random object is seeded from the seed, the generation,
+//       and the DarwinUnit index (using the SplitMix64 finalizer.)
+//
+//----------------------------------------------------------------------------
+void
+   DarwinPlex::evaluateUnit(        // Evaluate one DarwinUnit
+     unsigned int      index)       // The DarwinUnit index
+{
+   uint64_t            mix;         // The evaluation seed
+
+   mix= seed + uint64_t(generation) * 0x9e3779b97f4a7c15ULL;
+   mix += uint64_t(index + 1) * 0xd1b54a32d192ed03ULL;
+   mix= (mix ^ (mix >> 30)) * 0xbf58476d1ce4e5b9ULL;
+   mix= (mix ^ (mix >> 27)) * 0x94d049bb133111ebULL;
+   mix= mix ^ (mix >> 31);
+   getRandom().setSeed(mix);
+
+   unit[index]->evaluation= unit[index]->evaluate();
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       isBetter
+//
+// Purpose-
+//       DarwinPlex::evaluate sort comparator.
+//
+//----------------------------------------------------------------------------
+static inline bool                  // TRUE iff L sorts before R
+   isBetter(                        // Compare DarwinUnits
+     const DarwinUnit* L,           // Left DarwinUnit
+     const DarwinUnit* R)           // Right DarwinUnit
+{
+   return L->evaluation > R->evaluation;
 }
 
 //----------------------------------------------------------------------------
@@ -98,13 +504,16 @@ static Random&         RNG= Random::standard; // Our random number generator
 // Purpose-
 //       Evaluate the group
 //
+// Notes-
+//       Units dispatched by generate() have already been evaluated.
+//       The group is sorted by descending evaluation. Units with the same
+//       evaluation remain in index order.
+//
 //----------------------------------------------------------------------------
 void
    DarwinPlex::evaluate( void )     // Evaluate and sort the group
 {
-   DarwinUnit*         ptrUnit;     // -> DarwinUnit
-
-   unsigned int        i, j;
+   unsigned int        i;
 
    #ifdef HCDM
      debugf("DarwinPlex(%p)::evaluate()\n", this);
@@ -113,23 +522,21 @@ void
    // Evaluate the group
    for(i=0; i<used; i++)
    {
-     if( !unit[i]->isValid )
-       unit[i]->evaluation= unit[i]->evaluate();
-   }
-
-   // Sort the group
-   for(i=0; i<used; i++)
-   {
-     for(j=i+1; j<used; j++)
+     if( !unit[i]->isValid && !dispatched[i] )
      {
-       if( unit[j]->evaluation >= unit[i]->evaluation )
-       {
-         ptrUnit= unit[i];
-         unit[i]= unit[j];
-         unit[j]= ptrUnit;
-       }
+       if( pool != NULL )
+         pool->dispatch(i);
+       else
+         evaluateUnit(i);
      }
+     dispatched[i]= FALSE;
    }
+
+   if( pool != NULL )
+     pool->wait();
+
+   // Sort the group
+   std::stable_sort(unit, unit + used, isBetter);
 }
 
 //----------------------------------------------------------------------------
@@ -154,6 +561,9 @@ void
      debugf("DarwinPlex(%p)::generate()\n", this);
    #endif
 
+   if( pool != NULL )               // If evaluations may be in progress
+     pool->wait();                  // Complete them
+
    generation++;                    // Increment the generation
    if( used == 0 )                  // If empty group
      return;                        // Nothing to generate
@@ -199,6 +609,13 @@ void
          unit[i]->mutated= 1;
          mutation++;
        }
+
+       // Evaluate the new element while the next one is generated
+       if( pool != NULL && pipeline )
+       {
+         dispatched[i]= TRUE;
+         pool->dispatch(i);
+       }
        #ifdef HCDM
          debugf(">>[%10lu] [%2d] <= [%2d]+[%2d] %s\n", generation, i, mom, pop,
                 unit[i]->mutated ? "Mutate" : "" );
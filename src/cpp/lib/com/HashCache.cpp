@@ -0,0 +1,610 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the Lesser GNU
+//       General Public License, version 3.0.
+//       (See accompanying file LICENSE.LGPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/lgpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       HashCache.cpp
+//
+// Purpose-
+//       HashCache object methods.
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifndef _OS_WIN
+  #include <sys/file.h>             // For flock
+  #include <sys/mman.h>             // For mmap
+  #include <openssl/evp.h>          // For SHA-256
+#endif
+
+#include <com/Debug.h>
+#include <com/ifmacro.h>
+
+#include "com/HashCache.h"
+
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+#ifndef HCDM
+#undef  HCDM                        // If defined, Hard Core Debug Mode
+#endif
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+#define CACHE_IDENT     "HashCach"  // Cache file identifier
+#define CACHE_VERSION   2           // Cache file version
+#define HEADER_SIZE     64          // Cache file header size
+#define INITIAL_SLOTS   4096        // Initial table capacity (power of 2)
+#define READ_SIZE       0x00100000  // File read buffer size
+
+//----------------------------------------------------------------------------
+//
+// Struct-
+//       HashCache::Header
+//
+// Purpose-
+//       The cache file header, followed by the Entry table.
+//
+//----------------------------------------------------------------------------
+struct HashCache::Header {          // Cache file header
+char                   ident[8];    // CACHE_IDENT
+uint32_t               version;     // CACHE_VERSION
+uint32_t               entrySize;   // sizeof(Entry)
+uint64_t               capacity;    // Number of Entry slots (power of 2)
+uint64_t               used;        // Number of used Entry slots
+uint32_t               inuse;       // TRUE while the cache is open
+uint32_t               session;     // The current session number
+}; // struct HashCache::Header
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       keyHash
+//
+// Purpose-
+//       Hash a (device, inode) pair.
+//
+//----------------------------------------------------------------------------
+static inline uint64_t              // The hash value
+   keyHash(                         // Hash a file identifier
+     const HashCache::Key&
+                       key)         // The file identifier
+{
+   uint64_t h= key.inode ^ (key.device * 0x9E3779B97F4A7C15ULL);
+   h ^= h >> 33;
+   h *= 0xFF51AFD7ED558CCDULL;
+   h ^= h >> 33;
+   h *= 0xC4CEB9FE1A85EC53ULL;
+   h ^= h >> 33;
+
+   return h;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       table
+//
+// Purpose-
+//       Address the Entry table.
+//
+//----------------------------------------------------------------------------
+static inline HashCache::Entry*     // -> Entry table
+   table(                           // Address the Entry table
+     HashCache::Header*
+                       header)      // -> Header
+{
+   return (HashCache::Entry*)((char*)header + HEADER_SIZE);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       HashCache::~HashCache
+//
+// Purpose-
+//       Destructor
+//
+//----------------------------------------------------------------------------
+   HashCache::~HashCache( void )    // Destructor
+{
+   IFHCDM( debugf("HashCache(%p)::~HashCache()\n", this); )
+
+   close();
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       HashCache::HashCache
+//
+// Purpose-
+//       Constructor
+//
+//----------------------------------------------------------------------------
+   HashCache::HashCache(            // Constructor
+     const char*       fileName)    // The cache file name
+:  barrier()
+,  handle(-1)
+,  header(NULL)
+,  length(0)
+{
+   IFHCDM( debugf("HashCache(%p)::HashCache(%s)\n", this, fileName); )
+
+   barrier.reset();
+
+#ifndef _OS_WIN
+   typedef char _static_assert[(sizeof(Header) <= HEADER_SIZE) ? 1 : -1];
+   (void)sizeof(_static_assert);
+
+   handle= open(fileName, O_RDWR | O_CREAT | O_BINARY, 0644);
+   if( handle < 0 )
+     return;
+
+   if( flock(handle, LOCK_EX | LOCK_NB) != 0 ) // If cache already in use
+   {
+     ::close(handle);
+     handle= (-1);
+     return;
+   }
+
+   // Map and validate an existing cache file
+   struct stat info;
+   if( fstat(handle, &info) == 0 && info.st_size > HEADER_SIZE )
+   {
+     length= info.st_size;
+     void* addr= mmap(NULL, length, PROT_READ|PROT_WRITE, MAP_SHARED, handle, 0);
+     if( addr != MAP_FAILED )
+     {
+       header= (Header*)addr;
+       if( memcmp(header->ident, CACHE_IDENT, sizeof(header->ident)) != 0
+           || header->version != CACHE_VERSION
+           || header->entrySize != sizeof(Entry)
+           || header->inuse != 0
+           || header->capacity == 0
+           || (header->capacity & (header->capacity - 1)) != 0
+           || length != HEADER_SIZE + header->capacity * sizeof(Entry) )
+       {
+         munmap(header, length);
+         header= NULL;
+       }
+     }
+   }
+
+   // Initialize a new (or discarded) cache file
+   if( header == NULL )
+   {
+     length= HEADER_SIZE + INITIAL_SLOTS * sizeof(Entry);
+     void* addr= MAP_FAILED;
+     if( ftruncate(handle, 0) == 0 && ftruncate(handle, length) == 0 )
+       addr= mmap(NULL, length, PROT_READ|PROT_WRITE, MAP_SHARED, handle, 0);
+     if( addr == MAP_FAILED )
+     {
+       ::close(handle);
+       handle= (-1);
+       return;
+     }
+
+     header= (Header*)addr;
+     memcpy(header->ident, CACHE_IDENT, sizeof(header->ident));
+     header->version= CACHE_VERSION;
+     header->entrySize= sizeof(Entry);
+     header->capacity= INITIAL_SLOTS;
+     header->used= 0;
+     header->session= 0;
+   }
+
+   header->inuse= true;
+   header->session++;               // Begin a new session
+   msync(header, HEADER_SIZE, MS_SYNC);
+#else
+   (void)fileName;
+#endif
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       HashCache::close
+//
+// Purpose-
+//       Close the cache file.
+//
+//----------------------------------------------------------------------------
+void
+   HashCache::close( void )         // Close the cache file
+{
+#ifndef _OS_WIN
+   if( header != NULL )
+   {
+     prune();                       // Remove aged Entries
+     msync(header, length, MS_SYNC); // Write the table, then mark it closed
+     header->inuse= false;
+     msync(header, HEADER_SIZE, MS_SYNC);
+     munmap(header, length);
+     header= NULL;
+   }
+
+   if( handle >= 0 )
+   {
+     ::close(handle);               // (Also releases the flock)
+     handle= (-1);
+   }
+#endif
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       HashCache::digest
+//
+// Purpose-
+//       Get SHA-256 file digest, using (and updating) the cache.
+//
+//----------------------------------------------------------------------------
+int                                 // Return code (0 OK)
+   HashCache::digest(               // Get SHA-256 file digest, using cache
+     const char*       fileName,    // The file name
+     uint8_t*          hash)        // (OUTPUT) The digest[DIGEST_SIZE]
+{
+   Entry               entry;       // The cache Entry
+
+   if( getKey(fileName, entry.key) != 0 )
+     return (-1);
+
+   if( fetch(entry.key, entry) == 0 && (entry.flags & F_HASH) )
+   {
+     memcpy(hash, entry.hash, DIGEST_SIZE);
+     return 0;
+   }
+
+   if( getHash(fileName, hash) != 0 )
+     return (-1);
+
+   // Only cache the digest if the file did not change while being read
+   Key key;
+   if( getKey(fileName, key) == 0
+       && memcmp(&key, &entry.key, sizeof(key)) == 0 )
+   {
+     memcpy(entry.hash, hash, DIGEST_SIZE);
+     entry.ksum= 0;
+     entry.flags= F_HASH;
+     entry.session= 0;              // (Set by store)
+     store(entry);
+   }
+
+   return 0;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       HashCache::expand
+//
+// Purpose-
+//       Double the table capacity, rehashing all used entries.
+//
+//----------------------------------------------------------------------------
+int                                 // Return code (0 OK)
+   HashCache::expand( void )        // Double the table capacity
+{
+#ifndef _OS_WIN
+   uint64_t capacity= header->capacity;
+   size_t size= capacity * sizeof(Entry);
+   Entry* older= (Entry*)malloc(size);
+   if( older == NULL )
+     return (-1);
+   memcpy(older, table(header), size);
+
+   munmap(header, length);
+   header= NULL;
+
+   length= HEADER_SIZE + 2 * size;
+   void* addr= MAP_FAILED;
+   if( ftruncate(handle, length) == 0 )
+     addr= mmap(NULL, length, PROT_READ|PROT_WRITE, MAP_SHARED, handle, 0);
+   if( addr == MAP_FAILED )         // If failure, the cache is discarded
+   {
+     free(older);
+     ::close(handle);               // (Header.inuse remains set)
+     handle= (-1);
+     return (-1);
+   }
+
+   header= (Header*)addr;
+   header->capacity= 2 * capacity;
+   header->used= 0;
+   memset(table(header), 0, 2 * size);
+   for(uint64_t i= 0; i<capacity; i++)
+   {
+     if( older[i].flags != 0 )
+     {
+       *locate(older[i].key)= older[i];
+       header->used++;
+     }
+   }
+
+   free(older);
+   return 0;
+#else
+   return (-1);
+#endif
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       HashCache::fetch
+//
+// Purpose-
+//       Fetch the current Entry for a file identifier.
+//
+//----------------------------------------------------------------------------
+int                                 // Return code (0 iff found)
+   HashCache::fetch(                // Fetch Entry
+     const Key&        key,         // For this file identifier
+     Entry&            entry)       // (OUTPUT) The cached Entry
+{
+   AutoBarrier lock(barrier);
+
+   if( header == NULL )
+     return (-1);
+
+   Entry* slot= locate(key);
+   if( slot->flags == 0 || memcmp(&slot->key, &key, sizeof(key)) != 0 )
+     return (-1);
+
+   slot->session= header->session;  // (The Entry is in use)
+   entry= *slot;
+   return 0;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       HashCache::getHash
+//
+// Purpose-
+//       Compute the SHA-256 digest of a file.
+//
+//----------------------------------------------------------------------------
+int                                 // Return code (0 OK)
+   HashCache::getHash(              // Compute SHA-256 file digest
+     const char*       fileName,    // The file name
+     uint8_t*          hash)        // (OUTPUT) The digest[DIGEST_SIZE]
+{
+#ifndef _OS_WIN
+   int result= (-1);                // Default, failure
+
+   int hand= open(fileName, O_RDONLY | O_BINARY);
+   if( hand < 0 )
+     return result;
+
+   char* buffer= (char*)malloc(READ_SIZE);
+   EVP_MD_CTX* context= EVP_MD_CTX_new();
+   if( buffer != NULL && context != NULL
+       && EVP_DigestInit_ex(context, EVP_sha256(), NULL) == 1 )
+   {
+     for(;;)
+     {
+       ssize_t L= read(hand, buffer, READ_SIZE);
+       if( L <= 0 )
+       {
+         unsigned int size= DIGEST_SIZE;
+         if( L == 0 && EVP_DigestFinal_ex(context, hash, &size) == 1 )
+           result= 0;
+         break;
+       }
+
+       if( EVP_DigestUpdate(context, buffer, L) != 1 )
+         break;
+     }
+   }
+
+   EVP_MD_CTX_free(context);
+   free(buffer);
+   ::close(hand);
+   return result;
+#else
+   (void)fileName; (void)hash;
+   return (-1);
+#endif
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       HashCache::getKey
+//
+// Purpose-
+//       Get the file identifier.
+//
+//----------------------------------------------------------------------------
+int                                 // Return code (0 OK)
+   HashCache::getKey(               // Get file identifier
+     const char*       fileName,    // The file name
+     Key&              key)         // (OUTPUT) The file identifier
+{
+   struct stat info;
+   if( stat(fileName, &info) != 0 )
+     return (-1);
+
+   key.device= info.st_dev;
+   key.inode=  info.st_ino;
+   key.size=   info.st_size;
+#ifndef _OS_WIN
+   key.mtime=  (uint64_t)info.st_mtim.tv_sec * 1000000000 + info.st_mtim.tv_nsec;
+   key.ctime=  (uint64_t)info.st_ctim.tv_sec * 1000000000 + info.st_ctim.tv_nsec;
+#else
+   key.mtime=  (uint64_t)info.st_mtime * 1000000000;
+   key.ctime=  (uint64_t)info.st_ctime * 1000000000;
+#endif
+
+   return 0;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       HashCache::locate
+//
+// Purpose-
+//       Locate the slot for a (device, inode) pair: either its current
+//       (possibly stale) Entry or the empty slot where it belongs.
+//
+//----------------------------------------------------------------------------
+HashCache::Entry*                   // -> Entry slot
+   HashCache::locate(               // Locate Entry slot
+     const Key&        key)         // For this file identifier
+{
+   Entry* slot= table(header);
+   uint64_t mask= header->capacity - 1;
+   uint64_t index= keyHash(key) & mask;
+
+   // The table is never more than half full, so an empty slot exists
+   for(;;)
+   {
+     Entry* entry= slot + index;
+     if( entry->flags == 0
+         || (entry->key.device == key.device && entry->key.inode == key.inode) )
+       return entry;
+
+     index= (index + 1) & mask;
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       HashCache::prune
+//
+// Purpose-
+//       Remove the Entries not used during the last PRUNE_AGE sessions.
+//
+// Implementation notes-
+//       Removing an Entry from the (linear probing) table would break the
+//       probe chains of the Entries following it, so the remaining Entries
+//       are rehashed.
+//
+//----------------------------------------------------------------------------
+void
+   HashCache::prune( void )         // Remove aged Entries
+{
+   uint64_t capacity= header->capacity;
+   Entry* slot= table(header);
+
+   uint64_t count= 0;               // The number of remaining Entries
+   for(uint64_t i= 0; i<capacity; i++)
+   {
+     if( slot[i].flags != 0 )
+     {
+       if( uint32_t(header->session - slot[i].session) < PRUNE_AGE )
+         count++;
+       else
+         slot[i].flags= 0;
+     }
+   }
+   if( count == header->used )      // If nothing removed
+     return;
+
+   Entry* older= (Entry*)malloc(count * sizeof(Entry) + 1);
+   if( older == NULL )              // If failure, remove everything
+   {
+     memset(slot, 0, capacity * sizeof(Entry));
+     header->used= 0;
+     return;
+   }
+
+   uint64_t index= 0;
+   for(uint64_t i= 0; i<capacity; i++)
+   {
+     if( slot[i].flags != 0 )
+       older[index++]= slot[i];
+   }
+
+   memset(slot, 0, capacity * sizeof(Entry));
+   for(uint64_t i= 0; i<count; i++)
+     *locate(older[i].key)= older[i];
+   header->used= count;
+
+   free(older);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       HashCache::store
+//
+// Purpose-
+//       Store an Entry. If the file's current Entry is valid, the new
+//       Entry's flagged values are merged into it; otherwise it's replaced.
+//
+//----------------------------------------------------------------------------
+void
+   HashCache::store(                // Store (merge) Entry
+     const Entry&      entry)       // The Entry to store
+{
+   AutoBarrier lock(barrier);
+
+   if( header == NULL || entry.flags == 0 )
+     return;
+
+   if( (header->used + 1) * 2 > header->capacity && expand() != 0 )
+     return;
+
+   Entry* slot= locate(entry.key);
+   if( slot->flags == 0 )           // If new entry
+   {
+     *slot= entry;
+     header->used++;
+   }
+   else if( memcmp(&slot->key, &entry.key, sizeof(Key)) != 0 ) // If stale
+     *slot= entry;
+   else                             // If current, merge
+   {
+     if( entry.flags & F_KSUM )
+       slot->ksum= entry.ksum;
+     if( entry.flags & F_HASH )
+       memcpy(slot->hash, entry.hash, DIGEST_SIZE);
+     slot->flags |= entry.flags;
+   }
+   slot->session= header->session;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       HashCache::sync
+//
+// Purpose-
+//       Write the cache to disk.
+//
+//----------------------------------------------------------------------------
+void
+   HashCache::sync( void )          // Write the cache to disk
+{
+   AutoBarrier lock(barrier);
+
+#ifndef _OS_WIN
+   if( header != NULL )
+     msync(header, length, MS_SYNC);
+#endif
+}
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007-2020 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Instantiate Socket methods.
 //
 // Last change date-
-//       2020/10/03
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #define FD_SETSIZE 512
@@ -40,6 +40,7 @@
 #include <time.h>
 #include <arpa/inet.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>            // For TCP_NODELAY
 #include <sys/poll.h>
 #include <sys/select.h>
 #include <sys/socket.h>
@@ -175,6 +176,7 @@ static const int       convertSO[]= // SO_ conversion table
 ,  SOCK_SO_OOBINLINE                // Leave received OOB data in line
 ,  SOCK_SO_REUSEADDR                // Allow local address reuse
 ,  SOCK_SO_ACCEPTCONN               // Socket has had listen()
+,  TCP_NODELAY                      // Send without coalescing (IPPROTO_TCP)
 }; // convert SO
 
 //----------------------------------------------------------------------------
@@ -1265,6 +1267,15 @@ int                                 // The SocketOption value
          result= optval;
        break;
 
+     case SO_NODELAY:
+       optval= 0;
+       optlen= sizeof(optval);
+       rc= ::getsockopt(handle, IPPROTO_TCP, option,
+                        (char*)&optval, &optlen);
+       if( rc == 0 )
+         result= optval;
+       break;
+
      default:
        ec= Software::EC_INVAL;
        break;
@@ -1360,6 +1371,12 @@ int                                 // Resultant, 0 OK
                         (const char*)&optval, sizeof(optval));
        break;
 
+     case SO_NODELAY:
+       optval= value;
+       rc= ::setsockopt(handle, IPPROTO_TCP, option,
+                        (const char*)&optval, sizeof(optval));
+       break;
+
      default:
        ec= Software::EC_INVAL;
        break;
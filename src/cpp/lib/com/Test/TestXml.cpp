@@ -0,0 +1,385 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       TestXml.cpp
+//
+// Purpose-
+//       Test the XmlPull and XmlTree objects.
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#include <com/Debug.h>
+#include <com/Reader.h>
+#include <com/Verify.h>
+
+#include "com/XmlPull.h"
+#include "com/XmlTree.h"
+
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+#ifndef HCDM
+#undef  HCDM                        // If defined, Hard Core Debug Mode
+#endif
+
+#ifndef SCDM
+#undef  SCDM                        // If defined, Soft Core Debug Mode
+#endif
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       TextReader
+//
+// Purpose-
+//       Read a string, a few (odd sized) chunks at a time.
+//
+//----------------------------------------------------------------------------
+class TextReader : public Reader {  // Read from a string
+//----------------------------------------------------------------------------
+// TextReader::Typedefs and enumerations
+//----------------------------------------------------------------------------
+protected:
+enum
+{  DIM_CHUNK= 4093                  // The (odd) input chunk size
+}; // enum
+
+//----------------------------------------------------------------------------
+// TextReader::Attributes
+//----------------------------------------------------------------------------
+protected:
+const std::string&     text;        // The input text
+size_t                 offset;      // The current text offset
+
+//----------------------------------------------------------------------------
+// TextReader::Constructors
+//----------------------------------------------------------------------------
+public:
+virtual
+   ~TextReader( void ) {}           // Destructor
+
+   TextReader(                      // Constructor
+     const std::string&text)        // Read this string
+:  Reader(DIM_CHUNK)
+,  text(text)
+,  offset(0)
+{
+   #ifdef SCDM
+     debugf("TextReader(%p)::TextReader(%zd)\n", this, text.size());
+   #endif
+}
+
+//----------------------------------------------------------------------------
+// TextReader::Methods
+//----------------------------------------------------------------------------
+public:
+virtual int                         // Return code (0 OK)
+   open(                            // Open the Reader
+     const char*,                   // The Reader name
+     const char*)                   // The open mode
+{  return 0; }
+
+virtual int                         // Return code (0 OK)
+   close( void )                    // Close the Reader
+{  return 0; }
+
+virtual int                         // Return code (0 OK)
+   flush( void )                    // Flush the Reader
+{  return 0; }
+
+protected:
+virtual int                         // Return code (0 OK)
+   input( void )                    // Read input
+{
+   if( used < size && used > 0 )    // Preserve existing data
+     memmove(buffer, buffer + used, size - used);
+   size -= used;
+   used= 0;
+
+   size_t L= text.size() - offset;
+   if( L > length - size )
+     L= length - size;
+   if( L == 0 )
+     return -1;
+
+   memcpy(buffer + size, text.c_str() + offset, L);
+   offset += L;
+   size += L;
+   return 0;
+}
+}; // class TextReader
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       testMarkup
+//
+// Purpose-
+//       Test comments, CDATA, declarations and descriptions.
+//
+//----------------------------------------------------------------------------
+static void
+   testMarkup( void )               // Test markup
+{
+   debugf("\n");
+   verify_info(); debugf("testMarkup()\n");
+
+   static const char* text=
+     "<?xml version='1.0'?>"
+     "<!DOCTYPE root>"
+     "<root><!-- a <b> comment -->"
+     "<![CDATA[ <not> & element ]]>"
+     "</root>";
+
+   XmlPull pull(text, strlen(text));
+   verify( pull.next() == XmlPull::EVENT_DESC );
+   verify( pull.getText() == "<?xml version='1.0'?>" );
+   verify( pull.next() == XmlPull::EVENT_DECL );
+   verify( pull.getText() == "<!DOCTYPE root>" );
+   verify( pull.next() == XmlPull::EVENT_ELEM );
+   verify( pull.getName() == "root" );
+   verify( pull.next() == XmlPull::EVENT_COMMENT );
+   verify( pull.getText() == "<!-- a <b> comment -->" );
+   verify( pull.next() == XmlPull::EVENT_CDATA );
+   verify( pull.getText() == "<![CDATA[ <not> & element ]]>" );
+   verify( pull.next() == XmlPull::EVENT_END );
+   verify( pull.getName() == "root" );
+   verify( pull.next() == XmlPull::EVENT_EOF );
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       testQuoted
+//
+// Purpose-
+//       Test attribute values containing '>'.
+//
+//----------------------------------------------------------------------------
+static void
+   testQuoted( void )               // Test quoted '>'
+{
+   debugf("\n");
+   verify_info(); debugf("testQuoted()\n");
+
+   static const char* text= "<a v=\"x>y\" w='>' z=\"'\">t</a>";
+
+   XmlPull pull(text, strlen(text));
+   verify( pull.next() == XmlPull::EVENT_ELEM );
+   verify( pull.getName() == "a" );
+   verify( pull.getAttribCount() == 3 );
+   if( pull.getAttribCount() == 3 )
+   {
+     verify( pull.getAttrib(0).name  == "v" );
+     verify( pull.getAttrib(0).value == "x>y" );
+     verify( pull.getAttrib(1).name  == "w" );
+     verify( pull.getAttrib(1).value == ">" );
+     verify( pull.getAttrib(2).name  == "z" );
+     verify( pull.getAttrib(2).value == "'" );
+   }
+   verify( pull.next() == XmlPull::EVENT_TEXT );
+   verify( pull.getText() == "t" );
+   verify( pull.next() == XmlPull::EVENT_END );
+   verify( pull.next() == XmlPull::EVENT_EOF );
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       testSelfClosing
+//
+// Purpose-
+//       Test self-closing elements.
+//
+//----------------------------------------------------------------------------
+static void
+   testSelfClosing( void )          // Test self-closing elements
+{
+   debugf("\n");
+   verify_info(); debugf("testSelfClosing()\n");
+
+   static const char* text= "<a><b x='1'/><c/></a>";
+
+   XmlPull pull(text, strlen(text));
+   verify( pull.next() == XmlPull::EVENT_ELEM );
+   verify( pull.getName() == "a" && pull.getDepth() == 1 );
+   verify( pull.next() == XmlPull::EVENT_ELEM );
+   verify( pull.getName() == "b" && pull.getDepth() == 2 );
+   verify( pull.getAttribCount() == 1 );
+   verify( pull.next() == XmlPull::EVENT_END );
+   verify( pull.getName() == "b" && pull.getDepth() == 1 );
+   verify( pull.next() == XmlPull::EVENT_ELEM );
+   verify( pull.getName() == "c" && pull.getAttribCount() == 0 );
+   verify( pull.next() == XmlPull::EVENT_END );
+   verify( pull.getName() == "c" );
+   verify( pull.next() == XmlPull::EVENT_END );
+   verify( pull.getName() == "a" && pull.getDepth() == 0 );
+   verify( pull.next() == XmlPull::EVENT_EOF );
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       testBoundary
+//
+// Purpose-
+//       Test tokens that cross or exceed the XmlPull buffer.
+//
+//----------------------------------------------------------------------------
+static void
+   testBoundary( void )             // Test buffer boundaries
+{
+   debugf("\n");
+   verify_info(); debugf("testBoundary()\n");
+
+   // Pad so that the element, CDATA and comment straddle BUFFER_SIZE
+   std::string text= "<root>";
+   size_t pads= 0;
+   while( text.size() < XmlPull::BUFFER_SIZE - 40 )
+   {
+     text += "<p/>";
+     pads++;
+   }
+   text += "<e a=\"";
+   std::string value(100, '>');     // (Crosses the buffer boundary)
+   text += value;
+   text += "\"/>";
+
+   std::string cdata= "<![CDATA[" + std::string(3 * XmlPull::BUFFER_SIZE, 'c')
+                    + "]]>";
+   text += cdata;
+   std::string comment= "<!--" + std::string(XmlPull::BUFFER_SIZE, '-')
+                      + " -->";
+   text += comment;
+   std::string body(2 * XmlPull::BUFFER_SIZE + 7, 't');
+   text += body;
+   text += "</root>";
+
+   TextReader reader(text);
+   XmlPull pull(reader);
+   verify( pull.next() == XmlPull::EVENT_ELEM );
+   verify( pull.getName() == "root" );
+
+   size_t count= 0;
+   int event= pull.next();
+   while( event == XmlPull::EVENT_ELEM && pull.getName() == "p" )
+   {
+     verify( pull.next() == XmlPull::EVENT_END );
+     count++;
+     event= pull.next();
+   }
+   verify( count == pads );
+
+   verify( event == XmlPull::EVENT_ELEM );
+   verify( pull.getName() == "e" );
+   verify( pull.getAttribCount() == 1 );
+   if( pull.getAttribCount() == 1 )
+     verify( pull.getAttrib(0).value.toString() == value );
+   verify( pull.next() == XmlPull::EVENT_END );
+
+   verify( pull.next() == XmlPull::EVENT_CDATA );
+   verify( pull.getText().toString() == cdata );
+   verify( pull.next() == XmlPull::EVENT_COMMENT );
+   verify( pull.getText().toString() == comment );
+   verify( pull.next() == XmlPull::EVENT_TEXT );
+   verify( pull.getText().toString() == body );
+   verify( pull.next() == XmlPull::EVENT_END );
+   verify( pull.getName() == "root" );
+   verify( pull.next() == XmlPull::EVENT_EOF );
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       testTree
+//
+// Purpose-
+//       Test the XmlTree.
+//
+//----------------------------------------------------------------------------
+static void
+   testTree( void )                 // Test the XmlTree
+{
+   debugf("\n");
+   verify_info(); debugf("testTree()\n");
+
+   static const char* text=
+     "<?xml version='1.0'?>"
+     "<list kind='test'>"
+     "  <item id=\"1\">one &amp;  <!-- skip -->only</item>"
+     "  <item id='2'/>"
+     "</list>"
+     "<next/>";
+
+   XmlPull pull(text, strlen(text));
+   XmlTree tree;
+   XmlTree::Node* root= tree.parse(pull);
+   verify( root != NULL );
+   if( root == NULL )
+     return;
+
+   verify( root->type == XmlNode::TYPE_ROOT );
+   verify( strcmp(root->name, "list") == 0 );
+   verify( root->getAttrib("kind") != NULL );
+   if( root->getAttrib("kind") )
+     verify( tree.getValue(root->getAttrib("kind")) == "test" );
+
+   const XmlTree::Node* item= root->getChild("item");
+   verify( item != NULL );
+   if( item != NULL )
+   {
+     verify( item->parent == root );
+     verify( tree.getValue(item->getAttrib("id")) == "1" );
+     verify( tree.getText(item) == "one & only" );
+   }
+
+   root= tree.parse(pull);
+   verify( root != NULL && strcmp(root->name, "next") == 0 );
+   verify( tree.parse(pull) == NULL );
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       main
+//
+// Purpose-
+//       Mainline code.
+//
+//----------------------------------------------------------------------------
+extern int
+   main(int, char**)                // Mainline code
+//   int             argc,          // Argument count
+//   char*           argv[])        // Argument array
+{
+   try {
+     testSelfClosing();
+     testMarkup();
+     testQuoted();
+     testBoundary();
+     testTree();
+   } catch(const char* X) {
+     verify_info(); debugf("Exception(%s)\n", X);
+     verify( false );
+   } catch(std::exception& X) {
+     verify_info(); debugf("Exception(%s)\n", X.what());
+     verify( false );
+   }
+
+   verify_exit();
+}
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2007-2020 Frank Eskesen.
+//       Copyright (c) 2007-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Writer object methods.
 //
 // Last change date-
-//       2020/10/03
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <ctype.h>
@@ -246,6 +246,7 @@ void
    #endif
 
    Size_t              L;           // Number of bytes transmitted
+   va_list             outptr;      // Argument list pointer (copy)
 
    if( getState() != STATE_OUTPUT )
    {
@@ -256,7 +257,9 @@ void
    if( size >= length )
      output();
 
-   L= vsnprintf(buffer+size, length-size, fmt, argptr);
+   va_copy(outptr, argptr);         // (argptr may be used twice)
+   L= vsnprintf(buffer+size, length-size, fmt, outptr);
+   va_end(outptr);
 
    if( ssize_t(L) < 0 || L >= (length-size) )
    {
@@ -0,0 +1,508 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       XmlPull.cpp
+//
+// Purpose-
+//       XmlPull object methods.
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#include <ctype.h>                  // For isspace()
+#include <stdlib.h>                 // For malloc, realloc, free
+#include <string.h>                 // For memchr, memcmp, memmove
+
+#include <com/Debug.h>              // For throwf
+#include <com/Reader.h>
+
+#include "com/XmlPull.h"
+
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+#ifndef HCDM
+#undef  HCDM                        // If defined, Hard Core Debug Mode
+#endif
+
+static const size_t    npos= size_t(-1); // Not found offset
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       clip
+//       isWhite
+//
+// Purpose-
+//       Limit an error message token length
+//       Test for whitespace character
+//
+//----------------------------------------------------------------------------
+static inline int                   // The token display length
+   clip(                            // Limit token display length
+     size_t            size)        // The token length
+{
+   return size < 32 ? int(size) : 32;
+}
+
+static inline int                   // TRUE iff whitespace
+   isWhite(                         // Is character whitespace?
+     const char*       C)           // This character
+{
+   return isspace((unsigned char)*C);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlPull::Span::operator==
+//
+// Purpose-
+//       Compare a Span to a string
+//
+//----------------------------------------------------------------------------
+bool                                // TRUE if equal
+   XmlPull::Span::operator==(       // Compare
+     const char*       text) const  // To this ('\0' terminated) string
+{
+   return strlen(text) == size && memcmp(addr, text, size) == 0;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlPull::~XmlPull
+//
+// Purpose-
+//       Destructor.
+//
+//----------------------------------------------------------------------------
+   XmlPull::~XmlPull( void )        // Destructor
+{
+   if( reader != NULL )             // (Buffer input is not owned)
+     free(buffer);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlPull::XmlPull
+//
+// Purpose-
+//       Constructors.
+//
+//----------------------------------------------------------------------------
+   XmlPull::XmlPull(                // Constructor
+     Reader&           reader)      // Read from this Reader
+:  reader(&reader), buffer(NULL), length(BUFFER_SIZE), used(0)
+,  origin(0), offset(0), event(EVENT_EOF), empty(false)
+,  name{NULL, 0}, text{NULL, 0}, attrib(), stack()
+{
+   buffer= (char*)malloc(length);
+   if( buffer == NULL )
+     throwf("XmlPull: No storage");
+}
+
+   XmlPull::XmlPull(                // Constructor
+     const char*       addr,        // Parse this buffer
+     size_t            size)        // Of this length
+:  reader(NULL), buffer(const_cast<char*>(addr)), length(size), used(size)
+,  origin(0), offset(0), event(EVENT_EOF), empty(false)
+,  name{NULL, 0}, text{NULL, 0}, attrib(), stack()
+{
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlPull::ensure
+//
+// Purpose-
+//       Ensure that token bytes are available.
+//
+//----------------------------------------------------------------------------
+bool                                // TRUE if at least size bytes available
+   XmlPull::ensure(                 // Ensure token bytes are available
+     size_t            size)        // This many, from origin
+{
+   while( used - origin < size )
+   {
+     if( !fill() )
+       return false;
+   }
+
+   return true;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlPull::fill
+//
+// Purpose-
+//       Add data to the buffer.
+//
+// Implementation notes-
+//       The current token is moved to the beginning of the buffer, so token
+//       offsets (relative to origin) are not changed. The buffer is only
+//       expanded when the current token fills it.
+//
+//----------------------------------------------------------------------------
+bool                                // TRUE if data was added
+   XmlPull::fill( void )            // Add buffer data
+{
+   if( reader == NULL )             // If buffer input
+     return false;
+
+   if( origin > 0 )                 // Discard prior tokens
+   {
+     memmove(buffer, buffer + origin, used - origin);
+     used -= origin;
+     offset -= origin;
+     origin= 0;
+   }
+
+   if( used >= length )             // If the token fills the buffer
+   {
+     char* expand= (char*)realloc(buffer, length * 2);
+     if( expand == NULL )
+       throwf("XmlPull: No storage");
+
+     buffer= expand;
+     length *= 2;
+   }
+
+   size_t L= reader->read((Reader::Byte*)buffer + used, length - used);
+   used += L;
+   return L > 0;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlPull::find
+//
+// Purpose-
+//       Locate a character or string within the input.
+//
+//----------------------------------------------------------------------------
+size_t                              // Offset from origin, npos if EOF
+   XmlPull::find(                   // Locate a character
+     size_t            from,        // Starting at this offset from origin
+     int               C)           // This character
+{
+   for(;;)
+   {
+     const char* B= buffer + origin;
+     size_t L= used - origin;
+     if( from < L )
+     {
+       const char* M= (const char*)memchr(B + from, C, L - from);
+       if( M != NULL )
+         return M - B;
+
+       from= L;
+     }
+
+     if( !fill() )
+       return npos;
+   }
+}
+
+size_t                              // Offset from origin, npos if EOF
+   XmlPull::find(                   // Locate a string
+     size_t            from,        // Starting at this offset from origin
+     const char*       term)        // This ('\0' terminated) string
+{
+   size_t L= strlen(term);
+   for(;;)
+   {
+     size_t x= find(from, term[0]);
+     if( x == npos || !ensure(x + L) )
+       return npos;
+
+     if( memcmp(buffer + origin + x, term, L) == 0 )
+       return x;
+
+     from= x + 1;
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlPull::genElem
+//
+// Purpose-
+//       Handle element start: <name attr="value" ...> or <name .../>
+//
+//----------------------------------------------------------------------------
+int                                 // EVENT_ELEM
+   XmlPull::genElem( void )         // Handle element start
+{
+   // Locate the terminating '>', skipping quoted values
+   size_t x= 1;                     // Current offset
+   int Q= 0;                        // Current quote, if any
+   for(;;)
+   {
+     if( !ensure(x + 1) )
+       throwf("EOF in XML header '%.*s'", clip(used - origin)
+             , buffer + origin);
+
+     const char* B= buffer + origin;
+     size_t L= used - origin;
+     for(; x<L; x++)
+     {
+       int C= B[x];
+       if( Q != 0 )
+       {
+         if( C == Q )
+           Q= 0;
+       }
+       else if( C == '\'' || C == '\"' )
+         Q= C;
+       else if( C == '>' )
+         break;
+     }
+
+     if( x < L )
+       break;
+   }
+
+   // The tag is complete and the buffer does not move again in this call
+   const char* B= buffer + origin;
+   const char* E= B + x;            // The '>' address
+   offset= origin + x + 1;
+   if( E[-1] == '/' )               // If self-contained header/trailer
+   {
+     empty= true;
+     E--;
+   }
+
+   const char* P= B + 1;            // The name
+   while( P < E && !isWhite(P) )
+     P++;
+   name.addr= B + 1;
+   name.size= P - name.addr;
+   if( name.size == 0 )
+     throwf("Malformed XML header '%.*s'", int(E - B), B);
+
+   // Extract the attributes
+   for(;;)
+   {
+     while( P < E && isWhite(P) )
+       P++;
+     if( P >= E )
+       break;
+
+     Attr attr;
+     attr.name.addr= P;
+     while( P < E && *P != '=' && !isWhite(P) )
+     {
+       if( *P == '\'' || *P == '\"' )
+         throwf("Quote in name in '%.*s'", int(P - B), B);
+       P++;
+     }
+     attr.name.size= P - attr.name.addr;
+     if( attr.name.size == 0 )
+       throwf("Missing name in '%.*s'", int(P - B), B);
+
+     while( P < E && isWhite(P) )
+       P++;
+     if( P >= E || *P != '=' )
+       throwf("Missing '=' after '%.*s'", int(P - B), B);
+
+     P++;
+     while( P < E && isWhite(P) )
+       P++;
+     if( P >= E || (*P != '\'' && *P != '\"') )
+       throwf("Missing quote in '%.*s'", int(P - B), B);
+
+     const char* M= (const char*)memchr(P + 1, *P, E - P - 1);
+     if( M == NULL )
+       throwf("Missing terminator in '%.*s'", int(E - B), B);
+     attr.value.addr= P + 1;
+     attr.value.size= M - attr.value.addr;
+     attrib.push_back(attr);
+     P= M + 1;
+     if( P < E && !isWhite(P) )
+       throwf("Malformed header after '%.*s'", int(P - B), B);
+   }
+
+   stack.push_back(name.toString());
+   event= EVENT_ELEM;
+   return event;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlPull::genEnd
+//
+// Purpose-
+//       Handle element end: </name>
+//
+//----------------------------------------------------------------------------
+int                                 // EVENT_END
+   XmlPull::genEnd( void )          // Handle element end
+{
+   size_t x= find(2, '>');
+   if( x == npos )
+     throwf("EOF in XML terminator '%.*s'", clip(used - origin)
+           , buffer + origin);
+
+   const char* P= buffer + origin + 2;
+   const char* E= buffer + origin + x;
+   while( P < E && isWhite(P) )
+     P++;
+   while( P < E && isWhite(E - 1) )
+     E--;
+   name.addr= P;
+   name.size= E - P;
+   offset= origin + x + 1;
+
+   if( stack.empty() )
+     throwf("XML begins with '</%.*s>'", int(name.size), name.addr);
+   if( !(name == stack.back().c_str()) )
+     throwf("<%s> ... </%.*s>", stack.back().c_str()
+           , int(name.size), name.addr);
+
+   stack.pop_back();
+   event= EVENT_END;
+   return event;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlPull::genMark
+//
+// Purpose-
+//       Handle markup: comment, CDATA, declarative and descriptive.
+//
+//----------------------------------------------------------------------------
+int                                 // The event
+   XmlPull::genMark(                // Handle markup
+     int               event,       // With this event type
+     size_t            from,        // Start search at this offset
+     const char*       term)        // Using this terminator
+{
+   size_t x= find(from, term);
+   if( x == npos )
+     throwf("Unexpected EOF in '%.*s'", clip(used - origin)
+           , buffer + origin);
+
+   x += strlen(term);
+   text.addr= buffer + origin;
+   text.size= x;
+   offset= origin + x;
+
+   this->event= event;
+   return event;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlPull::next
+//
+// Purpose-
+//       Get the next event.
+//
+//----------------------------------------------------------------------------
+int                                 // The next event
+   XmlPull::next( void )            // Get next event
+{
+   if( empty )                      // If <name .../> EVENT_END pending
+   {
+     empty= false;
+     stack.pop_back();              // (The name is unchanged)
+     event= EVENT_END;
+     return event;
+   }
+
+   origin= offset;
+   attrib.clear();
+   if( !ensure(1) )                 // If end of input
+   {
+     if( !stack.empty() )
+       throwf("EOF in <%s>", stack.back().c_str());
+
+     text.addr= buffer + origin;
+     text.size= 0;
+     event= EVENT_EOF;
+     return event;
+   }
+
+   if( buffer[origin] != '<' )      // If text
+   {
+     size_t x= find(1, '<');
+     if( x == npos )
+       x= used - origin;
+
+     text.addr= buffer + origin;
+     text.size= x;
+     offset= origin + x;
+     event= EVENT_TEXT;
+     return event;
+   }
+
+   if( !ensure(2) )
+     throwf("EOF in XML header <");
+
+   int C= buffer[origin + 1];
+   if( C == '/' )
+     return genEnd();
+
+   if( C == '?' )
+     return genMark(EVENT_DESC, 2, "?>");
+
+   if( C == '!' )
+   {
+     if( ensure(4) && memcmp(buffer + origin, "<!--", 4) == 0 )
+       return genMark(EVENT_COMMENT, 4, "-->");
+
+     if( ensure(9) && memcmp(buffer + origin, "<![CDATA[", 9) == 0 )
+       return genMark(EVENT_CDATA, 9, "]]>");
+
+     return genMark(EVENT_DECL, 2, ">");
+   }
+
+   if( isspace(C) || C == '>' )
+     throwf("Malformed XML header '<%c'", C);
+
+   return genElem();
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlPull::skip
+//
+// Purpose-
+//       Skip the current element's content, through its EVENT_END.
+//
+//----------------------------------------------------------------------------
+void
+   XmlPull::skip( void )            // Skip the current element's content
+{
+   if( event != EVENT_ELEM )
+     return;
+
+   size_t depth= stack.size();
+   while( stack.size() >= depth )
+   {
+     if( next() == EVENT_EOF )      // (Not expected, next() throws)
+       break;
+   }
+}
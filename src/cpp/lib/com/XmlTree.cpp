@@ -0,0 +1,385 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       XmlTree.cpp
+//
+// Purpose-
+//       XmlTree object methods.
+//
+// Last change date-
+//       2026/10/18
+//
+//----------------------------------------------------------------------------
+#include <ctype.h>                  // For isspace()
+#include <stdlib.h>                 // For malloc, free
+#include <string.h>                 // For memcpy, strcmp
+
+#include <com/Debug.h>              // For throwf
+
+#include "com/XmlTree.h"
+using std::string;
+
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+#ifndef HCDM
+#undef  HCDM                        // If defined, Hard Core Debug Mode
+#endif
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlTree::Node::getAttrib
+//       XmlTree::Node::getChild
+//
+// Purpose-
+//       Get the first named attribute Node
+//       Get the first named child Node
+//
+//----------------------------------------------------------------------------
+const XmlTree::Node*                // The first associated attribute
+   XmlTree::Node::getAttrib(        // Get first associated attribute
+     const char*       name) const  // With this name
+{
+   for(const Node* node= attrib; node != NULL; node= node->next)
+   {
+     if( strcmp(node->name, name) == 0 )
+       return node;
+   }
+
+   return NULL;
+}
+
+const XmlTree::Node*                // The first associated child
+   XmlTree::Node::getChild(         // Get first associated child
+     const char*       name) const  // With this name
+{
+   for(const Node* node= child; node != NULL; node= node->next)
+   {
+     if( strcmp(node->name, name) == 0 )
+       return node;
+   }
+
+   return NULL;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlTree::~XmlTree
+//
+// Purpose-
+//       Destructor.
+//
+//----------------------------------------------------------------------------
+   XmlTree::~XmlTree( void )        // Destructor
+{
+   while( head != NULL )
+   {
+     Chunk* next= head->next;
+     free(head);
+     head= next;
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlTree::XmlTree
+//
+// Purpose-
+//       Constructor.
+//
+//----------------------------------------------------------------------------
+   XmlTree::XmlTree( void )         // Default constructor
+:  head(NULL), chunk(NULL), root(NULL), parser(), tail()
+{
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlTree::allocate
+//
+// Purpose-
+//       Allocate arena storage.
+//
+// Implementation notes-
+//       Chunks are allocated as needed and kept for reuse. A request larger
+//       than CHUNK_SIZE gets a Chunk of its own.
+//
+//----------------------------------------------------------------------------
+void*                               // The allocated storage
+   XmlTree::allocate(               // Allocate arena storage
+     size_t            size,        // Of this length
+     size_t            align)       // With this alignment
+{
+   for(;;)
+   {
+     if( chunk != NULL )
+     {
+       size_t used= (chunk->used + align - 1) & ~(align - 1);
+       if( used + size <= chunk->size )
+       {
+         chunk->used= used + size;
+         return (char*)(chunk + 1) + used;
+       }
+
+       if( chunk->next != NULL )    // Use the next (reused) Chunk
+       {
+         chunk= chunk->next;
+         chunk->used= 0;
+         continue;
+       }
+     }
+
+     size_t length= CHUNK_SIZE;
+     if( size > length )
+       length= size;
+     Chunk* next= (Chunk*)malloc(sizeof(Chunk) + length);
+     if( next == NULL )
+       throwf("XmlTree: No storage");
+
+     next->next= NULL;
+     next->size= length;
+     next->used= 0;
+     if( chunk == NULL )
+       head= next;
+     else
+       chunk->next= next;
+     chunk= next;
+   }
+}
+
+const char*                         // The allocated ('\0' terminated) string
+   XmlTree::allocate(               // Allocate arena string
+     const XmlPull::Span&
+                       span)        // Containing this Span
+{
+   char* result= (char*)allocate(span.size + 1, 1);
+   memcpy(result, span.addr, span.size);
+   result[span.size]= '\0';
+
+   return result;
+}
+
+XmlTree::Node*                      // The allocated Node
+   XmlTree::allocate(               // Allocate arena Node
+     int               type,        // With this type
+     const char*       name,        // And this (arena or constant) name
+     const char*       data)        // And this (arena or constant) value
+{
+   Node* node= (Node*)allocate(sizeof(Node), alignof(Node));
+   node->type= type;
+   node->name= name;
+   node->data= data;
+   node->parent= NULL;
+   node->attrib= NULL;
+   node->child= NULL;
+   node->next= NULL;
+
+   return node;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlTree::append
+//
+// Purpose-
+//       Append a child Node to the current element.
+//
+//----------------------------------------------------------------------------
+void
+   XmlTree::append(                 // Append a child Node
+     Node*             node)        // The child Node (parent set)
+{
+   if( tail.back() == NULL )
+     node->parent->child= node;
+   else
+     tail.back()->next= node;
+
+   tail.back()= node;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlTree::getText
+//
+// Purpose-
+//       Extract all text, normalizing it (as XmlParser::getText)
+//
+//----------------------------------------------------------------------------
+string                              // Resultant string
+   XmlTree::getText(                // Get associated text
+     const Node*       node) const  // From this Node
+{
+   string result;                   // Resultant
+   bool blank= false;               // Whitespace pending?
+   for(node= node->child; node != NULL; node= node->next)
+   {
+     if( node->type != XmlNode::TYPE_TEXT )
+       continue;
+
+     for(const char* C= node->data; *C != '\0'; C++)
+     {
+       if( isspace((unsigned char)*C) )
+         blank= true;
+       else
+       {
+         if( blank && result.size() > 0 )
+           result += ' ';
+         blank= false;
+         result += *C;
+       }
+     }
+   }
+
+   return parser.evaluate(result);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlTree::getValue
+//
+// Purpose-
+//       Extract value, replacing entities
+//
+//----------------------------------------------------------------------------
+string                              // Resultant string
+   XmlTree::getValue(               // Get associated value
+     const Node*       node) const  // From this Node
+{
+   return parser.evaluate(node->data);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlTree::parse
+//
+// Purpose-
+//       Generate the next complete element node tree.
+//
+// Implementation notes-
+//       Events outside of the root element are ignored.
+//
+//----------------------------------------------------------------------------
+XmlTree::Node*                      // The root node, NULL at end of input
+   XmlTree::parse(                  // Extract next complete node tree
+     XmlPull&          pull)        // From this XmlPull
+{
+   reset();                         // Reset the XmlTree
+
+   Node* node= NULL;                // The current element
+   for(;;)
+   {
+     int event= pull.next();
+     if( event == XmlPull::EVENT_EOF )
+       break;
+
+     if( node == NULL && event != XmlPull::EVENT_ELEM )
+       continue;
+
+     int type= XmlNode::TYPE_TEXT;
+     const char* name= "#text";
+     switch( event )
+     {
+       case XmlPull::EVENT_ELEM:
+       {
+         Node* elem= allocate(node ? XmlNode::TYPE_ELEM : XmlNode::TYPE_ROOT
+                             , allocate(pull.getName()), "");
+         elem->parent= node;
+         if( node == NULL )
+           root= elem;
+         else
+           append(elem);
+
+         Node* last= NULL;
+         for(size_t i= 0; i<pull.getAttribCount(); i++)
+         {
+           const XmlPull::Attr& attr= pull.getAttrib(i);
+           Node* next= allocate(XmlNode::TYPE_ATTR, allocate(attr.name)
+                               , allocate(attr.value));
+           next->parent= elem;
+           if( last == NULL )
+             elem->attrib= next;
+           else
+             last->next= next;
+           last= next;
+         }
+
+         node= elem;
+         tail.push_back(NULL);
+         continue;
+       }
+
+       case XmlPull::EVENT_END:
+         tail.pop_back();
+         node= node->parent;
+         if( node == NULL )         // If the root element is complete
+           return root;
+         continue;
+
+       case XmlPull::EVENT_COMMENT:
+         type= XmlNode::TYPE_COMMENT;
+         name= "#comment";
+         break;
+
+       case XmlPull::EVENT_CDATA:
+         type= XmlNode::TYPE_CDATA;
+         name= "#CDATA";
+         break;
+
+       case XmlPull::EVENT_DECL:
+         type= XmlNode::TYPE_DECL;
+         name= "#declare";
+         break;
+
+       case XmlPull::EVENT_DESC:
+         type= XmlNode::TYPE_DESC;
+         name= "#descriptor";
+         break;
+
+       default:                     // (EVENT_TEXT)
+         break;
+     }
+
+     Node* next= allocate(type, name, allocate(pull.getText()));
+     next->parent= node;
+     append(next);
+   }
+
+   return NULL;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       XmlTree::reset
+//
+// Purpose-
+//       Reset the XmlTree, keeping the arena Chunks for reuse
+//
+//----------------------------------------------------------------------------
+void
+   XmlTree::reset( void )           // Reset the XmlTree
+{
+   root= NULL;
+   tail.clear();
+
+   chunk= head;
+   if( chunk != NULL )
+     chunk->used= 0;
+}
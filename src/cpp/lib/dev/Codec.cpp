@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2022-2023 Frank Eskesen.
+//       Copyright (C) 2022-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,13 +16,16 @@
 //       Implement http/Codec.h
 //
 // Last change date-
-//       2023/07/29
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <stdexcept>                // For std::runtime_error
+#include <vector>                   // For std::vector
 #include <ctype.h>                  // For isspace
 #include <stdio.h>                  // For EOF
+#include <string.h>                 // For memchr
 
+#include <pub/Coding.h>             // For namespace pub::coding
 #include <pub/Debug.h>              // For namespace pub::debugging
 #include <pub/Ioda.h>               // For pub::Ioda
 #include <pub/utility.h>            // For namespace pub::utility
@@ -40,6 +43,8 @@ namespace _LIBPUB_NAMESPACE::http {  // Implementation namespace
 enum
 {  HCDM= false                      // Hard Core Debug Mode?
 ,  VERBOSE= 1                       // Verbosity, higher is more verbose
+
+,  LINE64= 76                       // Codec64 maximum line length
 }; // enum
 
 enum OPTIONS64                      // Codec64 options
@@ -244,6 +249,11 @@ int                                 // The next input character
 // Implentation note-
 //       RFC2045 decoder does not require terminating PAD_CHARs.
 //
+//       Complete lines (at most 76 characters, a multiple of 4, containing
+//       only Base64 alphabet characters) are decoded using coding::
+//       base64_decode. Decoding continues character by character at the
+//       first line that isn't complete, so errors are handled as before.
+//
 //----------------------------------------------------------------------------
 Ioda                                // Decoded I/O data area
    Codec64::decode(                 // Decode
@@ -254,7 +264,6 @@ Ioda                                // Decoded I/O data area
 
    int                 iset[4];     // The next 4 character input set
    Ioda                oda;         // The output I/O data area
-   IodaReader          reader(ida); // The IodaReader
    uint32_t            oword;       // Working output word
    bool                tchar= false; // Encountered terminating character
 
@@ -263,6 +272,41 @@ Ioda                                // Decoded I/O data area
    col= 0;                          // Current input column (-1)
    options &= 0xffff0000;           // Clear error reporting options
 
+   // DECODE complete lines --------------------------------------------------
+   string inp= (string)ida;         // The (contiguous) input data
+   const char* addr= inp.data();    // The input data address
+   size_t size= inp.size();         // The input data length
+   std::vector<char> buff(size / 4 * 3); // The output buffer
+   size_t skip= 0;                  // The input length decoded
+   size_t L= 0;                     // The output length
+   while( skip < size ) {
+     const char* line= addr + skip;
+     const char* next= (const char*)memchr(line, '\n', size - skip);
+     if( next == nullptr )          // (The last line is never complete)
+       break;
+
+     size_t length= next - line;    // The line length, excluding "\r\n"
+     if( length > 0 && line[length-1] == '\r' )
+       --length;
+     if( length == 0 || length > LINE64 || (length % 4) != 0 )
+       break;
+
+     size_t used;
+     size_t D= coding::base64_decode(line, length, buff.data() + L, used);
+     if( used != length )
+       break;
+
+     L += D;
+     skip= next + 1 - addr;
+     ++row;
+   }
+   oda.write(buff.data(), L);
+
+   Ioda rest;                       // The remaining input data
+   if( skip > 0 )
+     rest.write(addr + skip, size - skip);
+   IodaReader reader(skip > 0 ? rest : ida); // The IodaReader
+
    // DECODE -----------------------------------------------------------------
    for(;;) {                        // Decode the data
      iset[0]= d_read(reader);       // Load the next 4 character input set
@@ -331,6 +375,10 @@ Ioda                                // Decoded I/O data area
 // Purpose-
 //       Base64 encoder
 //
+// Implementation notes-
+//       The input data is encoded using coding::base64_encode, then split
+//       into 76 character lines.
+//
 //----------------------------------------------------------------------------
 Ioda                                // Encoded I/O data area
    Codec64::encode(                 // Encode
@@ -340,67 +388,28 @@ Ioda                                // Encoded I/O data area
            , visify((string)ida).c_str());
 
    Ioda                oda;         // The output data area
-   IodaReader          reader(ida); // The IodaReader
-   uint32_t            oword;       // Working output word
-   int                 iset[3];     // The next 3 character input set
 
    // Initialize
    row= 0;                          // Current input line (-1)
    col= 0;                          // Current input column (-1)
    options &= 0xffff0000;           // Clear error reporting options
 
-   int out_col= 0;                  // Current output line (-1)
-   int out_row= 0;                  // Current output column (-1)
-
    // ENCODE -----------------------------------------------------------------
-   for(;;) {                        // Encode the data
-     // TODO: Handle termination sequence according to RFC
-     iset[0]= read(reader);
-     if( iset[0] == EOF )
-       break;
-
-     iset[1]= read(reader);
-     if( iset[1] == EOF ) {
-       oword= iset[0];
-       oda.put(en_tab[(oword >>  2) & 0x003F]);
-       oda.put(en_tab[(oword <<  4) & 0x003F]);
-       oda.put((int)PAD_CHAR);
-       oda.put((int)PAD_CHAR);
-       out_col += 4;
-       break;
-     }
-
-     iset[2]= read(reader);
-     if( iset[2] == EOF ) {
-       oword= (iset[0] << 8) | iset[1];
-       oda.put(en_tab[(oword >> 10) & 0x003F]);
-       oda.put(en_tab[(oword >>  4) & 0x003F]);
-       oda.put(en_tab[(oword <<  2) & 0x003F]);
-       oda.put((int)PAD_CHAR);
-       out_col += 4;
-       break;
-     }
-
-     oword= (iset[0] << 16) | (iset[1] << 8) | iset[2];
-     oda.put(en_tab[(oword >> 18) & 0x003F]);
-     oda.put(en_tab[(oword >> 12) & 0x003F]);
-     oda.put(en_tab[(oword >>  6) & 0x003F]);
-     oda.put(en_tab[(oword >>  0) & 0x003F]);
-     out_col += 4;
-     if( out_col >= 76 ) {
-       out_col= 0;
-       ++out_row;
-       oda += "\r\n";
-     }
-   }
-
-   if( out_col ) {
-     out_col= 0;
-     ++out_row;
+   // TODO: Handle termination sequence according to RFC
+   string inp= (string)ida;         // The (contiguous) input data
+   std::vector<char> buff(coding::base64_length(inp.size()));
+   size_t L= coding::base64_encode(inp.data(), inp.size(), buff.data());
+   int out_row= 0;                  // Current output line (-1)
+   for(size_t i= 0; i<L; i += LINE64) {
+     size_t length= L - i;
+     if( length > LINE64 )
+       length= LINE64;
+     oda.write(buff.data() + i, length);
      oda += "\r\n";
+     ++out_row;
    }
 
-   col= out_col;
+   col= 0;
    row= out_row;
 
    return oda;
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2021-2024 Frank Eskesen.
+//       Copyright (C) 2021-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,15 +16,20 @@
 //       Implement Buffer.h
 //
 // Last change date-
-//       2024/03/31
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <exception>                // For std::exception
 #include <new>                      // For std::bad_alloc
 #include <stdexcept>                // For std::range_error
+#include <stdlib.h>                 // For malloc, free
+#include <string.h>                 // For memcpy
+#include <sys/ipc.h>                // For IPC_PRIVATE, IPC_RMID
+#include <sys/shm.h>                // For shmget, shmat, shmdt, shmctl
 #include <xcb/xcb.h>                // For xcb basic types
 #include <xcb/xproto.h>             // For xcb types and prototypes
 #include <xcb/xcb_image.h>          // For xcb_image_t, associated functions
+#include <xcb/shm.h>                // For MIT-SHM extension
 
 #include <pub/Debug.h>              // For namespace pub::debugging
 #include "gui/Global.h"             // For opt_* definitions, ...
@@ -79,10 +84,13 @@ namespace gui {
 
    Buffer::~Buffer( void )          // Destructor
 {
-   if( buffer ) {
+   // The connection may already be closed, so the X server segment isn't
+   // detached here. The server detaches it when the connection closes.
+   if( shm_state == SHM_ACTIVE )
+     shmdt(buffer);
+   else if( buffer )
      free(buffer);
-     buffer= nullptr;
-   }
+   buffer= nullptr;
 }
 
 //----------------------------------------------------------------------------
@@ -97,16 +105,120 @@ namespace gui {
 void
    Buffer::clear(                   // Clear the Buffer
      Pixel_t           p)           // Setting all Pixels to this
+{  fill(0, 0, width, height, p); }
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       gui::Buffer::damage
+//
+// Purpose-
+//       Add a rectangle to the damaged area
+//
+// Implementation notes-
+//       The damaged area is the bounding rectangle of all damage.
+//
+//----------------------------------------------------------------------------
+void
+   Buffer::damage(                  // Add to damaged area
+     unsigned          x,           // Left
+     unsigned          y,           // Top
+     unsigned          w,           // Width
+     unsigned          h)           // Height
 {
-   if( buffer ) {
-     for(unsigned h= 0; h<height; h++) {
-//     unsigned X0= width * h;
-       for(unsigned w= 0; w<width; w++) {
-//       buffer[X0 + w]= p;
-         put_xy(w, h, p);
-       }
+   if( x >= width || y >= height || w == 0 || h == 0 )
+     return;
+
+   unsigned x1= (w > width - x) ? width : x + w;
+   unsigned y1= (h > height - y) ? height : y + h;
+   if( damaged.x0 >= damaged.x1 ) { // If no current damage
+     damaged.x0= x;
+     damaged.y0= y;
+     damaged.x1= x1;
+     damaged.y1= y1;
+     return;
+   }
+
+   if( x < damaged.x0 ) damaged.x0= x;
+   if( y < damaged.y0 ) damaged.y0= y;
+   if( x1 > damaged.x1 ) damaged.x1= x1;
+   if( y1 > damaged.y1 ) damaged.y1= y1;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       gui::Buffer::draw
+//
+// Purpose-
+//       Draw a rectangle on a Pixmap
+//
+//----------------------------------------------------------------------------
+void
+   Buffer::draw(                    // Draw a rectangle
+     Pixmap*           pixmap,      // On this Pixmap (or Window)
+     xcb_gcontext_t    gc,          // Using this graphic context
+     unsigned          x,           // Left
+     unsigned          y,           // Top
+     unsigned          w,           // Width
+     unsigned          h)           // Height
+{
+   if( x >= width || y >= height )  // If nothing visible
+     return;
+   if( w > width - x )
+     w= width - x;
+   if( h > height - y )
+     h= height - y;
+   if( w == 0 || h == 0 )
+     return;
+
+   xcb_connection_t* c= pixmap->c;
+   if( shm_attach(c) ) {            // MIT-SHM: The server copies the pixels
+     pixmap->NOQUEUE("xcb_shm_put_image", xcb_shm_put_image
+                    ( c, pixmap->widget_id, gc, WH_t(width), WH_t(height)
+                    , XY_t(x), XY_t(y), WH_t(w), WH_t(h), PT_t(x), PT_t(y)
+                    , image.depth, XCB_IMAGE_FORMAT_Z_PIXMAP, 0, shm_seg, 0) );
+     shm_sync= xcb_get_input_focus(c); // (Replied to after the put completes)
+     shm_pending= true;
+     xcb_flush(c);
+     return;
+   }
+
+   // xcb_put_image: Send as many rows per request as the server allows.
+   // (The request header is much smaller than the 64 bytes reserved.)
+   unsigned row_size= w * sizeof(Pixel_t);
+   unsigned max_rows= (xcb_get_maximum_request_length(c) * 4 - 64) / row_size;
+   if( max_rows == 0 )
+     max_rows= 1;
+   if( max_rows > h )
+     max_rows= h;
+
+   Pixel_t* copy= nullptr;          // Contiguous rows, if needed
+   if( w != width ) {
+     copy= (Pixel_t*)malloc(size_t(row_size) * max_rows);
+     if( copy == nullptr )
+       throw std::bad_alloc();
+   }
+
+   for(unsigned r= 0; r<h; r += max_rows) {
+     unsigned rows= h - r;
+     if( rows > max_rows )
+       rows= max_rows;
+
+     const Pixel_t* data= buffer + size_t(y + r) * width + x;
+     if( copy ) {
+       for(unsigned i= 0; i<rows; i++)
+         memcpy(copy + size_t(i) * w, data + size_t(i) * width, row_size);
+       data= copy;
      }
+
+     pixmap->NOQUEUE("xcb_put_image", xcb_put_image
+                    ( c, XCB_IMAGE_FORMAT_Z_PIXMAP, pixmap->widget_id, gc
+                    , WH_t(w), WH_t(rows), PT_t(x), PT_t(y + r), 0
+                    , image.depth, rows * row_size, (const uint8_t*)data) );
    }
+
+   free(copy);
 }
 
 //----------------------------------------------------------------------------
@@ -128,43 +240,46 @@ void
    if( buffer == nullptr )
      throw std::range_error("Not initialized");
 
-   // Case 1: Full exposure
-   if( event->x == 0 && event->y == 0
-       && event->width == width && event->height == height ) {
-     pixmap->ENQUEUE("xcb_image_put", xcb_image_put
-                    ( pixmap->c, pixmap->widget_id, gc, &image, 0, 0, 0) );
-     return;
-   }
-
-   // Case 2: NO exposure
-   if( event->x >= width || event->y >= height )
-     return;
-
-   // Case 3: Partial exposure
    if( opt_hcdm && opt_verbose > 1 )
      printf("%4d HCDM %p [%u,%u] [%u,%u,%u,%u]\n", __LINE__, buffer
            , width, height, event->x, event->y, event->width, event->height);
 
-   xcb_image_t exposure= image;     // Use the base image
-   exposure.width= event->width;    // Set exposure width
-   if( width - event->x < exposure.width )
-     exposure.width= width - event->x;
-   exposure.stride= exposure.width * 4;
-   exposure.size= exposure.stride;
-
-   exposure.height= 1;              // Draw one pixel line at a time
-   unsigned maxY= event->y + event->height; // Set line limit
-   if( height < maxY )
-     maxY= height;
-
-   for(unsigned y= event->y; y<maxY; y++) {
-     exposure.base= buffer + (y * width) + event->x;
-     exposure.data= (uint8_t*)exposure.base;
-     if( opt_hcdm && opt_verbose > 1 )
-       printf("%4d HCDM %p [%u,%u].%u\n", __LINE__, exposure.base
-             , event->x, y, exposure.width);
-     xcb_image_put(pixmap->c, pixmap->widget_id, gc, &exposure, event->x, y, 0);
+   draw(pixmap, gc, event->x, event->y, event->width, event->height);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       gui::Buffer::fill
+//
+// Purpose-
+//       Fill a rectangle, adding it to the damaged area
+//
+//----------------------------------------------------------------------------
+void
+   Buffer::fill(                    // Fill rectangle
+     unsigned          x,           // Left
+     unsigned          y,           // Top
+     unsigned          w,           // Width
+     unsigned          h,           // Height
+     Pixel_t           p)           // Setting all its Pixels to this
+{
+   if( x >= width || y >= height )
+     return;
+   if( w > width - x )
+     w= width - x;
+   if( h > height - y )
+     h= height - y;
+
+   if( shm_pending )                // If the server may be reading
+     sync();
+   for(unsigned row= y; row<y+h; row++) {
+     Pixel_t* pixel= buffer + size_t(row) * width + x;
+     for(unsigned col= 0; col<w; col++)
+       pixel[col]= p;
    }
+
+   damage(x, y, w, h);
 }
 
 //----------------------------------------------------------------------------
@@ -187,7 +302,7 @@ Pixel_t                             // The Pixel
    if( x > width || y > height )
      throw std::range_error("Buffer::get_xy");
 
-   return buffer[y*height + x];
+   return buffer[y*width + x];
 }
 
 void
@@ -199,10 +314,32 @@ void
    if( x > width || y > height )
      throw std::range_error("Buffer::put_xy");
 
-   buffer[y*height + x]= p;
+   buffer[y*width + x]= p;
 }
 #endif // Inline in Buffer.h
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       gui::Buffer::refresh
+//
+// Purpose-
+//       Draw the damaged area on a Pixmap, then reset it
+//
+//----------------------------------------------------------------------------
+void
+   Buffer::refresh(                 // Draw the damaged area
+     Pixmap*           pixmap,      // Pixmap (or Window)
+     xcb_gcontext_t    gc)          // The graphic context
+{
+   if( damaged.x0 >= damaged.x1 )   // If no damage
+     return;
+
+   draw(pixmap, gc, damaged.x0, damaged.y0
+       , damaged.x1 - damaged.x0, damaged.y1 - damaged.y0);
+   damaged= Damage();
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -218,7 +355,52 @@ void
      unsigned          y,           // Y (Height)
      Pixel_t           p)           // Background Pixel
 {
-   // Initialize the image buffer
+   // Allocate the new pixel buffer
+   size_t size= size_t(x) * y * sizeof(Pixel_t);
+   Pixel_t* pixel= nullptr;         // The new buffer
+   if( size ) {
+     pixel= (Pixel_t*)malloc(size);
+     if( pixel == nullptr )
+       throw std::bad_alloc();
+   }
+
+   // Copy the current image buffer to the new buffer
+   unsigned wmax= x;
+   if( width < x )
+     wmax= width;
+
+   unsigned hmax= y;
+   if( height < y )
+     hmax= height;
+
+   for(unsigned h= 0; h<hmax; h++) {
+     size_t P0= size_t(h) * x;
+     size_t B0= size_t(h) * width;
+     for(unsigned w= 0; w<wmax; w++) {
+       pixel[P0 + w]= buffer[B0 + w];
+     }
+     for(unsigned w= wmax; w<x; w++) {
+       pixel[P0 + w]= p;
+     }
+   }
+
+   for(unsigned h= hmax; h<y; h++) {
+     size_t P0= size_t(h) * x;
+     for(unsigned w= 0; w<x; w++) {
+       pixel[P0 + w]= p;
+     }
+   }
+
+   // Replace the image buffer
+   if( shm_state == SHM_ACTIVE )    // (Reattached on next use)
+     shm_detach();
+   else if( buffer )
+     free(buffer);
+   buffer= pixel;
+   width= x;
+   height= y;
+
+   // Initialize the image
    image.width= x;                  // Width, in pixels
    image.height= y;                 // Height, in pixels
    image.format= XCB_IMAGE_FORMAT_Z_PIXMAP; // Format type
@@ -231,54 +413,120 @@ void
    image.bit_order=  XCB_IMAGE_ORDER_MSB_FIRST; // Bit order
    image.stride= image.width * 4;   // Bytes per image row
    image.size= image.width * image.height * 4; // Size of image (bytes)
-   image.base= malloc(image.size);  // Allocated storage
-   image.data= (uint8_t*)image.base;  // (Unused here)
-   memset(image.base, 0, image.size); // Initialize the allocated storage
+   image.base= buffer;              // The pixel buffer
+   image.data= (uint8_t*)image.base; // (Used by xcb_image_put)
 
-   // Copy the current image buffer to the new buffer
-   if( image.base ) {
-     unsigned wmax= x;
-     if( width < x )
-       wmax= width;
-
-     unsigned hmax= y;
-     if( height < y )
-       hmax= height;
-
-     Pixel_t* pixel= (Pixel_t*)image.base; // The new buffer
-     for(unsigned h= 0; h<hmax; h++) {
-       unsigned P0= h * y;
-       unsigned B0= h * height;
-       for(unsigned w= 0; w<wmax; w++) {
-         pixel[P0 + w]= buffer[B0 + w];
-       }
-       for(unsigned w= wmax; w<y; w++) {
-         pixel[P0 + w]= p;
-       }
-     }
+   damaged= Damage();
+   damage(0, 0, x, y);
+}
 
-     for(unsigned h= hmax; h<y; h++) {
-       unsigned P0= h * y;
-       for(unsigned w= 0; w<y; w++) {
-         pixel[P0 + w]= p;
-       }
-     }
+//----------------------------------------------------------------------------
+//
+// Method-
+//       gui::Buffer::shm_attach
+//       gui::Buffer::shm_detach
+//
+// Purpose-
+//       Attach MIT-SHM segment, moving the pixel buffer into it
+//       Detach MIT-SHM segment, releasing the pixel buffer
+//
+// Implementation notes-
+//       Attach fails permanently, for this Buffer, only if the extension
+//       isn't present or the server can't use the segment (e.g. a remote
+//       server.) An empty Buffer or a local shmget/shmat failure leaves the
+//       state reset, so attach is retried on the next draw.
+//       A Buffer is only attached to one connection at a time.
+//
+//----------------------------------------------------------------------------
+bool                                // TRUE if MIT-SHM is active
+   Buffer::shm_attach(              // Attach MIT-SHM segment
+     xcb_connection_t* conn)        // For this connection
+{
+   if( shm_state == SHM_ACTIVE )
+     return use_shm && conn == shm_conn;
+   size_t size= size_t(width) * height * sizeof(Pixel_t);
+   if( !use_shm || shm_state == SHM_FAILED || buffer == nullptr || size == 0 )
+     return false;
 
-     // Update the image buffer
-     if( buffer )
-       free(buffer);
-     buffer= (Pixel_t*)image.base;
-     width= x;
-     height= y;
-   } else {                         // If no new image
-     if( image.size )               // If storage allocation failed
-       throw std::bad_alloc();
+   const xcb_query_extension_reply_t* ext=
+       xcb_get_extension_data(conn, &xcb_shm_id);
+   if( ext == nullptr || !ext->present ) {
+     shm_state= SHM_FAILED;
+     return false;
+   }
 
-     if( buffer ) {
-       free(buffer);
-       buffer= nullptr;
-       width= height= 0;
-     }
+   int id= shmget(IPC_PRIVATE, size, IPC_CREAT | 0600);
+   if( id < 0 )
+     return false;
+
+   void* addr= shmat(id, nullptr, 0);
+   if( addr == (void*)(-1) ) {
+     shmctl(id, IPC_RMID, nullptr);
+     return false;
+   }
+
+   xcb_shm_seg_t seg= xcb_generate_id(conn);
+   xcb_generic_error_t* error=
+       xcb_request_check(conn, xcb_shm_attach_checked(conn, seg, id, 0));
+   shmctl(id, IPC_RMID, nullptr);   // (Removed after the last detach)
+   if( error ) {
+     if( opt_hcdm )
+       debugh("Buffer(%p) MIT-SHM unavailable, error(%d)\n", this
+             , error->error_code);
+     free(error);
+     shmdt(addr);
+     shm_state= SHM_FAILED;
+     return false;
+   }
+
+   memcpy(addr, buffer, size);      // Move the pixels into shared memory
+   free(buffer);
+   buffer= (Pixel_t*)addr;
+   image.base= buffer;
+   image.data= (uint8_t*)image.base;
+
+   shm_conn= conn;
+   shm_seg= seg;
+   shm_state= SHM_ACTIVE;
+   return true;
+}
+
+void
+   Buffer::shm_detach( void )       // Detach MIT-SHM segment
+{
+   if( shm_state == SHM_ACTIVE ) {
+     sync();                        // (The server may still be reading)
+     xcb_shm_detach(shm_conn, shm_seg);
+     shmdt(buffer);
+     buffer= nullptr;
+   }
+
+   shm_conn= nullptr;
+   shm_seg= 0;
+   shm_state= SHM_RESET;
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       gui::Buffer::sync
+//
+// Purpose-
+//       Wait until the X server has finished reading the shared segment
+//
+// Implementation notes-
+//       The server handles requests in order, so when the GetInputFocus
+//       reply arrives the preceding xcb_shm_put_image has completed.
+//       A reply (rather than a ShmCompletion event) is used so that the
+//       Device event loop never sees, or needs to handle, these events.
+//
+//----------------------------------------------------------------------------
+void
+   Buffer::sync( void )             // Wait for MIT-SHM draw completion
+{
+   if( shm_pending ) {
+     shm_pending= false;
+     free(xcb_get_input_focus_reply(shm_conn, shm_sync, nullptr));
    }
 }
 }  // namespace gui
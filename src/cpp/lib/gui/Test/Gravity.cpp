@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2021-2023 Frank Eskesen.
+//       Copyright (C) 2021-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Gravitational simulator.
 //
 // Last change date-
-//       2023/05/01
+//       2026/10/18
 //
 // Data points-
 //       https://nssdc.gsfc.nasa.gov/planetary/factsheet/moonfact.html
@@ -44,11 +44,19 @@
 //       seconds per orbit. This is an algorithmic error which can be halved
 //       each time delta_t is halved, up to some undetermined limit.
 //
+//       --test=nbody runs a headless N-body benchmark instead. A Plummer
+//       sphere is integrated (leapfrog) using both a Barnes-Hut octree and
+//       the exact O(n^2) method. Force evaluation runs on pub::WorkerPool
+//       threads. Steps per second and energy drift are reported for each.
+//
 //----------------------------------------------------------------------------
 #include <array>                    // For std::array
 #include <exception>                // For std::exception
+#include <functional>               // For std::function
 #include <memory>                   // For std::shared_ptr, std::unique_ptr
+#include <random>                   // For std::mt19937_64
 #include <string>                   // For std::string
+#include <thread>                   // For std::thread::hardware_concurrency
 
 #include <ctype.h>                  // For isprint, toupper
 #include <errno.h>                  // For errno
@@ -59,6 +67,7 @@
 #include <stdio.h>                  // For printf
 #include <stdlib.h>                 // For various
 #include <stdarg.h>                 // For va_list
+#include <string.h>                 // For memcmp, strcmp
 #include <unistd.h>                 // For close, ftruncate
 #include <sys/stat.h>               // For stat
 #include <sys/types.h>              // For type definitions
@@ -69,8 +78,10 @@
 #include <gui/Global.h>             // For gui::opt_* controls
 #include <gui/Keysym.h>             // For X11 keysymdef.h macros
 #include <gui/Window.h>             // For gui::Window
+#include <pub/Clock.h>              // For pub::Clock
 #include <pub/Debug.h>              // For namespace pub::Debug
 #include <pub/Exception.h>          // For pub::Exception
+#include <pub/Worker.h>             // For pub::WorkerPool
 
 #include "Config.h"                 // For namespace config
 #include "Gravity.h"                // For Gravity objects
@@ -122,18 +133,32 @@ static std::array<sim::Pos,DIM> M_pos; // Moon position array
 static uint32_t        pos_ix= 0;    // Current position index
 static uint32_t        pos_used= 0;  // Number of positions used
 
+//----------------------------------------------------------------------------
+// N-body benchmark controls (--test=nbody)
+//----------------------------------------------------------------------------
+static const double    NB_DT= 0.01;  // Time interval, model units
+static const double    NB_EPS2= 0.0025; // Softening length (0.05) squared
+
 //----------------------------------------------------------------------------
 // Options
 //----------------------------------------------------------------------------
+static int             opt_bodies= 4096; // --bodies
 static int             opt_help= false; // --help (or error)
 static int             opt_index;   // Option index
+static int             opt_steps= 100; // --steps
+static double          opt_theta= 0.5; // --theta
+static int             opt_threads= 0; // --threads (0: hardware threads)
 
 static const char*     OSTR= ":";   // The getopt_long optstring parameter
 static struct option   OPTS[]=      // The getopt_long longopts parameter
 {  {"help",    no_argument,       &opt_help,    true} // --help
 ,  {"hcdm",    no_argument,       &opt_hcdm,    true} // --hcdm
 
+,  {"bodies",  required_argument, nullptr,      0} // --bodies {required}
+,  {"steps",   required_argument, nullptr,      0} // --steps {required}
 ,  {"test",    required_argument, nullptr,      0} // --test {required}
+,  {"theta",   required_argument, nullptr,      0} // --theta {required}
+,  {"threads", required_argument, nullptr,      0} // --threads {required}
 ,  {"verbose", optional_argument, &opt_verbose, 0} // --verbose {optional}
 ,  {0, 0, 0, 0}                     // (End of option list)
 };
@@ -142,7 +167,11 @@ enum OPT_INDEX                      // Must match OPTS[]
 {  OPT_HELP
 ,  OPT_HCDM
 
+,  OPT_BODIES
+,  OPT_STEPS
 ,  OPT_TEST
+,  OPT_THETA
+,  OPT_THREADS
 ,  OPT_VERBOSE
 };
 
@@ -228,6 +257,247 @@ static inline sim::Xyz              // Force vector
 }
 
 namespace sim {                     // Simulation object namespace
+//----------------------------------------------------------------------------
+//
+// Method-
+//       sim::Octree::accel
+//
+// Purpose-
+//       Compute accelerations for a range of bodies
+//
+//----------------------------------------------------------------------------
+void
+   Octree::accel(                   // Compute acceleration
+     Bodies&           B,           // Of these bodies
+     size_t            begin,       // Starting with this body
+     size_t            end,         // Ending before this body
+     double            theta,       // Opening angle
+     double            eps2) const  // Softening length squared
+{
+   const double theta2= theta * theta;
+   std::vector<int32_t> stack;      // The cells to be examined
+   stack.reserve(512);
+
+   for(size_t i= begin; i<end; i++) {
+     const double xi= B.x[i], yi= B.y[i], zi= B.z[i];
+     double ax= 0.0, ay= 0.0, az= 0.0;
+
+     stack.push_back(0);
+     while( !stack.empty() ) {
+       const Node& N= node[stack.back()];
+       stack.pop_back();
+
+       // A distant cell, not containing this body, acts as a point mass
+       double dx= N.cx - xi, dy= N.cy - yi, dz= N.cz - zi;
+       double d2= dx*dx + dy*dy + dz*dz;
+       double size= 2.0 * N.half;
+       if( size * size < theta2 * d2
+           && (fabs(xi - N.ox) > N.half || fabs(yi - N.oy) > N.half
+               || fabs(zi - N.oz) > N.half) ) {
+         double r2= d2 + eps2;
+         double f= N.m / (r2 * sqrt(r2));
+         ax += dx * f; ay += dy * f; az += dz * f;
+         continue;
+       }
+
+       if( N.body >= 0 ) {          // Leaf: direct summation
+         for(int32_t b= N.body; b >= 0; b= next[b]) {
+           if( size_t(b) == i )
+             continue;
+           dx= B.x[b] - xi; dy= B.y[b] - yi; dz= B.z[b] - zi;
+           double r2= dx*dx + dy*dy + dz*dz + eps2;
+           double f= B.m[b] / (r2 * sqrt(r2));
+           ax += dx * f; ay += dy * f; az += dz * f;
+         }
+         continue;
+       }
+
+       for(int c= 0; c<8; c++) {    // Open the cell
+         if( N.child[c] >= 0 )
+           stack.push_back(N.child[c]);
+       }
+     }
+
+     B.ax[i]= ax;
+     B.ay[i]= ay;
+     B.az[i]= az;
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       sim::Octree::build
+//
+// Purpose-
+//       Build the tree
+//
+//----------------------------------------------------------------------------
+void
+   Octree::build(                   // Build the tree
+     const Bodies&     B)           // From these bodies
+{
+   const size_t n= B.size();
+   node.clear();
+   next.assign(n, -1);
+   if( n == 0 )
+     return;
+
+   // The root cell is the bounding cube
+   double lo[3]= {B.x[0], B.y[0], B.z[0]};
+   double hi[3]= {B.x[0], B.y[0], B.z[0]};
+   for(size_t i= 1; i<n; i++) {
+     if( B.x[i] < lo[0] ) lo[0]= B.x[i];
+     if( B.x[i] > hi[0] ) hi[0]= B.x[i];
+     if( B.y[i] < lo[1] ) lo[1]= B.y[i];
+     if( B.y[i] > hi[1] ) hi[1]= B.y[i];
+     if( B.z[i] < lo[2] ) lo[2]= B.z[i];
+     if( B.z[i] > hi[2] ) hi[2]= B.z[i];
+   }
+   double half= 0.0;
+   for(int d= 0; d<3; d++) {
+     if( hi[d] - lo[d] > half )
+       half= hi[d] - lo[d];
+   }
+   half= (half > 0.0) ? half * 0.5000001 : 1.0;
+   const double min_half= half * 1e-12; // Below this, bodies share a leaf
+
+   node.reserve(2 * n + 1);
+   cell((lo[0] + hi[0]) / 2, (lo[1] + hi[1]) / 2, (lo[2] + hi[2]) / 2, half);
+
+   // Insert the bodies
+   auto octant= [&](int32_t index, size_t b) {
+     const Node& N= node[index];
+     return int(B.x[b] > N.ox) | (int(B.y[b] > N.oy) << 1)
+          | (int(B.z[b] > N.oz) << 2);
+   };
+   auto subcell= [&](int32_t index, int oct) {
+     double h= node[index].half / 2;
+     int32_t c= cell(node[index].ox + ((oct & 1) ? h : -h)
+                    , node[index].oy + ((oct & 2) ? h : -h)
+                    , node[index].oz + ((oct & 4) ? h : -h), h);
+     node[index].child[oct]= c;     // (cell() may move node[])
+     return c;
+   };
+
+   node[0].body= 0;                 // The first body is the root leaf
+   node[0].count= 1;
+   for(size_t i= 1; i<n; i++) {
+     int32_t index= 0;
+     for(;;) {
+       if( node[index].body >= 0 ) { // If leaf
+         if( node[index].count < LEAF_MAX || node[index].half < min_half ) {
+           next[i]= node[index].body;
+           node[index].body= int32_t(i);
+           node[index].count++;
+           break;
+         }
+
+         int32_t b= node[index].body; // Split the leaf
+         node[index].body= -1;
+         node[index].count= 0;
+         while( b >= 0 ) {
+           int32_t after= next[b];
+           int oct= octant(index, b);
+           int32_t c= node[index].child[oct];
+           if( c < 0 )
+             c= subcell(index, oct);
+           next[b]= node[c].body;
+           node[c].body= b;
+           node[c].count++;
+           b= after;
+         }
+       }
+
+       int oct= octant(index, i);
+       int32_t c= node[index].child[oct];
+       if( c < 0 ) {
+         c= subcell(index, oct);
+         node[c].body= int32_t(i);
+         node[c].count= 1;
+         break;
+       }
+       index= c;
+     }
+   }
+
+   mass(B, 0);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       sim::Octree::cell
+//
+// Purpose-
+//       Allocate a cell
+//
+//----------------------------------------------------------------------------
+int32_t                             // The new cell index
+   Octree::cell(                    // Allocate a cell
+     double            ox,          // Cell center X
+     double            oy,          // Cell center Y
+     double            oz,          // Cell center Z
+     double            half)        // Cell half width
+{
+   Node N;
+   N.cx= N.cy= N.cz= N.m= 0.0;
+   N.ox= ox; N.oy= oy; N.oz= oz;
+   N.half= half;
+   for(int c= 0; c<8; c++)
+     N.child[c]= -1;
+   N.body= -1;
+   N.count= 0;
+
+   node.push_back(N);
+   return int32_t(node.size() - 1);
+}
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       sim::Octree::mass
+//
+// Purpose-
+//       Compute centers of mass
+//
+//----------------------------------------------------------------------------
+void
+   Octree::mass(                    // Compute centers of mass
+     const Bodies&     B,           // For these bodies
+     int32_t           index)       // Starting at this cell
+{
+   double m= 0.0, mx= 0.0, my= 0.0, mz= 0.0;
+   if( node[index].body >= 0 ) {    // If leaf
+     for(int32_t b= node[index].body; b >= 0; b= next[b]) {
+       m  += B.m[b];
+       mx += B.m[b] * B.x[b];
+       my += B.m[b] * B.y[b];
+       mz += B.m[b] * B.z[b];
+     }
+   } else {
+     for(int c= 0; c<8; c++) {
+       int32_t child= node[index].child[c];
+       if( child >= 0 ) {
+         mass(B, child);
+         const Node& C= node[child];
+         m  += C.m;
+         mx += C.m * C.cx;
+         my += C.m * C.cy;
+         mz += C.m * C.cz;
+       }
+     }
+   }
+
+   Node& N= node[index];
+   N.m= m;
+   if( m > 0.0 ) {
+     N.cx= mx / m;
+     N.cy= my / m;
+     N.cz= mz / m;
+   }
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -328,8 +598,8 @@ void
    if( opt_hcdm )
      debugh("sim::Window(%p)::draw Named(%s)\n", this, get_name().c_str());
 
-   ENQUEUE("xcb_image_put", xcb_image_put
-          (c, widget_id, drawGC, &image, 0, 0, 0) );
+   buffer.damage(0, 0, buffer.width, buffer.height);
+   buffer.refresh(this, drawGC);
 
    flush();
 }
@@ -354,7 +624,7 @@ void
    Window::image_draw( void )       // Update the image
 {
    // Only coded for two-body
-   memset(image.base, 0, image.size); // Initialize to black
+   buffer.clear(0);                 // Initialize to black
 
    for(unsigned i= pos_ix+1; i<pos_used; i++) {
      Pos& E= E_pos[i];
@@ -363,7 +633,7 @@ void
        printf("[%4d] E[%10.1e,%10.1e,%4d,%4d]  ", i, E.x, E.y, orb.x, orb.y);
      if( orb.x >= 0 && orb.y >=0
          && orb.x < rect.width && orb.y < rect.height ) {
-       xcb_image_put_pixel(&image, orb.x, orb.y, earth.color);
+       buffer.put_xy(orb.x, orb.y, earth.color);
      }
 
      Pos& M= M_pos[i];
@@ -373,7 +643,7 @@ void
              , M.x, M.y, orb.x, orb.y);
      if( orb.x >= 0 && orb.y >=0
          && orb.x < rect.width && orb.y < rect.height ) {
-       xcb_image_put_pixel(&image, orb.x, orb.y, moon.color);
+       buffer.put_xy(orb.x, orb.y, moon.color);
      }
    }
 
@@ -384,7 +654,7 @@ void
        printf("[%4d] E[%10.1e,%10.1e,%4d,%4d]  ", i, E.x, E.y, orb.x, orb.y);
      if( orb.x >= 0 && orb.y >=0
          && orb.x < rect.width && orb.y < rect.height ) {
-       xcb_image_put_pixel(&image, orb.x, orb.y, earth.color);
+       buffer.put_xy(orb.x, orb.y, earth.color);
      }
 
      Pos& M= M_pos[i];
@@ -394,7 +664,7 @@ void
              , M.x, M.y, orb.x, orb.y);
      if( orb.x >= 0 && orb.y >=0
          && orb.x < rect.width && orb.y < rect.height ) {
-       xcb_image_put_pixel(&image, orb.x, orb.y, moon.color);
+       buffer.put_xy(orb.x, orb.y, moon.color);
      }
    }
 
@@ -405,7 +675,7 @@ void
        printf("E[%10.1e,%10.1e,%4d,%4d]  ", E.x, E.y, orb.x, orb.y);
      if( orb.x >= 0 && orb.y >=0
          && orb.x < rect.width && orb.y < rect.height ) {
-       xcb_image_put_pixel(&image, orb.x, orb.y, earth.color);
+       buffer.put_xy(orb.x, orb.y, earth.color);
      }
 
      Pos& M= moon.pos;
@@ -414,57 +684,23 @@ void
        printf("M[%10.1e,%10.1e,%4d,%4d]\n", M.x, M.y, orb.x, orb.y);
      if( orb.x >= 0 && orb.y >=0
          && orb.x < rect.width && orb.y < rect.height ) {
-       xcb_image_put_pixel(&image, orb.x, orb.y, moon.color);
+       buffer.put_xy(orb.x, orb.y, moon.color);
      }
    }
 
-   xcb_image_put_pixel(&image, center_x, center_y, root.color);
+   buffer.put_xy(center_x, center_y, root.color);
+
+   // The image is only updated here. The changed pixels are drawn by put_xy
+   buffer.damaged= gui::Buffer::Damage();
 }
 
 void
    Window::image_init( void )       // Create and initialze the image
-{
-   // Clean up any prior image
-   image_term();
-
-   // Initialize the image buffer
-   image.width= rect.width;         // Width, in pixels
-   image.height= rect.height;       // Height, in pixels
-   image.format= XCB_IMAGE_FORMAT_Z_PIXMAP; // Format type
-   image.scanline_pad= 32;          // Scanline pad (bits)
-   image.depth= 24;                 // Depth (bits)
-   image.bpp= 32;                   // Storage per pixel (bits)
-   image.unit= 32;                  // Scanline unit (bits)
-   image.plane_mask= 0;             // (Unused here)
-   image.byte_order= gui::get_image_order(); // Byte order
-   image.bit_order=  XCB_IMAGE_ORDER_MSB_FIRST; // Bit order
-   image.stride= rect.width * 4;    // Bytes per image row
-   image.size= rect.width * rect.height * 4; // Size of image (bytes)
-   image.base= malloc(image.size);  // Allocated storage
-   image.data= (uint8_t*)image.base;  // (Unused here)
-   memset(image.base, 0, image.size); // Initialize the allocated storage
-
-   // Initialize the pixel buffer
-   pixel= image;                    // Copy the image buffer
-
-   // One pixel image buffer
-   pixel= image;                    // Start with image
-   pixel.width= 1;
-   pixel.height= 1;
-   pixel.stride= 4;
-   pixel.size= 4;
-   pixel.base= &pdata;
-   pixel.data= (uint8_t*)pixel.base;
-}
+{  buffer.resize(rect.width, rect.height, 0); } // (Black background)
 
 void
    Window::image_term( void )       // Clean up the image
-{
-   if( image.base ) {
-     free(image.base);
-     image.base= nullptr;
-   }
-}
+{  buffer.resize(0, 0); }
 
 //----------------------------------------------------------------------------
 //
@@ -484,10 +720,11 @@ void
    if( key_debug['x'] )
      debugh("sim::Window(%p)::put_xy(%4d,%4d,%.6x)\n", this, x, y, p);
 
-   if( x >= 0 && y >=0 && x < rect.width && y < rect.height ) {
-     pdata= p;                      // Set the Pixel data
-     ENQUEUE("xcb_image_put", xcb_image_put
-            (c, widget_id, drawGC, &pixel, x, y, 0));
+   if( x >= 0 && y >=0 && unsigned(x) < buffer.width
+       && unsigned(y) < buffer.height ) {
+     buffer.put_xy(x, y, p);        // Set the Pixel data
+     buffer.damage(x, y, 1, 1);
+     buffer.refresh(this, drawGC);
    }
 }
 
@@ -496,24 +733,16 @@ void
      int               x,           // X (Width) index  (from left)
      int               y)           // Y (Height) index (from top)
 {
-   if( x >= 0 && y >=0 && x < rect.width && y < rect.height ) {
-     pdata= xcb_image_get_pixel(&image, x, y);
+   if( x >= 0 && y >=0 && unsigned(x) < buffer.width
+       && unsigned(y) < buffer.height ) {
      if( key_debug['H'] )
-       printf("sim::Window(%p)::put_xy(%4d,%4d) %.6x\n", this, x, y, pdata);
+       printf("sim::Window(%p)::put_xy(%4d,%4d) %.6x\n", this, x, y
+             , buffer.get_xy(x, y));
 
-     ENQUEUE("xcb_image_put", xcb_image_put
-            (c, widget_id, drawGC, &pixel, x, y, 0));
+     buffer.damage(x, y, 1, 1);
+     buffer.refresh(this, drawGC);
    } else if( key_debug['H'] )
      printf("sim::Window(%p)::put_xy(%d,%d) RANGE\n", this, x, y);
-
-#if 0 // Single-shot debugging info
-static int once= true;
-if( once ) {
-  once= false;
-  ::debug("image", image); printf("\n");
-  ::debug("pixel", pixel); printf("..pdata(%p) %.6x\n", &pdata, pdata);
-}
-#endif
 }
 
 //----------------------------------------------------------------------------
@@ -534,10 +763,12 @@ void
    if( rect.width == x && rect.height == y ) // If unchanged
      return;                        // Nothing to do
 
-   // Reconfigure and draw the window
+   // Reconfigure, then redraw the window
    set_size(x, y);
    rect.width=  x;
    rect.height= y;
+   image_init();
+   image_draw();
    draw();
 }
 
@@ -549,7 +780,8 @@ void
      debugh("sim::Window(%p)::expose %d [%d,%d,%d,%d]\n", this
            , event->count, event->x, event->y, event->width, event->height);
 
-   draw();
+   buffer.expose(this, drawGC, event);
+   flush();
 }
 
 void
@@ -630,6 +862,266 @@ int
 }
 }  // namespace sim (Simulation object namespace)
 
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       parallel
+//
+// Purpose-
+//       Run a range function over all bodies, using opt_threads threads
+//
+// Implementation notes-
+//       The bodies are processed in blocks of PARALLEL_BLOCK bodies.
+//
+//----------------------------------------------------------------------------
+static void
+   parallel(                        // Run range function
+     size_t            count,       // For this many bodies
+     const std::function<void(size_t, size_t)>&
+                       range)       // The range function
+{
+   enum { PARALLEL_BLOCK= 64 };     // The number of bodies per block
+
+   size_t const blocks= (count + PARALLEL_BLOCK - 1) / PARALLEL_BLOCK;
+   pub::WorkerPool::parallel(unsigned(opt_threads), blocks,
+     [count, &range](size_t block)
+     {
+       size_t begin= block * PARALLEL_BLOCK;
+       size_t end= begin + PARALLEL_BLOCK;
+       if( end > count )
+         end= count;
+       range(begin, end);
+     });
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       nb_energy
+//
+// Purpose-
+//       Total (kinetic + potential) energy, O(n^2)
+//
+//----------------------------------------------------------------------------
+static double                       // The total energy
+   nb_energy(                       // Get total energy
+     const sim::Bodies&
+                       B)           // Of these bodies
+{
+   const size_t n= B.size();
+   std::vector<double> e(n);        // Energy, by body
+   parallel(n, [&](size_t begin, size_t end) {
+     for(size_t i= begin; i<end; i++) {
+       double v2= B.vx[i]*B.vx[i] + B.vy[i]*B.vy[i] + B.vz[i]*B.vz[i];
+       double p= 0.0;               // Potential (each pair counted twice)
+       for(size_t j= 0; j<n; j++) {
+         if( j == i )
+           continue;
+         double dx= B.x[j] - B.x[i], dy= B.y[j] - B.y[i], dz= B.z[j] - B.z[i];
+         p += B.m[j] / sqrt(dx*dx + dy*dy + dz*dz + NB_EPS2);
+       }
+       e[i]= B.m[i] * (0.5 * v2 - 0.5 * p);
+     }
+   });
+
+   double sum= 0.0;
+   for(size_t i= 0; i<n; i++)
+     sum += e[i];
+   return sum;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       nb_exact
+//       nb_tree
+//
+// Purpose-
+//       Compute accelerations, exact O(n^2) method
+//       Compute accelerations, Barnes-Hut O(n log n) method
+//
+//----------------------------------------------------------------------------
+static void
+   nb_exact(                        // Compute accelerations, exact method
+     sim::Bodies&      B)           // For these bodies
+{
+   const size_t n= B.size();
+   parallel(n, [&](size_t begin, size_t end) {
+     for(size_t i= begin; i<end; i++) {
+       const double xi= B.x[i], yi= B.y[i], zi= B.z[i];
+       double ax= 0.0, ay= 0.0, az= 0.0;
+       for(size_t j= 0; j<n; j++) {
+         double dx= B.x[j] - xi, dy= B.y[j] - yi, dz= B.z[j] - zi;
+         double r2= dx*dx + dy*dy + dz*dz + NB_EPS2;
+         double f= (j == i) ? 0.0 : B.m[j] / (r2 * sqrt(r2));
+         ax += dx * f; ay += dy * f; az += dz * f;
+       }
+       B.ax[i]= ax; B.ay[i]= ay; B.az[i]= az;
+     }
+   });
+}
+
+static void
+   nb_tree(                         // Compute accelerations, Barnes-Hut
+     sim::Bodies&      B)           // For these bodies
+{
+   static sim::Octree tree;         // (Storage reused between steps)
+   tree.build(B);
+   parallel(B.size(), [&](size_t begin, size_t end) {
+     tree.accel(B, begin, end, opt_theta, NB_EPS2);
+   });
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       nb_plummer
+//
+// Purpose-
+//       Initialize bodies: a Plummer sphere with total mass 1, scale 1
+//
+// Implementation notes-
+//       Aarseth, Henon and Wielen (1974) sampling, repeatable (fixed seed)
+//
+//----------------------------------------------------------------------------
+static void
+   nb_plummer(                      // Initialize Plummer sphere
+     sim::Bodies&      B,           // The bodies
+     size_t            n)           // The number of bodies
+{
+   std::mt19937_64 mt(1'234'567);   // (Fixed seed)
+   std::uniform_real_distribution<double> U(0.0, 1.0);
+   auto direction= [&](double r, double& x, double& y, double& z) {
+     double cz= 2.0 * U(mt) - 1.0;
+     double sz= sqrt(1.0 - cz * cz);
+     double phi= 2.0 * M_PI * U(mt);
+     x= r * sz * cos(phi);
+     y= r * sz * sin(phi);
+     z= r * cz;
+   };
+
+   B.resize(n);
+   double cx= 0.0, cy= 0.0, cz= 0.0, vx= 0.0, vy= 0.0, vz= 0.0;
+   for(size_t i= 0; i<n; i++) {
+     B.m[i]= 1.0 / n;
+
+     double r;                      // Radius, truncated at 10 scale lengths
+     do {
+       r= 1.0 / sqrt(pow(U(mt), -2.0 / 3.0) - 1.0);
+     } while( r > 10.0 );
+     direction(r, B.x[i], B.y[i], B.z[i]);
+
+     double q, g;                   // Velocity, by rejection
+     do {
+       q= U(mt);
+       g= 0.1 * U(mt);
+     } while( g > q * q * pow(1.0 - q * q, 3.5) );
+     direction(q * sqrt(2.0) * pow(1.0 + r * r, -0.25), B.vx[i], B.vy[i], B.vz[i]);
+
+     cx += B.m[i] * B.x[i];  cy += B.m[i] * B.y[i];  cz += B.m[i] * B.z[i];
+     vx += B.m[i] * B.vx[i]; vy += B.m[i] * B.vy[i]; vz += B.m[i] * B.vz[i];
+   }
+
+   for(size_t i= 0; i<n; i++) {     // Use the center of mass frame
+     B.x[i] -= cx;  B.y[i] -= cy;  B.z[i] -= cz;
+     B.vx[i] -= vx; B.vy[i] -= vy; B.vz[i] -= vz;
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       nb_run
+//
+// Purpose-
+//       Run the N-body simulation (leapfrog, kick-drift-kick)
+//
+//----------------------------------------------------------------------------
+static void
+   nb_run(                          // Run the N-body simulation
+     const char*       name,        // The method name
+     sim::Bodies&      B,           // The bodies
+     void            (*force)(sim::Bodies&)) // The force method
+{
+   const size_t n= B.size();
+   const double dt= NB_DT;
+
+   double E0= nb_energy(B);
+   double start= pub::Clock::now();
+   force(B);
+   for(int step= 0; step<opt_steps; step++) {
+     parallel(n, [&](size_t begin, size_t end) {
+       for(size_t i= begin; i<end; i++) {
+         B.vx[i] += 0.5 * dt * B.ax[i];
+         B.vy[i] += 0.5 * dt * B.ay[i];
+         B.vz[i] += 0.5 * dt * B.az[i];
+         B.x[i] += dt * B.vx[i];
+         B.y[i] += dt * B.vy[i];
+         B.z[i] += dt * B.vz[i];
+       }
+     });
+
+     force(B);
+
+     parallel(n, [&](size_t begin, size_t end) {
+       for(size_t i= begin; i<end; i++) {
+         B.vx[i] += 0.5 * dt * B.ax[i];
+         B.vy[i] += 0.5 * dt * B.ay[i];
+         B.vz[i] += 0.5 * dt * B.az[i];
+       }
+     });
+   }
+   double elapsed= pub::Clock::now() - start;
+   double E1= nb_energy(B);
+
+   printf("%-6s %10.2f steps/second, energy drift %+.3e\n", name
+         , opt_steps / elapsed, (E1 - E0) / fabs(E0));
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       nbody
+//
+// Purpose-
+//       Headless N-body benchmark: Barnes-Hut versus exact
+//
+//----------------------------------------------------------------------------
+static int                          // Return code (0 OK)
+   nbody( void )                    // N-body benchmark
+{
+   sim::Bodies initial;
+   nb_plummer(initial, opt_bodies);
+   printf("N-body: %d bodies, %d steps, theta %.3f, %d threads, dt %.3f\n"
+         , opt_bodies, opt_steps, opt_theta, opt_threads, NB_DT);
+
+   // Force accuracy: Barnes-Hut versus exact
+   sim::Bodies tree= initial;
+   sim::Bodies exact= initial;
+   nb_tree(tree);
+   nb_exact(exact);
+   double sum= 0.0, worst= 0.0;
+   for(size_t i= 0; i<initial.size(); i++) {
+     double dx= tree.ax[i] - exact.ax[i];
+     double dy= tree.ay[i] - exact.ay[i];
+     double dz= tree.az[i] - exact.az[i];
+     double a2= exact.ax[i]*exact.ax[i] + exact.ay[i]*exact.ay[i]
+              + exact.az[i]*exact.az[i];
+     double e= sqrt((dx*dx + dy*dy + dz*dz) / a2);
+     sum += e;
+     if( e > worst )
+       worst= e;
+   }
+   printf("Force: mean relative error %.3e, maximum %.3e\n"
+         , sum / initial.size(), worst);
+
+   nb_run("tree",  tree,  nb_tree);
+   nb_run("exact", exact, nb_exact);
+
+   pub::WorkerPool::reset();
+   return 0;
+}
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -797,7 +1289,14 @@ static int                          // Return code (Always 1)
                    "  --hcdm\tHard Core Debug Mode\n"
 
                    "  --test=T\tSelect test T\n" // (For expansion)
+                   "    --test=nbody\tHeadless N-body benchmark\n"
                    "  --verbose\t{=n} Verbosity, default 0\n"
+                   "\n"
+                   "N-body options:\n"
+                   "  --bodies=n\tNumber of bodies, default 4096\n"
+                   "  --steps=n\tNumber of time steps, default 100\n"
+                   "  --theta=t\tBarnes-Hut opening angle, default 0.5\n"
+                   "  --threads=n\tNumber of threads, default all\n"
                    , __FILE__
           );
 
@@ -891,10 +1390,37 @@ static int                          // Return code (0 if OK)
            case OPT_HCDM:
              break;
 
+           case OPT_BODIES:
+             opt_bodies= parm_int();
+             if( opt_bodies < 2 ) {
+               opt_help= true;
+               fprintf(stderr, "--bodies=%s, minimum 2\n", optarg);
+             }
+             break;
+
+           case OPT_STEPS:
+             opt_steps= parm_int();
+             break;
+
            case OPT_TEST:
              opt_test= optarg;
              break;
 
+           case OPT_THETA:
+           {{{{
+             char* last= nullptr;
+             opt_theta= strtod(optarg, &last);
+             if( last == optarg || *last != '\0' || opt_theta < 0.0 ) {
+               opt_help= true;
+               fprintf(stderr, "--theta, format error: '%s'\n", optarg);
+             }
+             break;
+           }}}}
+
+           case OPT_THREADS:
+             opt_threads= parm_int();
+             break;
+
            case OPT_VERBOSE:
              if( optarg )
                opt_verbose= parm_int();
@@ -937,6 +1463,11 @@ static int                          // Return code (0 if OK)
      }
    }
 
+   if( opt_threads <= 0 )           // Default, all hardware threads
+     opt_threads= int(std::thread::hardware_concurrency());
+   if( opt_threads <= 0 )
+     opt_threads= 1;
+
    // Return sequence
    int rc= 0;
    if( opt_help )
@@ -964,6 +1495,9 @@ extern int                          // Return code
    int rc= parm(argc, argv);        // Argument analysis
    if( rc ) return rc;              // Return if invalid
 
+   if( opt_test && strcmp(opt_test, "nbody") == 0 ) // N-body benchmark?
+     return nbody();
+
    rc= init(argc, argv);            // Initialize
    if( rc ) return rc;              // Return if invalid
 
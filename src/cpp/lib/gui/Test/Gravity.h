@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2021 Frank Eskesen.
+//       Copyright (C) 2021-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Gravitational simulator objects.
 //
 // Last change date-
-//       2021/02/04
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #ifndef GRAVITY_H_INCLUDED
@@ -24,10 +24,12 @@
 
 #include <memory>                   // For std::shared_ptr, std::unique_ptr
 #include <string>                   // For std::string
+#include <vector>                   // For std::vector
 #include <math.h>                   // For sqrt(), ...
-#include <xcb/xcb_image.h>          // For xcb_image_t, associated functions
+#include <stdint.h>                 // For int32_t
 
 #include <pub/List.h>               // For pub::List
+#include <gui/Buffer.h>             // For gui::Buffer
 #include <gui/Types.h>              // For GUI types
 #include <gui/Window.h>             // For gui::Window
 
@@ -257,6 +259,96 @@ Pos                                 // Current (relative) Center of Mass
 }
 }; // struct Com
 
+//----------------------------------------------------------------------------
+//
+// Struct-
+//       sim::Bodies
+//
+// Purpose-
+//       N-body container, structure of arrays
+//
+// Implementation notes-
+//       The N-body simulation uses model units, where G == 1.
+//
+//----------------------------------------------------------------------------
+struct Bodies {                     // N-body container
+std::vector<double>    x, y, z;     // Position
+std::vector<double>    vx, vy, vz;  // Velocity
+std::vector<double>    ax, ay, az;  // Acceleration
+std::vector<double>    m;           // Mass
+
+size_t                              // The number of bodies
+   size( void ) const               // Get number of bodies
+{  return m.size(); }
+
+void
+   resize(                          // Resize
+     size_t            n)           // To this number of bodies
+{
+   x.resize(n);  y.resize(n);  z.resize(n);
+   vx.resize(n); vy.resize(n); vz.resize(n);
+   ax.resize(n); ay.resize(n); az.resize(n);
+   m.resize(n);
+}
+}; // struct Bodies
+
+//----------------------------------------------------------------------------
+//
+// Class-
+//       sim::Octree
+//
+// Purpose-
+//       Barnes-Hut octree
+//
+// Implementation notes-
+//       A cell is opened when its size/distance ratio is at least theta.
+//       A leaf holds up to LEAF_MAX bodies (more, if they're at nearly the
+//       same position), chained by next[].
+//
+//----------------------------------------------------------------------------
+class Octree {                      // Barnes-Hut octree
+public:
+enum { LEAF_MAX= 8 };               // Maximum bodies per (divisible) leaf
+
+struct Node {                       // Octree cell
+double                 cx, cy, cz;  // Center of mass
+double                 m;           // Total mass
+double                 ox, oy, oz;  // Cell center
+double                 half;        // Cell half width
+int32_t                child[8];    // Child cell indexes (-1 if none)
+int32_t                body;        // Leaf: first body index (-1 if none)
+int32_t                count;       // Leaf: number of bodies
+}; // struct Node
+
+std::vector<Node>      node;        // The cells, node[0] is the root
+std::vector<int32_t>   next;        // The next body in the same leaf
+
+void
+   accel(                           // Compute acceleration
+     Bodies&           bodies,      // Of these bodies
+     size_t            begin,       // Starting with this body
+     size_t            end,         // Ending before this body
+     double            theta,       // Opening angle
+     double            eps2) const; // Softening length squared
+
+void
+   build(                           // Build the tree
+     const Bodies&     bodies);     // From these bodies
+
+protected:
+int32_t                             // The new cell index
+   cell(                            // Allocate a cell
+     double            ox,          // Cell center X
+     double            oy,          // Cell center Y
+     double            oz,          // Cell center Z
+     double            half);       // Cell half width
+
+void
+   mass(                            // Compute centers of mass
+     const Bodies&     bodies,      // For these bodies
+     int32_t           index);      // Starting at this cell
+}; // class Octree
+
 //----------------------------------------------------------------------------
 //
 // Class-
@@ -277,10 +369,8 @@ char                   key_debug[128]= {}; // Switchable debug flags
 // XCB fields
 int                    center_x;    // X Center of screen
 int                    center_y;    // Y Center of screen
-uint32_t               pdata= 0;    // The XCB pixel manipulator data
 xcb_gcontext_t         drawGC= 0;   // The default graphic context
-xcb_image_t            image= {};   // XCB image manipulator
-xcb_image_t            pixel= {};   // XCB pixel manipulator
+gui::Buffer            buffer;      // The pixel Buffer
 
 //----------------------------------------------------------------------------
 // sim::Window::Constructor/Destructor/Operators
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2021-2023 Frank Eskesen.
+//       Copyright (C) 2021-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Testcase: Test ~/src/cpp/inc/gui/Buffer.h
 //
 // Last change date-
-//       2023/05/01
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <exception>                // For std::exception
@@ -31,6 +31,7 @@
 #include <stdarg.h>                 // For va_list
 #include <stdio.h>                  // For printf
 #include <stdlib.h>                 // For various
+#include <string.h>                 // For strcmp
 #include <unistd.h>                 // For close, ftruncate
 #include <sys/mman.h>               // For mmap, shm_open, ...
 #include <sys/stat.h>               // For S_* constants
@@ -43,6 +44,7 @@
 #include <gui/Device.h>             // For gui::Device
 #include <gui/Keysym.h>             // For X11 keysymdef.h macros
 #include <gui/Window.h>             // For gui::Window
+#include <pub/Clock.h>              // For pub::Clock
 #include <pub/Debug.h>              // For Debug object
 #include <pub/Exception.h>          // For pub::Exception
 #include <pub/utility.h>            // For utility::dump
@@ -159,6 +161,7 @@ static int                          // Return code (Always 1)
                    "  --hcdm\tHard Core Debug Mode\n"
 
                    "  --test=T\tSelect test T\n" // (For expansion)
+                   "    --test=fps\tFrames per second benchmark\n"
                    "  --verbose\t{=n} Verbosity, default 0\n"
                    , __FILE__
           );
@@ -343,6 +346,60 @@ static void
    }
 }
 
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       fps
+//
+// Purpose-
+//       Frames per second benchmark: move a box across the Buffer
+//
+//----------------------------------------------------------------------------
+static void
+   fps(                             // Frames per second benchmark
+     Tester&           window,      // On this Window
+     gui::Buffer&      buffer,      // Using this Buffer
+     bool              use_shm,     // Use MIT-SHM, if available?
+     bool              full)        // Draw full frames? (Else damage only)
+{
+   enum { FRAMES= 1000, BOX= 32 };  // Frame count, box size
+   const gui::Pixel_t BG= 0x00ffffE0; // Background color
+   const gui::Pixel_t FG= 0x00FF0000; // Box color
+
+   xcb_expose_event_t event= {};    // Full exposure
+   event.width= gui::WH_t(buffer.width);
+   event.height= gui::WH_t(buffer.height);
+
+   buffer.use_shm= use_shm;
+   buffer.clear(BG);
+   buffer.refresh(&window, window.drawGC);
+
+   unsigned range= buffer.width - BOX;
+   if( buffer.height < buffer.width )
+     range= buffer.height - BOX;
+   unsigned x= 0;                   // The box position (on the diagonal)
+   double start= pub::Clock::now();
+   for(unsigned frame= 0; frame<FRAMES; frame++) {
+     buffer.fill(x, x, BOX, BOX, BG); // Erase the old box
+     x= (x + 1) % range;
+     buffer.fill(x, x, BOX, BOX, FG); // Draw the new box
+
+     if( full ) {
+       buffer.expose(&window, window.drawGC, &event);
+       buffer.damaged= gui::Buffer::Damage();
+     } else
+       buffer.refresh(&window, window.drawGC);
+
+     // Wait for the server to complete the frame
+     free(xcb_get_input_focus_reply(window.c
+                                   , xcb_get_input_focus(window.c), nullptr));
+   }
+   double elapsed= pub::Clock::now() - start;
+
+   printf("%-4s %-6s %8.1f frames/second\n", use_shm ? "shm" : "put"
+         , full ? "full" : "damage", FRAMES / elapsed);
+}
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -396,6 +453,16 @@ extern int                          // Return code
      device.draw();
      window.show();
      window.flush();
+
+     if( opt_test && strcmp(opt_test, "fps") == 0 ) { // Benchmark?
+       printf("Buffer[%u,%u]\n", buffer.width, buffer.height);
+       fps(window, buffer, true,  false);
+       fps(window, buffer, true,  true);
+       fps(window, buffer, false, false);
+       fps(window, buffer, false, true);
+       term();
+       return 0;
+     }
      wait(window);
 
      // Buffer window
@@ -0,0 +1,748 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (C) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       Coding.cpp
+//
+// Purpose-
+//       Implement Coding.h
+//
+// Last change date-
+//       2026/10/18
+//
+// Implementation notes-
+//       The vector kernels are compiled using function target attributes, so
+//       the library itself does not require any -m compiler options. Each
+//       vector kernel processes whole blocks, returning when it can't, and the
+//       scalar kernel completes the operation.
+//
+//       The Base64 vector algorithms are those described by Wojciech Mula and
+//       Daniel Lemire, "Faster Base64 Encoding and Decoding Using AVX2
+//       Instructions", ACM Transactions on the Web 12(3), 2018.
+//
+//----------------------------------------------------------------------------
+#include <atomic>                   // For std::atomic
+#include <cstdint>                  // For integer types
+
+#include "pub/Coding.h"             // For namespace pub::coding, implemented
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  include <immintrin.h>            // For x86 intrinsics
+#  define CODING_X86 1              // (Vector kernels available)
+#else
+#  define CODING_X86 0              // (Scalar kernels only)
+#endif
+
+namespace _LIBPUB_NAMESPACE::coding {
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+enum
+{  HCDM= false                      // Hard Core Debug Mode?
+,  VERBOSE= 0                       // Verbosity, higher is more verbose
+
+,  YENC_A= 42                       // The yEnc data offset
+,  YENC_B= 42 + 64                  // The yEnc escaped data offset
+}; // enum
+
+//----------------------------------------------------------------------------
+// Internal data areas
+//----------------------------------------------------------------------------
+static constexpr char  rfc2045[65]= "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                    "abcdefghijklmnopqrstuvwxyz"
+                                    "0123456789+/";
+
+static struct Tables {              // The scalar translation tables
+int8_t                 de64[256];   // Base64 decode table (-1 if invalid)
+uint8_t                yenc[256];   // yEnc escape table (1: edge, 2: always)
+
+constexpr Tables( void )
+:  de64(), yenc()
+{
+   for(unsigned i= 0; i<256; ++i)
+     de64[i]= -1;
+   for(unsigned i= 0; i<64; ++i)
+     de64[(uint8_t)rfc2045[i]]= int8_t(i);
+
+   yenc[(uint8_t)'\0']= 2;
+   yenc[(uint8_t)'\n']= 2;
+   yenc[(uint8_t)'\r']= 2;
+   yenc[(uint8_t)'=' ]= 2;
+   yenc[(uint8_t)'\t']= 1;
+   yenc[(uint8_t)' ' ]= 1;
+   yenc[(uint8_t)'.' ]= 1;
+}
+}                      constexpr tables; // The scalar translation tables
+
+static std::atomic<int>
+                       user_level(LEVEL_AVX2); // The set_level LEVEL
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       max_level
+//
+// Purpose-
+//       Determine the highest LEVEL the CPU supports.
+//
+//----------------------------------------------------------------------------
+static int                          // The highest supported LEVEL
+   max_level( void )                // Get highest supported LEVEL
+{
+   static const int level= []() {   // (Only determined once)
+#if CODING_X86
+     __builtin_cpu_init();
+     if( __builtin_cpu_supports("avx2") )
+       return int(LEVEL_AVX2);
+     if( __builtin_cpu_supports("sse4.1") )
+       return int(LEVEL_SSE41);
+#endif
+     return int(LEVEL_SCALAR);
+   }();
+
+   return level;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       yenc_put
+//
+// Purpose-
+//       Encode one yEnc byte (scalar.)
+//
+//----------------------------------------------------------------------------
+static inline void
+   yenc_put(                        // Encode one yEnc byte
+     uint8_t           B,           // The input byte
+     char*             out,         // The output buffer
+     size_t&           o,           // (IN/OUT) The output index
+     size_t&           column,      // (IN/OUT) The current line length
+     size_t            line)        // The line length
+{
+   uint8_t C= uint8_t(B + YENC_A);
+   uint8_t R= tables.yenc[C];
+   if( R == 2 || (R == 1 && (column == 0 || column + 1 >= line)) ) {
+     out[o++]= '=';
+     ++column;
+     C= uint8_t(B + YENC_B);
+   }
+   out[o++]= char(C);
+   if( ++column >= line ) {
+     out[o++]= '\n';
+     column= 0;
+   }
+}
+
+#if CODING_X86
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       b64_decode_avx2
+//       b64_decode_sse41
+//
+// Purpose-
+//       Decode Base64 blocks (vector.)
+//
+// Implementation notes-
+//       Each character's high and low nibble select a class bit set. A
+//       character is valid if its two sets don't intersect. The nibble
+//       tables also select the offset that converts the character into its
+//       6-bit value. The multiply-add instructions then pack the 6-bit values.
+//
+//       Only blocks with valid output space are processed. The 32 (16) byte
+//       store of 24 (12) output bytes needs 44 (24) remaining characters.
+//
+//----------------------------------------------------------------------------
+__attribute__((target("avx2")))
+static void
+   b64_decode_avx2(                 // Decode Base64 blocks
+     const uint8_t*    inp,         // The input buffer
+     size_t            size,        // The input length
+     uint8_t*          out,         // The output buffer
+     size_t&           i,           // (IN/OUT) The input index
+     size_t&           o)           // (IN/OUT) The output index
+{
+   const __m256i lut_lo= _mm256_setr_epi8(
+       0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11
+     , 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A
+     , 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11
+     , 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+   const __m256i lut_hi= _mm256_setr_epi8(
+       0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08
+     , 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+     , 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08
+     , 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+   const __m256i lut_roll= _mm256_setr_epi8(
+       0,   16,  19,   4, -65, -65, -71, -71
+     , 0,    0,   0,   0,   0,   0,   0,   0
+     , 0,   16,  19,   4, -65, -65, -71, -71
+     , 0,    0,   0,   0,   0,   0,   0,   0);
+   const __m256i pack= _mm256_setr_epi8(
+       2,  1,  0,  6,  5,  4, 10,  9,  8, 14, 13, 12, -1, -1, -1, -1
+     , 2,  1,  0,  6,  5,  4, 10,  9,  8, 14, 13, 12, -1, -1, -1, -1);
+   const __m256i join= _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+   const __m256i nibble= _mm256_set1_epi8(0x0F);
+   const __m256i slash= _mm256_set1_epi8('/');
+
+   while( i + 44 <= size ) {
+     __m256i S= _mm256_loadu_si256((const __m256i*)(inp + i));
+     __m256i hi= _mm256_and_si256(_mm256_srli_epi32(S, 4), nibble);
+     __m256i lo= _mm256_and_si256(S, nibble);
+     __m256i class_lo= _mm256_shuffle_epi8(lut_lo, lo);
+     __m256i class_hi= _mm256_shuffle_epi8(lut_hi, hi);
+     if( !_mm256_testz_si256(class_lo, class_hi) )
+       return;                      // (Invalid character in block)
+
+     __m256i eq_2F= _mm256_cmpeq_epi8(S, slash);
+     __m256i roll= _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_2F, hi));
+     S= _mm256_add_epi8(S, roll);   // (The 6-bit values)
+
+     S= _mm256_maddubs_epi16(S, _mm256_set1_epi32(0x01400140));
+     S= _mm256_madd_epi16(S, _mm256_set1_epi32(0x00011000));
+     S= _mm256_shuffle_epi8(S, pack);
+     S= _mm256_permutevar8x32_epi32(S, join);
+     _mm256_storeu_si256((__m256i*)(out + o), S);
+     i += 32;
+     o += 24;
+   }
+}
+
+__attribute__((target("sse4.1")))
+static void
+   b64_decode_sse41(                // Decode Base64 blocks
+     const uint8_t*    inp,         // The input buffer
+     size_t            size,        // The input length
+     uint8_t*          out,         // The output buffer
+     size_t&           i,           // (IN/OUT) The input index
+     size_t&           o)           // (IN/OUT) The output index
+{
+   const __m128i lut_lo= _mm_setr_epi8(
+       0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11
+     , 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+   const __m128i lut_hi= _mm_setr_epi8(
+       0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08
+     , 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+   const __m128i lut_roll= _mm_setr_epi8(
+       0,   16,  19,   4, -65, -65, -71, -71
+     , 0,    0,   0,   0,   0,   0,   0,   0);
+   const __m128i pack= _mm_setr_epi8(
+       2,  1,  0,  6,  5,  4, 10,  9,  8, 14, 13, 12, -1, -1, -1, -1);
+   const __m128i nibble= _mm_set1_epi8(0x0F);
+   const __m128i slash= _mm_set1_epi8('/');
+
+   while( i + 24 <= size ) {
+     __m128i S= _mm_loadu_si128((const __m128i*)(inp + i));
+     __m128i hi= _mm_and_si128(_mm_srli_epi32(S, 4), nibble);
+     __m128i lo= _mm_and_si128(S, nibble);
+     __m128i class_lo= _mm_shuffle_epi8(lut_lo, lo);
+     __m128i class_hi= _mm_shuffle_epi8(lut_hi, hi);
+     if( !_mm_testz_si128(class_lo, class_hi) )
+       return;                      // (Invalid character in block)
+
+     __m128i eq_2F= _mm_cmpeq_epi8(S, slash);
+     __m128i roll= _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_2F, hi));
+     S= _mm_add_epi8(S, roll);      // (The 6-bit values)
+
+     S= _mm_maddubs_epi16(S, _mm_set1_epi32(0x01400140));
+     S= _mm_madd_epi16(S, _mm_set1_epi32(0x00011000));
+     S= _mm_shuffle_epi8(S, pack);
+     _mm_storeu_si128((__m128i*)(out + o), S);
+     i += 16;
+     o += 12;
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       b64_encode_avx2
+//       b64_encode_sse41
+//
+// Purpose-
+//       Encode Base64 blocks (vector.)
+//
+// Implementation notes-
+//       Each 3 byte group is shuffled into a 32-bit word, the multiply
+//       instructions separate the 6-bit values, and the value ranges are
+//       converted into characters using a range offset table.
+//
+//       The 16 byte loads of 12 used bytes need 16 (28) remaining bytes.
+//
+//----------------------------------------------------------------------------
+__attribute__((target("avx2")))
+static void
+   b64_encode_avx2(                 // Encode Base64 blocks
+     const uint8_t*    inp,         // The input buffer
+     size_t            size,        // The input length
+     char*             out,         // The output buffer
+     size_t&           i,           // (IN/OUT) The input index
+     size_t&           o)           // (IN/OUT) The output index
+{
+   const __m256i split= _mm256_setr_epi8(
+       1,  0,  2,  1,  4,  3,  5,  4,  7,  6,  8,  7, 10,  9, 11, 10
+     , 1,  0,  2,  1,  4,  3,  5,  4,  7,  6,  8,  7, 10,  9, 11, 10);
+   const __m256i offset= _mm256_setr_epi8(
+       'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52
+     , '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62
+     , '/' - 63, 'A', 0, 0
+     , 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52
+     , '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62
+     , '/' - 63, 'A', 0, 0);
+
+   while( i + 28 <= size ) {
+     __m256i S= _mm256_inserti128_si256(
+         _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(inp + i)))
+         , _mm_loadu_si128((const __m128i*)(inp + i + 12)), 1);
+     S= _mm256_shuffle_epi8(S, split);
+
+     __m256i t0= _mm256_and_si256(S, _mm256_set1_epi32(0x0FC0FC00));
+     __m256i t1= _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+     __m256i t2= _mm256_and_si256(S, _mm256_set1_epi32(0x003F03F0));
+     __m256i t3= _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+     S= _mm256_or_si256(t1, t3);    // (The 6-bit values)
+
+     __m256i R= _mm256_subs_epu8(S, _mm256_set1_epi8(51));
+     __m256i L= _mm256_cmpgt_epi8(_mm256_set1_epi8(26), S);
+     R= _mm256_or_si256(R, _mm256_and_si256(L, _mm256_set1_epi8(13)));
+     S= _mm256_add_epi8(S, _mm256_shuffle_epi8(offset, R));
+     _mm256_storeu_si256((__m256i*)(out + o), S);
+     i += 24;
+     o += 32;
+   }
+}
+
+__attribute__((target("sse4.1")))
+static void
+   b64_encode_sse41(                // Encode Base64 blocks
+     const uint8_t*    inp,         // The input buffer
+     size_t            size,        // The input length
+     char*             out,         // The output buffer
+     size_t&           i,           // (IN/OUT) The input index
+     size_t&           o)           // (IN/OUT) The output index
+{
+   const __m128i split= _mm_setr_epi8(
+       1,  0,  2,  1,  4,  3,  5,  4,  7,  6,  8,  7, 10,  9, 11, 10);
+   const __m128i offset= _mm_setr_epi8(
+       'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52
+     , '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62
+     , '/' - 63, 'A', 0, 0);
+
+   while( i + 16 <= size ) {
+     __m128i S= _mm_loadu_si128((const __m128i*)(inp + i));
+     S= _mm_shuffle_epi8(S, split);
+
+     __m128i t0= _mm_and_si128(S, _mm_set1_epi32(0x0FC0FC00));
+     __m128i t1= _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+     __m128i t2= _mm_and_si128(S, _mm_set1_epi32(0x003F03F0));
+     __m128i t3= _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+     S= _mm_or_si128(t1, t3);       // (The 6-bit values)
+
+     __m128i R= _mm_subs_epu8(S, _mm_set1_epi8(51));
+     __m128i L= _mm_cmpgt_epi8(_mm_set1_epi8(26), S);
+     R= _mm_or_si128(R, _mm_and_si128(L, _mm_set1_epi8(13)));
+     S= _mm_add_epi8(S, _mm_shuffle_epi8(offset, R));
+     _mm_storeu_si128((__m128i*)(out + o), S);
+     i += 12;
+     o += 16;
+   }
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       yenc_decode_avx2
+//       yenc_decode_sse41
+//
+// Purpose-
+//       Decode yEnc blocks (vector.)
+//
+// Implementation notes-
+//       The whole block is converted and stored, but only the characters
+//       preceding the first '=', '\n' or '\r' are used. That character is
+//       then handled by the caller's scalar code.
+//
+//----------------------------------------------------------------------------
+__attribute__((target("avx2")))
+static size_t                       // The number of characters decoded
+   yenc_decode_avx2(                // Decode a yEnc block
+     const uint8_t*    inp,         // The input block
+     uint8_t*          out)         // The output block
+{
+   __m256i S= _mm256_loadu_si256((const __m256i*)inp);
+   __m256i M= _mm256_or_si256(
+       _mm256_cmpeq_epi8(S, _mm256_set1_epi8('='))
+     , _mm256_or_si256(_mm256_cmpeq_epi8(S, _mm256_set1_epi8('\n'))
+                     , _mm256_cmpeq_epi8(S, _mm256_set1_epi8('\r'))));
+   S= _mm256_sub_epi8(S, _mm256_set1_epi8(YENC_A));
+   _mm256_storeu_si256((__m256i*)out, S);
+
+   uint32_t mask= uint32_t(_mm256_movemask_epi8(M));
+   if( mask == 0 )
+     return 32;
+   return size_t(__builtin_ctz(mask));
+}
+
+__attribute__((target("sse4.1")))
+static size_t                       // The number of characters decoded
+   yenc_decode_sse41(               // Decode a yEnc block
+     const uint8_t*    inp,         // The input block
+     uint8_t*          out)         // The output block
+{
+   __m128i S= _mm_loadu_si128((const __m128i*)inp);
+   __m128i M= _mm_or_si128(
+       _mm_cmpeq_epi8(S, _mm_set1_epi8('='))
+     , _mm_or_si128(_mm_cmpeq_epi8(S, _mm_set1_epi8('\n'))
+                  , _mm_cmpeq_epi8(S, _mm_set1_epi8('\r'))));
+   S= _mm_sub_epi8(S, _mm_set1_epi8(YENC_A));
+   _mm_storeu_si128((__m128i*)out, S);
+
+   uint32_t mask= uint32_t(_mm_movemask_epi8(M));
+   if( mask == 0 )
+     return 16;
+   return size_t(__builtin_ctz(mask));
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       yenc_encode_avx2
+//       yenc_encode_sse41
+//
+// Purpose-
+//       Encode yEnc blocks (vector.)
+//
+// Implementation notes-
+//       The whole block is converted and stored, but only the bytes preceding
+//       the first byte that always needs an escape sequence are used. The
+//       caller limits the used length so that whitespace is never at the
+//       beginning or end of a line.
+//
+//----------------------------------------------------------------------------
+__attribute__((target("avx2")))
+static size_t                       // The number of bytes encoded
+   yenc_encode_avx2(                // Encode a yEnc block
+     const uint8_t*    inp,         // The input block
+     char*             out)         // The output block
+{
+   __m256i S= _mm256_loadu_si256((const __m256i*)inp);
+   S= _mm256_add_epi8(S, _mm256_set1_epi8(YENC_A));
+   __m256i M= _mm256_or_si256(
+       _mm256_or_si256(_mm256_cmpeq_epi8(S, _mm256_setzero_si256())
+                     , _mm256_cmpeq_epi8(S, _mm256_set1_epi8('=')))
+     , _mm256_or_si256(_mm256_cmpeq_epi8(S, _mm256_set1_epi8('\n'))
+                     , _mm256_cmpeq_epi8(S, _mm256_set1_epi8('\r'))));
+   _mm256_storeu_si256((__m256i*)out, S);
+
+   uint32_t mask= uint32_t(_mm256_movemask_epi8(M));
+   if( mask == 0 )
+     return 32;
+   return size_t(__builtin_ctz(mask));
+}
+
+__attribute__((target("sse4.1")))
+static size_t                       // The number of bytes encoded
+   yenc_encode_sse41(               // Encode a yEnc block
+     const uint8_t*    inp,         // The input block
+     char*             out)         // The output block
+{
+   __m128i S= _mm_loadu_si128((const __m128i*)inp);
+   S= _mm_add_epi8(S, _mm_set1_epi8(YENC_A));
+   __m128i M= _mm_or_si128(
+       _mm_or_si128(_mm_cmpeq_epi8(S, _mm_setzero_si128())
+                  , _mm_cmpeq_epi8(S, _mm_set1_epi8('=')))
+     , _mm_or_si128(_mm_cmpeq_epi8(S, _mm_set1_epi8('\n'))
+                  , _mm_cmpeq_epi8(S, _mm_set1_epi8('\r'))));
+   _mm_storeu_si128((__m128i*)out, S);
+
+   uint32_t mask= uint32_t(_mm_movemask_epi8(M));
+   if( mask == 0 )
+     return 16;
+   return size_t(__builtin_ctz(mask));
+}
+#endif // CODING_X86
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       get_level
+//       get_name
+//       set_level
+//
+// Purpose-
+//       Get the current kernel LEVEL
+//       Get a LEVEL's name
+//       Set the kernel LEVEL
+//
+//----------------------------------------------------------------------------
+int                                 // The current LEVEL
+   get_level( void )                // Get current LEVEL
+{
+   int level= user_level.load(std::memory_order_relaxed);
+   int limit= max_level();
+   return level < limit ? level : limit;
+}
+
+const char*                         // The LEVEL name
+   get_name(                        // Get LEVEL name
+     int               level)       // For this LEVEL
+{
+   switch( level ) {
+     case LEVEL_SCALAR:
+       return "scalar";
+
+     case LEVEL_SSE41:
+       return "sse4.1";
+
+     case LEVEL_AVX2:
+       return "avx2";
+
+     default:
+       break;
+   }
+
+   return "invalid";
+}
+
+int                                 // The resultant LEVEL
+   set_level(                       // Set the kernel LEVEL
+     int               level)       // (No higher than the CPU supports)
+{
+   if( level < LEVEL_SCALAR )
+     level= LEVEL_SCALAR;
+   user_level.store(level, std::memory_order_relaxed);
+   return get_level();
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       base64_decode
+//
+// Purpose-
+//       Decode complete, valid Base64 character groups.
+//
+//----------------------------------------------------------------------------
+size_t                              // The decoded (output) length
+   base64_decode(                   // Decode Base64 groups
+     const char*       addr,        // The input buffer
+     size_t            size,        // The input length
+     void*             buff,        // The output buffer
+     size_t&           used)        // (OUTPUT) The input length decoded
+{
+   const uint8_t* inp= (const uint8_t*)addr;
+   uint8_t* out= (uint8_t*)buff;
+   size_t i= 0;                     // The input index
+   size_t o= 0;                     // The output index
+
+#if CODING_X86
+   int level= get_level();
+   if( level >= LEVEL_AVX2 )
+     b64_decode_avx2(inp, size, out, i, o);
+   if( level >= LEVEL_SSE41 )
+     b64_decode_sse41(inp, size, out, i, o);
+#endif
+
+   while( i + 4 <= size ) {
+     int A= tables.de64[inp[i+0]];
+     int B= tables.de64[inp[i+1]];
+     int C= tables.de64[inp[i+2]];
+     int D= tables.de64[inp[i+3]];
+     if( (A | B | C | D) < 0 )
+       break;
+
+     uint32_t word= (A << 18) | (B << 12) | (C << 6) | D;
+     out[o+0]= uint8_t(word >> 16);
+     out[o+1]= uint8_t(word >>  8);
+     out[o+2]= uint8_t(word);
+     i += 4;
+     o += 3;
+   }
+
+   used= i;
+   return o;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       base64_encode
+//
+// Purpose-
+//       Encode Base64, including any trailing PAD_CHARs.
+//
+//----------------------------------------------------------------------------
+size_t                              // The encoded (output) length
+   base64_encode(                   // Encode Base64
+     const void*       addr,        // The input buffer
+     size_t            size,        // The input length
+     char*             out)         // The output buffer
+{
+   const uint8_t* inp= (const uint8_t*)addr;
+   size_t i= 0;                     // The input index
+   size_t o= 0;                     // The output index
+
+#if CODING_X86
+   int level= get_level();
+   if( level >= LEVEL_AVX2 )
+     b64_encode_avx2(inp, size, out, i, o);
+   if( level >= LEVEL_SSE41 )
+     b64_encode_sse41(inp, size, out, i, o);
+#endif
+
+   for(; i + 3 <= size; i += 3) {
+     uint32_t word= (inp[i] << 16) | (inp[i+1] << 8) | inp[i+2];
+     out[o++]= rfc2045[(word >> 18) & 0x003F];
+     out[o++]= rfc2045[(word >> 12) & 0x003F];
+     out[o++]= rfc2045[(word >>  6) & 0x003F];
+     out[o++]= rfc2045[(word      ) & 0x003F];
+   }
+
+   if( i < size ) {                 // Encode the PAD_CHAR group
+     uint32_t word= inp[i] << 16;
+     if( i + 1 < size )
+       word |= inp[i+1] << 8;
+
+     out[o++]= rfc2045[(word >> 18) & 0x003F];
+     out[o++]= rfc2045[(word >> 12) & 0x003F];
+     out[o++]= i + 1 < size ? rfc2045[(word >> 6) & 0x003F] : '=';
+     out[o++]= '=';
+   }
+
+   return o;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       yenc_decode
+//
+// Purpose-
+//       Decode yEnc data.
+//
+//----------------------------------------------------------------------------
+size_t                              // The decoded (output) length
+   yenc_decode(                     // Decode yEnc data
+     const char*       addr,        // The input buffer
+     size_t            size,        // The input length
+     void*             buff,        // The output buffer
+     size_t&           used,        // (OUTPUT) The input length decoded
+     bool&             escape)      // (IN/OUT) Escape sequence pending
+{
+   const uint8_t* inp= (const uint8_t*)addr;
+   uint8_t* out= (uint8_t*)buff;
+   size_t i= 0;                     // The input index
+   size_t o= 0;                     // The output index
+
+#if CODING_X86
+   int level= get_level();
+   size_t W= 0;                     // The vector width
+   if( level >= LEVEL_AVX2 )
+     W= 32;
+   else if( level >= LEVEL_SSE41 )
+     W= 16;
+#endif
+
+   while( i < size ) {
+#if CODING_X86
+     if( W && !escape && i + W <= size ) {
+       size_t n;
+       if( W == 32 )
+         n= yenc_decode_avx2(inp + i, out + o);
+       else
+         n= yenc_decode_sse41(inp + i, out + o);
+       i += n;
+       o += n;
+       if( n == W )
+         continue;
+     }
+#endif
+
+     uint8_t C= inp[i];
+     if( escape ) {
+       if( C == '\n' || C == '\r' || C == 'y' ) // If invalid escape sequence
+         break;
+
+       out[o++]= uint8_t(C - YENC_B);
+       escape= false;
+     } else if( C == '=' ) {
+       escape= true;
+     } else if( C != '\n' && C != '\r' ) {
+       out[o++]= uint8_t(C - YENC_A);
+     }
+     ++i;
+   }
+
+   used= i;
+   return o;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       yenc_encode
+//
+// Purpose-
+//       Encode yEnc data.
+//
+// Implementation notes-
+//       Vector blocks are only used within a line, never at its first or
+//       last character, where whitespace must also be escaped.
+//
+//----------------------------------------------------------------------------
+size_t                              // The encoded (output) length
+   yenc_encode(                     // Encode yEnc data
+     const void*       addr,        // The input buffer
+     size_t            size,        // The input length
+     char*             out,         // The output buffer
+     size_t&           column,      // (IN/OUT) The current line length
+     size_t            line)        // The line length
+{
+   const uint8_t* inp= (const uint8_t*)addr;
+   size_t i= 0;                     // The input index
+   size_t o= 0;                     // The output index
+
+#if CODING_X86
+   int level= get_level();
+   size_t W= 0;                     // The vector width
+   if( level >= LEVEL_AVX2 )
+     W= 32;
+   else if( level >= LEVEL_SSE41 )
+     W= 16;
+
+   if( W ) {
+     while( i + W <= size ) {
+       if( column > 0 && column + 1 < line ) {
+         size_t n;
+         if( W == 32 )
+           n= yenc_encode_avx2(inp + i, out + o);
+         else
+           n= yenc_encode_sse41(inp + i, out + o);
+         if( n > line - 1 - column )
+           n= line - 1 - column;
+         i += n;
+         o += n;
+         column += n;
+         if( n == W )
+           continue;
+       }
+
+       yenc_put(inp[i++], out, o, column, line);
+     }
+   }
+#endif
+
+   while( i < size )
+     yenc_put(inp[i++], out, o, column, line);
+
+   return o;
+}
+}  // namespace _LIBPUB_NAMESPACE::coding
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2018-2023 Frank Eskesen.
+//       Copyright (C) 2018-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,11 +16,16 @@
 //       Implement Dispatch object methods
 //
 // Last change date-
-//       2023/06/20
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <assert.h>                 // For assert
+#include <math.h>                   // For ceil, floor
+#include <stdint.h>                 // For uint64_t, uintptr_t
+#include <memory>                   // For std::unique_ptr
 #include <mutex>                    // For std::lock_guard
+#include <utility>                  // For std::pair
+#include <vector>                   // For std::vector
 
 #include <pub/Clock.h>              // DispatchTTL completion time
 #include <pub/Debug.h>              // For debugging
@@ -134,14 +139,7 @@ void
 void
    Disp::cancel(                    // Cancel
      void*             token)       // This timer event
-{
-   std::lock_guard<decltype(mutex)> lock(mutex);
-
-   if( timers == nullptr )
-     timers= new Timers();
-
-   timers->cancel(token);
-}
+{  get_timers()->cancel(token); }
 
 //----------------------------------------------------------------------------
 //
@@ -171,13 +169,37 @@ void*                               // Cancellation token
    Disp::delay(                     // Delay for
      double            seconds,     // This many seconds, then
      Item*             workItem)    // Complete this work Item
+{  return get_timers()->delay(seconds, nullptr, workItem); }
+
+void*                               // Cancellation token
+   Disp::delay(                     // Delay for
+     double            seconds,     // This many seconds, then
+     Task*             task,        // Enqueue onto this Task
+     Item*             workItem)    // This work Item
+{  return get_timers()->delay(seconds, task, workItem); }
+
+//----------------------------------------------------------------------------
+//
+// Method-
+//       dispatch::Disp::get_timers
+//
+// Purpose-
+//       Get (or create) the Timers Thread.
+//
+// Implementation notes-
+//       The mutex is only held while locating the Timers Thread. Timers
+//       serializes delay and cancel requests itself.
+//
+//----------------------------------------------------------------------------
+Timers*                             // The Timers Thread
+   Disp::get_timers( void )         // Get (or create) the Timers Thread
 {
    std::lock_guard<decltype(mutex)> lock(mutex);
 
    if( timers == nullptr )
      timers= new Timers();
 
-   return timers->delay(seconds, workItem);
+   return timers;
 }
 
 //----------------------------------------------------------------------------
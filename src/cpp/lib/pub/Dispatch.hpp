@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2018-2023 Frank Eskesen.
+//       Copyright (C) 2018-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Work dispatcher, including local definitions.
 //
 // Last change date-
-//       2023/05/28
+//       2026/10/18
 //
 // Implementation note-
 //       *ONLY* included from Dispatch.cpp (in namespace pub::dispatch)
@@ -59,31 +59,29 @@ virtual void                        // (IMPLEMENT this method)
 
 //----------------------------------------------------------------------------
 //
-// Class-
+// Struct-
 //       DispatchTTL
 //
 // Purpose-
 //       Dispatch Timer Thread Link: Keep track of delay request.
 //
+// Implementation notes-
+//       DispatchTTLs are allocated in chunks and never released. Unused
+//       DispatchTTLs are kept on the Timers free list. The generation number
+//       changes whenever a DispatchTTL is released, invalidating any
+//       cancellation token that refers to it.
+//
 //----------------------------------------------------------------------------
-class DispatchTTL : public List<DispatchTTL>::Link {
-//----------------------------------------------------------------------------
-// DispatchTTL::Attributes
-//----------------------------------------------------------------------------
-public:
-Clock const            time;        // The proposed completion time
-Item* const            item;        // The work Item
-
-//----------------------------------------------------------------------------
-// DispatchTTL::Constructors
-//----------------------------------------------------------------------------
-public:
-   ~DispatchTTL( void ) {}          // Destructor
-   DispatchTTL(                     // Constructor
-     Clock&            time,        // Completion time
-     Item*             item)        // WorkUnit object
-:  List<DispatchTTL>::Link(), time(time), item(item) {}
-}; // class DispatchTTL
+struct DispatchTTL {                // Dispatch Timer Thread Link
+DispatchTTL*           next;        // Next DispatchTTL (slot or free list)
+DispatchTTL*           prev;        // Prior DispatchTTL (slot list)
+Item*                  item;        // The work Item (nullptr if unused)
+Task*                  task;        // The target Task (nullptr: post Item)
+uint64_t               tick;        // The completion tick
+uint32_t               index;       // The DispatchTTL index (constant)
+uint32_t               generation;  // The generation number
+uint32_t               slot;        // The wheel slot index
+}; // struct DispatchTTL
 
 //----------------------------------------------------------------------------
 //
@@ -93,15 +91,63 @@ public:
 // Purpose-
 //       Handle time delay requests.
 //
+// Implementation notes-
+//       Pending delays are kept in a hierarchical timing wheel of LEVELS
+//       levels, each containing SLOTS slots. A level 0 slot represents one
+//       tick, a level 1 slot SLOTS ticks, and so on. Each slot holds a
+//       (doubly linked, unordered) list of DispatchTTLs, so that inserting
+//       and removing a delay takes constant time.
+//
+//       When the level 0 wheel wraps, the current slot of the next higher
+//       level is cascaded, redistributing its DispatchTTLs into the lower
+//       levels. Every DispatchTTL in a level 0 slot completes when that slot
+//       is reached.
+//
+//       Completed Items are collected while the mutex is held, then posted
+//       (or enqueued onto their Task) after it's released. Done callbacks
+//       may therefore use delay() and cancel().
+//
 //----------------------------------------------------------------------------
 class Timers : public Thread, public Named {
+//----------------------------------------------------------------------------
+// Timers::Enumerations and typedefs
+//----------------------------------------------------------------------------
+public:
+enum                                // Generic enum
+{  TICK_RATE= 64                    // Ticks per second
+,  SLOT_BITS= 8                     // log2(SLOTS)
+,  SLOTS= 1 << SLOT_BITS            // The number of slots per level
+,  LEVELS= 4                        // The number of wheel levels
+,  CHUNK= 4096                      // DispatchTTLs per allocation
+}; // enum
+
+static constexpr uint64_t
+                       MAX_DELTA=   // Maximum wheel range, in ticks
+                           (uint64_t(1) << (SLOT_BITS * LEVELS)) - 1;
+
+static_assert(sizeof(void*) >= sizeof(uint64_t)
+             , "Cancellation token encoding requires 64-bit pointers");
+
+typedef std::pair<Task*, Item*>    Done_t; // A completed (or purged) delay
+
 //----------------------------------------------------------------------------
 // Timers::Attributes
 //----------------------------------------------------------------------------
 protected:
 Semaphore              event;       // Synchronization event object
-List<DispatchTTL>      list;        // Ordered list of pending events
 Latch                  mutex;       // Synchronization mutex
+
+std::vector<std::unique_ptr<DispatchTTL[]>>
+                       chunk;       // The DispatchTTL allocation chunks
+DispatchTTL*           free_list= nullptr; // The unused DispatchTTL list
+DispatchTTL*           wheel[LEVELS * SLOTS]= {}; // The timing wheel
+uint64_t               in_use[LEVELS * SLOTS / 64]= {}; // Non-empty slot map
+
+std::vector<Done_t>    done;        // Completed delays (Timers Thread only)
+double                 origin;      // The Clock time of tick 0
+uint64_t               current= 0;  // The last processed tick
+uint64_t               wakeup= 0;   // The next tick the Thread examines
+size_t                 count= 0;    // The number of pending delays
 bool                   operational; // TRUE iff operational
 
 //----------------------------------------------------------------------------
@@ -112,9 +158,221 @@ virtual
    ~Timers( void ) {}               // Destructor
    Timers( void )                   // Constructor
 :  Thread(), Named("DispatchTime")
-,  event(), list(), mutex(), operational(true)
+,  event(), mutex(), origin(Clock::now()), operational(true)
 {  start(); }
 
+//----------------------------------------------------------------------------
+// Timers::Internal methods (mutex held)
+//----------------------------------------------------------------------------
+protected:
+DispatchTTL*                        // The DispatchTTL
+   allocate( void )                 // Allocate a DispatchTTL
+{
+   if( free_list == nullptr ) {     // If no unused DispatchTTLs
+     uint32_t index= uint32_t(chunk.size() * CHUNK);
+     DispatchTTL* array= new DispatchTTL[CHUNK];
+     chunk.emplace_back(array);
+     for(unsigned i= CHUNK; i > 0; i--) {
+       DispatchTTL* link= array + i - 1;
+       link->item= nullptr;
+       link->index= index + i - 1;
+       link->generation= 0;
+       link->next= free_list;
+       free_list= link;
+     }
+   }
+
+   DispatchTTL* link= free_list;
+   free_list= link->next;
+   return link;
+}
+
+void
+   release(                         // Release a DispatchTTL
+     DispatchTTL*      link)        // The (unlinked) DispatchTTL
+{
+   link->item= nullptr;
+   link->generation++;              // (Invalidates its cancellation token)
+   link->next= free_list;
+   free_list= link;
+}
+
+DispatchTTL*                        // The pending DispatchTTL, or nullptr
+   locate(                          // Locate a DispatchTTL
+     void*             token)       // From this cancellation token
+{
+   uint64_t ident= uint64_t(uintptr_t(token));
+   uint64_t index= uint32_t(ident) - uint64_t(1);
+   if( index >= chunk.size() * CHUNK )
+     return nullptr;
+
+   DispatchTTL* link= &chunk[index / CHUNK][index % CHUNK];
+   if( link->item == nullptr || link->generation != uint32_t(ident >> 32) )
+     return nullptr;
+
+   return link;
+}
+
+static void*                        // The cancellation token
+   token(                           // Get cancellation token
+     DispatchTTL*      link)        // For this DispatchTTL
+{
+   uint64_t ident= (uint64_t(link->generation) << 32) | (link->index + 1);
+   return (void*)uintptr_t(ident);
+}
+
+void
+   insert(                          // Insert a DispatchTTL into the wheel
+     DispatchTTL*      link)        // The DispatchTTL
+{
+   uint64_t tick= link->tick;
+   if( tick <= current )            // (Completes on the next tick)
+     tick= current + 1;
+   if( tick - current > MAX_DELTA ) // (Reinserted when reached)
+     tick= current + MAX_DELTA;
+
+   uint64_t delta= tick - current;
+   unsigned level= 0;
+   while( level < LEVELS - 1 && (delta >> (SLOT_BITS * (level + 1))) != 0 )
+     level++;
+
+   uint32_t slot= level * SLOTS
+                + ((tick >> (SLOT_BITS * level)) & (SLOTS - 1));
+   link->slot= slot;
+   link->prev= nullptr;
+   link->next= wheel[slot];
+   if( link->next )
+     link->next->prev= link;
+   wheel[slot]= link;
+   in_use[slot / 64] |= uint64_t(1) << (slot % 64);
+}
+
+void
+   remove(                          // Remove a DispatchTTL from the wheel
+     DispatchTTL*      link)        // The DispatchTTL
+{
+   uint32_t slot= link->slot;
+   if( link->prev )
+     link->prev->next= link->next;
+   else
+     wheel[slot]= link->next;
+   if( link->next )
+     link->next->prev= link->prev;
+
+   if( wheel[slot] == nullptr )
+     in_use[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+}
+
+DispatchTTL*                        // The slot's DispatchTTL list
+   detach(                          // Empty a wheel slot
+     uint32_t          slot)        // The slot index
+{
+   DispatchTTL* list= wheel[slot];
+   wheel[slot]= nullptr;
+   in_use[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+   return list;
+}
+
+void
+   advance(                         // Advance the wheel
+     uint64_t          tick)        // Through this tick
+{
+   while( current < tick ) {
+     current++;
+
+     // When level 0 wraps, cascade the higher levels' current slots
+     for(unsigned level= 1; level < LEVELS; level++) {
+       if( (current & ((uint64_t(1) << (SLOT_BITS * level)) - 1)) != 0 )
+         break;
+
+       uint32_t slot= level * SLOTS
+                    + ((current >> (SLOT_BITS * level)) & (SLOTS - 1));
+       DispatchTTL* link= detach(slot);
+       while( link ) {
+         DispatchTTL* next= link->next;
+         insert(link);
+         link= next;
+       }
+     }
+
+     // Complete the current level 0 slot
+     DispatchTTL* link= detach(uint32_t(current & (SLOTS - 1)));
+     while( link ) {
+       DispatchTTL* next= link->next;
+       if( link->tick > current ) { // If beyond the wheel's range
+         insert(link);
+       } else {
+         done.emplace_back(link->task, link->item);
+         release(link);
+         count--;
+       }
+       link= next;
+     }
+   }
+}
+
+uint64_t                            // The next tick to examine
+   next_tick( void ) const          // Get next tick to examine
+{
+   if( count == 0 )                 // If nothing pending
+     return current + 60 * TICK_RATE;
+
+   // The next non-empty level 0 slot before level 0 wraps, else the wrap
+   unsigned base= unsigned(current & (SLOTS - 1));
+   unsigned slot= base + 1;
+   while( slot < SLOTS ) {
+     uint64_t word= in_use[slot / 64] >> (slot % 64);
+     if( word == 0 ) {
+       slot= (slot | 63) + 1;
+       continue;
+     }
+
+     while( (word & 1) == 0 ) {
+       word >>= 1;
+       slot++;
+     }
+     return current + (slot - base);
+   }
+
+   return current + (SLOTS - base);
+}
+
+uint64_t                            // The elapsed tick count
+   elapsed( void ) const            // Get the elapsed tick count
+{
+   double tick= floor((Clock::now() - origin) * TICK_RATE);
+   if( tick < 0.0 )                 // (If the Clock was set back)
+     tick= 0.0;
+   return uint64_t(tick);
+}
+
+uint64_t                            // The tick
+   tick_of(                         // Convert Clock time to tick
+     double            time) const  // The Clock time
+{
+   double tick= ceil((time - origin) * TICK_RATE);
+   if( !(tick < 1.0e18) )           // (Also handles NaN)
+     tick= 1.0e18;
+   if( tick < 0.0 )
+     tick= 0.0;
+   return uint64_t(tick);
+}
+
+static void
+   complete(                        // Complete delays
+     std::vector<Done_t>&
+                       list,        // The completed delay list
+     int               cc)          // With this completion code
+{
+   for(Done_t& entry : list) {
+     if( entry.first && cc == Item::CC_NORMAL )
+       entry.first->enqueue(entry.second);
+     else
+       entry.second->post(cc);
+   }
+   list.clear();
+}
+
 //----------------------------------------------------------------------------
 // Timers::Methods
 //----------------------------------------------------------------------------
@@ -124,102 +382,111 @@ void
      void*             token)       // This timer event
 {  if( HCDM ) traceh("dispatch::Timers::cancel(%p)\n", token);
 
-   std::lock_guard<decltype(mutex)> lock(mutex);
+   Item* item= nullptr;
+   {{{{
+     std::lock_guard<decltype(mutex)> lock(mutex);
 
-   DispatchTTL* link= list.get_head();
-   while( link ) {
-     if( (void*)link == token ) {
-       list.remove(link, link);
-       link->item->post(Item::CC_PURGE);
-       delete link;
-       break;
+     DispatchTTL* link= locate(token);
+     if( link ) {
+       item= link->item;
+       remove(link);
+       release(link);
+       count--;
      }
-   }
+   }}}}
+
+   if( item )
+     item->post(Item::CC_PURGE);
 }
 
 void*                               // Cancellation token
    delay(                           // Delay for
      double            seconds,     // This many seconds, then
-     Item*             item)        // Complete this work Item
+     Task*             task,        // Enqueue onto this Task (or post)
+     Item*             item)        // This work Item
 {
-   if( seconds < 0.015625 ) {       // If interval too short
-     item->post();
+   if( seconds < 1.0 / TICK_RATE ) { // If interval too short
+     if( task )
+       task->enqueue(item);
+     else
+       item->post();
      return nullptr;
    }
 
-   Clock time(Clock::now() + seconds);
-   DispatchTTL* link= new DispatchTTL(time, item);
-
-   std::lock_guard<decltype(mutex)> lock(mutex);
+   uint64_t tick= tick_of(Clock::now() + seconds);
+   void* token= nullptr;
+   bool wake= false;
+   {{{{
+     std::lock_guard<decltype(mutex)> lock(mutex);
+
+     if( operational ) {
+       DispatchTTL* link= allocate();
+       link->item= item;
+       link->task= task;
+       link->tick= tick;
+       insert(link);
+       count++;
+
+       token= Timers::token(link);
+       wake= tick < wakeup;         // If before the Thread's next wakeup
+     }
+   }}}}
 
-   if( !operational ) {
+   if( token == nullptr ) {         // If not operational
      item->post(Item::CC_PURGE);
-     delete link;
      return nullptr;
    }
 
-   DispatchTTL* after= nullptr;
-   DispatchTTL* work= list.get_head();
-   while( work ) {
-     if( link->time < work->time )
-       break;
-
-     after= work;
-     work= work->get_next();
-   }
-
-   list.insert(after, link, link);
-   if( after == nullptr )           // If new head of list
-     event.post();                  // Use the new timeout
+   if( wake )                       // Use the new timeout
+     event.post();
 
    if( HCDM )
-     traceh("%p= dispatch::Timers::delay(%8.6f, %p)\n", link, seconds, item);
-   return link;
+     traceh("%p= dispatch::Timers::delay(%8.6f, %p, %p)\n"
+           , token, seconds, task, item);
+   return token;
 }
 
 virtual void                        // Operate the Thread
    run()
 {  if( HCDM ) traceh("dispatch::Timers running...\n");
 
-   while( operational ) {
-     double delay= 60.0;            // Minimum wait delay (seconds)
+   for(;;) {
+     double delay;                  // Wait delay (seconds)
 
      {{{{
        std::lock_guard<decltype(mutex)> lock(mutex);
 
-       // Drive all expired timers
-       DispatchTTL* link= list.get_head();
-       while( link ) {
-         delay= link->time.get() - Clock::now();
-         if( delay > 0.015625 ) {
-           if( delay > 60.0 )
-             delay= 60.0;
+       if( !operational )
+         break;
 
-           break;
-         }
-
-         list.remove(link, link);
-         link->item->post();
-         delete link;
-
-         link= list.get_head();
-       }
+       // Collect all expired timers
+       advance(elapsed());
+       wakeup= next_tick();
+       delay= origin + double(wakeup) / TICK_RATE - Clock::now();
      }}}}
 
+     complete(done, Item::CC_NORMAL);
+     if( delay > 60.0 )
+       delay= 60.0;
      event.wait(delay);
    }
 
    // Non-operational. Purge all timers before we go.
-   std::lock_guard<decltype(mutex)> lock(mutex);
+   {{{{
+     std::lock_guard<decltype(mutex)> lock(mutex);
 
-   DispatchTTL* link= list.get_head();
-   while( link ) {
-     list.remove(link, link);
-     link->item->post(Item::CC_PURGE);
-     delete link;
-
-     link= list.get_head();
-   }
+     for(uint32_t slot= 0; slot < LEVELS * SLOTS; slot++) {
+       DispatchTTL* link= detach(slot);
+       while( link ) {
+         DispatchTTL* next= link->next;
+         done.emplace_back(link->task, link->item);
+         release(link);
+         link= next;
+       }
+     }
+     count= 0;
+   }}}}
+   complete(done, Item::CC_PURGE);
 
    if( HCDM ) traceh("dispatch::Timers ...terminated\n");
 }
@@ -228,9 +495,10 @@ virtual void
    stop( void )                     // Terminate the Thread
 {  if( HCDM ) traceh("dispatch::Timers::stop\n");
 
-   std::lock_guard<decltype(mutex)> lock(mutex);
-
-   operational= false;
+   {{{{
+     std::lock_guard<decltype(mutex)> lock(mutex);
+     operational= false;
+   }}}}
    event.post();
 }
 }; // class Timers
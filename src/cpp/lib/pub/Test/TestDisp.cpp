@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2018-2024 Frank Eskesen.
+//       Copyright (c) 2018-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       Test the Dispatch objects.
 //
 // Last change date-
-//       2024/03/04
+//       2026/10/18
 //
 // Arguments: (For test_timing only)
 //       TestDisp --timing          // (Only run timing test)
@@ -30,6 +30,10 @@
 //       [2]*([1]-[4]) Number of opertion completion waits
 //       [2]*[1]*([3]+1) Number of operations
 //
+// Arguments: (For test_timers only)
+//       TestDisp --timers          // (Only run delay timer test)
+//       [1] 1000000 Number of outstanding delays
+//
 // Implementation notes-
 //       See ./.TIMING for timing test information.
 //
@@ -87,10 +91,12 @@ static void*           table= nullptr; // The Trace table
 // Extended options
 static int             opt_error= false; // --error TODO: REMOVE
 static int             opt_stress= false; // --stress
+static int             opt_timers= false; // --timers
 static int             opt_timing= false; // --timing
 static int             opt_trace= 0; // --trace
 static struct option   opts[]=      // The getopt_long parameter: longopts
 {  {"stress",  no_argument,       &opt_stress,      true} // --stress
+,  {"timers",  no_argument,       &opt_timers,      true} // --timers
 ,  {"timing",  no_argument,       &opt_timing,      true} // --timing
 ,  {"trace",   optional_argument, &opt_trace, 0x00400000} // --trace
 ,  {"error",   no_argument,       &opt_error,       true} // --error
@@ -445,6 +451,100 @@ static int
    return 0;
 }
 
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       test_timers
+//
+// Purpose-
+//       Delay timer test, with many outstanding delays.
+//
+// Implementation notes-
+//       Odd numbered Items are enqueued onto a Task when their delay
+//       completes, even numbered Items are posted.
+//
+//----------------------------------------------------------------------------
+static int
+   test_timers(                     // Delay timer test
+     int               argc,        // Argument count
+     char*             argv[])      // Argument array
+{
+   if( opt_verbose ) debugf("\n%4d test_timers\n", __LINE__);
+
+   // Set defaults
+   int COUNT= 1000000;              // Number of outstanding delays
+
+   // Parameter analysis
+   if( argc > optind + 0 )
+     COUNT= atoi(argv[optind + 0]);
+   if( COUNT < 2 )
+     COUNT= 2;
+   if( opt_verbose || opt_timers )
+     debugf("%16d COUNT\n", COUNT);
+
+   CountingTask        task;        // The completion counter
+   dispatch::Item*     ITEM= new dispatch::Item[COUNT];
+   void**              TOKEN= new void*[COUNT];
+   for(int i= 0; i<COUNT; i++)
+     ITEM[i].done= &task;
+
+   auto target= [&task](int i) { return (i & 1) ? &task : nullptr; };
+
+   // Start COUNT long delays (1 minute to 1 hour)
+   setlocale(LC_NUMERIC, "");       // Activates ' thousand separator
+   Interval interval;
+   interval.start();
+   for(int i= 0; i<COUNT; i++)
+     TOKEN[i]= dispatch::Disp::delay(60.0 + (i % 3541), target(i), &ITEM[i]);
+   double elapsed= interval.stop();
+   if( opt_verbose || opt_timers )
+     debugf("%'16.0f delay/second\n", COUNT / elapsed);
+   if( task.total() != 0 )
+     throwf(__LINE__, "%zd unexpected completions", task.total());
+
+   // Cancel them all
+   interval.start();
+   for(int i= 0; i<COUNT; i++)
+     dispatch::Disp::cancel(TOKEN[i]);
+   elapsed= interval.stop();
+   if( opt_verbose || opt_timers )
+     debugf("%'16.0f cancel/second\n", COUNT / elapsed);
+   if( task.purged != size_t(COUNT) || task.total() != size_t(COUNT) )
+     throwf(__LINE__, "purged(%zd) total(%zd) count(%d)"
+           , task.purged.load(), task.total(), COUNT);
+
+   // Cancelling completed delays has no effect
+   for(int i= 0; i<COUNT; i++)
+     dispatch::Disp::cancel(TOKEN[i]);
+   if( task.total() != size_t(COUNT) )
+     throwf(__LINE__, "total(%zd) count(%d)", task.total(), COUNT);
+
+   // Complete COUNT short delays (0.25 to 0.75 seconds) in batches
+   task.reset();
+   interval.start();
+   for(int i= 0; i<COUNT; i++)
+     dispatch::Disp::delay(0.25 + (i % 32) / 64.0, target(i), &ITEM[i]);
+
+   while( task.total() < size_t(COUNT) && interval.stop() < 60.0 )
+     Thread::sleep(0.001);
+   elapsed= interval.stop();
+   if( opt_verbose || opt_timers )
+     debugf("%'16.3f seconds, short delay completion\n", elapsed);
+   if( task.enqueued != size_t(COUNT / 2)
+       || task.posted != size_t(COUNT - COUNT / 2) || task.purged != 0 )
+     throwf(__LINE__, "enqueued(%zd) posted(%zd) purged(%zd) count(%d)"
+           , task.enqueued.load(), task.posted.load(), task.purged.load()
+           , COUNT);
+   if( elapsed < 0.25 )
+     throwf(__LINE__, "elapsed(%e) < 0.25", elapsed);
+
+   // Cleanup
+   delete[] TOKEN;
+   delete[] ITEM;
+
+   return 0;
+}
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -465,6 +565,7 @@ extern int
    tc.on_info([]()
    {
      fprintf(stderr, "  --stress\tRun stress test\n");
+     fprintf(stderr, "  --timers\tRun delay timer test\n");
      fprintf(stderr, "  --timing\tRun timing test\n");
      if( USE_ITRACE )
        fprintf(stderr,
@@ -509,6 +610,8 @@ extern int
 
        if( opt_timing ) {
          error_count= test_timing(argc, argv);
+       } else if( opt_timers ) {
+         error_count= test_timers(argc, argv);
        } else if( opt_stress ) {
          error_count= test_stress(argc, argv);
        } else if( opt_error ) {     // TODO: REMOVE
@@ -522,6 +625,7 @@ extern int
          if( true  ) error_count += test0000(argc, argv);
          if( true  ) error_count += test0001(argc, argv);
          if( true  ) error_count += test_timing(argc, argv);
+         if( true  ) error_count += test_timers(argc, argv);
        }
      } catch(const char* x) {
        debugf("FAILED: Exception: const char*(%s)\n", x);
@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (c) 2018-2023 Frank Eskesen.
+//       Copyright (c) 2018-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,7 +16,7 @@
 //       TestDisp internal classes and subroutines
 //
 // Last change date-
-//       2023/04/27
+//       2026/10/18
 //
 // Implementation notes-
 //       Only included from TestDisp.cpp
@@ -141,6 +141,49 @@ virtual void
 }
 }; // class RondesvousTask
 
+//----------------------------------------------------------------------------
+//
+// Class-
+//       CountingTask
+//
+// Purpose-
+//       Count delay completions, both enqueued and posted.
+//
+//----------------------------------------------------------------------------
+class CountingTask : public dispatch::Task, public dispatch::Done {
+public:
+std::atomic<size_t>    enqueued= 0; // Number of Items enqueued
+std::atomic<size_t>    posted= 0;   // Number of Items posted, CC_NORMAL
+std::atomic<size_t>    purged= 0;   // Number of Items posted, CC_PURGE
+
+   CountingTask( void )
+:  dispatch::Task(), dispatch::Done()
+{  if( opt_hcdm ) debugf("CountingTask(%p)\n", this); }
+
+void
+   reset( void )                    // Reset the counters
+{  enqueued= 0; posted= 0; purged= 0; }
+
+size_t                              // The number of completions
+   total( void ) const              // Get number of completions
+{  return enqueued + posted + purged; }
+
+virtual void
+   work(                            // (The Item was enqueued)
+     dispatch::Item*   item)
+{  (void)item; enqueued++; }
+
+virtual void
+   done(                            // (The Item was posted)
+     dispatch::Item*   item)
+{
+   if( item->cc == dispatch::Item::CC_PURGE )
+     purged++;
+   else
+     posted++;
+}
+}; // class CountingTask
+
 //----------------------------------------------------------------------------
 //
 // Subroutine-
@@ -0,0 +1,438 @@
+//----------------------------------------------------------------------------
+//
+//       Copyright (c) 2026 Frank Eskesen.
+//
+//       This file is free content, distributed under the GNU General
+//       Public License, version 3.0.
+//       (See accompanying file LICENSE.GPL-3.0 or the original
+//       contained within https://www.gnu.org/licenses/gpl-3.0.en.html)
+//
+//----------------------------------------------------------------------------
+//
+// Title-
+//       Test_code.cpp
+//
+// Purpose-
+//       Test Coding.h
+//
+// Last change date-
+//       2026/10/18
+//
+// Arguments: (For test_timing only)
+//       Test_code --timing         // (Only run timing test)
+//       [1] 64 Data length, in megabytes
+//
+//----------------------------------------------------------------------------
+#include <string>                   // For std::string
+#include <vector>                   // For std::vector
+
+#include <locale.h>                 // For setlocale
+#include <stdlib.h>                 // For atoi
+#include <string.h>                 // For memcmp
+
+#include <pub/Debug.h>              // For namespace pub::debugging
+#include <pub/Interval.h>           // For pub::Interval
+#include <pub/Random.h>             // For pub::Random
+#include "pub/TEST.H"               // For VERIFY, ...
+#include "pub/Wrapper.h"            // For pub::Wrapper
+
+// The tested include
+#include "pub/Coding.h"             // For namespace pub::coding
+
+#define PUB _LIBPUB_NAMESPACE
+using namespace PUB;
+using namespace PUB::coding;
+using namespace PUB::debugging;
+using PUB::Wrapper;
+using std::string;
+
+//----------------------------------------------------------------------------
+// Constants for parameterization
+//----------------------------------------------------------------------------
+enum
+{  HCDM= false                      // Hard Core Debug Mode?
+,  VERBOSE= 0                       // Verbosity, higher is more verbose
+
+,  LINE= 128                        // The yEnc line length
+}; // enum
+
+//----------------------------------------------------------------------------
+// Internal data areas
+//----------------------------------------------------------------------------
+static Random          RNG;         // Our random number generator
+
+static const char*     rfc2045=     // The Base64 alphabet
+                       "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                       "abcdefghijklmnopqrstuvwxyz"
+                       "0123456789+/";
+
+// Extended options
+static int             opt_timing= false; // --timing
+static struct option   opts[]=      // The getopt_long parameter: longopts
+{  {"timing",  no_argument,       &opt_timing,      true} // --timing
+,  {0, 0, 0, 0}                     // (End of option list)
+};
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       random_data
+//
+// Purpose-
+//       Generate random data.
+//
+// Implementation notes-
+//       When special is set, about half the bytes are yEnc escape candidates.
+//
+//----------------------------------------------------------------------------
+static string                       // The random data
+   random_data(                     // Generate random data
+     size_t            size,        // Of this length
+     bool              special= false) // Using mostly special characters?
+{
+   static const char escape[]= { '\0', '\n', '\r', '=', '\t', ' ', '.' };
+
+   string S(size, '\0');
+   for(size_t i= 0; i<size; ++i) {
+     if( special && RNG.get() & 1 )
+       S[i]= char(escape[RNG.modulus(sizeof(escape))] - 42);
+     else
+       S[i]= char(RNG.get());
+   }
+
+   return S;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       ref_b64_encode
+//       ref_yenc_encode
+//
+// Purpose-
+//       Reference (bytewise) Base64 encoder
+//       Reference (bytewise) yEnc encoder, as in Tools/codec/YncodeCodec
+//
+//----------------------------------------------------------------------------
+static string                       // The encoded data
+   ref_b64_encode(                  // Reference Base64 encoder
+     const string&     inp)         // The input data
+{
+   string out;
+   size_t i= 0;
+   for(; i + 3 <= inp.size(); i += 3) {
+     unsigned word= (uint8_t)inp[i] << 16 | (uint8_t)inp[i+1] << 8
+                  | (uint8_t)inp[i+2];
+     out += rfc2045[(word >> 18) & 0x3F];
+     out += rfc2045[(word >> 12) & 0x3F];
+     out += rfc2045[(word >>  6) & 0x3F];
+     out += rfc2045[(word      ) & 0x3F];
+   }
+
+   if( i + 1 == inp.size() ) {
+     unsigned word= (uint8_t)inp[i] << 16;
+     out += rfc2045[(word >> 18) & 0x3F];
+     out += rfc2045[(word >> 12) & 0x3F];
+     out += "==";
+   } else if( i + 2 == inp.size() ) {
+     unsigned word= (uint8_t)inp[i] << 16 | (uint8_t)inp[i+1] << 8;
+     out += rfc2045[(word >> 18) & 0x3F];
+     out += rfc2045[(word >> 12) & 0x3F];
+     out += rfc2045[(word >>  6) & 0x3F];
+     out += '=';
+   }
+
+   return out;
+}
+
+static string                       // The encoded data
+   ref_yenc_encode(                 // Reference yEnc encoder
+     const string&     inp,         // The input data
+     size_t            line)        // The line length
+{
+   string out;
+   size_t column= 0;
+   for(size_t i= 0; i<inp.size(); ++i) {
+     int C= ((uint8_t)inp[i] + 42) & 0x00ff;
+     bool always= C == '\0' || C == '\n' || C == '\r' || C == '=';
+     bool edge= C == '\t' || C == ' ' || C == '.';
+     if( always || (edge && (column == 0 || column >= line - 1)) ) {
+       out += '=';
+       ++column;
+       C= ((uint8_t)inp[i] + 106) & 0x00ff;
+     }
+     out += char(C);
+     if( ++column >= line ) {
+       out += '\n';
+       column= 0;
+     }
+   }
+
+   return out;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       test_base64
+//
+// Purpose-
+//       Test the Base64 kernels.
+//
+//----------------------------------------------------------------------------
+static int                          // Error count
+   test_base64( void )              // Test the Base64 kernels
+{
+   if( opt_verbose )
+     debugf("\ntest_base64(%s)\n", get_name(get_level()));
+
+   int error_count= 0;
+
+   // Round trip, all short lengths and one long length
+   for(size_t size= 0; size <= 301; ++size) {
+     if( size == 301 )
+       size= 1000000;
+
+     string data= random_data(size);
+     string expect= ref_b64_encode(data);
+
+     std::vector<char> code(base64_length(size));
+     size_t L= base64_encode(data.data(), size, code.data());
+     error_count += VERIFY( L == expect.size() );
+     error_count += VERIFY( memcmp(code.data(), expect.data(), L) == 0 );
+
+     std::vector<char> back(L / 4 * 3);
+     size_t used;
+     size_t D= base64_decode(code.data(), L, back.data(), used);
+     size_t full= size / 3 * 3;     // (The PAD_CHAR group isn't decoded)
+     error_count += VERIFY( used == full / 3 * 4 );
+     error_count += VERIFY( D == full );
+     error_count += VERIFY( memcmp(back.data(), data.data(), D) == 0 );
+     if( error_count ) {
+       debugf("%4d size(%zd)\n", __LINE__, size);
+       return error_count;
+     }
+     if( size == 1000000 )
+       break;
+   }
+
+   // Decoding stops at the group containing an invalid character
+   string valid= ref_b64_encode(random_data(96));
+   for(int C= 0; C < 256; ++C) {
+     bool is_valid= C != 0 && strchr(rfc2045, C) != nullptr;
+     for(size_t x= 0; x < valid.size(); ++x) {
+       string S= valid;
+       S[x]= char(C);
+       std::vector<char> back(S.size() / 4 * 3);
+       size_t used;
+       size_t D= base64_decode(S.data(), S.size(), back.data(), used);
+       size_t expect= is_valid ? S.size() : x / 4 * 4;
+       error_count += VERIFY( used == expect );
+       error_count += VERIFY( D == expect / 4 * 3 );
+       if( error_count ) {
+         debugf("%4d C(0x%.2x) x(%zd) used(%zd)\n", __LINE__, C, x, used);
+         return error_count;
+       }
+     }
+   }
+
+   return error_count;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       test_yenc
+//
+// Purpose-
+//       Test the yEnc kernels.
+//
+//----------------------------------------------------------------------------
+static int                          // Error count
+   test_yenc( void )                // Test the yEnc kernels
+{
+   if( opt_verbose )
+     debugf("\ntest_yenc(%s)\n", get_name(get_level()));
+
+   int error_count= 0;
+   for(int loop= 0; loop < 400; ++loop) {
+     size_t size= RNG.modulus(loop < 200 ? 300 : 100000);
+     size_t line= 2 + RNG.modulus(loop & 1 ? 200 : 40);
+     string data= random_data(size, loop & 2);
+     string expect= ref_yenc_encode(data, line);
+
+     // Encode, using random length segments
+     std::vector<char> code(yenc_length(size, line));
+     size_t column= 0;
+     size_t L= 0;
+     for(size_t i= 0; i < size; ) {
+       size_t n= 1 + RNG.modulus(loop < 200 ? 40 : 5000);
+       if( n > size - i )
+         n= size - i;
+       L += yenc_encode(data.data() + i, n, code.data() + L, column, line);
+       i += n;
+     }
+     error_count += VERIFY( L == expect.size() );
+     error_count += VERIFY( memcmp(code.data(), expect.data(), L) == 0 );
+
+     // Decode, using random length segments
+     std::vector<char> back(L);
+     bool escape= false;
+     size_t D= 0;
+     for(size_t i= 0; i < L; ) {
+       size_t n= 1 + RNG.modulus(loop < 200 ? 40 : 5000);
+       if( n > L - i )
+         n= L - i;
+       size_t used;
+       D += yenc_decode(code.data() + i, n, back.data() + D, used, escape);
+       error_count += VERIFY( used == n );
+       i += n;
+     }
+     error_count += VERIFY( !escape );
+     error_count += VERIFY( D == size );
+     error_count += VERIFY( memcmp(back.data(), data.data(), D) == 0 );
+     if( error_count ) {
+       debugf("%4d loop(%d) size(%zd) line(%zd)\n", __LINE__, loop, size, line);
+       return error_count;
+     }
+   }
+
+   // Decoding stops at an invalid escape sequence
+   string valid= ref_yenc_encode(random_data(200), LINE);
+   for(size_t x= 0; x < valid.size(); ++x) {
+     for(const char* seq : { "=\n", "=\r", "=y" }) {
+       string S= valid.substr(0, x) + seq + valid.substr(x);
+       std::vector<char> back(S.size());
+       bool escape= false;
+       size_t used;
+       yenc_decode(S.data(), S.size(), back.data(), used, escape);
+       bool in_escape= x > 0 && valid[x-1] == '=';
+       if( !in_escape ) {           // (Skip "==" sequences)
+         error_count += VERIFY( escape );
+         error_count += VERIFY( used == x + 1 );
+       }
+       if( error_count ) {
+         debugf("%4d x(%zd) used(%zd)\n", __LINE__, x, used);
+         return error_count;
+       }
+     }
+   }
+
+   return error_count;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       test_timing
+//
+// Purpose-
+//       Kernel throughput test.
+//
+//----------------------------------------------------------------------------
+static int                          // Error count
+   test_timing(                     // Kernel throughput test
+     int               argc,        // Argument count
+     char*             argv[])      // Argument array
+{
+   size_t size= 64;                 // Data length, in megabytes
+   if( argc > optind )
+     size= atoi(argv[optind]);
+   size *= 1024 * 1024;
+
+   string data= random_data(size);
+   std::vector<char> code(yenc_length(size, LINE));
+   std::vector<char> back(size);
+
+   setlocale(LC_NUMERIC, "");       // Activates ' thousand separator
+   debugf("%'16zd bytes\n", size);
+   debugf("  level  b64 encode  b64 decode yenc encode yenc decode (MB/s)\n");
+
+   int error_count= 0;
+   int limit= set_level(LEVEL_AVX2);
+   for(int level= LEVEL_SCALAR; level <= limit; ++level) {
+     set_level(level);
+     double MB= double(size) / (1024.0 * 1024.0);
+     double rate[4];
+     Interval interval;
+
+     interval.start();
+     size_t L= base64_encode(data.data(), size, code.data());
+     rate[0]= MB / interval.stop();
+
+     interval.start();
+     size_t used;
+     size_t D= base64_decode(code.data(), L, back.data(), used);
+     rate[1]= MB / interval.stop();
+     error_count += VERIFY( D == size / 3 * 3 );
+
+     interval.start();
+     size_t column= 0;
+     L= yenc_encode(data.data(), size, code.data(), column, LINE);
+     rate[2]= MB / interval.stop();
+
+     interval.start();
+     bool escape= false;
+     D= yenc_decode(code.data(), L, back.data(), used, escape);
+     rate[3]= MB / interval.stop();
+     error_count += VERIFY( D == size );
+     error_count += VERIFY( memcmp(back.data(), data.data(), size) == 0 );
+
+     debugf("%7s %'11.1f %'11.1f %'11.1f %'11.1f\n", get_name(level)
+           , rate[0], rate[1], rate[2], rate[3]);
+   }
+   set_level(limit);
+
+   return error_count;
+}
+
+//----------------------------------------------------------------------------
+//
+// Subroutine-
+//       main
+//
+// Purpose-
+//       Mainline code.
+//
+//----------------------------------------------------------------------------
+extern int                          // Return code
+   main(                            // Mainline code
+     int               argc,        // Argument count
+     char*             argv[])      // Argument array
+{
+   Wrapper  tc= opts;               // The test case wrapper
+   Wrapper* tr= &tc;                // A test case wrapper pointer
+
+   tc.on_info([]()
+   {
+     fprintf(stderr, "  --timing\tRun timing test\n");
+   });
+
+   tc.on_main([tr](int argc, char* argv[])
+   {
+     int error_count= 0;
+
+     RNG.set_seed(732);             // (Repeatable data)
+     if( opt_timing ) {
+       error_count += test_timing(argc, argv);
+     } else {                       // Test each supported kernel level
+       int limit= set_level(LEVEL_AVX2);
+       for(int level= LEVEL_SCALAR; level <= limit; ++level) {
+         set_level(level);
+         error_count += test_base64();
+         error_count += test_yenc();
+       }
+       set_level(limit);
+     }
+
+     if( error_count || opt_verbose ) {
+       debugf("\n");
+       tr->report_errors(error_count);
+     }
+     return error_count != 0;
+   });
+
+   //-------------------------------------------------------------------------
+   // Run the test
+   return tc.run(argc, argv);
+}
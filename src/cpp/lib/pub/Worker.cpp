@@ -1,6 +1,6 @@
 //----------------------------------------------------------------------------
 //
-//       Copyright (C) 2019-2023 Frank Eskesen.
+//       Copyright (C) 2019-2026 Frank Eskesen.
 //
 //       This file is free content, distributed under the GNU General
 //       Public License, version 3.0.
@@ -16,11 +16,12 @@
 //       Worker object methods.
 //
 // Last change date-
-//       2023/06/30
+//       2026/10/18
 //
 //----------------------------------------------------------------------------
 #include <atomic>                   // For std::atomic<>
 #include <mutex>                    // For std::lock_guard
+#include <vector>                   // For std::vector
 
 #include <pub/Debug.h>              // For namespace pub::debugging
 #include <pub/Exception.h>          // For pub::Exception
@@ -228,6 +229,44 @@ void
 }
 }; // class WorkerThread
 
+//----------------------------------------------------------------------------
+//
+// Class-
+//       ParallelWorker
+//
+// Purpose-
+//       Run WorkerPool::parallel tasks until none remain.
+//
+//----------------------------------------------------------------------------
+class ParallelWorker : public Worker { // WorkerPool::parallel Worker
+public:
+const std::function<void(size_t)>*
+                       task= nullptr; // The task, given its index
+atomic_size_t*         next= nullptr; // The next task index
+size_t                 count= 0;    // The number of tasks
+Semaphore*             done= nullptr; // Completion Semaphore
+
+virtual void
+   work( void )                     // Run tasks until none remain
+{
+   try {
+     for(;;) {
+       size_t index= next->fetch_add(1);
+       if( index >= count )
+         break;
+       (*task)(index);
+     }
+   } catch(...) {                   // (Don't leave the caller waiting)
+     if( done )
+       done->post();
+     throw;
+   }
+
+   if( done )
+     done->post();
+}
+}; // class ParallelWorker
+
 //----------------------------------------------------------------------------
 //
 // Method-
@@ -330,6 +369,59 @@ void
    }
 }
 
+//----------------------------------------------------------------------------
+//
+// Method-
+//       WorkerPool::parallel
+//
+// Purpose-
+//       Run tasks in parallel, returning when all are complete
+//
+// Implementation notes-
+//       The calling thread acts as worker[0]. The others are driven by
+//       (pooled) WorkerThreads.
+//
+//----------------------------------------------------------------------------
+void
+   WorkerPool::parallel(             // Run tasks in parallel
+     unsigned          threads,      // Using at most this many threads
+     size_t            count,        // The number of tasks
+     const std::function<void(size_t)>&
+                       task)         // The task, given its index
+{
+   if( threads > count )
+     threads= unsigned(count);
+   if( threads <= 1 ) {              // If serial
+     for(size_t index= 0; index<count; index++)
+       task(index);
+     return;
+   }
+
+   atomic_size_t next(0);
+   Semaphore done;
+   std::vector<ParallelWorker> worker(threads);
+   for(unsigned t= 0; t<threads; t++) {
+     worker[t].task= &task;
+     worker[t].next= &next;
+     worker[t].count= count;
+     if( t > 0 ) {                   // (This thread is worker[0])
+       worker[t].done= &done;
+       work(&worker[t]);
+     }
+   }
+
+   try {
+     worker[0].work();
+   } catch(...) {                   // (The other Workers use this frame)
+     for(unsigned t= 1; t<threads; t++)
+       done.wait();
+     throw;
+   }
+
+   for(unsigned t= 1; t<threads; t++)
+     done.wait();
+}
+
 //----------------------------------------------------------------------------
 //
 // Method-